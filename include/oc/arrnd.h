@@ -2,7 +2,10 @@
 #define OC_ARRAY_H
 
 #include <cstdint>
+#include <cstddef>
+#include <utility>
 #include <memory>
+#include <new>
 #include <initializer_list>
 #include <stdexcept>
 #include <limits>
@@ -25,6 +28,28 @@
 #include <ranges>
 #include <span>
 #include <bitset>
+#include <bit>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <exception>
+#include <system_error>
+#if defined(__unix__) || defined(__APPLE__)
+#define OC_ARRND_HAS_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// element-wise kernels are compiled for several instruction sets and the best
+// supported one is selected at runtime (x86-64 linux only). their loops are vectorized
+// according to the optimization options of the translation unit (e.g. -O3 or -ftree-vectorize).
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define OC_ARRND_VECTORIZED __attribute__((target_clones("avx512f", "avx2", "sse4.2", "default")))
+#else
+#define OC_ARRND_VECTORIZED
+#endif
 
 // expension of std::complex type overloaded operators
 namespace std {
@@ -976,457 +1001,786 @@ namespace details {
         return !(lhs == rhs);
     }
 
-}
+    // allocator of Alignment aligned buffers (e.g. cache line aligned, so vectorized loops do not split
+    // cache lines), whose sizes are rounded up to a multiple of Padding bytes - so whole vectors might be
+    // loaded past the last element. zero Padding means no rounding.
+    template <typename T, std::size_t Alignment = 64, std::size_t Padding = Alignment>
+    struct simple_aligned_allocator {
+        static_assert(std::has_single_bit(Alignment) && Alignment >= alignof(T), "invalid alignment");
 
-using details::simple_allocator;
-}
+        using value_type = T;
 
-namespace oc::arrnd {
-namespace details {
-    template <typename T, typename Allocator = simple_allocator<T>>
-    class simple_vector {
-        static_assert(std::is_same_v<T, typename Allocator::value_type>);
+        template <typename U>
+        struct rebind {
+            using other = simple_aligned_allocator<U, Alignment, Padding>;
+        };
 
-    public:
-        using value_type = T;
-        using allocator_type = Allocator;
-        using size_type = std::size_t;
-        using difference_type = std::ptrdiff_t;
-        using reference = T&;
-        using const_reference = const T&;
-        using pointer = T*;
-        using const_pointer = const T*;
-        using iterator = T*;
-        using const_iterator = const T*;
-        using reverse_iterator = std::reverse_iterator<pointer>;
-        using const_reverse_iterator = std::reverse_iterator<const_pointer>;
+        static constexpr std::size_t alignment = Alignment;
+        static constexpr std::size_t padding = Padding;
+        static constexpr std::size_t max_size = (std::size_t(-1) - Padding) / sizeof(T);
 
-        simple_vector() = default;
+        simple_aligned_allocator() = default;
 
-        explicit constexpr simple_vector(size_type size)
-            : size_(size)
-            , capacity_(size)
+        template <typename U>
+        constexpr simple_aligned_allocator(const simple_aligned_allocator<U, Alignment, Padding>&) noexcept
+        { }
+
+        [[nodiscard]] static constexpr std::size_t padded_size(std::size_t n) noexcept
         {
-            if (size > 0) {
-                ptr_ = alloc_.allocate(size);
-                if constexpr (!std::is_fundamental_v<value_type>) {
-                    std::uninitialized_default_construct_n(ptr_, size);
-                }
+            std::size_t bytes = n * sizeof(T);
+            if constexpr (Padding > 0) {
+                bytes = (bytes + Padding - 1) / Padding * Padding;
             }
+            return bytes;
         }
 
-        template <typename U>
-        explicit constexpr simple_vector(size_type size, const U& value)
-            : size_(size)
-            , capacity_(size)
+        [[nodiscard]] constexpr T* allocate(std::size_t n)
         {
-            if (size > 0) {
-                ptr_ = alloc_.allocate(size);
-                std::uninitialized_fill_n(ptr_, size, value);
+            if (n > max_size) {
+                throw std::bad_alloc{};
             }
+            return static_cast<T*>(::operator new[](padded_size(n), std::align_val_t{Alignment}));
         }
 
-        template <iterator_type InputIt>
-        explicit constexpr simple_vector(InputIt first, InputIt last)
-            : size_(std::distance(first, last))
-            , capacity_(std::distance(first, last))
+        constexpr void deallocate(T* p, std::size_t n) noexcept
         {
-            difference_type dist = std::distance(first, last);
-            if (dist < 0) {
-                throw std::invalid_argument("negative distance between iterators");
-            }
-            if (dist > 0) {
-                ptr_ = alloc_.allocate(dist);
-                std::uninitialized_copy_n(first, dist, ptr_);
-            }
+            assert("pre " && p != nullptr);
+            ::operator delete[](p, padded_size(n), std::align_val_t{Alignment});
         }
+    };
 
-        template <iterable_type Cont>
-        explicit constexpr simple_vector(const Cont& values)
-            : simple_vector(std::begin(values), std::end(values))
-        { }
+    template <typename T, typename U, std::size_t Alignment, std::size_t Padding>
+    [[nodiscard]] constexpr bool operator==(
+        const simple_aligned_allocator<T, Alignment, Padding>&, const simple_aligned_allocator<U, Alignment, Padding>&)
+    {
+        return sizeof(T) == sizeof(U);
+    }
 
-        explicit constexpr simple_vector(std::initializer_list<value_type> values)
-            : simple_vector(values.begin(), values.end())
+    template <typename T, typename U, std::size_t Alignment, std::size_t Padding>
+    [[nodiscard]] constexpr bool operator!=(const simple_aligned_allocator<T, Alignment, Padding>& lhs,
+        const simple_aligned_allocator<U, Alignment, Padding>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    // monotonic memory resource - allocations are bumped from blocks of memory, and are released all at once.
+    // if more than a single block was used, the blocks are replaced on release by a single block of their
+    // total size, so repeated uses of similar sizes do not allocate again.
+    class simple_arena {
+    public:
+        static constexpr std::size_t block_alignment = 64;
+
+        explicit simple_arena(std::size_t initial_size = std::size_t{1} << 20)
+            : next_block_size_(std::max(initial_size, block_alignment))
         { }
 
-        constexpr void clear()
+        simple_arena(const simple_arena&) = delete;
+        simple_arena& operator=(const simple_arena&) = delete;
+        simple_arena(simple_arena&&) = delete;
+        simple_arena& operator=(simple_arena&&) = delete;
+
+        ~simple_arena()
         {
-            if (!empty()) {
-                if constexpr (!std::is_fundamental_v<value_type>) {
-                    std::destroy_n(ptr_, size_);
-                }
+            for (const auto& b : blocks_) {
+                ::operator delete(b.data, b.size, std::align_val_t{block_alignment});
             }
-            size_ = 0;
         }
 
-        constexpr simple_vector(const simple_vector& other)
-            : alloc_(other.alloc_)
-            , size_(other.size_)
-            , capacity_(other.capacity_)
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
         {
-            if (other.capacity_ > 0) {
-                ptr_ = alloc_.allocate(other.capacity_);
-                std::uninitialized_copy_n(other.ptr_, other.size_, ptr_);
+            if (!blocks_.empty()) {
+                if (void* p = bump(blocks_.back(), bytes, alignment)) {
+                    return p;
+                }
             }
+
+            std::size_t size = std::max(next_block_size_, bytes + alignment);
+            blocks_.push_back(block{static_cast<std::byte*>(::operator new(size, std::align_val_t{block_alignment})),
+                size, 0});
+            next_block_size_ = size * 2;
+
+            return bump(blocks_.back(), bytes, alignment);
         }
 
-        constexpr simple_vector& operator=(const simple_vector& other)
+        // memory is released only by release()
+        constexpr void deallocate(void*, std::size_t) noexcept { }
+
+        void release() noexcept
         {
-            if (this == &other) {
-                return *this;
+            if (blocks_.size() > 1) {
+                std::size_t total_size = capacity();
+                for (const auto& b : blocks_) {
+                    ::operator delete(b.data, b.size, std::align_val_t{block_alignment});
+                }
+                blocks_.clear();
+                next_block_size_ = total_size;
             }
-
-            if (capacity_ > 0) {
-                clear();
-                alloc_.deallocate(ptr_, capacity_);
-                capacity_ = 0;
+            for (auto& b : blocks_) {
+                b.offset = 0;
             }
+            used_ = 0;
+        }
 
-            alloc_ = other.alloc_;
-            size_ = other.size_;
-            capacity_ = other.capacity_;
+        // allocated bytes since the last release
+        [[nodiscard]] std::size_t used() const noexcept
+        {
+            return used_;
+        }
 
-            if (other.capacity_ > 0) {
-                ptr_ = alloc_.allocate(other.capacity_);
-                std::uninitialized_copy_n(other.ptr_, other.size_, ptr_);
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            std::size_t res = 0;
+            for (const auto& b : blocks_) {
+                res += b.size;
             }
+            return res;
+        }
 
-            return *this;
+    private:
+        struct block {
+            std::byte* data;
+            std::size_t size;
+            std::size_t offset;
+        };
+
+        void* bump(block& b, std::size_t bytes, std::size_t alignment) noexcept
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(b.data) + b.offset;
+            std::size_t start = b.offset + ((alignment - address % alignment) % alignment);
+            if (start > b.size || b.size - start < bytes) {
+                return nullptr;
+            }
+            b.offset = start + bytes;
+            used_ += bytes;
+            return b.data + start;
         }
 
-        constexpr simple_vector(simple_vector&& other) noexcept
-            : alloc_(std::move(other.alloc_))
-            , size_(other.size_)
-            , capacity_(other.capacity_)
+        std::vector<block> blocks_;
+        std::size_t next_block_size_;
+        std::size_t used_ = 0;
+        // number of alive scopes of this arena (see simple_arena_scope)
+        std::size_t scopes_ = 0;
+
+        friend class simple_arena_scope;
+    };
+
+    [[nodiscard]] inline simple_arena*& current_simple_arena() noexcept
+    {
+        thread_local simple_arena* arena = nullptr;
+        return arena;
+    }
+
+    // while the scope is alive, arrays of simple_arena_vector_traits (e.g. temporaries of expressions) that are
+    // created by this thread are allocated from the arena, which is released at the end of its outermost scope -
+    // such arrays should not be used afterwards.
+    class simple_arena_scope {
+    public:
+        explicit simple_arena_scope(simple_arena& arena) noexcept
+            : arena_(arena)
+            , prev_(std::exchange(current_simple_arena(), &arena))
         {
-            ptr_ = other.ptr_;
+            ++arena_.scopes_;
+        }
 
-            other.ptr_ = nullptr;
-            other.size_ = 0;
-            other.capacity_ = 0;
+        simple_arena_scope(const simple_arena_scope&) = delete;
+        simple_arena_scope& operator=(const simple_arena_scope&) = delete;
+
+        ~simple_arena_scope()
+        {
+            current_simple_arena() = prev_;
+            // the arena might have other scopes (directly nested or not) that are still alive
+            if (--arena_.scopes_ == 0) {
+                arena_.release();
+            }
         }
 
-        constexpr simple_vector& operator=(simple_vector&& other) noexcept
+    private:
+        simple_arena& arena_;
+        simple_arena* prev_;
+    };
+
+    // allocates from the current arena of the thread at the allocator construction, if any,
+    // or from the heap otherwise.
+    template <typename T>
+    struct simple_arena_allocator {
+        using value_type = T;
+
+        static constexpr std::size_t max_size = std::size_t(-1) / sizeof(T);
+
+        simple_arena_allocator() noexcept
+            : arena(current_simple_arena())
+        { }
+
+        template <typename U>
+        constexpr simple_arena_allocator(const simple_arena_allocator<U>& other) noexcept
+            : arena(other.arena)
+        { }
+
+        [[nodiscard]] T* allocate(std::size_t n)
         {
-            if (this == &other) {
-                return *this;
+            if (n > max_size) {
+                throw std::bad_alloc{};
             }
+            if (arena) {
+                return static_cast<T*>(arena->allocate(n * sizeof(value_type), alignof(value_type)));
+            }
+            return static_cast<T*>(::operator new[](n * sizeof(value_type)));
+        }
 
-            if (capacity_ > 0) {
-                clear();
-                alloc_.deallocate(ptr_, capacity_);
-                capacity_ = 0;
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            assert("pre " && p != nullptr);
+            if (arena) {
+                arena->deallocate(p, n * sizeof(value_type));
+                return;
             }
+            ::operator delete[](p, n * sizeof(value_type));
+        }
 
-            alloc_ = std::move(other.alloc_);
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            ptr_ = other.ptr_;
+        simple_arena* arena;
+    };
 
-            other.ptr_ = nullptr;
-            other.size_ = 0;
-            other.capacity_ = 0;
+    template <typename T, typename U>
+    [[nodiscard]] constexpr bool operator==(const simple_arena_allocator<T>& lhs, const simple_arena_allocator<U>& rhs)
+    {
+        return lhs.arena == rhs.arena;
+    }
 
-            return *this;
+    template <typename T, typename U>
+    [[nodiscard]] constexpr bool operator!=(const simple_arena_allocator<T>& lhs, const simple_arena_allocator<U>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    struct simple_pool_stats {
+        // allocations served by retained buffers
+        std::size_t hits = 0;
+        // allocations served by the system
+        std::size_t misses = 0;
+        std::size_t bytes_retained = 0;
+        // the maximal value of bytes_retained
+        std::size_t high_water_mark = 0;
+    };
+
+    // cache of freed buffers by power of two size classes - buffers are retained up to max_retained bytes,
+    // and further freed buffers (and buffers larger than max_class_size) are returned to the system.
+    // not thread safe (see current_simple_pool).
+    class simple_pool {
+    public:
+        static constexpr std::size_t min_class_size = 64;
+        static constexpr std::size_t num_classes = 21;
+        static constexpr std::size_t max_class_size = min_class_size << (num_classes - 1);
+
+        explicit simple_pool(std::size_t max_retained = std::size_t{1} << 26)
+            : max_retained_(max_retained)
+        { }
+
+        simple_pool(const simple_pool&) = delete;
+        simple_pool& operator=(const simple_pool&) = delete;
+        simple_pool(simple_pool&&) = delete;
+        simple_pool& operator=(simple_pool&&) = delete;
+
+        ~simple_pool()
+        {
+            trim();
         }
 
-        constexpr ~simple_vector() noexcept
+        [[nodiscard]] void* allocate(std::size_t bytes)
         {
-            if (size_ > 0) {
-                clear();
+            if (bytes > max_class_size) {
+                ++stats_.misses;
+                return ::operator new(bytes);
             }
-            if (capacity_ > 0) {
-                alloc_.deallocate(ptr_, capacity_);
+
+            std::size_t cls = size_class(bytes);
+            if (free_lists_[cls]) {
+                ++stats_.hits;
+                stats_.bytes_retained -= class_size(cls);
+                return std::exchange(free_lists_[cls], free_lists_[cls]->next);
             }
+
+            ++stats_.misses;
+            return ::operator new(class_size(cls));
         }
 
-        [[nodiscard]] constexpr bool empty() const noexcept
+        void deallocate(void* p, std::size_t bytes) noexcept
         {
-            return size_ == 0;
+            if (bytes > max_class_size) {
+                ::operator delete(p, bytes);
+                return;
+            }
+
+            std::size_t cls = size_class(bytes);
+            if (stats_.bytes_retained + class_size(cls) > max_retained_) {
+                ::operator delete(p, class_size(cls));
+                return;
+            }
+
+            // the free lists nodes are stored in the retained buffers
+            free_lists_[cls] = ::new (p) node{free_lists_[cls]};
+            stats_.bytes_retained += class_size(cls);
+            stats_.high_water_mark = std::max(stats_.high_water_mark, stats_.bytes_retained);
         }
 
-        [[nodiscard]] constexpr size_type size() const noexcept
+        // returns all of the retained buffers to the system
+        void trim() noexcept
         {
-            return size_;
+            for (std::size_t cls = 0; cls < num_classes; ++cls) {
+                while (free_lists_[cls]) {
+                    ::operator delete(std::exchange(free_lists_[cls], free_lists_[cls]->next), class_size(cls));
+                }
+            }
+            stats_.bytes_retained = 0;
         }
 
-        [[nodiscard]] constexpr size_type capacity() const noexcept
+        void set_max_retained(std::size_t max_retained) noexcept
         {
-            return capacity_;
+            max_retained_ = max_retained;
+            if (stats_.bytes_retained > max_retained_) {
+                trim();
+            }
         }
 
-        [[nodiscard]] constexpr pointer data() const noexcept
+        [[nodiscard]] std::size_t max_retained() const noexcept
         {
-            return ptr_;
+            return max_retained_;
         }
 
-        [[nodiscard]] constexpr reference operator[](size_type index) noexcept
+        [[nodiscard]] const simple_pool_stats& stats() const noexcept
         {
-            assert(index < size_);
-            return ptr_[index];
+            return stats_;
         }
 
-        [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+        void reset_stats() noexcept
         {
-            assert(index < size_);
-            return ptr_[index];
+            stats_ = simple_pool_stats{
+                .bytes_retained = stats_.bytes_retained, .high_water_mark = stats_.bytes_retained};
         }
 
-        constexpr void resize(size_type count)
+    private:
+        struct node {
+            node* next;
+        };
+
+        [[nodiscard]] static constexpr std::size_t size_class(std::size_t bytes) noexcept
         {
-            if (count == 0) {
-                clear();
-            } else if (count < size_) {
-                if constexpr (!std::is_fundamental_v<value_type>) {
-                    std::destroy_n(ptr_ + count, size_ - count);
-                }
-                size_ = count;
-            } else if (count > size_) {
-                if (count <= capacity_) {
-                    if constexpr (!std::is_fundamental_v<value_type>) {
-                        std::uninitialized_default_construct_n(ptr_ + size_, count - size_);
-                    }
-                    size_ = count;
-                } else {
-                    pointer new_ptr = alloc_.allocate(count);
-                    std::uninitialized_move_n(ptr_, size_, new_ptr);
-                    if constexpr (!std::is_fundamental_v<value_type>) {
-                        std::uninitialized_default_construct_n(new_ptr + size_, count - size_);
-                    }
+            return bytes <= min_class_size ? 0
+                                           : static_cast<std::size_t>(std::bit_width((bytes - 1) / min_class_size));
+        }
 
-                    if (capacity_ > 0) {
-                        alloc_.deallocate(ptr_, capacity_);
-                    }
+        [[nodiscard]] static constexpr std::size_t class_size(std::size_t cls) noexcept
+        {
+            return min_class_size << cls;
+        }
 
-                    size_ = count;
-                    capacity_ = count;
-                    ptr_ = new_ptr;
-                }
+        node* free_lists_[num_classes]{};
+        std::size_t max_retained_;
+        simple_pool_stats stats_;
+    };
+
+    // pool of the calling thread, or null during the thread exit after its destruction
+    [[nodiscard]] inline simple_pool* current_simple_pool() noexcept
+    {
+        thread_local bool destroyed = false;
+
+        struct holder {
+            ~holder()
+            {
+                destroyed = true;
             }
-        }
+            simple_pool pool;
+        };
+        thread_local holder h;
 
-        constexpr void reserve(size_type new_cap)
+        return destroyed ? nullptr : &h.pool;
+    }
+
+    // buffers are recycled by the pool of the thread that frees them
+    template <typename T>
+    struct simple_pool_allocator {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "invalid alignment");
+
+        using value_type = T;
+
+        static constexpr std::size_t max_size = std::size_t(-1) / sizeof(T);
+
+        simple_pool_allocator() = default;
+
+        template <typename U>
+        constexpr simple_pool_allocator(const simple_pool_allocator<U>&) noexcept
+        { }
+
+        [[nodiscard]] T* allocate(std::size_t n)
         {
-            if (new_cap > capacity_) {
-                pointer new_ptr = alloc_.allocate(new_cap);
-                std::uninitialized_move_n(ptr_, size_, new_ptr);
+            if (n > max_size) {
+                throw std::bad_alloc{};
+            }
+            if (auto* pool = current_simple_pool()) {
+                return static_cast<T*>(pool->allocate(n * sizeof(value_type)));
+            }
+            return static_cast<T*>(::operator new(n * sizeof(value_type)));
+        }
 
-                if (capacity_ > 0) {
-                    alloc_.deallocate(ptr_, capacity_);
-                }
-                ptr_ = new_ptr;
-                capacity_ = new_cap;
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            assert("pre " && p != nullptr);
+            if (auto* pool = current_simple_pool()) {
+                pool->deallocate(p, n * sizeof(value_type));
+                return;
             }
+            ::operator delete(p);
         }
+    };
 
-        constexpr void append(size_type count)
+    template <typename T, typename U>
+    [[nodiscard]] constexpr bool operator==(const simple_pool_allocator<T>&, const simple_pool_allocator<U>&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    [[nodiscard]] constexpr bool operator!=(const simple_pool_allocator<T>& lhs, const simple_pool_allocator<U>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+#ifdef OC_ARRND_HAS_MMAP
+    enum class simple_file_map_mode {
+        read_only,
+        // writes are shared with the file
+        read_write,
+        // writes are private to the mapping
+        copy_on_write,
+    };
+
+    enum class simple_file_map_advice {
+        normal,
+        sequential,
+        random,
+        will_need,
+    };
+
+    // mapping of length bytes of a file from offset (zero length means up to the end of the file).
+    // read_write mappings extend shorter files. the mapped memory is acquired once - by the first allocation
+    // of simple_mapped_allocator, and unmapped by its deallocation.
+    class simple_file_mapping {
+    public:
+        explicit simple_file_mapping(const std::string& path,
+            simple_file_map_mode mode = simple_file_map_mode::read_only,
+            simple_file_map_advice advice = simple_file_map_advice::normal, std::size_t offset = 0,
+            std::size_t length = 0)
         {
-            if (size_ + count <= capacity_ && size_ + count > size_) {
-                if constexpr (!std::is_fundamental_v<value_type>) {
-                    std::uninitialized_default_construct_n(ptr_ + size_, count);
+            int fd = ::open(path.c_str(), mode == simple_file_map_mode::read_write ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "invalid file '" + path + "'");
+            }
+
+            auto fail = [fd](const char* what) {
+                int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), what);
+            };
+
+            struct stat st {};
+            if (::fstat(fd, &st) != 0) {
+                fail("fstat");
+            }
+            auto file_size = static_cast<std::size_t>(st.st_size);
+
+            if (length == 0) {
+                if (offset >= file_size) {
+                    ::close(fd);
+                    throw std::invalid_argument("invalid offset - not before the end of file");
                 }
-                size_ += count;
-            } else if (size_ + count > capacity_) {
-                size_type new_cap = static_cast<size_type>(1.5 * (size_ + count));
-                pointer new_ptr = alloc_.allocate(new_cap);
-                std::uninitialized_move_n(ptr_, size_, new_ptr);
-                if constexpr (!std::is_fundamental_v<value_type>) {
-                    std::uninitialized_default_construct_n(new_ptr + size_, count);
+                length = file_size - offset;
+            }
+            if (offset + length > file_size) {
+                if (mode != simple_file_map_mode::read_write) {
+                    ::close(fd);
+                    throw std::invalid_argument("invalid length - beyond the end of file");
                 }
-                if (capacity_ > 0) {
-                    alloc_.deallocate(ptr_, capacity_);
+                if (::ftruncate(fd, static_cast<off_t>(offset + length)) != 0) {
+                    fail("ftruncate");
                 }
-
-                ptr_ = new_ptr;
-                capacity_ = new_cap;
-                size_ += count;
             }
-        }
 
-        constexpr void shrink_to_fit()
-        {
-            if (capacity_ > size_) {
-                pointer new_ptr = alloc_.allocate(size_);
-                std::uninitialized_move_n(ptr_, size_, new_ptr);
+            // mapped offsets should be page aligned
+            auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            std::size_t map_offset = offset / page_size * page_size;
+            map_length_ = length + (offset - map_offset);
 
-                alloc_.deallocate(ptr_, capacity_);
-                ptr_ = new_ptr;
-                capacity_ = size_;
+            int prot = mode == simple_file_map_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+            int flags = mode == simple_file_map_mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+            void* addr = ::mmap(nullptr, map_length_, prot, flags, fd, static_cast<off_t>(map_offset));
+            if (addr == MAP_FAILED) {
+                fail("mmap");
             }
-        }
+            // the mapping keeps its own reference to the file
+            ::close(fd);
 
-        [[nodiscard]] constexpr pointer begin() noexcept
-        {
-            return ptr_;
-        }
+            map_addr_ = addr;
+            data_ = static_cast<std::byte*>(addr) + (offset - map_offset);
+            size_ = length;
 
-        [[nodiscard]] constexpr pointer end() noexcept
-        {
-            return ptr_ + size_;
+            advise(advice);
         }
 
-        [[nodiscard]] constexpr const_pointer begin() const noexcept
-        {
-            return ptr_;
-        }
+        simple_file_mapping(const simple_file_mapping&) = delete;
+        simple_file_mapping& operator=(const simple_file_mapping&) = delete;
 
-        [[nodiscard]] constexpr const_pointer end() const noexcept
+        ~simple_file_mapping()
         {
-            return ptr_ + size_;
+            unmap();
         }
 
-        [[nodiscard]] constexpr const_pointer cbegin() const noexcept
+        void advise(simple_file_map_advice advice) noexcept
         {
-            return ptr_;
+            if (!map_addr_) {
+                return;
+            }
+            constexpr int advices[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+            // advices are hints only
+            (void)::madvise(map_addr_, map_length_, advices[static_cast<int>(advice)]);
         }
 
-        [[nodiscard]] constexpr const_pointer cend() const noexcept
+        [[nodiscard]] void* data() const noexcept
         {
-            return ptr_ + size_;
+            return data_;
         }
 
-        [[nodiscard]] constexpr std::reverse_iterator<pointer> rbegin() noexcept
+        [[nodiscard]] std::size_t size() const noexcept
         {
-            return std::make_reverse_iterator(end());
+            return size_;
         }
 
-        [[nodiscard]] constexpr std::reverse_iterator<pointer> rend() noexcept
+        [[nodiscard]] void* acquire(std::size_t bytes) noexcept
         {
-            return std::make_reverse_iterator(begin());
+            if (acquired_ || !data_ || bytes > size_) {
+                return nullptr;
+            }
+            acquired_ = true;
+            return data_;
         }
 
-        [[nodiscard]] constexpr std::reverse_iterator<const_pointer> crbegin() const noexcept
+        [[nodiscard]] bool release(void* p) noexcept
         {
-            return std::make_reverse_iterator(cend());
+            if (!acquired_ || p != data_) {
+                return false;
+            }
+            unmap();
+            return true;
         }
 
-        [[nodiscard]] constexpr std::reverse_iterator<const_pointer> crend() const noexcept
+    private:
+        void unmap() noexcept
         {
-            return std::make_reverse_iterator(cbegin());
+            if (map_addr_) {
+                ::munmap(map_addr_, map_length_);
+                map_addr_ = nullptr;
+                data_ = nullptr;
+            }
         }
 
-        [[nodiscard]] constexpr const_reference back() const noexcept
-        {
-            return ptr_[size_ - 1];
-        }
+        void* map_addr_ = nullptr;
+        std::size_t map_length_ = 0;
+        std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool acquired_ = false;
+    };
 
-        [[nodiscard]] constexpr reference back() noexcept
-        {
-            return ptr_[size_ - 1];
-        }
+    // allocations are of the mapped file memory if not acquired yet, or of the heap otherwise
+    // (e.g. of copies, or of growing the storage - which detaches it from the file).
+    template <typename T>
+    struct simple_mapped_allocator {
+        using value_type = T;
 
-        [[nodiscard]] constexpr const_reference front() const noexcept
-        {
-            return ptr_[0];
-        }
+        static constexpr std::size_t max_size = std::size_t(-1) / sizeof(T);
 
-        [[nodiscard]] constexpr reference front() noexcept
-        {
-            return ptr_[0];
-        }
+        simple_mapped_allocator() = default;
 
-        template <iterator_type InputIt>
-        constexpr iterator insert(const_iterator pos, InputIt first, InputIt last)
+        explicit simple_mapped_allocator(std::shared_ptr<simple_file_mapping> file_mapping) noexcept
+            : mapping(std::move(file_mapping))
+        { }
+
+        template <typename U>
+        constexpr simple_mapped_allocator(const simple_mapped_allocator<U>& other) noexcept
+            : mapping(other.mapping)
+        { }
+
+        [[nodiscard]] T* allocate(std::size_t n)
         {
-            difference_type in_dist = std::distance(first, last);
-            if (in_dist < 0) {
-                throw std::invalid_argument("negative distance between iterators");
+            if (n > max_size) {
+                throw std::bad_alloc{};
             }
-
-            difference_type pos_dist = std::distance(cbegin(), pos);
-            if (pos_dist < 0 || pos_dist > size_) {
-                throw std::invalid_argument("unbound input pos");
+            if (mapping) {
+                if (void* p = mapping->acquire(n * sizeof(value_type))) {
+                    return static_cast<T*>(p);
+                }
             }
+            return static_cast<T*>(::operator new[](n * sizeof(value_type)));
+        }
 
-            if (in_dist == 0) {
-                return ptr_ + pos_dist;
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            assert("pre " && p != nullptr);
+            if (mapping && mapping->release(p)) {
+                return;
             }
+            ::operator delete[](p, n * sizeof(value_type));
+        }
 
-            append(in_dist);
-
-            auto new_pos = begin() + pos_dist;
+        std::shared_ptr<simple_file_mapping> mapping;
+    };
 
-            auto rpos_start = rbegin() + in_dist;
-            auto rpos_stop = rend() - pos_dist;
-            std::move(rpos_start, rpos_stop, rpos_start - in_dist);
+    template <typename T, typename U>
+    [[nodiscard]] constexpr bool operator==(const simple_mapped_allocator<T>&, const simple_mapped_allocator<U>&)
+    {
+        return sizeof(T) == sizeof(U);
+    }
 
-            std::copy(first, last, new_pos);
+    template <typename T, typename U>
+    [[nodiscard]] constexpr bool operator!=(
+        const simple_mapped_allocator<T>& lhs, const simple_mapped_allocator<U>& rhs)
+    {
+        return !(lhs == rhs);
+    }
 
-            return new_pos;
-        }
+    // allocations of at least Threshold bytes are mapped by huge pages - explicitly reserved pages if available
+    // (MAP_HUGETLB), or transparent huge pages otherwise (MADV_HUGEPAGE), which reduces tlb misses of strided
+    // traversals. smaller allocations are of the heap.
+    template <typename T, std::size_t Threshold = std::size_t{1} << 21>
+    struct simple_huge_page_allocator {
+        using value_type = T;
 
         template <typename U>
-        constexpr iterator insert(const_iterator pos, size_type count, const U& value)
-        {
-            difference_type pos_dist = std::distance(cbegin(), pos);
-            if (pos_dist < 0 || pos_dist > size_) {
-                throw std::invalid_argument("unbound input pos");
-            }
-
-            if (count == 0) {
-                return ptr_ + pos_dist;
-            }
+        struct rebind {
+            using other = simple_huge_page_allocator<U, Threshold>;
+        };
 
-            append(count);
+        static constexpr std::size_t huge_page_size = std::size_t{1} << 21;
+        static constexpr std::size_t threshold = Threshold;
+        static constexpr std::size_t max_size = (std::size_t(-1) - huge_page_size) / sizeof(T);
 
-            auto new_pos = begin() + pos_dist;
+        simple_huge_page_allocator() = default;
 
-            auto rpos_start = rbegin() + count;
-            auto rpos_stop = rend() - pos_dist;
-            std::move(rpos_start, rpos_stop, rpos_start - count);
+        template <typename U>
+        constexpr simple_huge_page_allocator(const simple_huge_page_allocator<U, Threshold>&) noexcept
+        { }
 
-            std::fill_n(new_pos, count, value);
+        [[nodiscard]] static constexpr bool is_huge(std::size_t n) noexcept
+        {
+            return n * sizeof(T) >= Threshold;
+        }
 
-            return new_pos;
+        [[nodiscard]] static constexpr std::size_t mapped_size(std::size_t n) noexcept
+        {
+            return (n * sizeof(T) + huge_page_size - 1) / huge_page_size * huge_page_size;
         }
 
-        constexpr iterator erase(const_iterator first, const_iterator last)
+        [[nodiscard]] T* allocate(std::size_t n)
         {
-            difference_type dist = std::distance(first, last);
-            if (dist < 0) {
-                throw std::invalid_argument("negative distance between iterators");
+            if (n > max_size) {
+                throw std::bad_alloc{};
             }
-
-            difference_type first_dist = std::distance(cbegin(), first);
-            if (first_dist < 0 || first_dist > size_) {
-                throw std::invalid_argument("unbound input first");
+            if (!is_huge(n)) {
+                return static_cast<T*>(::operator new[](n * sizeof(value_type)));
             }
 
-            difference_type last_dist = std::distance(cbegin(), last);
-            if (last_dist < 0 || last_dist > size_) {
-                throw std::invalid_argument("unbound input last");
-            }
+            std::size_t bytes = mapped_size(n);
 
-            if (dist == 0) {
-                return ptr_ + last_dist - 1;
+            // the reserved pages are explicitly requested of huge_page_size (rather than the system default),
+            // so the mapping is unmapped by mapped_size
+#if defined(MAP_HUGETLB) && (defined(MAP_HUGE_2MB) || defined(MAP_HUGE_SHIFT))
+#ifdef MAP_HUGE_2MB
+            constexpr int huge_page_flag = MAP_HUGE_2MB;
+#else
+            constexpr int huge_page_flag = 21 << MAP_HUGE_SHIFT;
+#endif
+            if (void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | huge_page_flag, -1, 0);
+                p != MAP_FAILED) {
+                return static_cast<T*>(p);
             }
+#endif
 
-            std::move(last, cend(), ptr_ + first_dist);
+            // transparent huge pages back only huge_page_size aligned ranges, therefore the mapping
+            // is extended by a huge page and its unaligned head and tail are unmapped
+            void* p
+                = ::mmap(nullptr, bytes + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
 
-            resize(size_ - dist);
+            auto first = reinterpret_cast<std::uintptr_t>(p);
+            auto aligned_first = (first + huge_page_size - 1) & ~(std::uintptr_t{huge_page_size} - 1);
+            if (std::size_t head = aligned_first - first; head > 0) {
+                ::munmap(p, head);
+            }
+            if (std::size_t tail = first + bytes + huge_page_size - (aligned_first + bytes); tail > 0) {
+                ::munmap(reinterpret_cast<void*>(aligned_first + bytes), tail);
+            }
 
-            return ptr_ + last_dist - 1;
+            p = reinterpret_cast<void*>(aligned_first);
+#ifdef MADV_HUGEPAGE
+            (void)::madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+            return static_cast<T*>(p);
         }
 
-        constexpr iterator erase(const_iterator pos)
+        void deallocate(T* p, std::size_t n) noexcept
         {
-            return erase(pos, pos + 1);
+            assert("pre " && p != nullptr);
+            if (!is_huge(n)) {
+                ::operator delete[](p, n * sizeof(value_type));
+                return;
+            }
+            ::munmap(p, mapped_size(n));
         }
-
-    private:
-        size_type size_ = 0;
-        size_type capacity_ = 0;
-        pointer ptr_ = nullptr;
-        allocator_type alloc_;
     };
 
-    template <typename T, std::size_t Capacity>
-    class simple_array {
-        static_assert(Capacity > 0);
-
-    public:
+    template <typename T, typename U, std::size_t Threshold>
+    [[nodiscard]] constexpr bool operator==(
+        const simple_huge_page_allocator<T, Threshold>&, const simple_huge_page_allocator<U, Threshold>&)
+    {
+        return sizeof(T) == sizeof(U);
+    }
+
+    template <typename T, typename U, std::size_t Threshold>
+    [[nodiscard]] constexpr bool operator!=(
+        const simple_huge_page_allocator<T, Threshold>& lhs, const simple_huge_page_allocator<U, Threshold>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+#endif // OC_ARRND_HAS_MMAP
+}
+
+using details::simple_allocator;
+using details::simple_aligned_allocator;
+using details::simple_arena;
+using details::simple_arena_scope;
+using details::simple_arena_allocator;
+using details::simple_pool_stats;
+using details::simple_pool;
+using details::current_simple_pool;
+using details::simple_pool_allocator;
+#ifdef OC_ARRND_HAS_MMAP
+using details::simple_file_map_mode;
+using details::simple_file_map_advice;
+using details::simple_file_mapping;
+using details::simple_mapped_allocator;
+using details::simple_huge_page_allocator;
+#endif // OC_ARRND_HAS_MMAP
+}
+
+namespace oc::arrnd {
+namespace details {
+    template <typename T, typename Allocator = simple_allocator<T>>
+    class simple_vector {
+        static_assert(std::is_same_v<T, typename Allocator::value_type>);
+
+    public:
         using value_type = T;
+        using allocator_type = Allocator;
         using size_type = std::size_t;
         using difference_type = std::ptrdiff_t;
         using reference = T&;
@@ -1438,43 +1792,67 @@ namespace details {
         using reverse_iterator = std::reverse_iterator<pointer>;
         using const_reverse_iterator = std::reverse_iterator<const_pointer>;
 
-        simple_array() = default;
+        simple_vector() = default;
 
-        explicit constexpr simple_array(size_type size)
+        explicit constexpr simple_vector(size_type size)
             : size_(size)
+            , capacity_(size)
         {
-            if (size > Capacity) {
-                throw std::invalid_argument("size bigger than maximum capacity");
+            if (size > 0) {
+                ptr_ = alloc_.allocate(size);
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::uninitialized_default_construct_n(ptr_, size);
+                }
+            }
+        }
+
+        // elements of fundamental types are not initialized - e.g. the allocator might provide existing data
+        explicit constexpr simple_vector(size_type size, const allocator_type& alloc)
+            : size_(size)
+            , capacity_(size)
+            , alloc_(alloc)
+        {
+            if (size > 0) {
+                ptr_ = alloc_.allocate(size);
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::uninitialized_default_construct_n(ptr_, size);
+                }
             }
         }
 
         template <typename U>
-        explicit constexpr simple_array(size_type size, const U& value)
-            : simple_array(size)
+        explicit constexpr simple_vector(size_type size, const U& value)
+            : size_(size)
+            , capacity_(size)
         {
-            std::fill_n(ptr_, size, value);
+            if (size > 0) {
+                ptr_ = alloc_.allocate(size);
+                std::uninitialized_fill_n(ptr_, size, value);
+            }
         }
 
         template <iterator_type InputIt>
-        explicit constexpr simple_array(InputIt first, InputIt last)
-            : simple_array(std::distance(first, last))
+        explicit constexpr simple_vector(InputIt first, InputIt last)
+            : size_(std::distance(first, last))
+            , capacity_(std::distance(first, last))
         {
             difference_type dist = std::distance(first, last);
             if (dist < 0) {
                 throw std::invalid_argument("negative distance between iterators");
             }
             if (dist > 0) {
-                std::copy_n(first, dist, ptr_);
+                ptr_ = alloc_.allocate(dist);
+                std::uninitialized_copy_n(first, dist, ptr_);
             }
         }
 
         template <iterable_type Cont>
-        explicit constexpr simple_array(const Cont& values)
-            : simple_array(std::begin(values), std::end(values))
+        explicit constexpr simple_vector(const Cont& values)
+            : simple_vector(std::begin(values), std::end(values))
         { }
 
-        explicit constexpr simple_array(std::initializer_list<value_type> values)
-            : simple_array(values.begin(), values.end())
+        explicit constexpr simple_vector(std::initializer_list<value_type> values)
+            : simple_vector(values.begin(), values.end())
         { }
 
         constexpr void clear()
@@ -1487,64 +1865,87 @@ namespace details {
             size_ = 0;
         }
 
-        constexpr simple_array(const simple_array& other)
-            : simple_array(other.ptr_, other.ptr_ + other.size_)
-        { }
+        constexpr simple_vector(const simple_vector& other)
+            : alloc_(other.alloc_)
+            , size_(other.size_)
+            , capacity_(other.capacity_)
+        {
+            if (other.capacity_ > 0) {
+                ptr_ = alloc_.allocate(other.capacity_);
+                std::uninitialized_copy_n(other.ptr_, other.size_, ptr_);
+            }
+        }
 
-        constexpr simple_array& operator=(const simple_array& other)
+        constexpr simple_vector& operator=(const simple_vector& other)
         {
             if (this == &other) {
                 return *this;
             }
 
-            if (other.empty()) {
+            if (capacity_ > 0) {
                 clear();
-                return *this;
+                alloc_.deallocate(ptr_, capacity_);
+                capacity_ = 0;
             }
 
-            std::copy(other.ptr_, other.ptr_ + other.size_, ptr_);
-            if constexpr (!std::is_fundamental_v<value_type>) {
-                if (other.size_ < size_) {
-                    std::destroy_n(ptr_ + other.size_, size_ - other.size_);
-                }
-            }
+            alloc_ = other.alloc_;
             size_ = other.size_;
+            capacity_ = other.capacity_;
+
+            if (other.capacity_ > 0) {
+                ptr_ = alloc_.allocate(other.capacity_);
+                std::uninitialized_copy_n(other.ptr_, other.size_, ptr_);
+            }
 
             return *this;
         }
 
-        constexpr simple_array(simple_array&& other) noexcept
-            : size_(other.size_)
+        constexpr simple_vector(simple_vector&& other) noexcept
+            : alloc_(std::move(other.alloc_))
+            , size_(other.size_)
+            , capacity_(other.capacity_)
         {
-            std::move(other.ptr_, other.ptr_ + other.size_, ptr_);
+            ptr_ = other.ptr_;
 
+            other.ptr_ = nullptr;
             other.size_ = 0;
+            other.capacity_ = 0;
         }
 
-        constexpr simple_array& operator=(simple_array&& other) noexcept
+        constexpr simple_vector& operator=(simple_vector&& other) noexcept
         {
             if (this == &other) {
                 return *this;
             }
 
-            if (other.empty()) {
+            if (capacity_ > 0) {
                 clear();
-                return *this;
+                alloc_.deallocate(ptr_, capacity_);
+                capacity_ = 0;
             }
 
-            std::move(other.ptr_, other.ptr_ + other.size_, ptr_);
-            if constexpr (!std::is_fundamental_v<value_type>) {
-                if (other.size_ < size_) {
-                    std::destroy_n(ptr_ + other.size_, size_ - other.size_);
-                }
-            }
+            alloc_ = std::move(other.alloc_);
             size_ = other.size_;
+            capacity_ = other.capacity_;
+            ptr_ = other.ptr_;
 
+            other.ptr_ = nullptr;
             other.size_ = 0;
+            other.capacity_ = 0;
 
             return *this;
         }
 
+        constexpr ~simple_vector() noexcept
+        {
+            if (size_ > 0) {
+                clear();
+            }
+            if (capacity_ > 0) {
+                alloc_.deallocate(ptr_, capacity_);
+            }
+        }
+
         [[nodiscard]] constexpr bool empty() const noexcept
         {
             return size_ == 0;
@@ -1557,12 +1958,12 @@ namespace details {
 
         [[nodiscard]] constexpr size_type capacity() const noexcept
         {
-            return Capacity;
+            return capacity_;
         }
 
         [[nodiscard]] constexpr pointer data() const noexcept
         {
-            return const_cast<pointer>(ptr_);
+            return ptr_;
         }
 
         [[nodiscard]] constexpr reference operator[](size_type index) noexcept
@@ -1579,38 +1980,85 @@ namespace details {
 
         constexpr void resize(size_type count)
         {
-            if (count > Capacity) {
-                throw std::invalid_argument("resize count > Capacity");
-            }
-
-            if (count < size_) {
+            if (count == 0) {
+                clear();
+            } else if (count < size_) {
                 if constexpr (!std::is_fundamental_v<value_type>) {
                     std::destroy_n(ptr_ + count, size_ - count);
                 }
                 size_ = count;
             } else if (count > size_) {
-                size_ = count;
+                if (count <= capacity_) {
+                    if constexpr (!std::is_fundamental_v<value_type>) {
+                        std::uninitialized_default_construct_n(ptr_ + size_, count - size_);
+                    }
+                    size_ = count;
+                } else {
+                    pointer new_ptr = alloc_.allocate(count);
+                    std::uninitialized_move_n(ptr_, size_, new_ptr);
+                    if constexpr (!std::is_fundamental_v<value_type>) {
+                        std::uninitialized_default_construct_n(new_ptr + size_, count - size_);
+                    }
+
+                    if (capacity_ > 0) {
+                        alloc_.deallocate(ptr_, capacity_);
+                    }
+
+                    size_ = count;
+                    capacity_ = count;
+                    ptr_ = new_ptr;
+                }
             }
         }
 
         constexpr void reserve(size_type new_cap)
         {
-            if (new_cap != Capacity) {
-                throw std::invalid_argument("new capacity different from fixed Capacity");
+            if (new_cap > capacity_) {
+                pointer new_ptr = alloc_.allocate(new_cap);
+                std::uninitialized_move_n(ptr_, size_, new_ptr);
+
+                if (capacity_ > 0) {
+                    alloc_.deallocate(ptr_, capacity_);
+                }
+                ptr_ = new_ptr;
+                capacity_ = new_cap;
             }
         }
 
         constexpr void append(size_type count)
         {
-            if (size_ + count > Capacity) {
-                throw std::invalid_argument("append size is bigger than fixed Capacity");
+            if (size_ + count <= capacity_ && size_ + count > size_) {
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::uninitialized_default_construct_n(ptr_ + size_, count);
+                }
+                size_ += count;
+            } else if (size_ + count > capacity_) {
+                size_type new_cap = static_cast<size_type>(1.5 * (size_ + count));
+                pointer new_ptr = alloc_.allocate(new_cap);
+                std::uninitialized_move_n(ptr_, size_, new_ptr);
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::uninitialized_default_construct_n(new_ptr + size_, count);
+                }
+                if (capacity_ > 0) {
+                    alloc_.deallocate(ptr_, capacity_);
+                }
+
+                ptr_ = new_ptr;
+                capacity_ = new_cap;
+                size_ += count;
             }
-            size_ += count;
         }
 
         constexpr void shrink_to_fit()
         {
-            // noop since Capacity is fixed value
+            if (capacity_ > size_) {
+                pointer new_ptr = alloc_.allocate(size_);
+                std::uninitialized_move_n(ptr_, size_, new_ptr);
+
+                alloc_.deallocate(ptr_, capacity_);
+                ptr_ = new_ptr;
+                capacity_ = size_;
+            }
         }
 
         [[nodiscard]] constexpr pointer begin() noexcept
@@ -1772,8596 +2220,12294 @@ namespace details {
         }
 
     private:
-        value_type ptr_[Capacity];
         size_type size_ = 0;
+        size_type capacity_ = 0;
+        pointer ptr_ = nullptr;
+        allocator_type alloc_;
     };
-}
 
-using details::simple_allocator;
-using details::simple_vector;
-using details::simple_array;
-}
+    template <typename T, std::size_t Capacity>
+    class simple_array {
+        static_assert(Capacity > 0);
 
-namespace oc::arrnd {
-namespace details {
-    template <typename T, template <typename> typename Allocator = simple_allocator>
-    struct simple_vector_traits {
-        using storage_type = simple_vector<T, Allocator<T>>;
-        template <typename U>
-        using replaced_type = simple_vector_traits<U, Allocator>;
-        template <typename U>
-        using allocator_template_type = Allocator<U>;
-    };
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<pointer>;
+        using const_reverse_iterator = std::reverse_iterator<const_pointer>;
 
-    template <typename T, std::int64_t N>
-    struct simple_array_traits {
-        using storage_type = simple_array<T, N>;
-        template <typename U>
-        using replaced_type = simple_array_traits<U, N>;
-        template <typename U>
-        using allocator_template_type = simple_allocator<U>;
-    };
-}
-
-using details::simple_vector_traits;
-using details::simple_array_traits;
-}
+        simple_array() = default;
 
-namespace oc::arrnd {
-namespace details {
-    template <typename T1, typename T2>
-    using tol_type = decltype(std::remove_cvref_t<T1>{} - std::remove_cvref_t<T2>{});
+        explicit constexpr simple_array(size_type size)
+            : size_(size)
+        {
+            if (size > Capacity) {
+                throw std::invalid_argument("size bigger than maximum capacity");
+            }
+        }
 
-    template <std::integral T>
-    [[nodiscard]] inline constexpr T default_atol() noexcept
-    {
-        return T{0};
-    }
+        template <typename U>
+        explicit constexpr simple_array(size_type size, const U& value)
+            : simple_array(size)
+        {
+            std::fill_n(ptr_, size, value);
+        }
 
-    template <typename T>
-        requires(std::floating_point<T> || template_type<T, std::complex>)
-    [[nodiscard]] inline constexpr T default_atol() noexcept
-    {
-        return T{1e-8};
-    }
+        template <iterator_type InputIt>
+        explicit constexpr simple_array(InputIt first, InputIt last)
+            : simple_array(std::distance(first, last))
+        {
+            difference_type dist = std::distance(first, last);
+            if (dist < 0) {
+                throw std::invalid_argument("negative distance between iterators");
+            }
+            if (dist > 0) {
+                std::copy_n(first, dist, ptr_);
+            }
+        }
 
-    template <std::integral T>
-    [[nodiscard]] inline constexpr T default_rtol() noexcept
-    {
-        return T{0};
-    }
+        template <iterable_type Cont>
+        explicit constexpr simple_array(const Cont& values)
+            : simple_array(std::begin(values), std::end(values))
+        { }
 
-    template <typename T>
-        requires(std::floating_point<T> || template_type<T, std::complex>)
-    [[nodiscard]] inline constexpr T default_rtol() noexcept
-    {
-        return T{1e-5};
-    }
+        explicit constexpr simple_array(std::initializer_list<value_type> values)
+            : simple_array(values.begin(), values.end())
+        { }
 
-    template <typename T1, typename T2>
-        requires((std::is_arithmetic_v<T1> || template_type<T1, std::complex>)
-            && (std::is_arithmetic_v<T2> || template_type<T2, std::complex>))
-    [[nodiscard]] inline constexpr bool close(const T1& a, const T2& b,
-        const tol_type<T1, T2>& atol = default_atol<tol_type<T1, T2>>(),
-        const tol_type<T1, T2>& rtol = default_rtol<tol_type<T1, T2>>()) noexcept
-    {
-        using std::abs;
-        if (a == b) {
-            return true;
+        constexpr void clear()
+        {
+            if (!empty()) {
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::destroy_n(ptr_, size_);
+                }
+            }
+            size_ = 0;
         }
-        const tol_type<T1, T2> reps{rtol * (abs(a) > abs(b) ? abs(a) : abs(b))};
-        return abs(a - b) <= (atol > reps ? atol : reps);
-    }
-
-    template <typename T>
-    [[nodiscard]] inline constexpr auto sign(const T& value)
-    {
-        return (T{0} < value) - (value < T{0});
-    }
-}
-}
-
-namespace oc::arrnd {
-namespace details {
-    // represents right-open interval
-    template <typename T = std::int64_t>
-        requires(std::is_fundamental_v<T>)
-    class interval {
-    public:
-        using size_type = T;
 
-        static constexpr size_type neginf = std::numeric_limits<size_type>::min();
-        static constexpr size_type posinf = std::numeric_limits<size_type>::max();
+        constexpr simple_array(const simple_array& other)
+            : simple_array(other.ptr_, other.ptr_ + other.size_)
+        { }
 
-        constexpr interval(size_type start, size_type stop, size_type step = 1)
-            : start_(start)
-            , stop_(stop)
-            , step_(step)
+        constexpr simple_array& operator=(const simple_array& other)
         {
-            if (start > stop || step <= 0) {
-                throw std::invalid_argument("invalid interval");
+            if (this == &other) {
+                return *this;
             }
 
-            if constexpr (std::is_integral_v<size_type> && std::is_signed_v<size_type>) {
-                if (start != neginf && stop != posinf && start < 0 && stop > posinf + start) {
-                    throw std::overflow_error("interval absdiff does not fit size_type");
-                }
+            if (other.empty()) {
+                clear();
+                return *this;
             }
-        }
 
-        constexpr interval() = default; // interval of first element
-        constexpr interval(const interval&) = default;
-        constexpr interval& operator=(const interval&) = default;
-        constexpr interval(interval&&) = default;
-        constexpr interval& operator=(interval&&) = default;
+            std::copy(other.ptr_, other.ptr_ + other.size_, ptr_);
+            if constexpr (!std::is_fundamental_v<value_type>) {
+                if (other.size_ < size_) {
+                    std::destroy_n(ptr_ + other.size_, size_ - other.size_);
+                }
+            }
+            size_ = other.size_;
 
-        [[nodiscard]] constexpr size_type start() const noexcept
-        {
-            return start_;
+            return *this;
         }
 
-        [[nodiscard]] constexpr size_type stop() const noexcept
+        constexpr simple_array(simple_array&& other) noexcept
+            : size_(other.size_)
         {
-            return stop_;
-        }
+            std::move(other.ptr_, other.ptr_ + other.size_, ptr_);
 
-        [[nodiscard]] constexpr size_type step() const noexcept
-        {
-            return step_;
+            other.size_ = 0;
         }
 
-        // conversion from interval<size_type> to interval<U>
-        template <typename U>
-            requires(std::is_fundamental_v<U>)
-        [[nodiscard]] constexpr operator interval<U>() const
+        constexpr simple_array& operator=(simple_array&& other) noexcept
         {
-            if constexpr (std::is_same_v<size_type, U>) {
+            if (this == &other) {
                 return *this;
-            } else {
-                if (step_ < std::numeric_limits<U>::min() || step_ > std::numeric_limits<U>::max()) {
-                    throw std::overflow_error(
-                        "invalid interval casting - step value is not fit to converted size type");
-                }
-
-                if (isunbound(*this)) {
-                    if (!isleftbound(*this) && !isrightbound(*this)) {
-                        return interval<U>::full(step_);
-                    }
-
-                    if (isleftbound(*this)
-                        && (start_ >= std::numeric_limits<U>::min() || start_ <= std::numeric_limits<U>::max())) {
-                        return interval<U>::from(start_, step_);
-                    }
-
-                    if (isrightbound(*this)
-                        && (stop_ >= std::numeric_limits<U>::min() || stop_ <= std::numeric_limits<U>::max())) {
-                        return interval<U>::to(stop_, step_);
-                    }
-                }
+            }
 
-                // conversion of negative values from signed to unsigned is undefined
-                if constexpr (std::is_signed_v<size_type> && std::is_unsigned_v<U>) {
-                    if (start_ < 0 || stop_ < 0) {
-                        throw std::overflow_error(
-                            "invalid interval casting - undifned conversion from negative signed to unsigned");
-                    }
-                }
+            if (other.empty()) {
+                clear();
+                return *this;
+            }
 
-                if (start_ < std::numeric_limits<U>::min() || start_ > std::numeric_limits<U>::max()) {
-                    throw std::overflow_error(
-                        "invalid interval casting - start value is not fit to converted size type");
+            std::move(other.ptr_, other.ptr_ + other.size_, ptr_);
+            if constexpr (!std::is_fundamental_v<value_type>) {
+                if (other.size_ < size_) {
+                    std::destroy_n(ptr_ + other.size_, size_ - other.size_);
                 }
+            }
+            size_ = other.size_;
 
-                if (stop_ < std::numeric_limits<U>::min() || stop_ > std::numeric_limits<U>::max()) {
-                    throw std::overflow_error(
-                        "invalid interval casting - stop value is not fit to converted size type");
-                }
+            other.size_ = 0;
 
-                return interval<U>(start_, stop_, step_);
-            }
+            return *this;
         }
 
-        [[nodiscard]] static constexpr interval full(size_type step = 1) noexcept
+        [[nodiscard]] constexpr bool empty() const noexcept
         {
-            if constexpr (std::is_signed_v<size_type>) {
-                return interval{neginf, posinf, step};
-            } else {
-                return interval{0, posinf, step};
-            }
+            return size_ == 0;
         }
 
-        [[nodiscard]] static constexpr interval from(size_type start, size_type step = 1) noexcept
+        [[nodiscard]] constexpr size_type size() const noexcept
         {
-            return interval{start, posinf, step};
+            return size_;
         }
 
-        [[nodiscard]] static constexpr interval to(size_type stop, size_type step = 1) noexcept
+        [[nodiscard]] constexpr size_type capacity() const noexcept
         {
-            if constexpr (std::is_signed_v<size_type>) {
-                return interval{neginf, stop, step};
-            } else {
-                return interval{0, stop, step};
-            }
+            return Capacity;
         }
 
-        [[nodiscard]] static constexpr interval at(size_type pos) noexcept
+        [[nodiscard]] constexpr pointer data() const noexcept
         {
-            return interval{pos, pos + 1, 1};
+            return const_cast<pointer>(ptr_);
         }
 
-        [[nodiscard]] static constexpr interval between(size_type start, size_type stop, size_type step = 1) noexcept
+        [[nodiscard]] constexpr reference operator[](size_type index) noexcept
         {
-            return interval{start, stop, step};
+            assert(index < size_);
+            return ptr_[index];
         }
 
-    private:
-        size_type start_ = 0;
-        size_type stop_ = 1;
-        size_type step_ = 1;
-    };
-
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool isbound(interval<T> ival) noexcept
-    {
-        if constexpr (std::is_signed_v<T>) {
-            return ival.start() != interval<T>::neginf && ival.stop() != interval<T>::posinf;
-        } else {
-            return ival.stop() != interval<T>::posinf;
+        [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+        {
+            assert(index < size_);
+            return ptr_[index];
         }
-    }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool isleftbound(interval<T> ival) noexcept
-    {
-        if constexpr (std::is_signed_v<T>) {
-            return ival.start() != interval<T>::neginf;
-        } else {
-            return true;
-        }
-    }
+        constexpr void resize(size_type count)
+        {
+            if (count > Capacity) {
+                throw std::invalid_argument("resize count > Capacity");
+            }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool isrightbound(interval<T> ival) noexcept
-    {
-        return ival.stop() != interval<T>::posinf;
-    }
+            if (count < size_) {
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::destroy_n(ptr_ + count, size_ - count);
+                }
+                size_ = count;
+            } else if (count > size_) {
+                size_ = count;
+            }
+        }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool isunbound(interval<T> ival) noexcept
-    {
-        return !isbound(ival);
-    }
+        constexpr void reserve(size_type new_cap)
+        {
+            if (new_cap != Capacity) {
+                throw std::invalid_argument("new capacity different from fixed Capacity");
+            }
+        }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool isbetween(interval<T> ival, auto start, auto stop) noexcept
-        requires(std::is_fundamental_v<decltype(start)> and std::is_fundamental_v<decltype(stop)>)
-    {
-        return !empty(ival) && ival.start() >= start && ival.stop() <= stop;
-    }
+        constexpr void append(size_type count)
+        {
+            if (size_ + count > Capacity) {
+                throw std::invalid_argument("append size is bigger than fixed Capacity");
+            }
+            size_ += count;
+        }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool isbetween(interval<T> ival, auto value) noexcept
-        requires(std::is_fundamental_v<decltype(value)>)
-    {
-        return !empty(ival) && value >= ival.start() && value < ival.stop();
-    }
+        constexpr void shrink_to_fit()
+        {
+            // noop since Capacity is fixed value
+        }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr bool empty(interval<T> ival) noexcept
-    {
-        return ival.start() == ival.stop();
-    }
+        [[nodiscard]] constexpr pointer begin() noexcept
+        {
+            return ptr_;
+        }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr T absdiff(interval<T> ival) noexcept
-    {
-        if (empty(ival)) {
-            return 0;
+        [[nodiscard]] constexpr pointer end() noexcept
+        {
+            return ptr_ + size_;
         }
-        if (isunbound(ival)) {
-            return interval<T>::posinf;
+
+        [[nodiscard]] constexpr const_pointer begin() const noexcept
+        {
+            return ptr_;
         }
-        if constexpr (std::is_signed_v<T>) {
-            return static_cast<T>(std::ceil(static_cast<double>(std::abs(ival.stop() - ival.start())) / ival.step()));
-        } else {
-            return static_cast<T>(std::ceil(static_cast<double>(ival.stop() - ival.start()) / ival.step()));
+
+        [[nodiscard]] constexpr const_pointer end() const noexcept
+        {
+            return ptr_ + size_;
         }
-    }
 
-    template <typename T>
-        requires(std::is_fundamental_v<T>)
-    [[nodiscard]] inline constexpr interval<T> bound(interval<T> ival, auto start, auto stop)
-        requires(std::is_fundamental_v<decltype(start)> && std::is_fundamental_v<decltype(stop)>)
-    {
-        if constexpr (std::is_signed_v<T>) {
-            return interval<T>{ival.start() == interval<T>::neginf ? start : ival.start(),
-                ival.stop() == interval<T>::posinf ? stop : ival.stop(), ival.step()};
-        } else {
-            return interval<T>{ival.start(), ival.stop() == interval<T>::posinf ? stop : ival.stop(), ival.step()};
+        [[nodiscard]] constexpr const_pointer cbegin() const noexcept
+        {
+            return ptr_;
         }
-    }
 
-    template <typename T, typename U>
-        requires(std::is_fundamental_v<T> && std::is_fundamental_v<U>)
-    [[nodiscard]] inline constexpr bool operator==(const interval<T>& lhs, const interval<U>& rhs) noexcept
-    {
-        return (empty(lhs) && empty(rhs))
-            || (lhs.start() == rhs.start() && lhs.stop() == rhs.stop() && lhs.step() == rhs.step());
-    }
+        [[nodiscard]] constexpr const_pointer cend() const noexcept
+        {
+            return ptr_ + size_;
+        }
 
-    template <typename T>
-    inline constexpr std::ostream& operator<<(std::ostream& os, const interval<T>& ival)
-    {
-        if (empty(ival)) {
-            os << "empty";
-            return os;
+        [[nodiscard]] constexpr std::reverse_iterator<pointer> rbegin() noexcept
+        {
+            return std::make_reverse_iterator(end());
         }
 
-        os << "[" << ival.start() << "," << ival.stop() << "," << ival.step() << ")";
-        return os;
-    }
-}
+        [[nodiscard]] constexpr std::reverse_iterator<pointer> rend() noexcept
+        {
+            return std::make_reverse_iterator(begin());
+        }
 
-using details::interval;
-using details::isbound;
-using details::isleftbound;
-using details::isrightbound;
-using details::isunbound;
-using details::isbetween;
-using details::empty;
-using details::absdiff;
-using details::bound;
-}
+        [[nodiscard]] constexpr std::reverse_iterator<const_pointer> crbegin() const noexcept
+        {
+            return std::make_reverse_iterator(cend());
+        }
 
-// custom internal general usage concepts and traits
-namespace oc::arrnd {
-namespace details {
-    template <typename Iter>
-    concept iterator_of_type_integral = iterator_type<Iter> && std::integral<iterator_value_t<Iter>>;
+        [[nodiscard]] constexpr std::reverse_iterator<const_pointer> crend() const noexcept
+        {
+            return std::make_reverse_iterator(cbegin());
+        }
 
-    template <typename Cont>
-    concept iterable_of_type_integral = iterable_type<Cont> && std::integral<iterable_value_t<Cont>>;
+        [[nodiscard]] constexpr const_reference back() const noexcept
+        {
+            return ptr_[size_ - 1];
+        }
 
-    template <typename Iter>
-    concept iterator_of_type_interval = iterator_type<Iter> && template_type<iterator_value_t<Iter>, interval>;
+        [[nodiscard]] constexpr reference back() noexcept
+        {
+            return ptr_[size_ - 1];
+        }
 
-    template <typename Cont>
-    concept iterable_of_type_interval = iterable_type<Cont> && template_type<iterable_value_t<Cont>, interval>;
+        [[nodiscard]] constexpr const_reference front() const noexcept
+        {
+            return ptr_[0];
+        }
 
-    template <typename T>
-    struct overflow_check_multiplies {
-        constexpr T operator()(T lhs, T rhs) const
+        [[nodiscard]] constexpr reference front() noexcept
         {
-            if (lhs > std::numeric_limits<T>::max() / rhs) {
-                throw std::overflow_error("invalid multiplication");
-            }
-            return lhs * rhs;
+            return ptr_[0];
         }
-    };
 
-    template <typename T>
-    struct overflow_check_plus {
-        constexpr T operator()(T lhs, T rhs) const
+        template <iterator_type InputIt>
+        constexpr iterator insert(const_iterator pos, InputIt first, InputIt last)
         {
-            if (lhs > std::numeric_limits<T>::max() - rhs) {
-                throw std::overflow_error("invalid addition");
+            difference_type in_dist = std::distance(first, last);
+            if (in_dist < 0) {
+                throw std::invalid_argument("negative distance between iterators");
             }
-            return lhs + rhs;
-        }
-    };
-}
-}
 
-namespace oc::arrnd {
-namespace details {
-    enum class arrnd_iterator_position { none, begin, end, rbegin, rend };
+            difference_type pos_dist = std::distance(cbegin(), pos);
+            if (pos_dist < 0 || pos_dist > size_) {
+                throw std::invalid_argument("unbound input pos");
+            }
 
-    enum class arrnd_hint : std::size_t {
-        none = 0,
-        continuous = std::size_t{1} << 0,
-        sliced = std::size_t{1} << 1,
-        transposed = std::size_t{1} << 2,
-        bitscount = 3,
-    };
+            if (in_dist == 0) {
+                return ptr_ + pos_dist;
+            }
 
-    [[nodiscard]] inline constexpr arrnd_hint operator|(const arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
-    {
-        return static_cast<arrnd_hint>(static_cast<std::underlying_type_t<arrnd_hint>>(lhs)
-            | static_cast<std::underlying_type_t<arrnd_hint>>(rhs));
-    }
+            append(in_dist);
 
-    inline constexpr arrnd_hint& operator|=(arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
-    {
-        return (lhs = lhs | rhs);
-    }
+            auto new_pos = begin() + pos_dist;
 
-    [[nodiscard]] inline constexpr arrnd_hint operator&(const arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
-    {
-        return static_cast<arrnd_hint>(static_cast<std::underlying_type_t<arrnd_hint>>(lhs)
-            & static_cast<std::underlying_type_t<arrnd_hint>>(rhs));
-    }
+            auto rpos_start = rbegin() + in_dist;
+            auto rpos_stop = rend() - pos_dist;
+            std::move(rpos_start, rpos_stop, rpos_start - in_dist);
 
-    inline constexpr arrnd_hint& operator&=(arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
-    {
-        return (lhs = lhs & rhs);
-    }
+            std::copy(first, last, new_pos);
 
-    [[nodiscard]] inline constexpr arrnd_hint operator~(const arrnd_hint& s) noexcept
-    {
-        return static_cast<arrnd_hint>(~static_cast<std::underlying_type_t<arrnd_hint>>(s));
-    }
+            return new_pos;
+        }
 
-    [[nodiscard]] inline constexpr auto to_underlying(const arrnd_hint& s) noexcept
-    {
-        return static_cast<std::underlying_type_t<arrnd_hint>>(s);
-    }
+        template <typename U>
+        constexpr iterator insert(const_iterator pos, size_type count, const U& value)
+        {
+            difference_type pos_dist = std::distance(cbegin(), pos);
+            if (pos_dist < 0 || pos_dist > size_) {
+                throw std::invalid_argument("unbound input pos");
+            }
 
-    enum class arrnd_squeeze_type {
-        left,
-        right,
-        trim,
-        full,
-    };
+            if (count == 0) {
+                return ptr_ + pos_dist;
+            }
 
-    template <typename StorageTraits = simple_vector_traits<std::size_t>>
-        requires(std::is_same_v<std::size_t, typename StorageTraits::storage_type::value_type>)
-    class arrnd_info {
-    public:
-        using storage_traits_type = StorageTraits;
+            append(count);
 
-        using extent_storage_type = typename storage_traits_type::storage_type;
-        using extent_type = typename extent_storage_type::value_type;
+            auto new_pos = begin() + pos_dist;
 
-        using boundary_type = interval<extent_type>;
+            auto rpos_start = rbegin() + count;
+            auto rpos_stop = rend() - pos_dist;
+            std::move(rpos_start, rpos_stop, rpos_start - count);
 
-        constexpr arrnd_info() = default;
-        constexpr arrnd_info(const arrnd_info&) = default;
-        constexpr arrnd_info& operator=(const arrnd_info&) = default;
-        constexpr arrnd_info(arrnd_info&&) = default;
-        constexpr arrnd_info& operator=(arrnd_info&&) = default;
+            std::fill_n(new_pos, count, value);
 
-        template <iterator_of_type_integral InputIt>
-        constexpr arrnd_info(InputIt first_dim, InputIt last_dim)
+            return new_pos;
+        }
+
+        constexpr iterator erase(const_iterator first, const_iterator last)
         {
-            if (std::distance(first_dim, last_dim) < 0) {
-                throw std::invalid_argument("invalid input iterators distance < 0");
+            difference_type dist = std::distance(first, last);
+            if (dist < 0) {
+                throw std::invalid_argument("negative distance between iterators");
             }
 
-            if (std::distance(first_dim, last_dim) == 0 || std::any_of(first_dim, last_dim, [](auto dim) {
-                    return dim == 0;
-                })) {
-                return;
+            difference_type first_dist = std::distance(cbegin(), first);
+            if (first_dist < 0 || first_dist > size_) {
+                throw std::invalid_argument("unbound input first");
             }
 
-            if constexpr (std::signed_integral<std::iter_value_t<InputIt>>) {
-                if (std::any_of(first_dim, last_dim, [](auto dim) {
-                        return dim < 0;
-                    })) {
-                    throw std::invalid_argument("invalid dims < 0");
-                }
+            difference_type last_dist = std::distance(cbegin(), last);
+            if (last_dist < 0 || last_dist > size_) {
+                throw std::invalid_argument("unbound input last");
             }
 
-            dims_.reserve(std::distance(first_dim, last_dim));
-            dims_.insert(dims_.cend(), first_dim, last_dim);
+            if (dist == 0) {
+                return ptr_ + last_dist - 1;
+            }
 
-            strides_.resize(std::distance(first_dim, last_dim));
-            std::exclusive_scan(dims_.crbegin(), dims_.crend(), strides_.rbegin(), extent_type{1},
-                overflow_check_multiplies<extent_type>{});
+            std::move(last, cend(), ptr_ + first_dist);
 
-            if (strides_[0] > std::numeric_limits<extent_type>::max() / dims_[0]) {
-                throw std::overflow_error("invalid multiplication");
-            }
-            indices_boundary_ = boundary_type(extent_type{0}, strides_[0] * dims_[0]);
+            resize(size_ - dist);
 
-            hints_ = arrnd_hint::continuous;
+            return ptr_ + last_dist - 1;
         }
 
-        template <iterable_of_type_integral Cont>
-        explicit constexpr arrnd_info(Cont&& dims)
-            : arrnd_info(std::begin(dims), std::end(dims))
-        { }
+        constexpr iterator erase(const_iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
 
-        explicit constexpr arrnd_info(std::initializer_list<extent_type> dims)
-            : arrnd_info(dims.begin(), dims.end())
-        { }
+    private:
+        value_type ptr_[Capacity];
+        size_type size_ = 0;
+    };
 
-        // for maximum flexibility, a constructor that sets the class members and check their validity.
-        // this constructor may add hints in addition to the hints argument.
-        template <iterator_of_type_integral InputIt1, iterator_of_type_integral InputIt2>
-        explicit constexpr arrnd_info(InputIt1 first_dim, InputIt1 last_dim, InputIt2 first_stride,
-            InputIt2 last_stride, template_type<interval> auto indices_boundary, arrnd_hint hints)
+    // vector with inline storage for up to Capacity elements,
+    // which falls back to allocated storage for bigger sizes.
+    template <typename T, std::size_t Capacity, typename Allocator = simple_allocator<T>>
+    class simple_small_vector {
+        static_assert(Capacity > 0);
+        static_assert(std::is_same_v<T, typename Allocator::value_type>);
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<pointer>;
+        using const_reverse_iterator = std::reverse_iterator<const_pointer>;
+
+        simple_small_vector() = default;
+
+        explicit constexpr simple_small_vector(size_type size)
         {
-            if (std::distance(first_dim, last_dim) < 0) {
-                throw std::invalid_argument("invalid input iterators distance < 0");
-            }
+            resize(size);
+        }
 
-            if (std::distance(first_dim, last_dim) != std::distance(first_stride, last_stride)) {
-                throw std::invalid_argument("invalid strides - different number from dimensions");
-            }
+        template <typename U>
+        explicit constexpr simple_small_vector(size_type size, const U& value)
+            : simple_small_vector(size)
+        {
+            std::fill_n(ptr_, size, value);
+        }
 
-            if constexpr (std::signed_integral<std::iter_value_t<InputIt1>>) {
-                if (std::any_of(first_dim, last_dim, [](auto dim) {
-                        return dim < 0;
-                    })) {
-                    throw std::invalid_argument("invalid dims < 0");
-                }
+        template <iterator_type InputIt>
+        explicit constexpr simple_small_vector(InputIt first, InputIt last)
+        {
+            difference_type dist = std::distance(first, last);
+            if (dist < 0) {
+                throw std::invalid_argument("negative distance between iterators");
             }
+            resize(dist);
+            std::copy_n(first, dist, ptr_);
+        }
 
-            if constexpr (std::signed_integral<std::iter_value_t<InputIt2>>) {
-                if (std::any_of(first_stride, last_stride, [](auto stride) {
-                        return stride < 0;
-                    })) {
-                    throw std::invalid_argument("invalid strides < 0");
-                }
-            }
+        template <iterable_type Cont>
+        explicit constexpr simple_small_vector(const Cont& values)
+            : simple_small_vector(std::begin(values), std::end(values))
+        { }
 
-            hints_ = arrnd_hint::none;
+        explicit constexpr simple_small_vector(std::initializer_list<value_type> values)
+            : simple_small_vector(values.begin(), values.end())
+        { }
 
-            if (std::distance(first_dim, last_dim) == 0) {
-                if (!empty(indices_boundary)) {
-                    throw std::invalid_argument("invalid indices boundary");
+        constexpr void clear()
+        {
+            if (!empty() && !is_inline()) {
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::destroy_n(ptr_, size_);
                 }
-                hints_ = hints | arrnd_hint::continuous;
-                return;
-            }
-
-            if (std::any_of(first_dim, last_dim, [](auto dim) {
-                    return dim == 0;
-                })) {
-                hints_ = hints | arrnd_hint::continuous;
-                return;
             }
+            size_ = 0;
+        }
 
-            extent_type num_elem
-                = std::reduce(first_dim, last_dim, extent_type{1}, overflow_check_multiplies<extent_type>{});
+        constexpr simple_small_vector(const simple_small_vector& other)
+            : alloc_(other.alloc_)
+        {
+            reserve(other.capacity_);
+            resize(other.size_);
+            std::copy_n(other.ptr_, other.size_, ptr_);
+        }
 
-            if (indices_boundary.stop() - indices_boundary.start() != num_elem) {
-                if (to_underlying(hints & arrnd_hint::continuous)) {
-                    throw std::invalid_argument("invalid hint - not continuous according to dims and indices boundary");
-                }
-                hints_ |= arrnd_hint::sliced;
-            } else {
-                hints_ |= arrnd_hint::continuous;
+        constexpr simple_small_vector& operator=(const simple_small_vector& other)
+        {
+            if (this == &other) {
+                return *this;
             }
 
-            dims_.reserve(std::distance(first_dim, last_dim));
-            dims_.insert(std::cend(dims_), first_dim, last_dim);
+            clear();
+            release();
 
-            strides_.reserve(std::distance(first_stride, last_stride));
-            strides_.insert(std::cend(strides_), first_stride, last_stride);
+            alloc_ = other.alloc_;
 
-            indices_boundary_ = static_cast<boundary_type>(indices_boundary);
+            reserve(other.capacity_);
+            resize(other.size_);
+            std::copy_n(other.ptr_, other.size_, ptr_);
 
-            hints_ |= hints;
+            return *this;
         }
 
-        template <iterable_of_type_integral Cont1, iterable_of_type_integral Cont2>
-        explicit constexpr arrnd_info(
-            Cont1&& dims, Cont2&& strides, template_type<interval> auto indices_boundary, arrnd_hint hints)
-            : arrnd_info(
-                std::begin(dims), std::end(dims), std::begin(strides), std::end(strides), indices_boundary, hints)
-        { }
+        constexpr simple_small_vector(simple_small_vector&& other) noexcept
+            : alloc_(std::move(other.alloc_))
+        {
+            steal(std::move(other));
+        }
 
-        explicit constexpr arrnd_info(std::initializer_list<extent_type> dims,
-            std::initializer_list<extent_type> strides, template_type<interval> auto indices_boundary, arrnd_hint hints)
-            : arrnd_info(dims.begin(), dims.end(), strides.begin(), strides.end(), indices_boundary, hints)
-        { }
+        constexpr simple_small_vector& operator=(simple_small_vector&& other) noexcept
+        {
+            if (this == &other) {
+                return *this;
+            }
 
-        // the constructor tries deducing the hints value according to its parameters
-        template <iterator_of_type_integral InputIt1, iterator_of_type_integral InputIt2>
-        explicit constexpr arrnd_info(InputIt1 first_dim, InputIt1 last_dim, InputIt2 first_stride,
-            InputIt2 last_stride, template_type<interval> auto indices_boundary)
-            : arrnd_info(first_dim, last_dim, first_stride, last_stride, indices_boundary, arrnd_hint::none)
-        { }
+            clear();
+            release();
 
-        template <iterable_of_type_integral Cont1, iterable_of_type_integral Cont2>
-        explicit constexpr arrnd_info(Cont1&& dims, Cont2&& strides, template_type<interval> auto indices_boundary)
-            : arrnd_info(std::begin(dims), std::end(dims), std::begin(strides), std::end(strides), indices_boundary)
-        { }
+            alloc_ = std::move(other.alloc_);
+            steal(std::move(other));
 
-        explicit constexpr arrnd_info(std::initializer_list<extent_type> dims,
-            std::initializer_list<extent_type> strides, template_type<interval> auto indices_boundary)
-            : arrnd_info(dims.begin(), dims.end(), strides.begin(), strides.end(), indices_boundary)
-        { }
+            return *this;
+        }
 
-        // empty arrnd info with specified hints e.g. an empty slice
-        explicit constexpr arrnd_info(arrnd_hint hints)
-            : hints_(arrnd_hint::continuous | hints)
-        { }
+        constexpr ~simple_small_vector() noexcept
+        {
+            clear();
+            release();
+        }
 
-        [[nodiscard]] constexpr const extent_storage_type& dims() const noexcept
+        [[nodiscard]] constexpr bool empty() const noexcept
         {
-            return dims_;
+            return size_ == 0;
         }
 
-        [[nodiscard]] constexpr const extent_storage_type& strides() const noexcept
+        [[nodiscard]] constexpr size_type size() const noexcept
         {
-            return strides_;
+            return size_;
         }
 
-        [[nodiscard]] constexpr const boundary_type& indices_boundary() const noexcept
+        [[nodiscard]] constexpr size_type capacity() const noexcept
         {
-            return indices_boundary_;
+            return capacity_;
         }
 
-        [[nodiscard]] constexpr arrnd_hint hints() const noexcept
+        [[nodiscard]] constexpr pointer data() const noexcept
         {
-            return hints_;
+            return ptr_;
         }
 
-    private:
-        extent_storage_type dims_;
-        extent_storage_type strides_;
-        boundary_type indices_boundary_{0, 0};
-        arrnd_hint hints_{arrnd_hint::continuous};
-    };
-
-    template <typename StorageTraits, iterator_of_type_interval InputIt>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(
-        const arrnd_info<StorageTraits>& info, InputIt first_dim_boundary, InputIt last_dim_boundary)
-    {
-        if (std::distance(first_dim_boundary, last_dim_boundary) < 0) {
-            throw std::invalid_argument("invalid input iterators distance < 0");
-        }
-
-        if (std::size(info.dims()) == 0 && std::distance(first_dim_boundary, last_dim_boundary) == 0) {
-            return arrnd_info<StorageTraits>(info.hints() | arrnd_hint::continuous | arrnd_hint::sliced);
+        [[nodiscard]] constexpr reference operator[](size_type index) noexcept
+        {
+            assert(index < size_);
+            return ptr_[index];
         }
 
-        if (std::size(info.dims()) < std::distance(first_dim_boundary, last_dim_boundary)) {
-            throw std::invalid_argument("invalid dim boundaries - different number from dims");
+        [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+        {
+            assert(index < size_);
+            return ptr_[index];
         }
 
-        // input boundries might not be of the same type
-        typename arrnd_info<StorageTraits>::storage_traits_type::template replaced_type<
-            typename arrnd_info<StorageTraits>::boundary_type>::storage_type
-            bounded_dim_boundaries(std::distance(first_dim_boundary, last_dim_boundary));
+        constexpr void resize(size_type count)
+        {
+            if (count > capacity_) {
+                reallocate(count);
+            }
 
-        std::transform(first_dim_boundary, last_dim_boundary, std::begin(info.dims()),
-            std::begin(bounded_dim_boundaries), [](auto boundary, auto dim) {
-                return bound(static_cast<typename arrnd_info<StorageTraits>::boundary_type>(boundary), 0, dim);
-            });
+            if (!is_inline()) {
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    if (count < size_) {
+                        std::destroy_n(ptr_ + count, size_ - count);
+                    } else if (count > size_) {
+                        std::uninitialized_default_construct_n(ptr_ + size_, count - size_);
+                    }
+                }
+            }
 
-        if (!std::transform_reduce(std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries),
-                std::begin(info.dims()), true, std::logical_and<>{}, [](auto boundary, auto dim) {
-                    return empty(boundary) || isbetween(boundary, 0, dim);
-                })) {
-            throw std::out_of_range("invalid dim boundaries - not suitable for dims");
+            size_ = count;
         }
 
-        typename arrnd_info<StorageTraits>::extent_storage_type dims = info.dims();
-        std::transform(
-            std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries), std::begin(dims), [](auto boundary) {
-                return absdiff(boundary);
-            });
-
-        if (std::any_of(std::begin(dims), std::end(dims), [](auto dim) {
-                return dim == 0;
-            })) {
-            return arrnd_info<StorageTraits>(info.hints() | arrnd_hint::continuous | arrnd_hint::sliced);
+        constexpr void reserve(size_type new_cap)
+        {
+            if (new_cap > capacity_) {
+                reallocate(new_cap);
+            }
         }
 
-        if (std::equal(std::begin(dims), std::end(dims), std::begin(info.dims()), std::end(info.dims()))) {
-            return info;
+        constexpr void append(size_type count)
+        {
+            if (size_ + count > capacity_) {
+                reallocate(static_cast<size_type>(1.5 * (size_ + count)));
+            }
+            resize(size_ + count);
         }
 
-        typename arrnd_info<StorageTraits>::extent_storage_type strides(
-            std::begin(info.strides()), std::end(info.strides()));
-
-        std::transform(std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries), std::begin(info.strides()),
-            std::begin(strides), [](auto boundary, auto stride) {
-                if (boundary.step()
-                    > std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max() / stride) {
-                    throw std::overflow_error("invalid multiplication");
-                }
-                return boundary.step() * stride;
-            });
+        constexpr void shrink_to_fit()
+        {
+            if (!is_inline() && capacity_ > size_) {
+                reallocate(size_);
+            }
+        }
 
-        typename arrnd_info<StorageTraits>::extent_type offset = info.indices_boundary().start()
-            + std::transform_reduce(std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries),
-                std::begin(info.strides()), typename arrnd_info<StorageTraits>::extent_type{0},
-                overflow_check_plus<typename arrnd_info<StorageTraits>::extent_type>{}, [](auto boundary, auto stride) {
-                    if (boundary.start()
-                        > std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max() / stride) {
-                        throw std::overflow_error("invalid multiplication");
-                    }
-                    return boundary.start() * stride;
-                });
+        [[nodiscard]] constexpr pointer begin() noexcept
+        {
+            return ptr_;
+        }
 
-        typename arrnd_info<StorageTraits>::extent_type max_index = std::transform_reduce(std::begin(dims),
-            std::end(dims), std::begin(strides), typename arrnd_info<StorageTraits>::extent_type{0},
-            overflow_check_plus<typename arrnd_info<StorageTraits>::extent_type>{}, [](auto dim, auto stride) {
-                if (dim - 1 > std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max() / stride) {
-                    throw std::overflow_error("invalid multiplication");
-                }
-                return (dim - 1) * stride;
-            });
+        [[nodiscard]] constexpr pointer end() noexcept
+        {
+            return ptr_ + size_;
+        }
 
-        typename arrnd_info<StorageTraits>::boundary_type indices_boundary(offset, offset + max_index + 1);
+        [[nodiscard]] constexpr const_pointer begin() const noexcept
+        {
+            return ptr_;
+        }
 
-        typename arrnd_info<StorageTraits>::extent_type num_elem
-            = std::reduce(std::begin(dims), std::end(dims), typename arrnd_info<StorageTraits>::extent_type{1},
-                overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
+        [[nodiscard]] constexpr const_pointer end() const noexcept
+        {
+            return ptr_ + size_;
+        }
 
-        arrnd_hint hints = info.hints() | arrnd_hint::sliced;
-        if (max_index + 1 == num_elem) {
-            hints |= arrnd_hint::continuous;
-        } else {
-            hints &= ~arrnd_hint::continuous;
+        [[nodiscard]] constexpr const_pointer cbegin() const noexcept
+        {
+            return ptr_;
         }
 
-        return arrnd_info<StorageTraits>(dims, strides, indices_boundary, hints);
-    }
+        [[nodiscard]] constexpr const_pointer cend() const noexcept
+        {
+            return ptr_ + size_;
+        }
 
-    template <typename StorageTraits, iterable_of_type_interval Cont>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(
-        const arrnd_info<StorageTraits>& info, Cont&& dim_boundaries)
-    {
-        return slice(info, std::begin(dim_boundaries), std::end(dim_boundaries));
-    }
+        [[nodiscard]] constexpr std::reverse_iterator<pointer> rbegin() noexcept
+        {
+            return std::make_reverse_iterator(end());
+        }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(const arrnd_info<StorageTraits>& info,
-        std::initializer_list<typename arrnd_info<StorageTraits>::boundary_type> dim_boundaries)
-    {
-        return slice(info, dim_boundaries.begin(), dim_boundaries.end());
-    }
+        [[nodiscard]] constexpr std::reverse_iterator<pointer> rend() noexcept
+        {
+            return std::make_reverse_iterator(begin());
+        }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(const arrnd_info<StorageTraits>& info,
-        template_type<interval> auto dim_boundary, typename arrnd_info<StorageTraits>::extent_type axis)
-    {
-        if (std::size(info.dims()) == 0) {
-            throw std::invalid_argument("invalid arrnd info");
+        [[nodiscard]] constexpr std::reverse_iterator<const_pointer> crbegin() const noexcept
+        {
+            return std::make_reverse_iterator(cend());
         }
 
-        if (axis >= std::size(info.dims())) {
-            throw std::out_of_range("invalid axis");
+        [[nodiscard]] constexpr std::reverse_iterator<const_pointer> crend() const noexcept
+        {
+            return std::make_reverse_iterator(cbegin());
         }
 
-        typename arrnd_info<StorageTraits>::storage_traits_type::template replaced_type<
-            typename arrnd_info<StorageTraits>::boundary_type>::storage_type dim_boundaries(std::size(info.dims()),
-            arrnd_info<StorageTraits>::boundary_type::full());
+        [[nodiscard]] constexpr const_reference back() const noexcept
+        {
+            return ptr_[size_ - 1];
+        }
 
-        dim_boundaries[axis] = static_cast<typename arrnd_info<StorageTraits>::boundary_type>(dim_boundary);
+        [[nodiscard]] constexpr reference back() noexcept
+        {
+            return ptr_[size_ - 1];
+        }
 
-        return slice(info, dim_boundaries);
-    }
+        [[nodiscard]] constexpr const_reference front() const noexcept
+        {
+            return ptr_[0];
+        }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> squeeze(const arrnd_info<StorageTraits>& info,
-        arrnd_squeeze_type squeeze_type,
-        typename arrnd_info<StorageTraits>::extent_type max_count
-        = std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max())
-    {
-        if (squeeze_type == arrnd_squeeze_type::full
-            && max_count != std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max()) {
-            throw std::invalid_argument("invalid squeeze type - no max count support for full squeeze type");
+        [[nodiscard]] constexpr reference front() noexcept
+        {
+            return ptr_[0];
         }
 
-        if (size(info) == 0) {
-            if (max_count != std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max()
-                && max_count != 0) {
-                throw std::invalid_argument("invalid squeeze - empty squeeze support for max count > 0");
+        template <iterator_type InputIt>
+        constexpr iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            difference_type in_dist = std::distance(first, last);
+            if (in_dist < 0) {
+                throw std::invalid_argument("negative distance between iterators");
             }
-            return info;
-        }
 
-        if (size(info) == 1) {
-            if (max_count != std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max()
-                && max_count > 1) {
-                throw std::invalid_argument("invalid squeeze - no 1d squeeze support for max count > 1");
+            difference_type pos_dist = std::distance(cbegin(), pos);
+            if (pos_dist < 0 || pos_dist > size_) {
+                throw std::invalid_argument("unbound input pos");
             }
 
-            // max_count is valid - no squeeze in case of 1d
-            return info;
-        }
+            if (in_dist == 0) {
+                return ptr_ + pos_dist;
+            }
 
-        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
-        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
+            append(in_dist);
 
-        if (squeeze_type == arrnd_squeeze_type::left || squeeze_type == arrnd_squeeze_type::trim) {
-            typename arrnd_info<StorageTraits>::extent_type left_ones_count = 0;
-            auto dims_it = std::begin(dims);
-            while (*dims_it == 1 && left_ones_count < max_count) {
-                ++dims_it;
-                ++left_ones_count;
-            }
-            if (left_ones_count > 0) {
-                dims.erase(std::begin(dims), std::next(std::begin(dims), left_ones_count));
-                dims.shrink_to_fit();
+            auto new_pos = begin() + pos_dist;
 
-                strides.erase(std::begin(strides), std::next(std::begin(strides), left_ones_count));
-                strides.shrink_to_fit();
-            }
-        }
+            auto rpos_start = rbegin() + in_dist;
+            auto rpos_stop = rend() - pos_dist;
+            std::move(rpos_start, rpos_stop, rpos_start - in_dist);
 
-        if (squeeze_type == arrnd_squeeze_type::right || squeeze_type == arrnd_squeeze_type::trim) {
-            typename arrnd_info<StorageTraits>::extent_type right_ones_count = 0;
-            auto dims_it = std::rbegin(dims);
-            while (*dims_it == 1 && right_ones_count < max_count) {
-                ++dims_it;
-                ++right_ones_count;
-            }
-            if (right_ones_count > 0) {
-                dims.erase(std::next(std::begin(dims), std::size(dims) - right_ones_count), std::end(dims));
-                dims.shrink_to_fit();
+            std::copy(first, last, new_pos);
 
-                strides.erase(std::next(std::begin(strides), std::size(strides) - right_ones_count), std::end(strides));
-                strides.shrink_to_fit();
-            }
+            return new_pos;
         }
 
-        if (squeeze_type == arrnd_squeeze_type::full) {
-            if (std::any_of(std::begin(dims), std::end(dims), [](auto dim) {
-                    return dim == 1;
-                })) {
-                typename arrnd_info<StorageTraits>::extent_type not_one_index = 0;
-                for (typename arrnd_info<StorageTraits>::extent_type i = 0; i < std::size(dims); ++i) {
-                    if (dims[i] != 1) {
-                        dims[not_one_index] = dims[i];
-                        strides[not_one_index] = strides[i];
-                        ++not_one_index;
-                    }
-                }
-
-                dims.resize(not_one_index);
-                dims.shrink_to_fit();
+        template <typename U>
+        constexpr iterator insert(const_iterator pos, size_type count, const U& value)
+        {
+            difference_type pos_dist = std::distance(cbegin(), pos);
+            if (pos_dist < 0 || pos_dist > size_) {
+                throw std::invalid_argument("unbound input pos");
+            }
 
-                strides.resize(not_one_index);
-                strides.shrink_to_fit();
+            if (count == 0) {
+                return ptr_ + pos_dist;
             }
-        }
 
-        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints());
-    }
+            append(count);
 
-    template <typename StorageTraits, iterator_of_type_integral InputIt>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> transpose(
-        const arrnd_info<StorageTraits>& info, InputIt first_axis, InputIt last_axis)
-    {
-        if (std::distance(first_axis, last_axis) != std::size(info.dims())) {
-            throw std::invalid_argument("invalid input iterators distance != number of dims");
-        }
+            auto new_pos = begin() + pos_dist;
 
-        if (empty(info)) {
-            return info;
+            auto rpos_start = rbegin() + count;
+            auto rpos_stop = rend() - pos_dist;
+            std::move(rpos_start, rpos_stop, rpos_start - count);
+
+            std::fill_n(new_pos, count, value);
+
+            return new_pos;
         }
 
-        if (std::size(info.dims()) == 0) {
-            if (*first_axis != 0) {
-                throw std::out_of_range("invalid axis value");
+        constexpr iterator erase(const_iterator first, const_iterator last)
+        {
+            difference_type dist = std::distance(first, last);
+            if (dist < 0) {
+                throw std::invalid_argument("negative distance between iterators");
             }
-            return info;
-        }
 
-        if (std::any_of(first_axis, last_axis, [&info](std::size_t axis) {
-                return axis < 0 || axis >= std::size(info.dims());
-            })) {
-            throw std::out_of_range("invalid axis value");
-        }
+            difference_type first_dist = std::distance(cbegin(), first);
+            if (first_dist < 0 || first_dist > size_) {
+                throw std::invalid_argument("unbound input first");
+            }
 
-        auto is_unique_axes = [](InputIt first, InputIt last) {
-            typename arrnd_info<StorageTraits>::extent_storage_type sorted_axes(first, last);
-            std::sort(std::begin(sorted_axes), std::end(sorted_axes));
-            return std::adjacent_find(std::begin(sorted_axes), std::end(sorted_axes)) == std::end(sorted_axes);
-        };
+            difference_type last_dist = std::distance(cbegin(), last);
+            if (last_dist < 0 || last_dist > size_) {
+                throw std::invalid_argument("unbound input last");
+            }
 
-        if (!is_unique_axes(first_axis, last_axis)) {
-            throw std::invalid_argument("not unique axes");
-        }
+            if (dist == 0) {
+                return ptr_ + last_dist - 1;
+            }
 
-        if (std::is_sorted(first_axis, last_axis)) {
-            return info;
-        }
+            std::move(last, cend(), ptr_ + first_dist);
 
-        typename arrnd_info<StorageTraits>::extent_storage_type dims(std::size(info.dims()));
-        typename arrnd_info<StorageTraits>::extent_storage_type strides(std::size(info.strides()));
+            resize(size_ - dist);
 
-        typename arrnd_info<StorageTraits>::extent_type i = 0;
-        for (auto axes_it = first_axis; axes_it != last_axis; ++axes_it, ++i) {
-            dims[i] = info.dims()[*axes_it];
-            strides[i] = info.strides()[*axes_it];
+            return ptr_ + last_dist - 1;
         }
 
-        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
-    }
+        constexpr iterator erase(const_iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
 
-    template <typename StorageTraits, iterable_of_type_integral Cont>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> transpose(
-        const arrnd_info<StorageTraits>& info, Cont&& axes)
-    {
-        return transpose(info, std::begin(axes), std::end(axes));
-    }
+    private:
+        [[nodiscard]] constexpr bool is_inline() const noexcept
+        {
+            return ptr_ == buff_;
+        }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> transpose(const arrnd_info<StorageTraits>& info,
-        std::initializer_list<typename arrnd_info<StorageTraits>::extent_type> axes)
-    {
-        return transpose(info, axes.begin(), axes.end());
-    }
+        // move the elements to inline or allocated storage according to the new capacity
+        constexpr void reallocate(size_type new_cap)
+        {
+            assert(new_cap >= size_);
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> swap(const arrnd_info<StorageTraits>& info,
-        typename arrnd_info<StorageTraits>::extent_type first_axis = 0,
-        typename arrnd_info<StorageTraits>::extent_type second_axis = 1)
-    {
+            if (new_cap <= Capacity) {
+                if (!is_inline()) {
+                    std::move(ptr_, ptr_ + size_, buff_);
+                    release();
+                }
+                return;
+            }
 
-        if (first_axis >= std::size(info.dims()) || second_axis >= std::size(info.dims())) {
-            throw std::out_of_range("invalid axis value");
+            pointer new_ptr = alloc_.allocate(new_cap);
+            std::uninitialized_move_n(ptr_, size_, new_ptr);
+            release();
+
+            ptr_ = new_ptr;
+            capacity_ = new_cap;
         }
 
-        if (first_axis == second_axis) {
-            return info;
+        // free allocated storage (if exists) and return to inline storage
+        constexpr void release() noexcept
+        {
+            if (!is_inline()) {
+                if constexpr (!std::is_fundamental_v<value_type>) {
+                    std::destroy_n(ptr_, size_);
+                }
+                alloc_.deallocate(ptr_, capacity_);
+            }
+            ptr_ = buff_;
+            capacity_ = Capacity;
         }
 
-        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
-        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
+        constexpr void steal(simple_small_vector&& other) noexcept
+        {
+            if (other.is_inline()) {
+                std::move(other.ptr_, other.ptr_ + other.size_, buff_);
+                size_ = other.size_;
+            } else {
+                ptr_ = other.ptr_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
 
-        std::swap(dims[first_axis], dims[second_axis]);
-        std::swap(strides[first_axis], strides[second_axis]);
+                other.ptr_ = other.buff_;
+                other.capacity_ = Capacity;
+            }
+            other.size_ = 0;
+        }
 
-        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
-    }
+        size_type size_ = 0;
+        size_type capacity_ = Capacity;
+        pointer ptr_ = buff_;
+        allocator_type alloc_;
+        value_type buff_[Capacity];
+    };
+}
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> move(const arrnd_info<StorageTraits>& info,
-        typename arrnd_info<StorageTraits>::extent_type src_axis = 0,
-        typename arrnd_info<StorageTraits>::extent_type dst_axis = 1)
-    {
+using details::simple_allocator;
+using details::simple_vector;
+using details::simple_array;
+using details::simple_small_vector;
+}
 
-        if (src_axis >= std::size(info.dims()) || dst_axis >= std::size(info.dims())) {
-            throw std::out_of_range("invalid axis value");
-        }
+namespace oc::arrnd {
+namespace details {
+    template <typename T, template <typename> typename Allocator = simple_allocator>
+    struct simple_vector_traits {
+        using storage_type = simple_vector<T, Allocator<T>>;
+        template <typename U>
+        using replaced_type = simple_vector_traits<U, Allocator>;
+        template <typename U>
+        using allocator_template_type = Allocator<U>;
+    };
 
-        if (src_axis == dst_axis) {
-            return info;
-        }
+    template <typename T, std::int64_t N>
+    struct simple_array_traits {
+        using storage_type = simple_array<T, N>;
+        template <typename U>
+        using replaced_type = simple_array_traits<U, N>;
+        template <typename U>
+        using allocator_template_type = simple_allocator<U>;
+    };
 
-        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
-        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
+    template <typename T, std::size_t Capacity = 8, template <typename> typename Allocator = simple_allocator>
+    struct simple_small_vector_traits {
+        using storage_type = simple_small_vector<T, Capacity, Allocator<T>>;
+        template <typename U>
+        using replaced_type = simple_small_vector_traits<U, Capacity, Allocator>;
+        template <typename U>
+        using allocator_template_type = Allocator<U>;
+    };
 
-        auto src_dim = dims[src_axis];
-        dims.erase(std::next(std::begin(dims), src_axis));
-        dims.insert(std::next(std::begin(dims), dst_axis), 1, src_dim);
+    // e.g. arrnd<float, simple_aligned_vector_traits<float>>
+    template <typename T, std::size_t Alignment = 64, std::size_t Padding = Alignment>
+    struct simple_aligned_vector_traits {
+        template <typename U>
+        using allocator_template_type = simple_aligned_allocator<U, Alignment, Padding>;
+        using storage_type = simple_vector<T, allocator_template_type<T>>;
+        template <typename U>
+        using replaced_type = simple_aligned_vector_traits<U, Alignment, Padding>;
+    };
 
-        auto src_stride = strides[src_axis];
-        strides.erase(std::next(std::begin(strides), src_axis));
-        strides.insert(std::next(std::begin(strides), dst_axis), 1, src_stride);
+    // see simple_arena_scope
+    template <typename T>
+    using simple_arena_vector_traits = simple_vector_traits<T, simple_arena_allocator>;
 
-        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
-    }
+    // see simple_pool
+    template <typename T>
+    using simple_pool_vector_traits = simple_vector_traits<T, simple_pool_allocator>;
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> roll(const arrnd_info<StorageTraits>& info, int offset = 1)
-    {
-        if (empty(info) || std::size(info.dims()) == 1 || offset == 0) {
-            return info;
-        }
+#ifdef OC_ARRND_HAS_MMAP
+    // see map_file
+    template <typename T>
+    using simple_mapped_vector_traits = simple_vector_traits<T, simple_mapped_allocator>;
 
-        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
-        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
+    // e.g. arrnd<float, simple_huge_page_vector_traits<float>>
+    template <typename T, std::size_t Threshold = std::size_t{1} << 21>
+    struct simple_huge_page_vector_traits {
+        template <typename U>
+        using allocator_template_type = simple_huge_page_allocator<U, Threshold>;
+        using storage_type = simple_vector<T, allocator_template_type<T>>;
+        template <typename U>
+        using replaced_type = simple_huge_page_vector_traits<U, Threshold>;
+    };
+#endif // OC_ARRND_HAS_MMAP
+}
 
-        typename arrnd_info<StorageTraits>::extent_type wrapped_offset
-            = static_cast<typename arrnd_info<StorageTraits>::extent_type>(std::abs(offset)) % std::size(info.dims());
+using details::simple_vector_traits;
+using details::simple_array_traits;
+using details::simple_small_vector_traits;
+using details::simple_aligned_vector_traits;
+using details::simple_arena_vector_traits;
+using details::simple_pool_vector_traits;
+#ifdef OC_ARRND_HAS_MMAP
+using details::simple_mapped_vector_traits;
+using details::simple_huge_page_vector_traits;
+#endif // OC_ARRND_HAS_MMAP
+}
 
-        if (offset > 0) {
-            std::rotate(std::rbegin(dims), std::next(std::rbegin(dims), wrapped_offset), std::rend(dims));
-            std::rotate(std::rbegin(strides), std::next(std::rbegin(strides), wrapped_offset), std::rend(strides));
-        } else {
-            std::rotate(std::begin(dims), std::next(std::begin(dims), wrapped_offset), std::end(dims));
-            std::rotate(std::begin(strides), std::next(std::begin(strides), wrapped_offset), std::end(strides));
-        }
+namespace oc::arrnd {
+namespace details {
+    template <typename T1, typename T2>
+    using tol_type = decltype(std::remove_cvref_t<T1>{} - std::remove_cvref_t<T2>{});
 
-        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
+    template <std::integral T>
+    [[nodiscard]] inline constexpr T default_atol() noexcept
+    {
+        return T{0};
     }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type total(
-        const arrnd_info<StorageTraits>& info)
+    template <typename T>
+        requires(std::floating_point<T> || template_type<T, std::complex>)
+    [[nodiscard]] inline constexpr T default_atol() noexcept
     {
-        if (empty(info)) {
-            return 0;
-        }
-
-        return std::reduce(std::begin(info.dims()), std::end(info.dims()),
-            typename arrnd_info<StorageTraits>::extent_type{1},
-            overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
+        return T{1e-8};
     }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type size(
-        const arrnd_info<StorageTraits>& info)
+    template <std::integral T>
+    [[nodiscard]] inline constexpr T default_rtol() noexcept
     {
-        return std::size(info.dims());
+        return T{0};
     }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool empty(const arrnd_info<StorageTraits>& info)
-    {
-        return size(info) == 0;
-    }
-
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool iscontinuous(const arrnd_info<StorageTraits>& info)
+    template <typename T>
+        requires(std::floating_point<T> || template_type<T, std::complex>)
+    [[nodiscard]] inline constexpr T default_rtol() noexcept
     {
-        return static_cast<bool>(to_underlying(info.hints() & arrnd_hint::continuous));
+        return T{1e-5};
     }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool issliced(const arrnd_info<StorageTraits>& info)
+    template <typename T1, typename T2>
+        requires((std::is_arithmetic_v<T1> || template_type<T1, std::complex>)
+            && (std::is_arithmetic_v<T2> || template_type<T2, std::complex>))
+    [[nodiscard]] inline constexpr bool close(const T1& a, const T2& b,
+        const tol_type<T1, T2>& atol = default_atol<tol_type<T1, T2>>(),
+        const tol_type<T1, T2>& rtol = default_rtol<tol_type<T1, T2>>()) noexcept
     {
-        return static_cast<bool>(to_underlying(info.hints() & arrnd_hint::sliced));
+        using std::abs;
+        if (a == b) {
+            return true;
+        }
+        const tol_type<T1, T2> reps{rtol * (abs(a) > abs(b) ? abs(a) : abs(b))};
+        return abs(a - b) <= (atol > reps ? atol : reps);
     }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool istransposed(const arrnd_info<StorageTraits>& ai)
+    template <typename T>
+    [[nodiscard]] inline constexpr auto sign(const T& value)
     {
-        return static_cast<bool>(to_underlying(ai.hints() & arrnd_hint::transposed));
+        return (T{0} < value) - (value < T{0});
     }
+}
+}
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool isvector(const arrnd_info<StorageTraits>& info)
-    {
-        return size(info) == 1;
-    }
+namespace oc::arrnd {
+namespace details {
+    // represents right-open interval
+    template <typename T = std::int64_t>
+        requires(std::is_fundamental_v<T>)
+    class interval {
+    public:
+        using size_type = T;
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool ismatrix(const arrnd_info<StorageTraits>& info)
-    {
-        return size(info) == 2;
-    }
+        static constexpr size_type neginf = std::numeric_limits<size_type>::min();
+        static constexpr size_type posinf = std::numeric_limits<size_type>::max();
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool isrow(const arrnd_info<StorageTraits>& info)
-    {
-        return ismatrix(info) && info.dims().front() == 1;
-    }
+        constexpr interval(size_type start, size_type stop, size_type step = 1)
+            : start_(start)
+            , stop_(stop)
+            , step_(step)
+        {
+            if (start > stop || step <= 0) {
+                throw std::invalid_argument("invalid interval");
+            }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool iscolumn(const arrnd_info<StorageTraits>& info)
-    {
-        return ismatrix(info) && info.dims().back() == 1;
-    }
+            if constexpr (std::is_integral_v<size_type> && std::is_signed_v<size_type>) {
+                if (start != neginf && stop != posinf && start < 0 && stop > posinf + start) {
+                    throw std::overflow_error("interval absdiff does not fit size_type");
+                }
+            }
+        }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr bool isscalar(const arrnd_info<StorageTraits>& info)
-    {
-        return total(info) == 1;
-    }
+        constexpr interval() = default; // interval of first element
+        constexpr interval(const interval&) = default;
+        constexpr interval& operator=(const interval&) = default;
+        constexpr interval(interval&&) = default;
+        constexpr interval& operator=(interval&&) = default;
 
-    template <typename StorageTraits, iterator_of_type_integral InputIt>
-    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type sub2ind(
-        const arrnd_info<StorageTraits>& info, InputIt first_sub, InputIt last_sub)
-    {
-        if (std::distance(first_sub, last_sub) <= 0) {
-            throw std::invalid_argument("invalid input iterators distance <= 0");
+        [[nodiscard]] constexpr size_type start() const noexcept
+        {
+            return start_;
         }
 
-        if (std::distance(first_sub, last_sub) > size(info)) {
-            throw std::invalid_argument("bad sub iterators distance > ndi.ndims");
+        [[nodiscard]] constexpr size_type stop() const noexcept
+        {
+            return stop_;
         }
 
-        if (empty(info)) {
-            throw std::invalid_argument("undefined operation for empty arrnd info");
+        [[nodiscard]] constexpr size_type step() const noexcept
+        {
+            return step_;
         }
 
-        if (!std::transform_reduce(first_sub, last_sub,
-                std::next(std::begin(info.dims()), std::size(info.dims()) - std::distance(first_sub, last_sub)), true,
-                std::logical_and<>{}, [](auto sub, auto dim) {
-                    return sub >= 0 && sub < dim;
-                })) {
-            throw std::out_of_range("invalid subs - not suitable for dims");
-        }
+        // conversion from interval<size_type> to interval<U>
+        template <typename U>
+            requires(std::is_fundamental_v<U>)
+        [[nodiscard]] constexpr operator interval<U>() const
+        {
+            if constexpr (std::is_same_v<size_type, U>) {
+                return *this;
+            } else {
+                if (step_ < std::numeric_limits<U>::min() || step_ > std::numeric_limits<U>::max()) {
+                    throw std::overflow_error(
+                        "invalid interval casting - step value is not fit to converted size type");
+                }
 
-        return info.indices_boundary().start()
-            + std::transform_reduce(first_sub, last_sub,
-                std::next(std::begin(info.strides()), std::size(info.strides()) - std::distance(first_sub, last_sub)),
-                typename arrnd_info<StorageTraits>::extent_type{0},
-                overflow_check_plus<typename arrnd_info<StorageTraits>::extent_type>{},
-                overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
-    }
+                if (isunbound(*this)) {
+                    if (!isleftbound(*this) && !isrightbound(*this)) {
+                        return interval<U>::full(step_);
+                    }
 
-    template <typename StorageTraits, iterable_of_type_integral Cont>
-    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type sub2ind(
-        const arrnd_info<StorageTraits>& info, Cont&& subs)
-    {
-        return sub2ind(info, std::begin(subs), std::end(subs));
-    }
+                    if (isleftbound(*this)
+                        && (start_ >= std::numeric_limits<U>::min() || start_ <= std::numeric_limits<U>::max())) {
+                        return interval<U>::from(start_, step_);
+                    }
 
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type sub2ind(
-        const arrnd_info<StorageTraits>& info,
-        std::initializer_list<typename arrnd_info<StorageTraits>::extent_type> subs)
-    {
-        return sub2ind(info, subs.begin(), subs.end());
-    }
+                    if (isrightbound(*this)
+                        && (stop_ >= std::numeric_limits<U>::min() || stop_ <= std::numeric_limits<U>::max())) {
+                        return interval<U>::to(stop_, step_);
+                    }
+                }
 
-    template <typename StorageTraits, iterator_of_type_integral OutputIt>
-    inline constexpr void ind2sub(
-        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type ind, OutputIt d_sub)
-    {
-        if (empty(info)) {
-            throw std::invalid_argument("undefined operation for empty arrnd info");
-        }
+                // conversion of negative values from signed to unsigned is undefined
+                if constexpr (std::is_signed_v<size_type> && std::is_unsigned_v<U>) {
+                    if (start_ < 0 || stop_ < 0) {
+                        throw std::overflow_error(
+                            "invalid interval casting - undifned conversion from negative signed to unsigned");
+                    }
+                }
 
-        if (!isbetween(info.indices_boundary(), ind)) {
-            throw std::out_of_range("invalid ind - not inside indices boundary");
-        }
+                if (start_ < std::numeric_limits<U>::min() || start_ > std::numeric_limits<U>::max()) {
+                    throw std::overflow_error(
+                        "invalid interval casting - start value is not fit to converted size type");
+                }
 
-        for (typename arrnd_info<StorageTraits>::extent_type i = 0; i < std::size(info.dims()); ++i) {
-            *d_sub
-                = (info.dims()[i] > 1 ? ((ind - info.indices_boundary().start()) / info.strides()[i]) % info.dims()[i]
-                                      : 0);
-            ++d_sub;
-        }
-    }
+                if (stop_ < std::numeric_limits<U>::min() || stop_ > std::numeric_limits<U>::max()) {
+                    throw std::overflow_error(
+                        "invalid interval casting - stop value is not fit to converted size type");
+                }
 
-    // convert relative index to abosolute index
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type ind2ind(
-        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type rel_ind)
-    {
-        if (empty(info)) {
-            throw std::invalid_argument("undefined operation for empty arrnd info");
+                return interval<U>(start_, stop_, step_);
+            }
         }
 
-        if (rel_ind >= total(info)) {
-            throw std::out_of_range("invalid ind - not inside indices boundary");
+        [[nodiscard]] static constexpr interval full(size_type step = 1) noexcept
+        {
+            if constexpr (std::is_signed_v<size_type>) {
+                return interval{neginf, posinf, step};
+            } else {
+                return interval{0, posinf, step};
+            }
         }
 
-        if (!issliced(info)) {
-            return rel_ind;
+        [[nodiscard]] static constexpr interval from(size_type start, size_type step = 1) noexcept
+        {
+            return interval{start, posinf, step};
         }
 
-        if (iscontinuous(info)) {
-            return info.indices_boundary().start() + rel_ind;
+        [[nodiscard]] static constexpr interval to(size_type stop, size_type step = 1) noexcept
+        {
+            if constexpr (std::is_signed_v<size_type>) {
+                return interval{neginf, stop, step};
+            } else {
+                return interval{0, stop, step};
+            }
         }
 
-        typename arrnd_info<StorageTraits>::extent_type current_rel_stride
-            = std::reduce(std::next(std::begin(info.dims()), 1), std::end(info.dims()),
-                typename arrnd_info<StorageTraits>::extent_type{1},
-                overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
+        [[nodiscard]] static constexpr interval at(size_type pos) noexcept
+        {
+            return interval{pos, pos + 1, 1};
+        }
 
-        typename arrnd_info<StorageTraits>::extent_type abs_ind = info.indices_boundary().start();
+        [[nodiscard]] static constexpr interval between(size_type start, size_type stop, size_type step = 1) noexcept
+        {
+            return interval{start, stop, step};
+        }
 
-        for (typename arrnd_info<StorageTraits>::extent_type i = 0; i < std::size(info.dims()); ++i) {
-            auto sub = (info.dims()[i] > 1 ? (rel_ind / current_rel_stride) % info.dims()[i] : 0);
-            abs_ind += sub * info.strides()[i];
+    private:
+        size_type start_ = 0;
+        size_type stop_ = 1;
+        size_type step_ = 1;
+    };
 
-            current_rel_stride /= (i + 1 >= std::size(info.dims()) ? 1 : info.dims()[i + 1]);
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool isbound(interval<T> ival) noexcept
+    {
+        if constexpr (std::is_signed_v<T>) {
+            return ival.start() != interval<T>::neginf && ival.stop() != interval<T>::posinf;
+        } else {
+            return ival.stop() != interval<T>::posinf;
         }
-
-        return abs_ind;
     }
 
-    // return arrnd info suitable for reduced dimension at specified axis.
-    // previous strides and hints are being ignored.
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> reduce(
-        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type axis)
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool isleftbound(interval<T> ival) noexcept
     {
-        if (empty(info)) {
-            throw std::invalid_argument("undefined operation for empty arrnd info");
-        }
-
-        if (axis >= std::size(info.dims())) {
-            throw std::out_of_range("invalid axis value");
-        }
-
-        if (std::size(info.dims()) == 1) {
-            return arrnd_info<StorageTraits>({1});
+        if constexpr (std::is_signed_v<T>) {
+            return ival.start() != interval<T>::neginf;
+        } else {
+            return true;
         }
-
-        typename arrnd_info<StorageTraits>::extent_storage_type new_dims(info.dims());
-        new_dims.erase(std::next(std::begin(new_dims), axis));
-        new_dims.shrink_to_fit();
-
-        return arrnd_info<StorageTraits>(new_dims);
     }
 
-    // undo transposed info by rearranging dims accoding to sorted strides.
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> unstranspose(const arrnd_info<StorageTraits>& info)
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool isrightbound(interval<T> ival) noexcept
     {
-        if (empty(info)) {
-            return arrnd_info<StorageTraits>{};
-        }
+        return ival.stop() != interval<T>::posinf;
+    }
 
-        if (!istransposed(info)) {
-            return info;
-        }
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool isunbound(interval<T> ival) noexcept
+    {
+        return !isbound(ival);
+    }
 
-        typename arrnd_info<StorageTraits>::extent_storage_type new_dims(info.dims());
-        typename arrnd_info<StorageTraits>::extent_storage_type new_strides(info.strides());
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool isbetween(interval<T> ival, auto start, auto stop) noexcept
+        requires(std::is_fundamental_v<decltype(start)> and std::is_fundamental_v<decltype(stop)>)
+    {
+        return !empty(ival) && ival.start() >= start && ival.stop() <= stop;
+    }
 
-        auto z = zip(zipped(new_strides), zipped(new_dims));
-        std::sort(std::begin(z), std::end(z), [](auto t1, auto t2) {
-            return std::get<0>(t1) > std::get<0>(t2);
-        });
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool isbetween(interval<T> ival, auto value) noexcept
+        requires(std::is_fundamental_v<decltype(value)>)
+    {
+        return !empty(ival) && value >= ival.start() && value < ival.stop();
+    }
 
-        return arrnd_info<StorageTraits>(
-            new_dims, new_strides, info.indices_boundary(), info.hints() & ~arrnd_hint::transposed);
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr bool empty(interval<T> ival) noexcept
+    {
+        return ival.start() == ival.stop();
     }
 
-    // return simple arrnd info by dims only,
-    // ignoring hints such as sliced.
-    template <typename StorageTraits>
-    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> simplify(const arrnd_info<StorageTraits>& info)
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr T absdiff(interval<T> ival) noexcept
     {
-        if (empty(info)) {
-            return arrnd_info<StorageTraits>{};
+        if (empty(ival)) {
+            return 0;
+        }
+        if (isunbound(ival)) {
+            return interval<T>::posinf;
+        }
+        if constexpr (std::is_signed_v<T>) {
+            return static_cast<T>(std::ceil(static_cast<double>(std::abs(ival.stop() - ival.start())) / ival.step()));
+        } else {
+            return static_cast<T>(std::ceil(static_cast<double>(ival.stop() - ival.start()) / ival.step()));
         }
+    }
 
-        if (info.hints() == arrnd_hint::continuous) {
-            return info;
+    template <typename T>
+        requires(std::is_fundamental_v<T>)
+    [[nodiscard]] inline constexpr interval<T> bound(interval<T> ival, auto start, auto stop)
+        requires(std::is_fundamental_v<decltype(start)> && std::is_fundamental_v<decltype(stop)>)
+    {
+        if constexpr (std::is_signed_v<T>) {
+            return interval<T>{ival.start() == interval<T>::neginf ? start : ival.start(),
+                ival.stop() == interval<T>::posinf ? stop : ival.stop(), ival.step()};
+        } else {
+            return interval<T>{ival.start(), ival.stop() == interval<T>::posinf ? stop : ival.stop(), ival.step()};
         }
+    }
 
-        return arrnd_info<StorageTraits>(info.dims());
+    template <typename T, typename U>
+        requires(std::is_fundamental_v<T> && std::is_fundamental_v<U>)
+    [[nodiscard]] inline constexpr bool operator==(const interval<T>& lhs, const interval<U>& rhs) noexcept
+    {
+        return (empty(lhs) && empty(rhs))
+            || (lhs.start() == rhs.start() && lhs.stop() == rhs.stop() && lhs.step() == rhs.step());
     }
 
-    template <typename StorageTraits>
-    inline constexpr std::ostream& operator<<(std::ostream& os, const arrnd_info<StorageTraits>& info)
+    template <typename T>
+    inline constexpr std::ostream& operator<<(std::ostream& os, const interval<T>& ival)
     {
-        if (empty(info)) {
+        if (empty(ival)) {
             os << "empty";
             return os;
         }
 
-        auto print_vec = [&os](const auto& vec) {
-            os << '[';
-            std::for_each_n(std::cbegin(vec), std::ssize(vec) - 1, [&os](const auto& e) {
-                os << e << ' ';
-            });
-            os << *std::next(std::cbegin(vec), std::ssize(vec) - 1) << ']';
-        };
-
-        os << "total: " << total(info) << '\n';
-        os << "dims: ";
-        print_vec(info.dims());
-        os << '\n';
-        os << "strides: ";
-        print_vec(info.strides());
-        os << '\n';
-        os << "indices_boundary: " << info.indices_boundary() << "\n";
-        os << "hints (transposed|sliced|continuous): "
-           << std::bitset<to_underlying(arrnd_hint::bitscount)>(to_underlying(info.hints())) << "\n";
-        os << "props (vector|matrix|row|column|scalar): " << isvector(info) << ismatrix(info) << isrow(info)
-           << iscolumn(info) << isscalar(info);
-
+        os << "[" << ival.start() << "," << ival.stop() << "," << ival.step() << ")";
         return os;
     }
-
 }
 
-using details::arrnd_iterator_position;
-using details::arrnd_hint;
-using details::to_underlying;
-using details::arrnd_squeeze_type;
-using details::arrnd_info;
-using details::slice;
-using details::squeeze;
-using details::transpose;
-using details::swap;
-using details::move;
-using details::roll;
-using details::sub2ind;
-using details::ind2sub;
-using details::ind2ind;
-using details::total;
-using details::size;
+using details::interval;
+using details::isbound;
+using details::isleftbound;
+using details::isrightbound;
+using details::isunbound;
+using details::isbetween;
 using details::empty;
-using details::iscontinuous;
-using details::issliced;
-using details::istransposed;
-using details::isvector;
-using details::ismatrix;
-using details::isrow;
-using details::iscolumn;
-using details::isscalar;
-using details::reduce;
-using details::unstranspose;
-using details::simplify;
+using details::absdiff;
+using details::bound;
 }
 
+// custom internal general usage concepts and traits
 namespace oc::arrnd {
 namespace details {
-    template <typename ArrndInfo = arrnd_info<>>
-    class arrnd_indexer {
-    public:
-        using info_type = ArrndInfo;
+    template <typename Iter>
+    concept iterator_of_type_integral = iterator_type<Iter> && std::integral<iterator_value_t<Iter>>;
 
-        using index_type = typename info_type::extent_type;
-        using size_type = typename info_type::extent_type;
-        using difference_type = typename info_type::extent_storage_type::difference_type;
+    template <typename Cont>
+    concept iterable_of_type_integral = iterable_type<Cont> && std::integral<iterable_value_t<Cont>>;
 
-        using sub_storage_type = typename info_type::extent_storage_type;
+    template <typename Iter>
+    concept iterator_of_type_interval = iterator_type<Iter> && template_type<iterator_value_t<Iter>, interval>;
 
-        explicit constexpr arrnd_indexer(
-            const info_type& info, arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
-            : info_(info)
-            , subs_(size(info))
-            , pos_(empty(info) ? arrnd_iterator_position::end : start_pos)
+    template <typename Cont>
+    concept iterable_of_type_interval = iterable_type<Cont> && template_type<iterable_value_t<Cont>, interval>;
+
+    template <typename T>
+    struct overflow_check_multiplies {
+        constexpr T operator()(T lhs, T rhs) const
         {
-            if (!empty(info)) {
-                if (start_pos == arrnd_iterator_position::begin || start_pos == arrnd_iterator_position::rend) {
-                    std::fill(std::begin(subs_), std::end(subs_), index_type{0});
-                    curr_abs_ind_ = info.indices_boundary().start();
-                    curr_rel_ind_ = index_type{0};
-                } else {
-                    std::transform(std::begin(info.dims()), std::end(info.dims()), std::begin(subs_), [](auto dim) {
-                        return dim - index_type{1};
-                    });
-                    curr_abs_ind_ = info.indices_boundary().stop() - index_type{1};
-                    curr_rel_ind_ = total(info) - index_type{1};
-                }
-                if (start_pos == arrnd_iterator_position::end) {
-                    curr_rel_ind_ = total(info);
-                } else if (start_pos == arrnd_iterator_position::rend) {
-                    curr_rel_ind_ = index_type{0} - 1;
-                }
+            if (lhs > std::numeric_limits<T>::max() / rhs) {
+                throw std::overflow_error("invalid multiplication");
             }
+            return lhs * rhs;
         }
+    };
 
-        constexpr arrnd_indexer() = default;
-        constexpr arrnd_indexer(const arrnd_indexer&) = default;
-        constexpr arrnd_indexer& operator=(const arrnd_indexer&) = default;
-        constexpr arrnd_indexer(arrnd_indexer&&) noexcept = default;
-        constexpr arrnd_indexer& operator=(arrnd_indexer&&) noexcept = default;
-        constexpr ~arrnd_indexer() = default;
-
-        constexpr arrnd_indexer& operator++() noexcept
+    template <typename T>
+    struct overflow_check_plus {
+        constexpr T operator()(T lhs, T rhs) const
         {
-            if (pos_ == arrnd_iterator_position::end) {
-                return *this;
-            }
-
-            if (pos_ == arrnd_iterator_position::rend) {
-                ++curr_rel_ind_;
-                pos_ = arrnd_iterator_position::begin;
-                return *this;
+            if (lhs > std::numeric_limits<T>::max() - rhs) {
+                throw std::overflow_error("invalid addition");
             }
+            return lhs + rhs;
+        }
+    };
+}
+}
 
-            ++curr_rel_ind_;
+namespace oc::arrnd {
+namespace details {
+    enum class arrnd_iterator_position { none, begin, end, rbegin, rend };
 
-            for (index_type i = size(info_); i > 0; --i) {
-                ++subs_[i - 1];
-                curr_abs_ind_ += info_.strides()[i - 1];
-                if (subs_[i - 1] < info_.dims()[i - 1]) {
-                    return *this;
-                }
-                curr_abs_ind_ -= info_.strides()[i - 1] * subs_[i - 1];
-                subs_[i - 1] = 0;
-            }
+    enum class arrnd_hint : std::size_t {
+        none = 0,
+        continuous = std::size_t{1} << 0,
+        sliced = std::size_t{1} << 1,
+        transposed = std::size_t{1} << 2,
+        bitscount = 3,
+    };
 
-            std::transform(std::begin(info_.dims()), std::end(info_.dims()), std::begin(subs_), [](auto dim) {
-                return dim - index_type{1};
-            });
-            curr_abs_ind_ = info_.indices_boundary().stop() - index_type{1};
-            curr_rel_ind_ = total(info_);
-            pos_ = arrnd_iterator_position::end;
+    [[nodiscard]] inline constexpr arrnd_hint operator|(const arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
+    {
+        return static_cast<arrnd_hint>(static_cast<std::underlying_type_t<arrnd_hint>>(lhs)
+            | static_cast<std::underlying_type_t<arrnd_hint>>(rhs));
+    }
 
-            return *this;
-        }
+    inline constexpr arrnd_hint& operator|=(arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
+    {
+        return (lhs = lhs | rhs);
+    }
 
-        constexpr arrnd_indexer operator++(int) noexcept
-        {
-            arrnd_indexer<info_type> temp{*this};
-            ++(*this);
-            return temp;
-        }
+    [[nodiscard]] inline constexpr arrnd_hint operator&(const arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
+    {
+        return static_cast<arrnd_hint>(static_cast<std::underlying_type_t<arrnd_hint>>(lhs)
+            & static_cast<std::underlying_type_t<arrnd_hint>>(rhs));
+    }
 
-        constexpr arrnd_indexer& operator+=(size_type count) noexcept
-        {
-            for (size_type i = 0; i < count; ++i) {
-                ++(*this);
-            }
-            return *this;
-        }
+    inline constexpr arrnd_hint& operator&=(arrnd_hint& lhs, const arrnd_hint& rhs) noexcept
+    {
+        return (lhs = lhs & rhs);
+    }
 
-        arrnd_indexer operator+(size_type count) const noexcept
-        {
-            arrnd_indexer<info_type> temp{*this};
-            temp += count;
-            return temp;
-        }
+    [[nodiscard]] inline constexpr arrnd_hint operator~(const arrnd_hint& s) noexcept
+    {
+        return static_cast<arrnd_hint>(~static_cast<std::underlying_type_t<arrnd_hint>>(s));
+    }
 
-        constexpr arrnd_indexer& operator--() noexcept
+    [[nodiscard]] inline constexpr auto to_underlying(const arrnd_hint& s) noexcept
+    {
+        return static_cast<std::underlying_type_t<arrnd_hint>>(s);
+    }
+
+    enum class arrnd_squeeze_type {
+        left,
+        right,
+        trim,
+        full,
+    };
+
+    // dims and strides of most arrays fit in inline storage, which saves their allocations
+    template <typename StorageTraits = simple_small_vector_traits<std::size_t>>
+        requires(std::is_same_v<std::size_t, typename StorageTraits::storage_type::value_type>)
+    class arrnd_info {
+    public:
+        using storage_traits_type = StorageTraits;
+
+        using extent_storage_type = typename storage_traits_type::storage_type;
+        using extent_type = typename extent_storage_type::value_type;
+
+        using boundary_type = interval<extent_type>;
+
+        constexpr arrnd_info() = default;
+        constexpr arrnd_info(const arrnd_info&) = default;
+        constexpr arrnd_info& operator=(const arrnd_info&) = default;
+        constexpr arrnd_info(arrnd_info&&) = default;
+        constexpr arrnd_info& operator=(arrnd_info&&) = default;
+
+        template <iterator_of_type_integral InputIt>
+        constexpr arrnd_info(InputIt first_dim, InputIt last_dim)
         {
-            if (pos_ == arrnd_iterator_position::rend) {
-                return *this;
+            if (std::distance(first_dim, last_dim) < 0) {
+                throw std::invalid_argument("invalid input iterators distance < 0");
             }
 
-            if (pos_ == arrnd_iterator_position::end) {
-                --curr_rel_ind_;
-                pos_ = arrnd_iterator_position::rbegin;
-                return *this;
+            if (std::distance(first_dim, last_dim) == 0 || std::any_of(first_dim, last_dim, [](auto dim) {
+                    return dim == 0;
+                })) {
+                return;
             }
 
-            --curr_rel_ind_;
-
-            for (index_type i = size(info_); i > 0; --i) {
-                if (subs_[i - 1] >= 1) {
-                    --subs_[i - 1];
-                    curr_abs_ind_ -= info_.strides()[i - 1];
-                    return *this;
+            if constexpr (std::signed_integral<std::iter_value_t<InputIt>>) {
+                if (std::any_of(first_dim, last_dim, [](auto dim) {
+                        return dim < 0;
+                    })) {
+                    throw std::invalid_argument("invalid dims < 0");
                 }
-                subs_[i - 1] = info_.dims()[i - 1] - index_type{1};
-                curr_abs_ind_ += info_.strides()[i - 1] * subs_[i - 1];
             }
 
-            std::fill(std::begin(subs_), std::end(subs_), index_type{0});
-            curr_abs_ind_ = info_.indices_boundary().start();
-            curr_rel_ind_ = index_type{0} - 1;
-            pos_ = arrnd_iterator_position::rend;
-
-            return *this;
-        }
+            dims_.reserve(std::distance(first_dim, last_dim));
+            dims_.insert(dims_.cend(), first_dim, last_dim);
 
-        constexpr arrnd_indexer operator--(int) noexcept
-        {
-            arrnd_indexer<info_type> temp{*this};
-            --(*this);
-            return temp;
-        }
+            strides_.resize(std::distance(first_dim, last_dim));
+            std::exclusive_scan(dims_.crbegin(), dims_.crend(), strides_.rbegin(), extent_type{1},
+                overflow_check_multiplies<extent_type>{});
 
-        constexpr arrnd_indexer& operator-=(size_type count) noexcept
-        {
-            for (size_type i = 0; i < count; ++i) {
-                --(*this);
+            if (strides_[0] > std::numeric_limits<extent_type>::max() / dims_[0]) {
+                throw std::overflow_error("invalid multiplication");
             }
-            return *this;
-        }
+            indices_boundary_ = boundary_type(extent_type{0}, strides_[0] * dims_[0]);
 
-        constexpr arrnd_indexer operator-(size_type count) const noexcept
-        {
-            arrnd_indexer<info_type> temp{*this};
-            temp -= count;
-            return temp;
+            hints_ = arrnd_hint::continuous;
         }
 
-        [[nodiscard]] explicit constexpr operator bool() const noexcept
-        {
-            return !(pos_ == arrnd_iterator_position::end || pos_ == arrnd_iterator_position::rend);
-        }
+        template <iterable_of_type_integral Cont>
+        explicit constexpr arrnd_info(Cont&& dims)
+            : arrnd_info(std::begin(dims), std::end(dims))
+        { }
 
-        [[nodiscard]] constexpr index_type operator*() const noexcept
-        {
-            return curr_abs_ind_;
-        }
+        explicit constexpr arrnd_info(std::initializer_list<extent_type> dims)
+            : arrnd_info(dims.begin(), dims.end())
+        { }
 
-        [[nodiscard]] constexpr const sub_storage_type& subs() const noexcept
+        // for maximum flexibility, a constructor that sets the class members and check their validity.
+        // this constructor may add hints in addition to the hints argument.
+        template <iterator_of_type_integral InputIt1, iterator_of_type_integral InputIt2>
+        explicit constexpr arrnd_info(InputIt1 first_dim, InputIt1 last_dim, InputIt2 first_stride,
+            InputIt2 last_stride, template_type<interval> auto indices_boundary, arrnd_hint hints)
         {
-            return subs_;
-        }
+            if (std::distance(first_dim, last_dim) < 0) {
+                throw std::invalid_argument("invalid input iterators distance < 0");
+            }
 
-        [[nodiscard]] constexpr arrnd_indexer operator[](index_type index) const noexcept
-        {
-            assert(index >= 0 && index < total(info_));
+            if (std::distance(first_dim, last_dim) != std::distance(first_stride, last_stride)) {
+                throw std::invalid_argument("invalid strides - different number from dimensions");
+            }
 
-            if (index > curr_rel_ind_) {
-                return *this + (index - curr_rel_ind_);
+            if constexpr (std::signed_integral<std::iter_value_t<InputIt1>>) {
+                if (std::any_of(first_dim, last_dim, [](auto dim) {
+                        return dim < 0;
+                    })) {
+                    throw std::invalid_argument("invalid dims < 0");
+                }
             }
 
-            if (index < curr_rel_ind_) {
-                return *this - (curr_rel_ind_ - index);
+            if constexpr (std::signed_integral<std::iter_value_t<InputIt2>>) {
+                if (std::any_of(first_stride, last_stride, [](auto stride) {
+                        return stride < 0;
+                    })) {
+                    throw std::invalid_argument("invalid strides < 0");
+                }
             }
 
-            return *this;
-        }
+            hints_ = arrnd_hint::none;
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_indexer& other) const noexcept
-        {
-            return curr_rel_ind_ + 1 == other.curr_rel_ind_ + 1;
-        }
+            if (std::distance(first_dim, last_dim) == 0) {
+                if (!empty(indices_boundary)) {
+                    throw std::invalid_argument("invalid indices boundary");
+                }
+                hints_ = hints | arrnd_hint::continuous;
+                return;
+            }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_indexer& other) const noexcept
-        {
-            return curr_rel_ind_ + 1 < other.curr_rel_ind_ + 1;
-        }
+            if (std::any_of(first_dim, last_dim, [](auto dim) {
+                    return dim == 0;
+                })) {
+                hints_ = hints | arrnd_hint::continuous;
+                return;
+            }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_indexer& other) const noexcept
-        {
-            return curr_rel_ind_ + 1 <= other.curr_rel_ind_ + 1;
-        }
+            extent_type num_elem
+                = std::reduce(first_dim, last_dim, extent_type{1}, overflow_check_multiplies<extent_type>{});
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_indexer& other) const noexcept
-        {
-            return static_cast<difference_type>(curr_rel_ind_ + 1)
-                - static_cast<difference_type>(other.curr_rel_ind_ + 1);
-        }
+            if (indices_boundary.stop() - indices_boundary.start() != num_elem) {
+                if (to_underlying(hints & arrnd_hint::continuous)) {
+                    throw std::invalid_argument("invalid hint - not continuous according to dims and indices boundary");
+                }
+                hints_ |= arrnd_hint::sliced;
+            } else {
+                hints_ |= arrnd_hint::continuous;
+            }
 
-    private:
-        info_type info_;
+            dims_.reserve(std::distance(first_dim, last_dim));
+            dims_.insert(std::cend(dims_), first_dim, last_dim);
 
-        sub_storage_type subs_;
+            strides_.reserve(std::distance(first_stride, last_stride));
+            strides_.insert(std::cend(strides_), first_stride, last_stride);
 
-        index_type curr_abs_ind_{0};
-        index_type curr_rel_ind_{0};
+            indices_boundary_ = static_cast<boundary_type>(indices_boundary);
 
-        arrnd_iterator_position pos_{arrnd_iterator_position::end};
-    };
+            hints_ |= hints;
+        }
 
-    enum class arrnd_window_type {
-        complete,
-        partial,
-    };
-
-    template <typename Interval>
-        requires(std::signed_integral<typename Interval::size_type>)
-    struct arrnd_window {
-        using interval_type = Interval;
-
-        explicit constexpr arrnd_window(interval_type nival, arrnd_window_type ntype = arrnd_window_type::complete)
-            : ival(nival)
-            , type(ntype)
+        template <iterable_of_type_integral Cont1, iterable_of_type_integral Cont2>
+        explicit constexpr arrnd_info(
+            Cont1&& dims, Cont2&& strides, template_type<interval> auto indices_boundary, arrnd_hint hints)
+            : arrnd_info(
+                std::begin(dims), std::end(dims), std::begin(strides), std::end(strides), indices_boundary, hints)
         { }
 
-        constexpr arrnd_window() = default;
-        constexpr arrnd_window(const arrnd_window&) = default;
-        constexpr arrnd_window& operator=(const arrnd_window&) = default;
-        constexpr arrnd_window(arrnd_window&&) noexcept = default;
-        constexpr arrnd_window& operator=(arrnd_window&&) noexcept = default;
-        constexpr ~arrnd_window() = default;
-
-        interval_type ival;
-        arrnd_window_type type{arrnd_window_type::complete};
-    };
-
-    template <typename ArrndInfo = arrnd_info<>>
-    class arrnd_windows_slider {
-    public:
-        using info_type = ArrndInfo;
-
-        using index_type = typename info_type::extent_type;
-        using size_type = typename info_type::extent_type;
-
-        using boundary_storage_type = typename info_type::storage_traits_type::template replaced_type<
-            typename info_type::boundary_type>::storage_type;
-
-        using window_type = arrnd_window<interval<std::make_signed_t<typename info_type::extent_type>>>;
-
-        template <typename InputIt>
-            requires(template_type<iterator_value_t<InputIt>, arrnd_window>)
-        explicit constexpr arrnd_windows_slider(const info_type& info, InputIt first_window, InputIt last_window,
-            arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
-            : info_(info)
-            , windows_(size(info))
-            , curr_boundaries_(size(info))
-        {
-            if (size(info) < std::distance(first_window, last_window)) {
-                throw std::invalid_argument("invalid window size - bigger than number of dims");
-            }
-
-            if (std::any_of(first_window, last_window, [](auto window) {
-                    return isunbound(window.ival) && (isleftbound(window.ival) || isrightbound(window.ival));
-                })) {
-                throw std::invalid_argument("invalid window interval - half bounded intervals currently not supported");
-            }
-
-            if (!std::transform_reduce(std::begin(info.dims()),
-                    std::next(std::begin(info.dims()), std::distance(first_window, last_window)), first_window, true,
-                    std::logical_and<>{}, [](auto dim, auto window) {
-                        auto ival = window.ival;
-                        auto type = window.type;
-                        return (type == arrnd_window_type::complete
-                                   && (isunbound(ival)
-                                       || (ival.start() <= 0 && ival.stop() >= 0 && absdiff(ival) <= dim)))
-                            || type == arrnd_window_type::partial;
-                    })) {
-                throw std::invalid_argument("invalid window interval");
-            }
-
-            if constexpr (std::is_same_v<std::iter_value_t<InputIt>, typename window_type::interval_type>) {
-                std::copy(first_window, last_window, std::begin(windows_));
-            } else {
-                std::transform(first_window, last_window, std::begin(windows_), [](auto window) {
-                    return window_type(static_cast<typename window_type::interval_type>(window.ival), window.type);
-                });
-            }
-            if (size(info) > std::distance(first_window, last_window)) {
-                std::transform(std::next(std::begin(info.dims()), std::distance(first_window, last_window)),
-                    std::end(info.dims()), std::next(std::begin(windows_), std::distance(first_window, last_window)),
-                    [](auto dim) {
-                        return window_type(typename window_type::interval_type(0, static_cast<size_type>(dim)),
-                            arrnd_window_type::complete);
-                    });
-            }
-
-            typename info_type::extent_storage_type indexer_dims(size(info));
-            std::transform(std::begin(info.dims()), std::end(info.dims()), std::begin(windows_),
-                std::begin(indexer_dims), [](auto dim, auto window) {
-                    auto ival = window.ival;
-                    if (isunbound(window.ival)) {
-                        return index_type{1};
-                    }
-                    return window.type == arrnd_window_type::complete ? dim - absdiff(ival) + 1 : dim;
-                });
-
-            indexer_ = arrnd_indexer(info_type(indexer_dims), start_pos);
-
-            for (size_type i = 0; i < size(info); ++i) {
-                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info.dims()[i]);
-            }
-        }
-
-        template <iterable_type Cont>
-            requires(template_type<iterable_value_t<Cont>, arrnd_window>)
-        explicit constexpr arrnd_windows_slider(
-            const info_type& info, Cont&& windows, arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
-            : arrnd_windows_slider(info, std::begin(windows), std::end(windows), start_pos)
+        explicit constexpr arrnd_info(std::initializer_list<extent_type> dims,
+            std::initializer_list<extent_type> strides, template_type<interval> auto indices_boundary, arrnd_hint hints)
+            : arrnd_info(dims.begin(), dims.end(), strides.begin(), strides.end(), indices_boundary, hints)
         { }
 
-        explicit constexpr arrnd_windows_slider(const info_type& info, std::initializer_list<window_type> windows,
-            arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
-            : arrnd_windows_slider(info, windows.begin(), windows.end(), start_pos)
+        // the constructor tries deducing the hints value according to its parameters
+        template <iterator_of_type_integral InputIt1, iterator_of_type_integral InputIt2>
+        explicit constexpr arrnd_info(InputIt1 first_dim, InputIt1 last_dim, InputIt2 first_stride,
+            InputIt2 last_stride, template_type<interval> auto indices_boundary)
+            : arrnd_info(first_dim, last_dim, first_stride, last_stride, indices_boundary, arrnd_hint::none)
         { }
 
-        explicit constexpr arrnd_windows_slider(const info_type& info, index_type axis,
-            const window_type& window = window_type(typename window_type::interval_type(0, 1)),
-            arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
-        {
-            if (axis >= size(info)) {
-                throw std::out_of_range("invalid axis");
-            }
-
-            typename info_type::storage_traits_type::template replaced_type<window_type>::storage_type windows(
-                size(info));
-
-            std::transform(std::begin(info.dims()), std::end(info.dims()), std::begin(windows), [](auto dim) {
-                return window_type(
-                    typename window_type::interval_type(0, static_cast<size_type>(dim)), arrnd_window_type::complete);
-            });
-
-            windows[axis] = window;
+        template <iterable_of_type_integral Cont1, iterable_of_type_integral Cont2>
+        explicit constexpr arrnd_info(Cont1&& dims, Cont2&& strides, template_type<interval> auto indices_boundary)
+            : arrnd_info(std::begin(dims), std::end(dims), std::begin(strides), std::end(strides), indices_boundary)
+        { }
 
-            *this = arrnd_windows_slider(info, windows, start_pos);
-        }
+        explicit constexpr arrnd_info(std::initializer_list<extent_type> dims,
+            std::initializer_list<extent_type> strides, template_type<interval> auto indices_boundary)
+            : arrnd_info(dims.begin(), dims.end(), strides.begin(), strides.end(), indices_boundary)
+        { }
 
-        constexpr arrnd_windows_slider() = default;
-        constexpr arrnd_windows_slider(const arrnd_windows_slider&) = default;
-        constexpr arrnd_windows_slider& operator=(const arrnd_windows_slider&) = default;
-        constexpr arrnd_windows_slider(arrnd_windows_slider&&) noexcept = default;
-        constexpr arrnd_windows_slider& operator=(arrnd_windows_slider&&) noexcept = default;
-        constexpr ~arrnd_windows_slider() = default;
+        // empty arrnd info with specified hints e.g. an empty slice
+        explicit constexpr arrnd_info(arrnd_hint hints)
+            : hints_(arrnd_hint::continuous | hints)
+        { }
 
-        constexpr arrnd_windows_slider& operator++() noexcept
+        [[nodiscard]] constexpr const extent_storage_type& dims() const noexcept
         {
-            ++indexer_;
-
-            for (size_type i = 0; i < size(info_); ++i) {
-                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info_.dims()[i]);
-            }
-
-            return *this;
+            return dims_;
         }
 
-        constexpr arrnd_windows_slider operator++(int) noexcept
+        [[nodiscard]] constexpr const extent_storage_type& strides() const noexcept
         {
-            arrnd_windows_slider<info_type> temp{*this};
-            ++(*this);
-            return temp;
+            return strides_;
         }
 
-        constexpr arrnd_windows_slider& operator+=(size_type count) noexcept
+        [[nodiscard]] constexpr const boundary_type& indices_boundary() const noexcept
         {
-            for (size_type i = 0; i < count; ++i) {
-                ++(*this);
-            }
-            return *this;
+            return indices_boundary_;
         }
 
-        arrnd_windows_slider operator+(size_type count) const noexcept
+        [[nodiscard]] constexpr arrnd_hint hints() const noexcept
         {
-            arrnd_windows_slider<info_type> temp{*this};
-            temp += count;
-            return temp;
+            return hints_;
         }
 
-        constexpr arrnd_windows_slider& operator--() noexcept
-        {
-            --indexer_;
-
-            for (size_type i = 0; i < size(info_); ++i) {
-                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info_.dims()[i]);
-            }
+    private:
+        extent_storage_type dims_;
+        extent_storage_type strides_;
+        boundary_type indices_boundary_{0, 0};
+        arrnd_hint hints_{arrnd_hint::continuous};
+    };
 
-            return *this;
+    template <typename StorageTraits, iterator_of_type_interval InputIt>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(
+        const arrnd_info<StorageTraits>& info, InputIt first_dim_boundary, InputIt last_dim_boundary)
+    {
+        if (std::distance(first_dim_boundary, last_dim_boundary) < 0) {
+            throw std::invalid_argument("invalid input iterators distance < 0");
         }
 
-        constexpr arrnd_windows_slider operator--(int) noexcept
-        {
-            arrnd_windows_slider<info_type> temp{*this};
-            --(*this);
-            return temp;
+        if (std::size(info.dims()) == 0 && std::distance(first_dim_boundary, last_dim_boundary) == 0) {
+            return arrnd_info<StorageTraits>(info.hints() | arrnd_hint::continuous | arrnd_hint::sliced);
         }
 
-        constexpr arrnd_windows_slider& operator-=(size_type count) noexcept
-        {
-            for (size_type i = 0; i < count; ++i) {
-                --(*this);
-            }
-            return *this;
+        if (std::size(info.dims()) < std::distance(first_dim_boundary, last_dim_boundary)) {
+            throw std::invalid_argument("invalid dim boundaries - different number from dims");
         }
 
-        constexpr arrnd_windows_slider operator-(size_type count) const noexcept
-        {
-            arrnd_windows_slider<info_type> temp{*this};
-            temp -= count;
-            return temp;
+        // input boundries might not be of the same type
+        typename arrnd_info<StorageTraits>::storage_traits_type::template replaced_type<
+            typename arrnd_info<StorageTraits>::boundary_type>::storage_type
+            bounded_dim_boundaries(std::distance(first_dim_boundary, last_dim_boundary));
+
+        std::transform(first_dim_boundary, last_dim_boundary, std::begin(info.dims()),
+            std::begin(bounded_dim_boundaries), [](auto boundary, auto dim) {
+                return bound(static_cast<typename arrnd_info<StorageTraits>::boundary_type>(boundary), 0, dim);
+            });
+
+        if (!std::transform_reduce(std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries),
+                std::begin(info.dims()), true, std::logical_and<>{}, [](auto boundary, auto dim) {
+                    return empty(boundary) || isbetween(boundary, 0, dim);
+                })) {
+            throw std::out_of_range("invalid dim boundaries - not suitable for dims");
         }
 
-        [[nodiscard]] explicit constexpr operator bool() const noexcept
-        {
-            return static_cast<bool>(indexer_);
+        typename arrnd_info<StorageTraits>::extent_storage_type dims = info.dims();
+        std::transform(
+            std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries), std::begin(dims), [](auto boundary) {
+                return absdiff(boundary);
+            });
+
+        if (std::any_of(std::begin(dims), std::end(dims), [](auto dim) {
+                return dim == 0;
+            })) {
+            return arrnd_info<StorageTraits>(info.hints() | arrnd_hint::continuous | arrnd_hint::sliced);
         }
 
-        [[nodiscard]] constexpr const boundary_storage_type& operator*() const noexcept
-        {
-            return curr_boundaries_;
+        if (std::equal(std::begin(dims), std::end(dims), std::begin(info.dims()), std::end(info.dims()))) {
+            return info;
         }
 
-        [[nodiscard]] constexpr arrnd_windows_slider operator[](index_type index) const noexcept
-        {
-            auto subs = indexer_[index].subs();
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(
+            std::begin(info.strides()), std::end(info.strides()));
 
-            arrnd_windows_slider<info_type> temp{*this};
+        std::transform(std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries), std::begin(info.strides()),
+            std::begin(strides), [](auto boundary, auto stride) {
+                if (boundary.step()
+                    > std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max() / stride) {
+                    throw std::overflow_error("invalid multiplication");
+                }
+                return boundary.step() * stride;
+            });
 
-            for (size_type i = 0; i < size(info_); ++i) {
-                temp.curr_boundaries_[i] = window2boundary(windows_[i], subs[i], info_.dims()[i]);
-            }
+        typename arrnd_info<StorageTraits>::extent_type offset = info.indices_boundary().start()
+            + std::transform_reduce(std::begin(bounded_dim_boundaries), std::end(bounded_dim_boundaries),
+                std::begin(info.strides()), typename arrnd_info<StorageTraits>::extent_type{0},
+                overflow_check_plus<typename arrnd_info<StorageTraits>::extent_type>{}, [](auto boundary, auto stride) {
+                    if (boundary.start()
+                        > std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max() / stride) {
+                        throw std::overflow_error("invalid multiplication");
+                    }
+                    return boundary.start() * stride;
+                });
 
-            return temp;
+        typename arrnd_info<StorageTraits>::extent_type max_index = std::transform_reduce(std::begin(dims),
+            std::end(dims), std::begin(strides), typename arrnd_info<StorageTraits>::extent_type{0},
+            overflow_check_plus<typename arrnd_info<StorageTraits>::extent_type>{}, [](auto dim, auto stride) {
+                if (dim - 1 > std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max() / stride) {
+                    throw std::overflow_error("invalid multiplication");
+                }
+                return (dim - 1) * stride;
+            });
+
+        typename arrnd_info<StorageTraits>::boundary_type indices_boundary(offset, offset + max_index + 1);
+
+        typename arrnd_info<StorageTraits>::extent_type num_elem
+            = std::reduce(std::begin(dims), std::end(dims), typename arrnd_info<StorageTraits>::extent_type{1},
+                overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
+
+        arrnd_hint hints = info.hints() | arrnd_hint::sliced;
+        if (max_index + 1 == num_elem) {
+            hints |= arrnd_hint::continuous;
+        } else {
+            hints &= ~arrnd_hint::continuous;
         }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_windows_slider& other) const noexcept
-        {
-            return indexer_ == other.indexer_;
+        return arrnd_info<StorageTraits>(dims, strides, indices_boundary, hints);
+    }
+
+    template <typename StorageTraits, iterable_of_type_interval Cont>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(
+        const arrnd_info<StorageTraits>& info, Cont&& dim_boundaries)
+    {
+        return slice(info, std::begin(dim_boundaries), std::end(dim_boundaries));
+    }
+
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(const arrnd_info<StorageTraits>& info,
+        std::initializer_list<typename arrnd_info<StorageTraits>::boundary_type> dim_boundaries)
+    {
+        return slice(info, dim_boundaries.begin(), dim_boundaries.end());
+    }
+
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> slice(const arrnd_info<StorageTraits>& info,
+        template_type<interval> auto dim_boundary, typename arrnd_info<StorageTraits>::extent_type axis)
+    {
+        if (std::size(info.dims()) == 0) {
+            throw std::invalid_argument("invalid arrnd info");
         }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_windows_slider& other) const noexcept
-        {
-            return indexer_ < other.indexer_;
+        if (axis >= std::size(info.dims())) {
+            throw std::out_of_range("invalid axis");
         }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_windows_slider& other) const noexcept
-        {
-            return indexer_ <= other.indexer_;
+        typename arrnd_info<StorageTraits>::storage_traits_type::template replaced_type<
+            typename arrnd_info<StorageTraits>::boundary_type>::storage_type dim_boundaries(std::size(info.dims()),
+            arrnd_info<StorageTraits>::boundary_type::full());
+
+        dim_boundaries[axis] = static_cast<typename arrnd_info<StorageTraits>::boundary_type>(dim_boundary);
+
+        return slice(info, dim_boundaries);
+    }
+
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> squeeze(const arrnd_info<StorageTraits>& info,
+        arrnd_squeeze_type squeeze_type,
+        typename arrnd_info<StorageTraits>::extent_type max_count
+        = std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max())
+    {
+        if (squeeze_type == arrnd_squeeze_type::full
+            && max_count != std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max()) {
+            throw std::invalid_argument("invalid squeeze type - no max count support for full squeeze type");
         }
 
-        [[nodiscard]] constexpr auto operator-(const arrnd_windows_slider& other) const noexcept
-        {
-            return indexer_ - other.indexer_;
+        if (size(info) == 0) {
+            if (max_count != std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max()
+                && max_count != 0) {
+                throw std::invalid_argument("invalid squeeze - empty squeeze support for max count > 0");
+            }
+            return info;
         }
 
-        // not so safe function, and should be used with consideration of the internal indexer.
-        constexpr void modify_window(index_type axis, window_type window)
-        {
-            if (axis >= size(info_)) {
-                throw std::out_of_range("invalid axis");
+        if (size(info) == 1) {
+            if (max_count != std::numeric_limits<typename arrnd_info<StorageTraits>::extent_type>::max()
+                && max_count > 1) {
+                throw std::invalid_argument("invalid squeeze - no 1d squeeze support for max count > 1");
             }
 
-            const auto& ival = window.ival;
+            // max_count is valid - no squeeze in case of 1d
+            return info;
+        }
 
-            if (isunbound(ival) && (isleftbound(ival) || isrightbound(ival))) {
-                throw std::invalid_argument("invalid window interval - half bounded intervals currently not supported");
-            }
+        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
 
-            if (!(isunbound(ival) || (ival.start() <= 0 && ival.stop() >= 0 && absdiff(ival) <= info_.dims()[axis]))) {
-                throw std::invalid_argument("invalid window interval");
+        if (squeeze_type == arrnd_squeeze_type::left || squeeze_type == arrnd_squeeze_type::trim) {
+            typename arrnd_info<StorageTraits>::extent_type left_ones_count = 0;
+            auto dims_it = std::begin(dims);
+            while (*dims_it == 1 && left_ones_count < max_count) {
+                ++dims_it;
+                ++left_ones_count;
             }
+            if (left_ones_count > 0) {
+                dims.erase(std::begin(dims), std::next(std::begin(dims), left_ones_count));
+                dims.shrink_to_fit();
 
-            windows_[axis] = window;
-
-            curr_boundaries_[axis] = window2boundary(windows_[axis], indexer_.subs()[axis], info_.dims()[axis]);
+                strides.erase(std::begin(strides), std::next(std::begin(strides), left_ones_count));
+                strides.shrink_to_fit();
+            }
         }
 
-    private:
-        [[nodiscard]] typename info_type::boundary_type window2boundary(
-            window_type window, index_type sub, size_type dim) const
-        {
-            const auto& ival = window.ival;
-            auto type = window.type;
-
-            if (isunbound(ival)) {
-                // unsupported half bound intervals checked in class constructor.
-                return typename info_type::boundary_type(
-                    0, static_cast<index_type>(dim), static_cast<index_type>(ival.step()));
+        if (squeeze_type == arrnd_squeeze_type::right || squeeze_type == arrnd_squeeze_type::trim) {
+            typename arrnd_info<StorageTraits>::extent_type right_ones_count = 0;
+            auto dims_it = std::rbegin(dims);
+            while (*dims_it == 1 && right_ones_count < max_count) {
+                ++dims_it;
+                ++right_ones_count;
             }
+            if (right_ones_count > 0) {
+                dims.erase(std::next(std::begin(dims), std::size(dims) - right_ones_count), std::end(dims));
+                dims.shrink_to_fit();
 
-            if (type == arrnd_window_type::complete) {
-                return typename info_type::boundary_type(
-                    sub, sub + static_cast<index_type>(absdiff(ival)), static_cast<index_type>(ival.step()));
+                strides.erase(std::next(std::begin(strides), std::size(strides) - right_ones_count), std::end(strides));
+                strides.shrink_to_fit();
             }
+        }
 
-            auto before = static_cast<index_type>(std::abs(ival.start()));
-            auto nstart = (sub < before ? 0 : sub - before);
+        if (squeeze_type == arrnd_squeeze_type::full) {
+            if (std::any_of(std::begin(dims), std::end(dims), [](auto dim) {
+                    return dim == 1;
+                })) {
+                typename arrnd_info<StorageTraits>::extent_type not_one_index = 0;
+                for (typename arrnd_info<StorageTraits>::extent_type i = 0; i < std::size(dims); ++i) {
+                    if (dims[i] != 1) {
+                        dims[not_one_index] = dims[i];
+                        strides[not_one_index] = strides[i];
+                        ++not_one_index;
+                    }
+                }
 
-            auto after = static_cast<index_type>(ival.stop());
-            auto nstop = (sub + after > dim ? dim : sub + after);
+                dims.resize(not_one_index);
+                dims.shrink_to_fit();
 
-            return typename info_type::boundary_type(nstart, nstop, static_cast<index_type>(ival.step()));
+                strides.resize(not_one_index);
+                strides.shrink_to_fit();
+            }
         }
 
-        info_type info_;
+        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints());
+    }
 
-        typename info_type::storage_traits_type::template replaced_type<window_type>::storage_type windows_;
-        arrnd_indexer<info_type> indexer_;
+    template <typename StorageTraits, iterator_of_type_integral InputIt>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> transpose(
+        const arrnd_info<StorageTraits>& info, InputIt first_axis, InputIt last_axis)
+    {
+        if (std::distance(first_axis, last_axis) != std::size(info.dims())) {
+            throw std::invalid_argument("invalid input iterators distance != number of dims");
+        }
 
-        boundary_storage_type curr_boundaries_;
-    };
-}
+        if (empty(info)) {
+            return info;
+        }
 
-using details::arrnd_indexer;
-using details::arrnd_window_type;
-using details::arrnd_window;
-using details::arrnd_windows_slider;
-}
+        if (std::size(info.dims()) == 0) {
+            if (*first_axis != 0) {
+                throw std::out_of_range("invalid axis value");
+            }
+            return info;
+        }
 
-// arrnd iterator types
-namespace oc::arrnd {
-namespace details {
-    struct arrnd_returned_element_iterator_tag { };
-    struct arrnd_returned_slice_iterator_tag { };
+        if (std::any_of(first_axis, last_axis, [&info](std::size_t axis) {
+                return axis < 0 || axis >= std::size(info.dims());
+            })) {
+            throw std::out_of_range("invalid axis value");
+        }
 
-    template <typename Arrnd>
-    class arrnd_const_iterator;
+        auto is_unique_axes = [](InputIt first, InputIt last) {
+            typename arrnd_info<StorageTraits>::extent_storage_type sorted_axes(first, last);
+            std::sort(std::begin(sorted_axes), std::end(sorted_axes));
+            return std::adjacent_find(std::begin(sorted_axes), std::end(sorted_axes)) == std::end(sorted_axes);
+        };
 
-    template <typename Arrnd>
-    class arrnd_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = typename Arrnd::value_type;
-        using pointer = typename Arrnd::value_type*;
-        using reference = typename Arrnd::value_type&;
+        if (!is_unique_axes(first_axis, last_axis)) {
+            throw std::invalid_argument("not unique axes");
+        }
 
-        using indexer_type = typename Arrnd::indexer_type;
+        if (std::is_sorted(first_axis, last_axis)) {
+            return info;
+        }
 
-        friend class arrnd_const_iterator<Arrnd>;
+        typename arrnd_info<StorageTraits>::extent_storage_type dims(std::size(info.dims()));
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(std::size(info.strides()));
 
-        explicit constexpr arrnd_iterator(pointer data, const indexer_type& indexer)
-            : indexer_(indexer)
-            , data_(data)
-        { }
-
-        constexpr arrnd_iterator() = default;
+        typename arrnd_info<StorageTraits>::extent_type i = 0;
+        for (auto axes_it = first_axis; axes_it != last_axis; ++axes_it, ++i) {
+            dims[i] = info.dims()[*axes_it];
+            strides[i] = info.strides()[*axes_it];
+        }
 
-        constexpr arrnd_iterator(const arrnd_iterator& other) = default;
-        constexpr arrnd_iterator& operator=(const arrnd_iterator& other) = default;
+        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
+    }
 
-        constexpr arrnd_iterator(arrnd_iterator&& other) noexcept = default;
-        constexpr arrnd_iterator& operator=(arrnd_iterator&& other) noexcept = default;
+    template <typename StorageTraits, iterable_of_type_integral Cont>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> transpose(
+        const arrnd_info<StorageTraits>& info, Cont&& axes)
+    {
+        return transpose(info, std::begin(axes), std::end(axes));
+    }
 
-        constexpr ~arrnd_iterator() = default;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> transpose(const arrnd_info<StorageTraits>& info,
+        std::initializer_list<typename arrnd_info<StorageTraits>::extent_type> axes)
+    {
+        return transpose(info, axes.begin(), axes.end());
+    }
 
-        constexpr arrnd_iterator& operator++() noexcept
-        {
-            ++indexer_;
-            return *this;
-        }
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> swap(const arrnd_info<StorageTraits>& info,
+        typename arrnd_info<StorageTraits>::extent_type first_axis = 0,
+        typename arrnd_info<StorageTraits>::extent_type second_axis = 1)
+    {
 
-        constexpr arrnd_iterator operator++(int) noexcept
-        {
-            arrnd_iterator temp{*this};
-            ++(*this);
-            return temp;
+        if (first_axis >= std::size(info.dims()) || second_axis >= std::size(info.dims())) {
+            throw std::out_of_range("invalid axis value");
         }
 
-        constexpr arrnd_iterator& operator+=(difference_type count) noexcept
-        {
-            indexer_ += count;
-            return *this;
+        if (first_axis == second_axis) {
+            return info;
         }
 
-        constexpr arrnd_iterator operator+(difference_type count) const noexcept
-        {
-            arrnd_iterator temp{*this};
-            temp += count;
-            return temp;
-        }
+        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
 
-        constexpr arrnd_iterator& operator--() noexcept
-        {
-            --indexer_;
-            return *this;
-        }
+        std::swap(dims[first_axis], dims[second_axis]);
+        std::swap(strides[first_axis], strides[second_axis]);
 
-        constexpr arrnd_iterator operator--(int) noexcept
-        {
-            arrnd_iterator temp{*this};
-            --(*this);
-            return temp;
-        }
+        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
+    }
 
-        constexpr arrnd_iterator& operator-=(difference_type count) noexcept
-        {
-            indexer_ -= count;
-            return *this;
-        }
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> move(const arrnd_info<StorageTraits>& info,
+        typename arrnd_info<StorageTraits>::extent_type src_axis = 0,
+        typename arrnd_info<StorageTraits>::extent_type dst_axis = 1)
+    {
 
-        constexpr arrnd_iterator operator-(difference_type count) const noexcept
-        {
-            arrnd_iterator temp{*this};
-            temp -= count;
-            return temp;
+        if (src_axis >= std::size(info.dims()) || dst_axis >= std::size(info.dims())) {
+            throw std::out_of_range("invalid axis value");
         }
 
-        [[nodiscard]] constexpr reference operator*() const noexcept
-        {
-            return data_[*indexer_];
+        if (src_axis == dst_axis) {
+            return info;
         }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_iterator& iter) const noexcept
-        {
-            return indexer_ == iter.indexer_;
-        }
+        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_iterator& iter) const noexcept
-        {
-            return indexer_ < iter.indexer_;
-        }
+        auto src_dim = dims[src_axis];
+        dims.erase(std::next(std::begin(dims), src_axis));
+        dims.insert(std::next(std::begin(dims), dst_axis), 1, src_dim);
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_iterator& iter) const noexcept
-        {
-            return indexer_ <= iter.indexer_;
-        }
+        auto src_stride = strides[src_axis];
+        strides.erase(std::next(std::begin(strides), src_axis));
+        strides.insert(std::next(std::begin(strides), dst_axis), 1, src_stride);
 
-        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
-        {
-            return data_[indexer_[index]];
-        }
+        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
+    }
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_iterator& other) const noexcept
-        {
-            return indexer_ - other.indexer_;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> roll(const arrnd_info<StorageTraits>& info, int offset = 1)
+    {
+        if (empty(info) || std::size(info.dims()) == 1 || offset == 0) {
+            return info;
         }
 
-    private:
-        indexer_type indexer_;
-        pointer data_ = nullptr;
-    };
-
-    template <typename Arrnd>
-    class arrnd_const_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = typename Arrnd::value_type;
-        using pointer = typename Arrnd::value_type*;
-        using reference = typename Arrnd::value_type&;
-
-        using indexer_type = typename Arrnd::indexer_type;
+        typename arrnd_info<StorageTraits>::extent_storage_type dims(info.dims());
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(info.strides());
 
-        explicit constexpr arrnd_const_iterator(pointer data, const indexer_type& indexer)
-            : indexer_(indexer)
-            , data_(data)
-        { }
+        typename arrnd_info<StorageTraits>::extent_type wrapped_offset
+            = static_cast<typename arrnd_info<StorageTraits>::extent_type>(std::abs(offset)) % std::size(info.dims());
 
-        constexpr arrnd_const_iterator() = default;
+        if (offset > 0) {
+            std::rotate(std::rbegin(dims), std::next(std::rbegin(dims), wrapped_offset), std::rend(dims));
+            std::rotate(std::rbegin(strides), std::next(std::rbegin(strides), wrapped_offset), std::rend(strides));
+        } else {
+            std::rotate(std::begin(dims), std::next(std::begin(dims), wrapped_offset), std::end(dims));
+            std::rotate(std::begin(strides), std::next(std::begin(strides), wrapped_offset), std::end(strides));
+        }
 
-        constexpr arrnd_const_iterator(const arrnd_const_iterator& other) = default;
-        constexpr arrnd_const_iterator& operator=(const arrnd_const_iterator& other) = default;
+        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() | arrnd_hint::transposed);
+    }
 
-        constexpr arrnd_const_iterator(arrnd_const_iterator&& other) noexcept = default;
-        constexpr arrnd_const_iterator& operator=(arrnd_const_iterator&& other) noexcept = default;
+    // dims are broadcastable according to numpy rules - compared from the last dim, each pair of dims
+    // should be equal or one of them should be 1 (missing dims are considered as 1).
+    template <typename StorageTraits1, typename StorageTraits2>
+    [[nodiscard]] inline constexpr bool isbroadcastable(
+        const arrnd_info<StorageTraits1>& lhs, const arrnd_info<StorageTraits2>& rhs)
+    {
+        if (std::empty(lhs.dims()) || std::empty(rhs.dims())) {
+            return false;
+        }
 
-        constexpr ~arrnd_const_iterator() = default;
+        auto lsize = std::size(lhs.dims());
+        auto rsize = std::size(rhs.dims());
 
-        constexpr arrnd_const_iterator(const arrnd_iterator<Arrnd>& other)
-            : indexer_(other.indexer_)
-            , data_(other.data_)
-        { }
-        constexpr arrnd_const_iterator& operator=(const arrnd_iterator<Arrnd>& other)
-        {
-            indexer_ = other.indexer_;
-            data_ = other.data_;
-            return *this;
+        for (std::size_t i = 1; i <= std::min(lsize, rsize); ++i) {
+            auto ldim = lhs.dims()[lsize - i];
+            auto rdim = rhs.dims()[rsize - i];
+            if (ldim != rdim && ldim != 1 && rdim != 1) {
+                return false;
+            }
         }
 
-        constexpr arrnd_const_iterator(arrnd_iterator<Arrnd>&& other)
-            : indexer_(std::move(other.indexer_))
-            , data_(std::move(other.data_))
-        { }
-        constexpr arrnd_const_iterator& operator=(arrnd_iterator<Arrnd>&& other)
-        {
-            indexer_ = std::move(other.indexer_);
-            data_ = std::move(other.data_);
-            return *this;
-        }
+        return true;
+    }
 
-        constexpr arrnd_const_iterator& operator++() noexcept
-        {
-            ++indexer_;
-            return *this;
+    template <typename StorageTraits1, typename StorageTraits2>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits1>::extent_storage_type broadcast_dims(
+        const arrnd_info<StorageTraits1>& lhs, const arrnd_info<StorageTraits2>& rhs)
+    {
+        if (!isbroadcastable(lhs, rhs)) {
+            throw std::invalid_argument("invalid dims - not broadcastable");
         }
 
-        constexpr arrnd_const_iterator operator++(int) noexcept
-        {
-            arrnd_const_iterator temp{*this};
-            ++(*this);
-            return temp;
-        }
+        auto lsize = std::size(lhs.dims());
+        auto rsize = std::size(rhs.dims());
 
-        constexpr arrnd_const_iterator& operator+=(difference_type count) noexcept
-        {
-            indexer_ += count;
-            return *this;
-        }
+        typename arrnd_info<StorageTraits1>::extent_storage_type dims(std::max(lsize, rsize));
 
-        constexpr arrnd_const_iterator operator+(difference_type count) const noexcept
-        {
-            arrnd_const_iterator temp{*this};
-            temp += count;
-            return temp;
+        for (std::size_t i = 1; i <= std::size(dims); ++i) {
+            auto ldim = i <= lsize ? lhs.dims()[lsize - i] : 1;
+            auto rdim = i <= rsize ? rhs.dims()[rsize - i] : 1;
+            dims[std::size(dims) - i] = ldim == 1 ? rdim : ldim;
         }
 
-        constexpr arrnd_const_iterator& operator--() noexcept
-        {
-            --indexer_;
-            return *this;
-        }
+        return dims;
+    }
 
-        constexpr arrnd_const_iterator operator--(int) noexcept
-        {
-            arrnd_const_iterator temp{*this};
-            --(*this);
-            return temp;
+    // a view of info with the broadcasted dims - its broadcasted dims have zero strides,
+    // i.e. their elements are not copied.
+    template <typename StorageTraits, iterable_of_type_integral Cont>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> broadcast(
+        const arrnd_info<StorageTraits>& info, const Cont& dims)
+    {
+        if (empty(info) || std::size(dims) < std::size(info.dims())) {
+            throw std::invalid_argument("invalid dims - not broadcastable");
         }
 
-        constexpr arrnd_const_iterator& operator-=(difference_type count) noexcept
-        {
-            indexer_ -= count;
-            return *this;
-        }
+        typename arrnd_info<StorageTraits>::extent_storage_type strides(std::size(dims));
 
-        constexpr arrnd_const_iterator operator-(difference_type count) const noexcept
-        {
-            arrnd_const_iterator temp{*this};
-            temp -= count;
-            return temp;
+        auto offset = std::size(dims) - std::size(info.dims());
+        for (std::size_t i = 0; i < std::size(dims); ++i) {
+            auto dim = static_cast<typename arrnd_info<StorageTraits>::extent_type>(*std::next(std::begin(dims), i));
+            if (i < offset || (info.dims()[i - offset] == 1 && dim != 1)) {
+                strides[i] = 0;
+                continue;
+            }
+            if (info.dims()[i - offset] != dim) {
+                throw std::invalid_argument("invalid dims - not broadcastable");
+            }
+            strides[i] = info.strides()[i - offset];
         }
 
-        [[nodiscard]] constexpr const reference operator*() const noexcept
-        {
-            return data_[*indexer_];
-        }
+        return arrnd_info<StorageTraits>(dims, strides, info.indices_boundary(), info.hints() & ~arrnd_hint::continuous);
+    }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_const_iterator& iter) const noexcept
-        {
-            return indexer_ == iter.indexer_;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type total(
+        const arrnd_info<StorageTraits>& info)
+    {
+        if (empty(info)) {
+            return 0;
         }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_const_iterator& iter) const noexcept
-        {
-            return indexer_ < iter.indexer_;
-        }
-
-        [[nodiscard]] constexpr bool operator<=(const arrnd_const_iterator& iter) const noexcept
-        {
-            return indexer_ <= iter.indexer_;
-        }
-
-        [[nodiscard]] constexpr const reference operator[](difference_type index) const noexcept
-        {
-            return data_[indexer_[index]];
-        }
-
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_const_iterator& other) const noexcept
-        {
-            return indexer_ - other.indexer_;
-        }
+        return std::reduce(std::begin(info.dims()), std::end(info.dims()),
+            typename arrnd_info<StorageTraits>::extent_type{1},
+            overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
+    }
 
-    private:
-        indexer_type indexer_;
-        pointer data_ = nullptr;
-    };
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type size(
+        const arrnd_info<StorageTraits>& info)
+    {
+        return std::size(info.dims());
+    }
 
-    template <typename Arrnd>
-    class arrnd_const_reverse_iterator;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool empty(const arrnd_info<StorageTraits>& info)
+    {
+        return size(info) == 0;
+    }
 
-    template <typename Arrnd>
-    class arrnd_reverse_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = typename Arrnd::value_type;
-        using pointer = typename Arrnd::value_type*;
-        using reference = typename Arrnd::value_type&;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool iscontinuous(const arrnd_info<StorageTraits>& info)
+    {
+        return static_cast<bool>(to_underlying(info.hints() & arrnd_hint::continuous));
+    }
 
-        using indexer_type = typename Arrnd::indexer_type;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool issliced(const arrnd_info<StorageTraits>& info)
+    {
+        return static_cast<bool>(to_underlying(info.hints() & arrnd_hint::sliced));
+    }
 
-        friend arrnd_const_reverse_iterator<Arrnd>;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool istransposed(const arrnd_info<StorageTraits>& ai)
+    {
+        return static_cast<bool>(to_underlying(ai.hints() & arrnd_hint::transposed));
+    }
 
-        explicit constexpr arrnd_reverse_iterator(pointer data, const indexer_type& indexer)
-            : indexer_(indexer)
-            , data_(data)
-        { }
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool isvector(const arrnd_info<StorageTraits>& info)
+    {
+        return size(info) == 1;
+    }
 
-        constexpr arrnd_reverse_iterator() = default;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool ismatrix(const arrnd_info<StorageTraits>& info)
+    {
+        return size(info) == 2;
+    }
 
-        constexpr arrnd_reverse_iterator(const arrnd_reverse_iterator& other) = default;
-        constexpr arrnd_reverse_iterator& operator=(const arrnd_reverse_iterator& other) = default;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool isrow(const arrnd_info<StorageTraits>& info)
+    {
+        return ismatrix(info) && info.dims().front() == 1;
+    }
 
-        constexpr arrnd_reverse_iterator(arrnd_reverse_iterator&& other) noexcept = default;
-        constexpr arrnd_reverse_iterator& operator=(arrnd_reverse_iterator&& other) noexcept = default;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool iscolumn(const arrnd_info<StorageTraits>& info)
+    {
+        return ismatrix(info) && info.dims().back() == 1;
+    }
 
-        constexpr ~arrnd_reverse_iterator() = default;
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr bool isscalar(const arrnd_info<StorageTraits>& info)
+    {
+        return total(info) == 1;
+    }
 
-        constexpr arrnd_reverse_iterator& operator++() noexcept
-        {
-            --indexer_;
-            return *this;
+    template <typename StorageTraits, iterator_of_type_integral InputIt>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type sub2ind(
+        const arrnd_info<StorageTraits>& info, InputIt first_sub, InputIt last_sub)
+    {
+        if (std::distance(first_sub, last_sub) <= 0) {
+            throw std::invalid_argument("invalid input iterators distance <= 0");
         }
 
-        constexpr arrnd_reverse_iterator operator++(int) noexcept
-        {
-            arrnd_reverse_iterator temp{*this};
-            --(*this);
-            return temp;
+        if (std::distance(first_sub, last_sub) > size(info)) {
+            throw std::invalid_argument("bad sub iterators distance > ndi.ndims");
         }
 
-        constexpr arrnd_reverse_iterator& operator+=(difference_type count) noexcept
-        {
-            indexer_ -= count;
-            return *this;
+        if (empty(info)) {
+            throw std::invalid_argument("undefined operation for empty arrnd info");
         }
 
-        constexpr arrnd_reverse_iterator operator+(difference_type count) const noexcept
-        {
-            arrnd_reverse_iterator temp{*this};
-            temp += count;
-            return temp;
+        if (!std::transform_reduce(first_sub, last_sub,
+                std::next(std::begin(info.dims()), std::size(info.dims()) - std::distance(first_sub, last_sub)), true,
+                std::logical_and<>{}, [](auto sub, auto dim) {
+                    return sub >= 0 && sub < dim;
+                })) {
+            throw std::out_of_range("invalid subs - not suitable for dims");
         }
 
-        constexpr arrnd_reverse_iterator& operator--() noexcept
-        {
-            ++indexer_;
-            return *this;
-        }
+        return info.indices_boundary().start()
+            + std::transform_reduce(first_sub, last_sub,
+                std::next(std::begin(info.strides()), std::size(info.strides()) - std::distance(first_sub, last_sub)),
+                typename arrnd_info<StorageTraits>::extent_type{0},
+                overflow_check_plus<typename arrnd_info<StorageTraits>::extent_type>{},
+                overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
+    }
 
-        constexpr arrnd_reverse_iterator operator--(int) noexcept
-        {
-            arrnd_reverse_iterator temp{*this};
-            ++(*this);
-            return temp;
-        }
+    template <typename StorageTraits, iterable_of_type_integral Cont>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type sub2ind(
+        const arrnd_info<StorageTraits>& info, Cont&& subs)
+    {
+        return sub2ind(info, std::begin(subs), std::end(subs));
+    }
 
-        constexpr arrnd_reverse_iterator& operator-=(difference_type count) noexcept
-        {
-            indexer_ += count;
-            return *this;
-        }
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type sub2ind(
+        const arrnd_info<StorageTraits>& info,
+        std::initializer_list<typename arrnd_info<StorageTraits>::extent_type> subs)
+    {
+        return sub2ind(info, subs.begin(), subs.end());
+    }
 
-        constexpr arrnd_reverse_iterator operator-(difference_type count) const noexcept
-        {
-            arrnd_reverse_iterator temp{*this};
-            temp -= count;
-            return temp;
+    template <typename StorageTraits, iterator_of_type_integral OutputIt>
+    inline constexpr void ind2sub(
+        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type ind, OutputIt d_sub)
+    {
+        if (empty(info)) {
+            throw std::invalid_argument("undefined operation for empty arrnd info");
         }
 
-        [[nodiscard]] constexpr reference operator*() const noexcept
-        {
-            return data_[*indexer_];
+        if (!isbetween(info.indices_boundary(), ind)) {
+            throw std::out_of_range("invalid ind - not inside indices boundary");
         }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_reverse_iterator& iter) const noexcept
-        {
-            return indexer_ == iter.indexer_;
+        for (typename arrnd_info<StorageTraits>::extent_type i = 0; i < std::size(info.dims()); ++i) {
+            *d_sub
+                = (info.dims()[i] > 1 ? ((ind - info.indices_boundary().start()) / info.strides()[i]) % info.dims()[i]
+                                      : 0);
+            ++d_sub;
         }
+    }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_reverse_iterator& iter) const noexcept
-        {
-            return iter.indexer_ < indexer_;
+    // convert relative index to abosolute index
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr typename arrnd_info<StorageTraits>::extent_type ind2ind(
+        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type rel_ind)
+    {
+        if (empty(info)) {
+            throw std::invalid_argument("undefined operation for empty arrnd info");
         }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_reverse_iterator& iter) const noexcept
-        {
-            return iter.indexer_ <= indexer_;
+        if (rel_ind >= total(info)) {
+            throw std::out_of_range("invalid ind - not inside indices boundary");
         }
 
-        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
-        {
-            return data_[indexer_[index]];
+        if (!issliced(info)) {
+            return rel_ind;
         }
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_reverse_iterator& other) const noexcept
-        {
-            return other.indexer_ - indexer_;
+        if (iscontinuous(info)) {
+            return info.indices_boundary().start() + rel_ind;
         }
 
-    private:
-        indexer_type indexer_;
-        pointer data_ = nullptr;
-    };
+        typename arrnd_info<StorageTraits>::extent_type current_rel_stride
+            = std::reduce(std::next(std::begin(info.dims()), 1), std::end(info.dims()),
+                typename arrnd_info<StorageTraits>::extent_type{1},
+                overflow_check_multiplies<typename arrnd_info<StorageTraits>::extent_type>{});
 
-    template <typename Arrnd>
-    class arrnd_const_reverse_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = typename Arrnd::value_type;
-        using pointer = typename Arrnd::value_type*;
-        using reference = typename Arrnd::value_type&;
+        typename arrnd_info<StorageTraits>::extent_type abs_ind = info.indices_boundary().start();
 
-        using indexer_type = typename Arrnd::indexer_type;
+        for (typename arrnd_info<StorageTraits>::extent_type i = 0; i < std::size(info.dims()); ++i) {
+            auto sub = (info.dims()[i] > 1 ? (rel_ind / current_rel_stride) % info.dims()[i] : 0);
+            abs_ind += sub * info.strides()[i];
 
-        explicit constexpr arrnd_const_reverse_iterator(pointer data, const indexer_type& indexer)
-            : indexer_(indexer)
-            , data_(data)
-        { }
+            current_rel_stride /= (i + 1 >= std::size(info.dims()) ? 1 : info.dims()[i + 1]);
+        }
 
-        constexpr arrnd_const_reverse_iterator() = default;
+        return abs_ind;
+    }
 
-        constexpr arrnd_const_reverse_iterator(const arrnd_const_reverse_iterator& other) = default;
-        constexpr arrnd_const_reverse_iterator& operator=(const arrnd_const_reverse_iterator& other) = default;
+    // return arrnd info suitable for reduced dimension at specified axis.
+    // previous strides and hints are being ignored.
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> reduce(
+        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type axis)
+    {
+        if (empty(info)) {
+            throw std::invalid_argument("undefined operation for empty arrnd info");
+        }
 
-        constexpr arrnd_const_reverse_iterator(arrnd_const_reverse_iterator&& other) noexcept = default;
-        constexpr arrnd_const_reverse_iterator& operator=(arrnd_const_reverse_iterator&& other) noexcept = default;
-
-        constexpr ~arrnd_const_reverse_iterator() = default;
-
-        constexpr arrnd_const_reverse_iterator(const arrnd_reverse_iterator<Arrnd>& other)
-            : indexer_(other.indexer_)
-            , data_(other.data_)
-        { }
-        constexpr arrnd_const_reverse_iterator& operator=(const arrnd_reverse_iterator<Arrnd>& other)
-        {
-            indexer_ = other.indexer_;
-            data_ = other.data_;
-            return *this;
+        if (axis >= std::size(info.dims())) {
+            throw std::out_of_range("invalid axis value");
         }
 
-        constexpr arrnd_const_reverse_iterator(arrnd_reverse_iterator<Arrnd>&& other)
-            : indexer_(std::move(other.indexer_))
-            , data_(std::move(other.data_))
-        { }
-        constexpr arrnd_const_reverse_iterator& operator=(arrnd_reverse_iterator<Arrnd>&& other)
-        {
-            indexer_ = std::move(other.indexer_);
-            data_ = std::move(other.data_);
-            return *this;
+        if (std::size(info.dims()) == 1) {
+            return arrnd_info<StorageTraits>({1});
         }
 
-        constexpr arrnd_const_reverse_iterator& operator++() noexcept
-        {
-            --indexer_;
-            return *this;
-        }
+        typename arrnd_info<StorageTraits>::extent_storage_type new_dims(info.dims());
+        new_dims.erase(std::next(std::begin(new_dims), axis));
+        new_dims.shrink_to_fit();
 
-        constexpr arrnd_const_reverse_iterator operator++(int) noexcept
-        {
-            arrnd_const_reverse_iterator temp{*this};
-            --(*this);
-            return temp;
-        }
+        return arrnd_info<StorageTraits>(new_dims);
+    }
 
-        constexpr arrnd_const_reverse_iterator& operator+=(difference_type count) noexcept
-        {
-            indexer_ -= count;
-            return *this;
-        }
+    // number of elements before and after the axis dim i.e. the array might be viewed
+    // as [outer, dims[axis], inner] array
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr auto reduction_extents(
+        const arrnd_info<StorageTraits>& info, typename arrnd_info<StorageTraits>::extent_type axis)
+    {
+        using extent_type = typename arrnd_info<StorageTraits>::extent_type;
 
-        constexpr arrnd_const_reverse_iterator operator+(difference_type count) const noexcept
-        {
-            arrnd_const_reverse_iterator temp{*this};
-            temp += count;
-            return temp;
+        if (axis >= std::size(info.dims())) {
+            throw std::out_of_range("invalid axis value");
         }
 
-        constexpr arrnd_const_reverse_iterator& operator--() noexcept
-        {
-            ++indexer_;
-            return *this;
-        }
+        auto axis_dim = std::next(std::begin(info.dims()), axis);
+        return std::pair<extent_type, extent_type>(
+            std::reduce(std::begin(info.dims()), axis_dim, extent_type{1}, std::multiplies<>{}),
+            std::reduce(std::next(axis_dim), std::end(info.dims()), extent_type{1}, std::multiplies<>{}));
+    }
 
-        constexpr arrnd_const_reverse_iterator operator--(int) noexcept
-        {
-            arrnd_const_reverse_iterator temp{*this};
-            ++(*this);
-            return temp;
+    // undo transposed info by rearranging dims accoding to sorted strides.
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> unstranspose(const arrnd_info<StorageTraits>& info)
+    {
+        if (empty(info)) {
+            return arrnd_info<StorageTraits>{};
         }
 
-        constexpr arrnd_const_reverse_iterator& operator-=(difference_type count) noexcept
-        {
-            indexer_ += count;
-            return *this;
+        if (!istransposed(info)) {
+            return info;
         }
 
-        constexpr arrnd_const_reverse_iterator operator-(difference_type count) const noexcept
-        {
-            arrnd_const_reverse_iterator temp{*this};
-            temp -= count;
-            return temp;
-        }
+        typename arrnd_info<StorageTraits>::extent_storage_type new_dims(info.dims());
+        typename arrnd_info<StorageTraits>::extent_storage_type new_strides(info.strides());
 
-        [[nodiscard]] constexpr const reference operator*() const noexcept
-        {
-            return data_[*indexer_];
-        }
+        auto z = zip(zipped(new_strides), zipped(new_dims));
+        std::sort(std::begin(z), std::end(z), [](auto t1, auto t2) {
+            return std::get<0>(t1) > std::get<0>(t2);
+        });
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_const_reverse_iterator& iter) const noexcept
-        {
-            return indexer_ == iter.indexer_;
-        }
+        return arrnd_info<StorageTraits>(
+            new_dims, new_strides, info.indices_boundary(), info.hints() & ~arrnd_hint::transposed);
+    }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_const_reverse_iterator& iter) const noexcept
-        {
-            return iter.indexer_ < indexer_;
+    // return simple arrnd info by dims only,
+    // ignoring hints such as sliced.
+    template <typename StorageTraits>
+    [[nodiscard]] inline constexpr arrnd_info<StorageTraits> simplify(const arrnd_info<StorageTraits>& info)
+    {
+        if (empty(info)) {
+            return arrnd_info<StorageTraits>{};
         }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_const_reverse_iterator& iter) const noexcept
-        {
-            return iter.indexer_ <= indexer_;
+        if (info.hints() == arrnd_hint::continuous) {
+            return info;
         }
 
-        [[nodiscard]] constexpr const reference operator[](difference_type index) const noexcept
-        {
-            return data_[indexer_[index]];
-        }
+        return arrnd_info<StorageTraits>(info.dims());
+    }
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_const_reverse_iterator& other) const noexcept
-        {
-            return other.indexer_ - indexer_;
+    template <typename StorageTraits>
+    inline constexpr std::ostream& operator<<(std::ostream& os, const arrnd_info<StorageTraits>& info)
+    {
+        if (empty(info)) {
+            os << "empty";
+            return os;
         }
 
-    private:
-        indexer_type indexer_;
-        pointer data_ = nullptr;
-    };
+        auto print_vec = [&os](const auto& vec) {
+            os << '[';
+            std::for_each_n(std::cbegin(vec), std::ssize(vec) - 1, [&os](const auto& e) {
+                os << e << ' ';
+            });
+            os << *std::next(std::cbegin(vec), std::ssize(vec) - 1) << ']';
+        };
 
-    template <typename Arrnd>
-    class arrnd_slice_const_iterator;
+        os << "total: " << total(info) << '\n';
+        os << "dims: ";
+        print_vec(info.dims());
+        os << '\n';
+        os << "strides: ";
+        print_vec(info.strides());
+        os << '\n';
+        os << "indices_boundary: " << info.indices_boundary() << "\n";
+        os << "hints (transposed|sliced|continuous): "
+           << std::bitset<to_underlying(arrnd_hint::bitscount)>(to_underlying(info.hints())) << "\n";
+        os << "props (vector|matrix|row|column|scalar): " << isvector(info) << ismatrix(info) << isrow(info)
+           << iscolumn(info) << isscalar(info);
 
-    template <typename Arrnd>
-    class arrnd_slice_iterator {
+        return os;
+    }
+
+}
+
+using details::arrnd_iterator_position;
+using details::arrnd_hint;
+using details::to_underlying;
+using details::arrnd_squeeze_type;
+using details::arrnd_info;
+using details::slice;
+using details::squeeze;
+using details::transpose;
+using details::swap;
+using details::move;
+using details::roll;
+using details::sub2ind;
+using details::ind2sub;
+using details::ind2ind;
+using details::total;
+using details::size;
+using details::empty;
+using details::iscontinuous;
+using details::issliced;
+using details::istransposed;
+using details::isvector;
+using details::ismatrix;
+using details::isrow;
+using details::iscolumn;
+using details::isscalar;
+using details::reduce;
+using details::unstranspose;
+using details::simplify;
+}
+
+namespace oc::arrnd {
+namespace details {
+    template <typename ArrndInfo = arrnd_info<>>
+    class arrnd_indexer {
     public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = Arrnd;
-        using reference = Arrnd&;
+        using info_type = ArrndInfo;
 
-        using windows_slider_type = typename Arrnd::windows_slider_type;
+        using index_type = typename info_type::extent_type;
+        using size_type = typename info_type::extent_type;
+        using difference_type = typename info_type::extent_storage_type::difference_type;
 
-        friend arrnd_slice_const_iterator<Arrnd>;
+        using sub_storage_type = typename info_type::extent_storage_type;
 
-        explicit constexpr arrnd_slice_iterator(const value_type& arrnd_ref, const windows_slider_type& far)
-            : arrnd_ref_(arrnd_ref)
-            , far_(far)
+        explicit constexpr arrnd_indexer(
+            const info_type& info, arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
+            : info_(info)
+            , subs_(size(info))
+            , pos_(empty(info) ? arrnd_iterator_position::end : start_pos)
         {
-            if (far) {
-                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            if (!empty(info)) {
+                if (start_pos == arrnd_iterator_position::begin || start_pos == arrnd_iterator_position::rend) {
+                    std::fill(std::begin(subs_), std::end(subs_), index_type{0});
+                    curr_abs_ind_ = info.indices_boundary().start();
+                    curr_rel_ind_ = index_type{0};
+                } else {
+                    std::transform(std::begin(info.dims()), std::end(info.dims()), std::begin(subs_), [](auto dim) {
+                        return dim - index_type{1};
+                    });
+                    curr_abs_ind_ = info.indices_boundary().stop() - index_type{1};
+                    curr_rel_ind_ = total(info) - index_type{1};
+                }
+                if (start_pos == arrnd_iterator_position::end) {
+                    curr_rel_ind_ = total(info);
+                } else if (start_pos == arrnd_iterator_position::rend) {
+                    curr_rel_ind_ = index_type{0} - 1;
+                }
             }
         }
 
-        constexpr arrnd_slice_iterator() = default;
-
-        constexpr arrnd_slice_iterator(const arrnd_slice_iterator& other) = default;
-        constexpr arrnd_slice_iterator& operator=(const arrnd_slice_iterator& other) = default;
-
-        constexpr arrnd_slice_iterator(arrnd_slice_iterator&& other) noexcept = default;
-        constexpr arrnd_slice_iterator& operator=(arrnd_slice_iterator&& other) noexcept = default;
-
-        constexpr ~arrnd_slice_iterator() = default;
+        constexpr arrnd_indexer() = default;
+        constexpr arrnd_indexer(const arrnd_indexer&) = default;
+        constexpr arrnd_indexer& operator=(const arrnd_indexer&) = default;
+        constexpr arrnd_indexer(arrnd_indexer&&) noexcept = default;
+        constexpr arrnd_indexer& operator=(arrnd_indexer&&) noexcept = default;
+        constexpr ~arrnd_indexer() = default;
 
-        constexpr arrnd_slice_iterator& operator++() noexcept
+        constexpr arrnd_indexer& operator++() noexcept
         {
-            ++far_;
-            return *this;
-        }
+            if (pos_ == arrnd_iterator_position::end) {
+                return *this;
+            }
 
-        constexpr arrnd_slice_iterator operator++(int) noexcept
-        {
-            arrnd_slice_iterator temp{*this};
-            ++(*this);
-            return temp;
-        }
+            if (pos_ == arrnd_iterator_position::rend) {
+                ++curr_rel_ind_;
+                pos_ = arrnd_iterator_position::begin;
+                return *this;
+            }
 
-        constexpr arrnd_slice_iterator& operator+=(difference_type count) noexcept
-        {
-            far_ += count;
-            return *this;
-        }
+            ++curr_rel_ind_;
 
-        constexpr arrnd_slice_iterator operator+(difference_type count) const
-        {
-            arrnd_slice_iterator temp{*this};
-            temp += count;
-            return temp;
-        }
+            for (index_type i = size(info_); i > 0; --i) {
+                ++subs_[i - 1];
+                curr_abs_ind_ += info_.strides()[i - 1];
+                if (subs_[i - 1] < info_.dims()[i - 1]) {
+                    return *this;
+                }
+                curr_abs_ind_ -= info_.strides()[i - 1] * subs_[i - 1];
+                subs_[i - 1] = 0;
+            }
+
+            seek_end();
 
-        constexpr arrnd_slice_iterator& operator--() noexcept
-        {
-            --far_;
             return *this;
         }
 
-        constexpr arrnd_slice_iterator operator--(int) noexcept
+        constexpr arrnd_indexer operator++(int) noexcept
         {
-            arrnd_slice_iterator temp{*this};
-            --(*this);
+            arrnd_indexer<info_type> temp{*this};
+            ++(*this);
             return temp;
         }
 
-        constexpr arrnd_slice_iterator& operator-=(difference_type count) noexcept
+        constexpr arrnd_indexer& operator+=(size_type count) noexcept
         {
-            far_ -= count;
+            // negative counts might be received from iterators difference_type
+            if (static_cast<difference_type>(count) < 0) {
+                return *this -= static_cast<size_type>(-static_cast<difference_type>(count));
+            }
+
+            if (count == 0 || pos_ == arrnd_iterator_position::end) {
+                return *this;
+            }
+
+            // relative index of rend position is -1, therefore shifted relative indices are being compared
+            if (curr_rel_ind_ + 1 + count > total(info_)) {
+                seek_end();
+                return *this;
+            }
+
+            if (pos_ == arrnd_iterator_position::rend) {
+                pos_ = arrnd_iterator_position::begin;
+            }
+
+            seek(curr_rel_ind_ + count);
+
             return *this;
         }
 
-        constexpr arrnd_slice_iterator operator-(difference_type count) const noexcept
+        arrnd_indexer operator+(size_type count) const noexcept
         {
-            arrnd_slice_iterator temp{*this};
-            temp -= count;
+            arrnd_indexer<info_type> temp{*this};
+            temp += count;
             return temp;
         }
 
-        [[nodiscard]] constexpr reference operator*() const noexcept
+        constexpr arrnd_indexer& operator--() noexcept
         {
-            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
-            return slice_;
-        }
+            if (pos_ == arrnd_iterator_position::rend) {
+                return *this;
+            }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_slice_iterator& iter) const noexcept
-        {
-            return far_ == iter.far_;
-        }
+            if (pos_ == arrnd_iterator_position::end) {
+                --curr_rel_ind_;
+                pos_ = arrnd_iterator_position::rbegin;
+                return *this;
+            }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_slice_iterator& iter) const noexcept
-        {
-            return far_ < iter.far_;
-        }
+            --curr_rel_ind_;
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_iterator& iter) const noexcept
-        {
-            return far_ <= iter.far_;
-        }
+            for (index_type i = size(info_); i > 0; --i) {
+                if (subs_[i - 1] >= 1) {
+                    --subs_[i - 1];
+                    curr_abs_ind_ -= info_.strides()[i - 1];
+                    return *this;
+                }
+                subs_[i - 1] = info_.dims()[i - 1] - index_type{1};
+                curr_abs_ind_ += info_.strides()[i - 1] * subs_[i - 1];
+            }
 
-        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
-        {
-            auto ranges = far_[index];
-            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+            seek_rend();
+
+            return *this;
         }
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_slice_iterator& other) const noexcept
+        constexpr arrnd_indexer operator--(int) noexcept
         {
-            return far_ - other.far_;
+            arrnd_indexer<info_type> temp{*this};
+            --(*this);
+            return temp;
         }
 
-    private:
-        value_type arrnd_ref_;
-        windows_slider_type far_;
-
-        mutable value_type slice_;
-    };
-
-    template <typename Arrnd>
-    class arrnd_slice_const_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = Arrnd;
-        using const_reference = const Arrnd&;
-
-        using windows_slider_type = typename Arrnd::windows_slider_type;
-
-        explicit constexpr arrnd_slice_const_iterator(const value_type& arrnd_ref, const windows_slider_type& far)
-            : arrnd_ref_(arrnd_ref)
-            , far_(far)
+        constexpr arrnd_indexer& operator-=(size_type count) noexcept
         {
-            if (far) {
-                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            // negative counts might be received from iterators difference_type
+            if (static_cast<difference_type>(count) < 0) {
+                return *this += static_cast<size_type>(-static_cast<difference_type>(count));
             }
-        }
 
-        constexpr arrnd_slice_const_iterator() = default;
+            if (count == 0 || pos_ == arrnd_iterator_position::rend) {
+                return *this;
+            }
 
-        constexpr arrnd_slice_const_iterator(const arrnd_slice_const_iterator& other) = default;
-        constexpr arrnd_slice_const_iterator& operator=(const arrnd_slice_const_iterator& other) = default;
+            // relative index of rend position is -1, therefore shifted relative indices are being compared
+            if (count >= curr_rel_ind_ + 1) {
+                seek_rend();
+                return *this;
+            }
 
-        constexpr arrnd_slice_const_iterator(arrnd_slice_const_iterator&& other) noexcept = default;
-        constexpr arrnd_slice_const_iterator& operator=(arrnd_slice_const_iterator&& other) noexcept = default;
+            if (pos_ == arrnd_iterator_position::end) {
+                pos_ = arrnd_iterator_position::rbegin;
+            }
 
-        constexpr ~arrnd_slice_const_iterator() = default;
+            seek(curr_rel_ind_ - count);
 
-        constexpr arrnd_slice_const_iterator(const arrnd_slice_iterator<Arrnd>& other)
-            : arrnd_ref_(other.arrnd_ref_)
-            , far_(other.far_)
-            , slice_(other.slice_)
-        { }
-        constexpr arrnd_slice_const_iterator& operator=(const arrnd_slice_iterator<Arrnd>& other)
-        {
-            arrnd_ref_ = other.arrnd_ref_;
-            far_ = other.far_;
-            slice_ = other.slice_;
             return *this;
         }
 
-        constexpr arrnd_slice_const_iterator(arrnd_slice_iterator<Arrnd>&& other)
-            : arrnd_ref_(std::move(other.arrnd_ref_))
-            , far_(std::move(other.far_))
-            , slice_(std::move(other.slice_))
-        { }
-        constexpr arrnd_slice_const_iterator& operator=(arrnd_slice_iterator<Arrnd>&& other)
+        constexpr arrnd_indexer operator-(size_type count) const noexcept
         {
-            arrnd_ref_ = std::move(other.arrnd_ref_);
-            far_ = std::move(other.far_);
-            slice_ = std::move(other.slice_);
-            return *this;
+            arrnd_indexer<info_type> temp{*this};
+            temp -= count;
+            return temp;
         }
 
-        constexpr arrnd_slice_const_iterator& operator++() noexcept
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
         {
-            ++far_;
-            return *this;
+            return !(pos_ == arrnd_iterator_position::end || pos_ == arrnd_iterator_position::rend);
         }
 
-        constexpr arrnd_slice_const_iterator operator++(int) noexcept
+        [[nodiscard]] constexpr index_type operator*() const noexcept
         {
-            arrnd_slice_const_iterator temp{*this};
-            ++(*this);
-            return temp;
+            return curr_abs_ind_;
         }
 
-        constexpr arrnd_slice_const_iterator& operator+=(difference_type count) noexcept
+        [[nodiscard]] constexpr const sub_storage_type& subs() const noexcept
         {
-            far_ += count;
-            return *this;
+            return subs_;
         }
 
-        constexpr arrnd_slice_const_iterator operator+(difference_type count) const noexcept
+        [[nodiscard]] constexpr arrnd_indexer operator[](index_type index) const noexcept
         {
-            arrnd_slice_const_iterator temp{*this};
-            temp += count;
-            return temp;
-        }
+            assert(index >= 0 && index < total(info_));
 
-        constexpr arrnd_slice_const_iterator& operator--() noexcept
-        {
-            --far_;
-            return *this;
-        }
+            arrnd_indexer<info_type> temp{*this};
+
+            if (!temp) {
+                temp.pos_ = arrnd_iterator_position::begin;
+            }
+
+            temp.seek(index);
 
-        constexpr arrnd_slice_const_iterator operator--(int) noexcept
-        {
-            arrnd_slice_const_iterator temp{*this};
-            --(*this);
             return temp;
         }
 
-        constexpr arrnd_slice_const_iterator& operator-=(difference_type count) noexcept
+        [[nodiscard]] constexpr bool operator==(const arrnd_indexer& other) const noexcept
         {
-            far_ -= count;
-            return *this;
+            return curr_rel_ind_ + 1 == other.curr_rel_ind_ + 1;
         }
 
-        constexpr arrnd_slice_const_iterator operator-(difference_type count) const noexcept
+        [[nodiscard]] constexpr bool operator<(const arrnd_indexer& other) const noexcept
         {
-            arrnd_slice_const_iterator temp{*this};
-            temp -= count;
-            return temp;
+            return curr_rel_ind_ + 1 < other.curr_rel_ind_ + 1;
         }
 
-        [[nodiscard]] constexpr const_reference operator*() const noexcept
+        [[nodiscard]] constexpr bool operator<=(const arrnd_indexer& other) const noexcept
         {
-            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
-            return slice_;
+            return curr_rel_ind_ + 1 <= other.curr_rel_ind_ + 1;
         }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_slice_const_iterator& iter) const noexcept
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_indexer& other) const noexcept
         {
-            return far_ == iter.far_;
+            return static_cast<difference_type>(curr_rel_ind_ + 1)
+                - static_cast<difference_type>(other.curr_rel_ind_ + 1);
         }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_slice_const_iterator& iter) const noexcept
+    private:
+        // compute subscripts and absolute index of a valid relative index directly from the dims and strides,
+        // instead of carrying the subscripts one step at a time.
+        constexpr void seek(index_type rel_ind) noexcept
         {
-            return far_ < iter.far_;
+            assert(rel_ind < total(info_));
+
+            curr_rel_ind_ = rel_ind;
+            curr_abs_ind_ = info_.indices_boundary().start();
+
+            for (index_type i = size(info_); i > 0; --i) {
+                subs_[i - 1] = rel_ind % info_.dims()[i - 1];
+                rel_ind /= info_.dims()[i - 1];
+                curr_abs_ind_ += subs_[i - 1] * info_.strides()[i - 1];
+            }
         }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_const_iterator& iter) const noexcept
+        constexpr void seek_end() noexcept
         {
-            return far_ <= iter.far_;
+            std::transform(std::begin(info_.dims()), std::end(info_.dims()), std::begin(subs_), [](auto dim) {
+                return dim - index_type{1};
+            });
+            curr_abs_ind_ = info_.indices_boundary().stop() - index_type{1};
+            curr_rel_ind_ = total(info_);
+            pos_ = arrnd_iterator_position::end;
         }
 
-        [[nodiscard]] constexpr const_reference operator[](difference_type index) const noexcept
+        constexpr void seek_rend() noexcept
         {
-            auto ranges = far_[index];
-            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+            std::fill(std::begin(subs_), std::end(subs_), index_type{0});
+            curr_abs_ind_ = info_.indices_boundary().start();
+            curr_rel_ind_ = index_type{0} - 1;
+            pos_ = arrnd_iterator_position::rend;
         }
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_slice_const_iterator& other) const noexcept
-        {
-            return far_ - other.far_;
-        }
+        info_type info_;
 
-    private:
-        value_type arrnd_ref_;
-        windows_slider_type far_;
+        sub_storage_type subs_;
 
-        mutable value_type slice_;
+        index_type curr_abs_ind_{0};
+        index_type curr_rel_ind_{0};
+
+        arrnd_iterator_position pos_{arrnd_iterator_position::end};
     };
 
-    template <typename Arrnd>
-    class arrnd_slice_reverse_const_iterator;
+    enum class arrnd_window_type {
+        complete,
+        partial,
+    };
 
-    template <typename Arrnd>
-    class arrnd_slice_reverse_iterator {
+    template <typename Interval>
+        requires(std::signed_integral<typename Interval::size_type>)
+    struct arrnd_window {
+        using interval_type = Interval;
+
+        explicit constexpr arrnd_window(interval_type nival, arrnd_window_type ntype = arrnd_window_type::complete)
+            : ival(nival)
+            , type(ntype)
+        { }
+
+        constexpr arrnd_window() = default;
+        constexpr arrnd_window(const arrnd_window&) = default;
+        constexpr arrnd_window& operator=(const arrnd_window&) = default;
+        constexpr arrnd_window(arrnd_window&&) noexcept = default;
+        constexpr arrnd_window& operator=(arrnd_window&&) noexcept = default;
+        constexpr ~arrnd_window() = default;
+
+        interval_type ival;
+        arrnd_window_type type{arrnd_window_type::complete};
+    };
+
+    template <typename ArrndInfo = arrnd_info<>>
+    class arrnd_windows_slider {
     public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = Arrnd;
-        using reference = Arrnd&;
+        using info_type = ArrndInfo;
 
-        using windows_slider_type = typename Arrnd::windows_slider_type;
+        using index_type = typename info_type::extent_type;
+        using size_type = typename info_type::extent_type;
 
-        friend arrnd_slice_reverse_const_iterator<Arrnd>;
+        using boundary_storage_type = typename info_type::storage_traits_type::template replaced_type<
+            typename info_type::boundary_type>::storage_type;
 
-        explicit constexpr arrnd_slice_reverse_iterator(const value_type& arrnd_ref, const windows_slider_type& far)
-            : arrnd_ref_(arrnd_ref)
-            , far_(far)
+        using window_type = arrnd_window<interval<std::make_signed_t<typename info_type::extent_type>>>;
+
+        template <typename InputIt>
+            requires(template_type<iterator_value_t<InputIt>, arrnd_window>)
+        explicit constexpr arrnd_windows_slider(const info_type& info, InputIt first_window, InputIt last_window,
+            arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
+            : info_(info)
+            , windows_(size(info))
+            , curr_boundaries_(size(info))
         {
-            if (far) {
-                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            if (size(info) < std::distance(first_window, last_window)) {
+                throw std::invalid_argument("invalid window size - bigger than number of dims");
+            }
+
+            if (std::any_of(first_window, last_window, [](auto window) {
+                    return isunbound(window.ival) && (isleftbound(window.ival) || isrightbound(window.ival));
+                })) {
+                throw std::invalid_argument("invalid window interval - half bounded intervals currently not supported");
+            }
+
+            if (!std::transform_reduce(std::begin(info.dims()),
+                    std::next(std::begin(info.dims()), std::distance(first_window, last_window)), first_window, true,
+                    std::logical_and<>{}, [](auto dim, auto window) {
+                        auto ival = window.ival;
+                        auto type = window.type;
+                        return (type == arrnd_window_type::complete
+                                   && (isunbound(ival)
+                                       || (ival.start() <= 0 && ival.stop() >= 0 && absdiff(ival) <= dim)))
+                            || type == arrnd_window_type::partial;
+                    })) {
+                throw std::invalid_argument("invalid window interval");
+            }
+
+            if constexpr (std::is_same_v<std::iter_value_t<InputIt>, typename window_type::interval_type>) {
+                std::copy(first_window, last_window, std::begin(windows_));
+            } else {
+                std::transform(first_window, last_window, std::begin(windows_), [](auto window) {
+                    return window_type(static_cast<typename window_type::interval_type>(window.ival), window.type);
+                });
+            }
+            if (size(info) > std::distance(first_window, last_window)) {
+                std::transform(std::next(std::begin(info.dims()), std::distance(first_window, last_window)),
+                    std::end(info.dims()), std::next(std::begin(windows_), std::distance(first_window, last_window)),
+                    [](auto dim) {
+                        return window_type(typename window_type::interval_type(0, static_cast<size_type>(dim)),
+                            arrnd_window_type::complete);
+                    });
+            }
+
+            typename info_type::extent_storage_type indexer_dims(size(info));
+            std::transform(std::begin(info.dims()), std::end(info.dims()), std::begin(windows_),
+                std::begin(indexer_dims), [](auto dim, auto window) {
+                    auto ival = window.ival;
+                    if (isunbound(window.ival)) {
+                        return index_type{1};
+                    }
+                    return window.type == arrnd_window_type::complete ? dim - absdiff(ival) + 1 : dim;
+                });
+
+            indexer_ = arrnd_indexer(info_type(indexer_dims), start_pos);
+
+            for (size_type i = 0; i < size(info); ++i) {
+                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info.dims()[i]);
             }
         }
 
-        constexpr arrnd_slice_reverse_iterator() = default;
+        template <iterable_type Cont>
+            requires(template_type<iterable_value_t<Cont>, arrnd_window>)
+        explicit constexpr arrnd_windows_slider(
+            const info_type& info, Cont&& windows, arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
+            : arrnd_windows_slider(info, std::begin(windows), std::end(windows), start_pos)
+        { }
 
-        constexpr arrnd_slice_reverse_iterator(const arrnd_slice_reverse_iterator& other) = default;
-        constexpr arrnd_slice_reverse_iterator& operator=(const arrnd_slice_reverse_iterator& other) = default;
+        explicit constexpr arrnd_windows_slider(const info_type& info, std::initializer_list<window_type> windows,
+            arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
+            : arrnd_windows_slider(info, windows.begin(), windows.end(), start_pos)
+        { }
 
-        constexpr arrnd_slice_reverse_iterator(arrnd_slice_reverse_iterator&& other) noexcept = default;
-        constexpr arrnd_slice_reverse_iterator& operator=(arrnd_slice_reverse_iterator&& other) noexcept = default;
+        explicit constexpr arrnd_windows_slider(const info_type& info, index_type axis,
+            const window_type& window = window_type(typename window_type::interval_type(0, 1)),
+            arrnd_iterator_position start_pos = arrnd_iterator_position::begin)
+        {
+            if (axis >= size(info)) {
+                throw std::out_of_range("invalid axis");
+            }
 
-        constexpr ~arrnd_slice_reverse_iterator() = default;
+            typename info_type::storage_traits_type::template replaced_type<window_type>::storage_type windows(
+                size(info));
 
-        constexpr arrnd_slice_reverse_iterator& operator--() noexcept
+            std::transform(std::begin(info.dims()), std::end(info.dims()), std::begin(windows), [](auto dim) {
+                return window_type(
+                    typename window_type::interval_type(0, static_cast<size_type>(dim)), arrnd_window_type::complete);
+            });
+
+            windows[axis] = window;
+
+            *this = arrnd_windows_slider(info, windows, start_pos);
+        }
+
+        constexpr arrnd_windows_slider() = default;
+        constexpr arrnd_windows_slider(const arrnd_windows_slider&) = default;
+        constexpr arrnd_windows_slider& operator=(const arrnd_windows_slider&) = default;
+        constexpr arrnd_windows_slider(arrnd_windows_slider&&) noexcept = default;
+        constexpr arrnd_windows_slider& operator=(arrnd_windows_slider&&) noexcept = default;
+        constexpr ~arrnd_windows_slider() = default;
+
+        constexpr arrnd_windows_slider& operator++() noexcept
         {
-            ++far_;
+            ++indexer_;
+
+            for (size_type i = 0; i < size(info_); ++i) {
+                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info_.dims()[i]);
+            }
+
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_iterator operator--(int) noexcept
+        constexpr arrnd_windows_slider operator++(int) noexcept
         {
-            arrnd_slice_reverse_iterator temp{*this};
+            arrnd_windows_slider<info_type> temp{*this};
             ++(*this);
             return temp;
         }
 
-        constexpr arrnd_slice_reverse_iterator& operator-=(difference_type count) noexcept
+        constexpr arrnd_windows_slider& operator+=(size_type count) noexcept
         {
-            far_ += count;
+            indexer_ += count;
+
+            for (size_type i = 0; i < size(info_); ++i) {
+                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info_.dims()[i]);
+            }
+
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_iterator operator-(difference_type count) const noexcept
+        arrnd_windows_slider operator+(size_type count) const noexcept
         {
-            arrnd_slice_reverse_iterator temp{*this};
+            arrnd_windows_slider<info_type> temp{*this};
             temp += count;
             return temp;
         }
 
-        constexpr arrnd_slice_reverse_iterator& operator++() noexcept
+        constexpr arrnd_windows_slider& operator--() noexcept
         {
-            --far_;
+            --indexer_;
+
+            for (size_type i = 0; i < size(info_); ++i) {
+                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info_.dims()[i]);
+            }
+
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_iterator operator++(int) noexcept
+        constexpr arrnd_windows_slider operator--(int) noexcept
         {
-            arrnd_slice_reverse_iterator temp{*this};
+            arrnd_windows_slider<info_type> temp{*this};
             --(*this);
             return temp;
         }
 
-        constexpr arrnd_slice_reverse_iterator& operator+=(difference_type count) noexcept
+        constexpr arrnd_windows_slider& operator-=(size_type count) noexcept
         {
-            far_ -= count;
+            indexer_ -= count;
+
+            for (size_type i = 0; i < size(info_); ++i) {
+                curr_boundaries_[i] = window2boundary(windows_[i], indexer_.subs()[i], info_.dims()[i]);
+            }
+
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_iterator operator+(difference_type count) const noexcept
+        constexpr arrnd_windows_slider operator-(size_type count) const noexcept
         {
-            arrnd_slice_reverse_iterator temp{*this};
+            arrnd_windows_slider<info_type> temp{*this};
             temp -= count;
             return temp;
         }
 
-        [[nodiscard]] constexpr reference operator*() const noexcept
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
         {
-            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
-            return slice_;
+            return static_cast<bool>(indexer_);
         }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_slice_reverse_iterator& iter) const noexcept
+        [[nodiscard]] constexpr const boundary_storage_type& operator*() const noexcept
         {
-            return far_ == iter.far_;
+            return curr_boundaries_;
         }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_slice_reverse_iterator& iter) const noexcept
+        [[nodiscard]] constexpr arrnd_windows_slider operator[](index_type index) const noexcept
         {
-            return far_ > iter.far_;
+            auto subs = indexer_[index].subs();
+
+            arrnd_windows_slider<info_type> temp{*this};
+
+            for (size_type i = 0; i < size(info_); ++i) {
+                temp.curr_boundaries_[i] = window2boundary(windows_[i], subs[i], info_.dims()[i]);
+            }
+
+            return temp;
         }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_reverse_iterator& iter) const noexcept
+        [[nodiscard]] constexpr bool operator==(const arrnd_windows_slider& other) const noexcept
         {
-            return far_ >= iter.far_;
+            return indexer_ == other.indexer_;
         }
 
-        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
+        [[nodiscard]] constexpr bool operator<(const arrnd_windows_slider& other) const noexcept
         {
-            auto ranges = far_[index];
-            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+            return indexer_ < other.indexer_;
         }
 
-        [[nodiscard]] constexpr difference_type operator-(const arrnd_slice_reverse_iterator& other) const noexcept
+        [[nodiscard]] constexpr bool operator<=(const arrnd_windows_slider& other) const noexcept
         {
-            return far_ - other.far_;
+            return indexer_ <= other.indexer_;
         }
 
-    private:
-        value_type arrnd_ref_;
-        windows_slider_type far_;
-
-        mutable value_type slice_;
-    };
+        [[nodiscard]] constexpr auto operator-(const arrnd_windows_slider& other) const noexcept
+        {
+            return indexer_ - other.indexer_;
+        }
 
-    template <typename Arrnd>
-    class arrnd_slice_reverse_const_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using difference_type = typename Arrnd::difference_type;
-        using value_type = Arrnd;
-        using const_reference = const Arrnd&;
+        // not so safe function, and should be used with consideration of the internal indexer.
+        constexpr void modify_window(index_type axis, window_type window)
+        {
+            if (axis >= size(info_)) {
+                throw std::out_of_range("invalid axis");
+            }
 
-        using windows_slider_type = typename Arrnd::windows_slider_type;
+            const auto& ival = window.ival;
 
-        explicit constexpr arrnd_slice_reverse_const_iterator(
-            const value_type& arrnd_ref, const windows_slider_type& far)
-            : arrnd_ref_(arrnd_ref)
-            , far_(far)
-        {
-            if (far) {
-                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            if (isunbound(ival) && (isleftbound(ival) || isrightbound(ival))) {
+                throw std::invalid_argument("invalid window interval - half bounded intervals currently not supported");
+            }
+
+            if (!(isunbound(ival) || (ival.start() <= 0 && ival.stop() >= 0 && absdiff(ival) <= info_.dims()[axis]))) {
+                throw std::invalid_argument("invalid window interval");
             }
+
+            windows_[axis] = window;
+
+            curr_boundaries_[axis] = window2boundary(windows_[axis], indexer_.subs()[axis], info_.dims()[axis]);
         }
 
-        constexpr arrnd_slice_reverse_const_iterator() = default;
+    private:
+        [[nodiscard]] typename info_type::boundary_type window2boundary(
+            window_type window, index_type sub, size_type dim) const
+        {
+            const auto& ival = window.ival;
+            auto type = window.type;
 
-        constexpr arrnd_slice_reverse_const_iterator(const arrnd_slice_reverse_const_iterator& other) = default;
-        constexpr arrnd_slice_reverse_const_iterator& operator=(const arrnd_slice_reverse_const_iterator& other)
-            = default;
+            if (isunbound(ival)) {
+                // unsupported half bound intervals checked in class constructor.
+                return typename info_type::boundary_type(
+                    0, static_cast<index_type>(dim), static_cast<index_type>(ival.step()));
+            }
 
-        constexpr arrnd_slice_reverse_const_iterator(arrnd_slice_reverse_const_iterator&& other) noexcept = default;
-        constexpr arrnd_slice_reverse_const_iterator& operator=(arrnd_slice_reverse_const_iterator&& other) noexcept
-            = default;
+            if (type == arrnd_window_type::complete) {
+                return typename info_type::boundary_type(
+                    sub, sub + static_cast<index_type>(absdiff(ival)), static_cast<index_type>(ival.step()));
+            }
 
-        constexpr ~arrnd_slice_reverse_const_iterator() = default;
+            auto before = static_cast<index_type>(std::abs(ival.start()));
+            auto nstart = (sub < before ? 0 : sub - before);
 
-        constexpr arrnd_slice_reverse_const_iterator(const arrnd_slice_reverse_iterator<Arrnd>& other)
-            : arrnd_ref_(other.arrnd_ref_)
-            , far_(other.far_)
-            , slice_(other.slice_)
-        { }
-        constexpr arrnd_slice_reverse_const_iterator& operator=(const arrnd_slice_reverse_iterator<Arrnd>& other)
-        {
-            arrnd_ref_ = other.arrnd_ref_;
-            far_ = other.far_;
-            slice_ = other.slice_;
-            return *this;
+            auto after = static_cast<index_type>(ival.stop());
+            auto nstop = (sub + after > dim ? dim : sub + after);
+
+            return typename info_type::boundary_type(nstart, nstop, static_cast<index_type>(ival.step()));
         }
 
-        constexpr arrnd_slice_reverse_const_iterator(arrnd_slice_reverse_iterator<Arrnd>&& other)
-            : arrnd_ref_(std::move(other.arrnd_ref_))
-            , far_(std::move(other.far_))
-            , slice_(std::move(other.slice_))
+        info_type info_;
+
+        typename info_type::storage_traits_type::template replaced_type<window_type>::storage_type windows_;
+        arrnd_indexer<info_type> indexer_;
+
+        boundary_storage_type curr_boundaries_;
+    };
+}
+
+using details::arrnd_indexer;
+using details::arrnd_window_type;
+using details::arrnd_window;
+using details::arrnd_windows_slider;
+}
+
+// arrnd iterator types
+namespace oc::arrnd {
+namespace details {
+    struct arrnd_returned_element_iterator_tag { };
+    struct arrnd_returned_slice_iterator_tag { };
+
+    template <typename Arrnd>
+    class arrnd_const_iterator;
+
+    template <typename Arrnd>
+    class arrnd_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = typename Arrnd::value_type;
+        using pointer = typename Arrnd::value_type*;
+        using reference = typename Arrnd::value_type&;
+
+        using indexer_type = typename Arrnd::indexer_type;
+
+        friend class arrnd_const_iterator<Arrnd>;
+
+        explicit constexpr arrnd_iterator(pointer data, const indexer_type& indexer)
+            : indexer_(indexer)
+            , data_(data)
         { }
-        constexpr arrnd_slice_reverse_const_iterator& operator=(arrnd_slice_reverse_iterator<Arrnd>&& other)
-        {
-            arrnd_ref_ = std::move(other.arrnd_ref_);
-            far_ = std::move(other.far_);
-            slice_ = std::move(other.slice_);
-            return *this;
-        }
 
-        constexpr arrnd_slice_reverse_const_iterator& operator--() noexcept
+        constexpr arrnd_iterator() = default;
+
+        constexpr arrnd_iterator(const arrnd_iterator& other) = default;
+        constexpr arrnd_iterator& operator=(const arrnd_iterator& other) = default;
+
+        constexpr arrnd_iterator(arrnd_iterator&& other) noexcept = default;
+        constexpr arrnd_iterator& operator=(arrnd_iterator&& other) noexcept = default;
+
+        constexpr ~arrnd_iterator() = default;
+
+        constexpr arrnd_iterator& operator++() noexcept
         {
-            ++far_;
+            ++indexer_;
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator operator--(int) noexcept
+        constexpr arrnd_iterator operator++(int) noexcept
         {
-            arrnd_slice_reverse_const_iterator temp{*this};
+            arrnd_iterator temp{*this};
             ++(*this);
             return temp;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator& operator-=(difference_type count) noexcept
+        constexpr arrnd_iterator& operator+=(difference_type count) noexcept
         {
-            far_ += count;
+            indexer_ += count;
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator operator-(difference_type count) const noexcept
+        constexpr arrnd_iterator operator+(difference_type count) const noexcept
         {
-            arrnd_slice_reverse_const_iterator temp{*this};
+            arrnd_iterator temp{*this};
             temp += count;
             return temp;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator& operator++() noexcept
+        constexpr arrnd_iterator& operator--() noexcept
         {
-            --far_;
+            --indexer_;
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator operator++(int) noexcept
+        constexpr arrnd_iterator operator--(int) noexcept
         {
-            arrnd_slice_reverse_const_iterator temp{*this};
+            arrnd_iterator temp{*this};
             --(*this);
             return temp;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator& operator+=(difference_type count) noexcept
+        constexpr arrnd_iterator& operator-=(difference_type count) noexcept
         {
-            far_ -= count;
+            indexer_ -= count;
             return *this;
         }
 
-        constexpr arrnd_slice_reverse_const_iterator operator+(difference_type count) const noexcept
+        constexpr arrnd_iterator operator-(difference_type count) const noexcept
         {
-            arrnd_slice_reverse_const_iterator temp{*this};
+            arrnd_iterator temp{*this};
             temp -= count;
             return temp;
         }
 
-        [[nodiscard]] constexpr const_reference operator*() const noexcept
+        [[nodiscard]] constexpr reference operator*() const noexcept
         {
-            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
-            return slice_;
+            return data_[*indexer_];
         }
 
-        [[nodiscard]] constexpr bool operator==(const arrnd_slice_reverse_const_iterator& iter) const noexcept
+        [[nodiscard]] constexpr bool operator==(const arrnd_iterator& iter) const noexcept
         {
-            return far_ == iter.far_;
+            return indexer_ == iter.indexer_;
         }
 
-        [[nodiscard]] constexpr bool operator<(const arrnd_slice_reverse_const_iterator& iter) const noexcept
+        [[nodiscard]] constexpr bool operator<(const arrnd_iterator& iter) const noexcept
         {
-            return far_ > iter.far_;
+            return indexer_ < iter.indexer_;
         }
 
-        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_reverse_const_iterator& iter) const noexcept
+        [[nodiscard]] constexpr bool operator<=(const arrnd_iterator& iter) const noexcept
         {
-            return far_ >= iter.far_;
+            return indexer_ <= iter.indexer_;
         }
 
-        [[nodiscard]] constexpr const_reference operator[](difference_type index) const noexcept
+        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
         {
-            auto ranges = far_[index];
-            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+            return data_[*indexer_[index]];
         }
 
-        [[nodiscard]] constexpr difference_type operator-(
-            const arrnd_slice_reverse_const_iterator& other) const noexcept
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_iterator& other) const noexcept
         {
-            return far_ - other.far_;
+            return indexer_ - other.indexer_;
         }
 
     private:
-        value_type arrnd_ref_;
-        windows_slider_type far_;
-
-        mutable value_type slice_;
+        indexer_type indexer_;
+        pointer data_ = nullptr;
     };
 
     template <typename Arrnd>
-    class arrnd_back_insert_iterator {
+    class arrnd_const_iterator {
     public:
-        using iterator_category = std::output_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = typename Arrnd::value_type;
+        using pointer = typename Arrnd::value_type*;
+        using reference = typename Arrnd::value_type&;
 
-        constexpr arrnd_back_insert_iterator() noexcept = default;
+        using indexer_type = typename Arrnd::indexer_type;
 
-        explicit arrnd_back_insert_iterator(Arrnd& cont) noexcept
-            : cont_(std::addressof(cont))
+        explicit constexpr arrnd_const_iterator(pointer data, const indexer_type& indexer)
+            : indexer_(indexer)
+            , data_(data)
         { }
 
-        arrnd_back_insert_iterator& operator=(const Arrnd& cont)
+        constexpr arrnd_const_iterator() = default;
+
+        constexpr arrnd_const_iterator(const arrnd_const_iterator& other) = default;
+        constexpr arrnd_const_iterator& operator=(const arrnd_const_iterator& other) = default;
+
+        constexpr arrnd_const_iterator(arrnd_const_iterator&& other) noexcept = default;
+        constexpr arrnd_const_iterator& operator=(arrnd_const_iterator&& other) noexcept = default;
+
+        constexpr ~arrnd_const_iterator() = default;
+
+        constexpr arrnd_const_iterator(const arrnd_iterator<Arrnd>& other)
+            : indexer_(other.indexer_)
+            , data_(other.data_)
+        { }
+        constexpr arrnd_const_iterator& operator=(const arrnd_iterator<Arrnd>& other)
         {
-            cont_->push_back(cont);
+            indexer_ = other.indexer_;
+            data_ = other.data_;
             return *this;
         }
 
-        arrnd_back_insert_iterator& operator=(Arrnd&& cont)
+        constexpr arrnd_const_iterator(arrnd_iterator<Arrnd>&& other)
+            : indexer_(std::move(other.indexer_))
+            , data_(std::move(other.data_))
+        { }
+        constexpr arrnd_const_iterator& operator=(arrnd_iterator<Arrnd>&& other)
         {
-            cont_->push_back(std::move(cont));
+            indexer_ = std::move(other.indexer_);
+            data_ = std::move(other.data_);
             return *this;
         }
 
-        arrnd_back_insert_iterator& operator=(const typename Arrnd::value_type& value)
+        constexpr arrnd_const_iterator& operator++() noexcept
         {
-            cont_->push_back(Arrnd({1}, value));
+            ++indexer_;
             return *this;
         }
 
-        arrnd_back_insert_iterator& operator=(typename Arrnd::value_type&& value)
+        constexpr arrnd_const_iterator operator++(int) noexcept
         {
-            cont_->push_back(std::move(Arrnd({1}, value)));
-            return *this;
+            arrnd_const_iterator temp{*this};
+            ++(*this);
+            return temp;
         }
 
-        [[nodiscard]] arrnd_back_insert_iterator& operator*() noexcept
+        constexpr arrnd_const_iterator& operator+=(difference_type count) noexcept
         {
+            indexer_ += count;
             return *this;
         }
 
-        arrnd_back_insert_iterator& operator++() noexcept
+        constexpr arrnd_const_iterator operator+(difference_type count) const noexcept
         {
-            return *this;
+            arrnd_const_iterator temp{*this};
+            temp += count;
+            return temp;
         }
 
-        arrnd_back_insert_iterator operator++(int) noexcept
+        constexpr arrnd_const_iterator& operator--() noexcept
         {
+            --indexer_;
             return *this;
         }
 
-    protected:
-        Arrnd* cont_ = nullptr;
-    };
-
-    template <typename Arrnd>
-    [[nodiscard]] inline constexpr arrnd_back_insert_iterator<Arrnd> arrnd_back_inserter(Arrnd& cont) noexcept
-    {
-        return arrnd_back_insert_iterator<Arrnd>(cont);
-    }
-
-    template <typename Arrnd>
-    class arrnd_front_insert_iterator {
-    public:
-        using iterator_category = std::output_iterator_tag;
-
-        constexpr arrnd_front_insert_iterator() noexcept = default;
-
-        explicit arrnd_front_insert_iterator(Arrnd& cont)
-            : cont_(std::addressof(cont))
-        { }
+        constexpr arrnd_const_iterator operator--(int) noexcept
+        {
+            arrnd_const_iterator temp{*this};
+            --(*this);
+            return temp;
+        }
 
-        arrnd_front_insert_iterator& operator=(const Arrnd& cont)
+        constexpr arrnd_const_iterator& operator-=(difference_type count) noexcept
         {
-            cont_->push_front(cont);
+            indexer_ -= count;
             return *this;
         }
 
-        arrnd_front_insert_iterator& operator=(Arrnd&& cont)
+        constexpr arrnd_const_iterator operator-(difference_type count) const noexcept
         {
-            cont_->push_front(std::move(cont));
-            return *this;
+            arrnd_const_iterator temp{*this};
+            temp -= count;
+            return temp;
         }
 
-        arrnd_front_insert_iterator& operator=(const typename Arrnd::value_type& value)
+        [[nodiscard]] constexpr const reference operator*() const noexcept
         {
-            cont_->push_front(Arrnd({1}, value));
-            return *this;
+            return data_[*indexer_];
         }
 
-        arrnd_front_insert_iterator& operator=(typename Arrnd::value_type&& value)
+        [[nodiscard]] constexpr bool operator==(const arrnd_const_iterator& iter) const noexcept
         {
-            cont_->push_front(std::move(Arrnd({1}, value)));
-            return *this;
+            return indexer_ == iter.indexer_;
         }
 
-        [[nodiscard]] arrnd_front_insert_iterator& operator*()
+        [[nodiscard]] constexpr bool operator<(const arrnd_const_iterator& iter) const noexcept
         {
-            return *this;
+            return indexer_ < iter.indexer_;
         }
 
-        arrnd_front_insert_iterator& operator++()
+        [[nodiscard]] constexpr bool operator<=(const arrnd_const_iterator& iter) const noexcept
         {
-            return *this;
+            return indexer_ <= iter.indexer_;
         }
 
-        arrnd_front_insert_iterator operator++(int)
+        [[nodiscard]] constexpr const reference operator[](difference_type index) const noexcept
         {
-            return *this;
+            return data_[*indexer_[index]];
         }
 
-    protected:
-        Arrnd* cont_ = nullptr;
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_const_iterator& other) const noexcept
+        {
+            return indexer_ - other.indexer_;
+        }
+
+    private:
+        indexer_type indexer_;
+        pointer data_ = nullptr;
     };
 
     template <typename Arrnd>
-    [[nodiscard]] inline constexpr arrnd_front_insert_iterator<Arrnd> arrnd_front_inserter(Arrnd& cont)
-    {
-        return arrnd_front_insert_iterator<Arrnd>(cont);
-    }
+    class arrnd_const_reverse_iterator;
 
     template <typename Arrnd>
-    class arrnd_insert_iterator {
+    class arrnd_reverse_iterator {
     public:
-        using iterator_category = std::output_iterator_tag;
-        using size_type = typename Arrnd::size_type;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = typename Arrnd::value_type;
+        using pointer = typename Arrnd::value_type*;
+        using reference = typename Arrnd::value_type&;
 
-        constexpr arrnd_insert_iterator() noexcept = default;
+        using indexer_type = typename Arrnd::indexer_type;
 
-        explicit arrnd_insert_iterator(Arrnd& cont, size_type ind = 0)
-            : cont_(std::addressof(cont))
-            , ind_(ind)
+        friend arrnd_const_reverse_iterator<Arrnd>;
+
+        explicit constexpr arrnd_reverse_iterator(pointer data, const indexer_type& indexer)
+            : indexer_(indexer)
+            , data_(data)
         { }
 
-        arrnd_insert_iterator& operator=(const Arrnd& cont)
+        constexpr arrnd_reverse_iterator() = default;
+
+        constexpr arrnd_reverse_iterator(const arrnd_reverse_iterator& other) = default;
+        constexpr arrnd_reverse_iterator& operator=(const arrnd_reverse_iterator& other) = default;
+
+        constexpr arrnd_reverse_iterator(arrnd_reverse_iterator&& other) noexcept = default;
+        constexpr arrnd_reverse_iterator& operator=(arrnd_reverse_iterator&& other) noexcept = default;
+
+        constexpr ~arrnd_reverse_iterator() = default;
+
+        constexpr arrnd_reverse_iterator& operator++() noexcept
         {
-            cont_->insert(cont, ind_);
-            ind_ += cont.info().numel();
+            --indexer_;
             return *this;
         }
 
-        arrnd_insert_iterator& operator=(Arrnd&& cont)
+        constexpr arrnd_reverse_iterator operator++(int) noexcept
         {
-            cont_->insert(std::move(cont), ind_);
-            ind_ += cont.info().numel();
-            return *this;
+            arrnd_reverse_iterator temp{*this};
+            --(*this);
+            return temp;
         }
 
-        arrnd_insert_iterator& operator=(const typename Arrnd::value_type& value)
+        constexpr arrnd_reverse_iterator& operator+=(difference_type count) noexcept
         {
-            cont_->insert(Arrnd({1}, value), ind_);
-            ind_ += 1;
+            indexer_ -= count;
             return *this;
         }
 
-        arrnd_insert_iterator& operator=(typename Arrnd::value_type&& value)
+        constexpr arrnd_reverse_iterator operator+(difference_type count) const noexcept
         {
-            cont_->insert(std::move(Arrnd({1}, value)), ind_);
-            ind_ += 1;
-            return *this;
+            arrnd_reverse_iterator temp{*this};
+            temp += count;
+            return temp;
         }
 
-        [[nodiscard]] arrnd_insert_iterator& operator*()
+        constexpr arrnd_reverse_iterator& operator--() noexcept
         {
+            ++indexer_;
             return *this;
         }
 
-        arrnd_insert_iterator& operator++()
+        constexpr arrnd_reverse_iterator operator--(int) noexcept
         {
-            return *this;
+            arrnd_reverse_iterator temp{*this};
+            ++(*this);
+            return temp;
         }
 
-        arrnd_insert_iterator operator++(int)
+        constexpr arrnd_reverse_iterator& operator-=(difference_type count) noexcept
         {
+            indexer_ += count;
             return *this;
         }
 
-    protected:
-        Arrnd* cont_ = nullptr;
-        size_type ind_;
-    };
-
-    template <typename Arrnd>
-    [[nodiscard]] inline constexpr arrnd_insert_iterator<Arrnd> arrnd_inserter(
-        Arrnd& cont, typename Arrnd::size_type ind = 0)
-    {
-        return arrnd_insert_iterator<Arrnd>(cont, ind);
-    }
-
-    template <typename Arrnd>
-    class arrnd_slice_back_insert_iterator {
-    public:
-        using iterator_category = std::output_iterator_tag;
-        using size_type = typename Arrnd::size_type;
-
-        constexpr arrnd_slice_back_insert_iterator() noexcept = default;
+        constexpr arrnd_reverse_iterator operator-(difference_type count) const noexcept
+        {
+            arrnd_reverse_iterator temp{*this};
+            temp -= count;
+            return temp;
+        }
 
-        explicit arrnd_slice_back_insert_iterator(Arrnd& cont, size_type axis = 0) noexcept
-            : cont_(std::addressof(cont))
-            , axis_(axis)
-        { }
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            return data_[*indexer_];
+        }
 
-        arrnd_slice_back_insert_iterator& operator=(const Arrnd& cont)
+        [[nodiscard]] constexpr bool operator==(const arrnd_reverse_iterator& iter) const noexcept
         {
-            cont_->push_back(cont, axis_);
-            return *this;
+            return indexer_ == iter.indexer_;
         }
 
-        arrnd_slice_back_insert_iterator& operator=(Arrnd&& cont)
+        [[nodiscard]] constexpr bool operator<(const arrnd_reverse_iterator& iter) const noexcept
         {
-            cont_->push_back(std::move(cont), axis_);
-            return *this;
+            return iter.indexer_ < indexer_;
         }
 
-        [[nodiscard]] arrnd_slice_back_insert_iterator& operator*() noexcept
+        [[nodiscard]] constexpr bool operator<=(const arrnd_reverse_iterator& iter) const noexcept
         {
-            return *this;
+            return iter.indexer_ <= indexer_;
         }
 
-        arrnd_slice_back_insert_iterator& operator++() noexcept
+        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
         {
-            return *this;
+            return data_[*indexer_[index]];
         }
 
-        arrnd_slice_back_insert_iterator operator++(int) noexcept
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_reverse_iterator& other) const noexcept
         {
-            return *this;
+            return other.indexer_ - indexer_;
         }
 
-    protected:
-        Arrnd* cont_ = nullptr;
-        size_type axis_;
+    private:
+        indexer_type indexer_;
+        pointer data_ = nullptr;
     };
 
     template <typename Arrnd>
-    [[nodiscard]] inline constexpr arrnd_slice_back_insert_iterator<Arrnd> arrnd_slice_back_inserter(
-        Arrnd& cont, typename Arrnd::size_type axis = 0) noexcept
-    {
-        return arrnd_slice_back_insert_iterator<Arrnd>(cont, axis);
-    }
-
-    template <typename Arrnd>
-    class arrnd_slice_front_insert_iterator {
+    class arrnd_const_reverse_iterator {
     public:
-        using iterator_category = std::output_iterator_tag;
-        using size_type = typename Arrnd::size_type;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = typename Arrnd::value_type;
+        using pointer = typename Arrnd::value_type*;
+        using reference = typename Arrnd::value_type&;
 
-        constexpr arrnd_slice_front_insert_iterator() noexcept = default;
+        using indexer_type = typename Arrnd::indexer_type;
 
-        explicit arrnd_slice_front_insert_iterator(Arrnd& cont, size_type axis = 0)
-            : cont_(std::addressof(cont))
-            , axis_(axis)
+        explicit constexpr arrnd_const_reverse_iterator(pointer data, const indexer_type& indexer)
+            : indexer_(indexer)
+            , data_(data)
         { }
 
-        arrnd_slice_front_insert_iterator& operator=(const Arrnd& cont)
+        constexpr arrnd_const_reverse_iterator() = default;
+
+        constexpr arrnd_const_reverse_iterator(const arrnd_const_reverse_iterator& other) = default;
+        constexpr arrnd_const_reverse_iterator& operator=(const arrnd_const_reverse_iterator& other) = default;
+
+        constexpr arrnd_const_reverse_iterator(arrnd_const_reverse_iterator&& other) noexcept = default;
+        constexpr arrnd_const_reverse_iterator& operator=(arrnd_const_reverse_iterator&& other) noexcept = default;
+
+        constexpr ~arrnd_const_reverse_iterator() = default;
+
+        constexpr arrnd_const_reverse_iterator(const arrnd_reverse_iterator<Arrnd>& other)
+            : indexer_(other.indexer_)
+            , data_(other.data_)
+        { }
+        constexpr arrnd_const_reverse_iterator& operator=(const arrnd_reverse_iterator<Arrnd>& other)
         {
-            cont_->insert(cont, 0, axis_);
+            indexer_ = other.indexer_;
+            data_ = other.data_;
             return *this;
         }
 
-        arrnd_slice_front_insert_iterator& operator=(Arrnd&& cont)
+        constexpr arrnd_const_reverse_iterator(arrnd_reverse_iterator<Arrnd>&& other)
+            : indexer_(std::move(other.indexer_))
+            , data_(std::move(other.data_))
+        { }
+        constexpr arrnd_const_reverse_iterator& operator=(arrnd_reverse_iterator<Arrnd>&& other)
         {
-            cont_->insert(std::move(cont), 0, axis_);
+            indexer_ = std::move(other.indexer_);
+            data_ = std::move(other.data_);
             return *this;
         }
 
-        [[nodiscard]] arrnd_slice_front_insert_iterator& operator*()
+        constexpr arrnd_const_reverse_iterator& operator++() noexcept
         {
+            --indexer_;
             return *this;
         }
 
-        arrnd_slice_front_insert_iterator& operator++()
+        constexpr arrnd_const_reverse_iterator operator++(int) noexcept
         {
-            return *this;
+            arrnd_const_reverse_iterator temp{*this};
+            --(*this);
+            return temp;
         }
 
-        arrnd_slice_front_insert_iterator operator++(int)
+        constexpr arrnd_const_reverse_iterator& operator+=(difference_type count) noexcept
         {
+            indexer_ -= count;
             return *this;
         }
 
-    protected:
-        Arrnd* cont_ = nullptr;
-        size_type axis_;
-    };
+        constexpr arrnd_const_reverse_iterator operator+(difference_type count) const noexcept
+        {
+            arrnd_const_reverse_iterator temp{*this};
+            temp += count;
+            return temp;
+        }
 
-    template <typename Arrnd>
-    [[nodiscard]] inline constexpr arrnd_slice_front_insert_iterator<Arrnd> arrnd_slice_front_inserter(
-        Arrnd& cont, typename Arrnd::size_type axis = 0)
-    {
-        return arrnd_slice_front_insert_iterator<Arrnd>(cont, axis);
-    }
+        constexpr arrnd_const_reverse_iterator& operator--() noexcept
+        {
+            ++indexer_;
+            return *this;
+        }
 
-    template <typename Arrnd>
-    class arrnd_slice_insert_iterator {
-    public:
-        using iterator_category = std::output_iterator_tag;
-        using size_type = typename Arrnd::size_type;
+        constexpr arrnd_const_reverse_iterator operator--(int) noexcept
+        {
+            arrnd_const_reverse_iterator temp{*this};
+            ++(*this);
+            return temp;
+        }
 
-        constexpr arrnd_slice_insert_iterator() noexcept = default;
+        constexpr arrnd_const_reverse_iterator& operator-=(difference_type count) noexcept
+        {
+            indexer_ += count;
+            return *this;
+        }
 
-        explicit arrnd_slice_insert_iterator(Arrnd& cont, size_type ind = 0, size_type axis = 0)
-            : cont_(std::addressof(cont))
-            , ind_(ind)
-            , axis_(axis)
-        { }
+        constexpr arrnd_const_reverse_iterator operator-(difference_type count) const noexcept
+        {
+            arrnd_const_reverse_iterator temp{*this};
+            temp -= count;
+            return temp;
+        }
 
-        arrnd_slice_insert_iterator& operator=(const Arrnd& cont)
+        [[nodiscard]] constexpr const reference operator*() const noexcept
         {
-            cont_->insert(cont, ind_, axis_);
-            ind_ += cont.info().dims()[axis_];
-            return *this;
+            return data_[*indexer_];
         }
 
-        arrnd_slice_insert_iterator& operator=(Arrnd&& cont)
+        [[nodiscard]] constexpr bool operator==(const arrnd_const_reverse_iterator& iter) const noexcept
         {
-            cont_->insert(std::move(cont), ind_, axis_);
-            ind_ += cont.info().dims()[axis_];
-            return *this;
+            return indexer_ == iter.indexer_;
         }
 
-        [[nodiscard]] arrnd_slice_insert_iterator& operator*()
+        [[nodiscard]] constexpr bool operator<(const arrnd_const_reverse_iterator& iter) const noexcept
         {
-            return *this;
+            return iter.indexer_ < indexer_;
         }
 
-        arrnd_slice_insert_iterator& operator++()
+        [[nodiscard]] constexpr bool operator<=(const arrnd_const_reverse_iterator& iter) const noexcept
         {
-            return *this;
+            return iter.indexer_ <= indexer_;
         }
 
-        arrnd_slice_insert_iterator operator++(int)
+        [[nodiscard]] constexpr const reference operator[](difference_type index) const noexcept
         {
-            return *this;
+            return data_[*indexer_[index]];
         }
 
-    protected:
-        Arrnd* cont_ = nullptr;
-        size_type ind_;
-        size_type axis_;
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_const_reverse_iterator& other) const noexcept
+        {
+            return other.indexer_ - indexer_;
+        }
+
+    private:
+        indexer_type indexer_;
+        pointer data_ = nullptr;
     };
 
     template <typename Arrnd>
-    [[nodiscard]] inline constexpr arrnd_slice_insert_iterator<Arrnd> arrnd_slice_inserter(
-        Arrnd& cont, typename Arrnd::size_type ind = 0, typename Arrnd::size_type axis = 0)
-    {
-        return arrnd_slice_insert_iterator<Arrnd>(cont, ind, axis);
-    }
-}
-
-using details::arrnd_returned_element_iterator_tag;
-using details::arrnd_returned_slice_iterator_tag;
+    class arrnd_slice_const_iterator;
 
-using details::arrnd_iterator;
-using details::arrnd_const_iterator;
-using details::arrnd_reverse_iterator;
-using details::arrnd_const_reverse_iterator;
+    template <typename Arrnd>
+    class arrnd_slice_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = Arrnd;
+        using reference = Arrnd&;
 
-using details::arrnd_slice_iterator;
-using details::arrnd_slice_const_iterator;
-using details::arrnd_slice_reverse_iterator;
-using details::arrnd_slice_reverse_const_iterator;
+        using windows_slider_type = typename Arrnd::windows_slider_type;
 
-using details::arrnd_back_inserter;
-using details::arrnd_front_inserter;
-using details::arrnd_inserter;
+        friend arrnd_slice_const_iterator<Arrnd>;
 
-using details::arrnd_slice_back_inserter;
-using details::arrnd_slice_front_inserter;
-using details::arrnd_slice_inserter;
-}
+        explicit constexpr arrnd_slice_iterator(const value_type& arrnd_ref, const windows_slider_type& far)
+            : arrnd_ref_(arrnd_ref)
+            , far_(far)
+        {
+            if (far) {
+                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            }
+        }
 
-namespace oc::arrnd {
-namespace details {
-    struct arrnd_tag { };
-    template <typename T>
-    concept arrnd_type = std::is_same_v<typename std::remove_cvref_t<T>::tag, arrnd_tag>;
+        constexpr arrnd_slice_iterator() = default;
 
-    template <arrnd_type T>
-    [[nodiscard]] inline constexpr std::size_t arrnd_depth()
-    {
-        return T::depth + 1;
-    }
-    template <typename T>
-    [[nodiscard]] inline constexpr std::size_t arrnd_depth()
-    {
-        return 0;
-    }
+        constexpr arrnd_slice_iterator(const arrnd_slice_iterator& other) = default;
+        constexpr arrnd_slice_iterator& operator=(const arrnd_slice_iterator& other) = default;
 
-    template <typename Arrnd1, typename Arrnd2>
-    concept arrnd_depths_match = arrnd_type<Arrnd1> && arrnd_type<Arrnd2> && (Arrnd1::depth == Arrnd2::depth);
+        constexpr arrnd_slice_iterator(arrnd_slice_iterator&& other) noexcept = default;
+        constexpr arrnd_slice_iterator& operator=(arrnd_slice_iterator&& other) noexcept = default;
 
-    template <typename T, std::int64_t Depth>
-        requires(Depth >= 0 && Depth <= T::depth)
-    struct arrnd_inner {
-        using type = arrnd_inner<typename T::value_type, Depth - 1>::type;
-    };
-    template <typename T>
-    struct arrnd_inner<T, 0> {
-        using type = T;
-    };
-    template <typename Arrnd, std::int64_t Level = Arrnd::depth>
-        requires std::is_same_v<typename Arrnd::tag, arrnd_tag>
-    using arrnd_inner_t = arrnd_inner<Arrnd, Level>::type;
+        constexpr ~arrnd_slice_iterator() = default;
 
-    template <typename T>
-    struct typed {
-        using type = T;
-    };
+        constexpr arrnd_slice_iterator& operator++() noexcept
+        {
+            ++far_;
+            return *this;
+        }
 
-    // Replace type in nested arrnd at specific depth
+        constexpr arrnd_slice_iterator operator++(int) noexcept
+        {
+            arrnd_slice_iterator temp{*this};
+            ++(*this);
+            return temp;
+        }
 
-    template <typename T, typename R, std::size_t Depth>
-    struct arrnd_last_replaced_type_nested_tuple {
-        template <typename UT>
-        struct typed {
-            using type = UT;
-        };
+        constexpr arrnd_slice_iterator& operator+=(difference_type count) noexcept
+        {
+            far_ += count;
+            return *this;
+        }
 
-        template <typename UT, typename UR, std::size_t UDepth>
-        struct impl {
-            using type = std::tuple<UT, typename impl<typename UT::value_type, UR, UDepth - 1>::type>;
-        };
+        constexpr arrnd_slice_iterator operator+(difference_type count) const
+        {
+            arrnd_slice_iterator temp{*this};
+            temp += count;
+            return temp;
+        }
 
-        template <typename UT, typename UR>
-        struct impl<UT, UR, 0> {
-            using type = typename UT::template replaced_type<UR>;
-        };
+        constexpr arrnd_slice_iterator& operator--() noexcept
+        {
+            --far_;
+            return *this;
+        }
 
-        using type
-            = std::conditional_t<Depth == 0, std::tuple<typename T::template replaced_type<R>>, typename impl<T, R, Depth>::type>;
-    };
+        constexpr arrnd_slice_iterator operator--(int) noexcept
+        {
+            arrnd_slice_iterator temp{*this};
+            --(*this);
+            return temp;
+        }
 
-    template <typename T, typename R, std::size_t Depth>
-    using arrnd_last_replaced_type_nested_tuple_t = typename arrnd_last_replaced_type_nested_tuple<T, R, Depth>::type;
+        constexpr arrnd_slice_iterator& operator-=(difference_type count) noexcept
+        {
+            far_ -= count;
+            return *this;
+        }
 
-    template <typename T>
-    struct flat_tuple {
-        using type = std::tuple<T>;
-    };
+        constexpr arrnd_slice_iterator operator-(difference_type count) const noexcept
+        {
+            arrnd_slice_iterator temp{*this};
+            temp -= count;
+            return temp;
+        }
 
-    template <typename... Args>
-    struct flat_tuple<std::tuple<Args...>> {
-        using type = decltype(std::tuple_cat(typename flat_tuple<Args>::type{}...));
-    };
-
-    template <typename Tuple>
-    using flat_tuple_t = typename flat_tuple<Tuple>::type;
-
-    template <typename Tuple, std::size_t Depth>
-    struct arrnd_fold_tuple {
-        static constexpr std::size_t idx = std::tuple_size_v<Tuple> - 1;
-        using type = typename std::tuple_element_t<idx - Depth,
-            Tuple>::template replaced_type<typename arrnd_fold_tuple<Tuple, Depth - 1>::type>;
-    };
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            return slice_;
+        }
 
-    template <typename Tuple>
-    struct arrnd_fold_tuple<Tuple, 1> {
-        static constexpr std::size_t idx = std::tuple_size_v<Tuple> - 1;
-        using type =
-            typename std::tuple_element_t<idx - 1, Tuple>::template replaced_type<std::tuple_element_t<idx - 0, Tuple>>;
-    };
+        [[nodiscard]] constexpr bool operator==(const arrnd_slice_iterator& iter) const noexcept
+        {
+            return far_ == iter.far_;
+        }
 
-    template <typename Tuple>
-    struct arrnd_fold_tuple<Tuple, 0> {
-        static constexpr int idx = std::tuple_size_v<Tuple> - 1;
-        using type = std::tuple_element_t<idx - 0, Tuple>;
-    };
+        [[nodiscard]] constexpr bool operator<(const arrnd_slice_iterator& iter) const noexcept
+        {
+            return far_ < iter.far_;
+        }
 
-    template <typename Tuple>
-    using arrnd_fold_tuple_t = typename arrnd_fold_tuple<Tuple, std::tuple_size_v<Tuple> - 1>::type;
+        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_iterator& iter) const noexcept
+        {
+            return far_ <= iter.far_;
+        }
 
-    template <typename T, typename R, std::size_t Depth>
-    struct arrnd_replaced_inner_type {
-        using type = arrnd_fold_tuple_t<flat_tuple_t<arrnd_last_replaced_type_nested_tuple_t<T, R, Depth>>>;
-    };
+        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
+        {
+            auto ranges = far_[index];
+            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+        }
 
-    template <typename T, typename R, std::size_t Depth>
-    using arrnd_replaced_inner_type_t = arrnd_replaced_inner_type<T, R, Depth>::type;
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_slice_iterator& other) const noexcept
+        {
+            return far_ - other.far_;
+        }
 
-    // ----------------------------------------------
+    private:
+        value_type arrnd_ref_;
+        windows_slider_type far_;
 
-    template <typename Arrnd, std::size_t Depth>
-        requires(Depth >= 0)
-    struct arrnd_nested {
-        using type = typename Arrnd::template replaced_type<typename arrnd_nested<Arrnd, Depth - 1>::type>;
+        mutable value_type slice_;
     };
 
     template <typename Arrnd>
-    struct arrnd_nested<Arrnd, 0> {
-        using type = Arrnd;
-    };
-
-    template <typename Arrnd, std::size_t Depth>
-    using arrnd_nested_t = arrnd_nested<Arrnd, Depth>::type;
-
-    template <typename Arrnd1, typename Arrnd2, std::size_t Depth = std::min(Arrnd1::depth, Arrnd2::depth)>
-    using arrnd_tol_type = decltype(typename std::remove_cvref_t<Arrnd1>::template inner_type<Depth>::value_type{} -
-        typename std::remove_cvref_t<Arrnd2>::template inner_type<Depth>::value_type{});
-
-    template <typename Arrnd1, typename T, std::size_t Depth = Arrnd1::depth>
-    using arrnd_lhs_tol_type
-        = decltype(typename std::remove_cvref_t<Arrnd1>::template inner_type<Depth>::value_type{} - std::remove_cvref_t<T>{});
-
-    template <typename T, typename Arrnd2, std::size_t Depth = Arrnd2::depth>
-    using arrnd_rhs_tol_type
-        = decltype(std::remove_cvref_t<T>{} - typename std::remove_cvref_t<Arrnd2>::template inner_type<Depth>::value_type{});
-
-    enum class arrnd_common_shape { vector, row, column };
-
-    template <arrnd_type Arrnd, typename Constraint>
-    class arrnd_lazy_filter {
+    class arrnd_slice_const_iterator {
     public:
-        constexpr arrnd_lazy_filter() = delete;
-
-        explicit constexpr arrnd_lazy_filter(Arrnd arr_ref, Constraint constraint)
-            : arr_ref_(arr_ref)
-            , constraint_(constraint)
-        { }
-
-        [[nodiscard]] constexpr operator Arrnd() const
-        {
-            return arr_ref_.filter(constraint_);
-        }
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = Arrnd;
+        using const_reference = const Arrnd&;
 
-        [[nodiscard]] constexpr Arrnd operator()() const
-        {
-            return arr_ref_.filter(constraint_);
-        }
+        using windows_slider_type = typename Arrnd::windows_slider_type;
 
-        constexpr arrnd_lazy_filter(arrnd_lazy_filter&& other) = default;
-        template <arrnd_type OtherArrnd, typename OtherConstraint>
-        constexpr arrnd_lazy_filter& operator=(arrnd_lazy_filter<OtherArrnd, OtherConstraint>&& other)
+        explicit constexpr arrnd_slice_const_iterator(const value_type& arrnd_ref, const windows_slider_type& far)
+            : arrnd_ref_(arrnd_ref)
+            , far_(far)
         {
-            // copy array elements from one proxy to another according to mask
-
-            if (arr_ref_.empty()) {
-                return *this;
+            if (far) {
+                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
             }
+        }
 
-            // the user is responsible that the number of elements in both constraints is the same
+        constexpr arrnd_slice_const_iterator() = default;
 
-            auto other_filtered = static_cast<OtherArrnd>(other);
+        constexpr arrnd_slice_const_iterator(const arrnd_slice_const_iterator& other) = default;
+        constexpr arrnd_slice_const_iterator& operator=(const arrnd_slice_const_iterator& other) = default;
 
-            arr_ref_.copy_from(other_filtered, constraint_);
+        constexpr arrnd_slice_const_iterator(arrnd_slice_const_iterator&& other) noexcept = default;
+        constexpr arrnd_slice_const_iterator& operator=(arrnd_slice_const_iterator&& other) noexcept = default;
 
-            (void)arrnd_lazy_filter<OtherArrnd, OtherConstraint>(std::move(other));
+        constexpr ~arrnd_slice_const_iterator() = default;
 
+        constexpr arrnd_slice_const_iterator(const arrnd_slice_iterator<Arrnd>& other)
+            : arrnd_ref_(other.arrnd_ref_)
+            , far_(other.far_)
+            , slice_(other.slice_)
+        { }
+        constexpr arrnd_slice_const_iterator& operator=(const arrnd_slice_iterator<Arrnd>& other)
+        {
+            arrnd_ref_ = other.arrnd_ref_;
+            far_ = other.far_;
+            slice_ = other.slice_;
             return *this;
         }
 
-        constexpr arrnd_lazy_filter(const arrnd_lazy_filter& other) = delete;
-        constexpr arrnd_lazy_filter& operator=(const arrnd_lazy_filter& other) = delete;
-
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator(arrnd_slice_iterator<Arrnd>&& other)
+            : arrnd_ref_(std::move(other.arrnd_ref_))
+            , far_(std::move(other.far_))
+            , slice_(std::move(other.slice_))
+        { }
+        constexpr arrnd_slice_const_iterator& operator=(arrnd_slice_iterator<Arrnd>&& other)
         {
-            arr_ref_.copy_from(other, constraint_);
+            arrnd_ref_ = std::move(other.arrnd_ref_);
+            far_ = std::move(other.far_);
+            slice_ = std::move(other.slice_);
             return *this;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator+=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator& operator++() noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) + other, constraint_);
+            ++far_;
             return *this;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator-=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator operator++(int) noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) - other, constraint_);
-            return *this;
+            arrnd_slice_const_iterator temp{*this};
+            ++(*this);
+            return temp;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator*=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator& operator+=(difference_type count) noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) * other, constraint_);
+            far_ += count;
             return *this;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator/=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator operator+(difference_type count) const noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) / other, constraint_);
-            return *this;
+            arrnd_slice_const_iterator temp{*this};
+            temp += count;
+            return temp;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator%=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator& operator--() noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) % other, constraint_);
+            --far_;
             return *this;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator^=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator operator--(int) noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) ^ other, constraint_);
-            return *this;
+            arrnd_slice_const_iterator temp{*this};
+            --(*this);
+            return temp;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator&=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator& operator-=(difference_type count) noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) & other, constraint_);
+            far_ -= count;
             return *this;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator|=(const Arrnd& other) &&
+        constexpr arrnd_slice_const_iterator operator-(difference_type count) const noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) | other, constraint_);
-            return *this;
+            arrnd_slice_const_iterator temp{*this};
+            temp -= count;
+            return temp;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator<<=(const Arrnd& other) &&
+        [[nodiscard]] constexpr const_reference operator*() const noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) << other, constraint_);
-            return *this;
+            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            return slice_;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator>>=(const Arrnd& other) &&
+        [[nodiscard]] constexpr bool operator==(const arrnd_slice_const_iterator& iter) const noexcept
         {
-            arr_ref_.copy_from(arr_ref_.filter(constraint_) >> other, constraint_);
-            return *this;
+            return far_ == iter.far_;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator+=(const U& value) &&
+        [[nodiscard]] constexpr bool operator<(const arrnd_slice_const_iterator& iter) const noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ + value, constraint_);
-            return *this;
+            return far_ < iter.far_;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator-=(const U& value) &&
+        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_const_iterator& iter) const noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ - value, constraint_);
-            return *this;
+            return far_ <= iter.far_;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator*=(const U& value) &&
+        [[nodiscard]] constexpr const_reference operator[](difference_type index) const noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ * value, constraint_);
-            return *this;
+            auto ranges = far_[index];
+            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator/=(const U& value) &&
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_slice_const_iterator& other) const noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ / value, constraint_);
-            return *this;
+            return far_ - other.far_;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator%=(const U& value) &&
-        {
-            *this = arrnd_lazy_filter(arr_ref_ % value, constraint_);
-            return *this;
+    private:
+        value_type arrnd_ref_;
+        windows_slider_type far_;
+
+        mutable value_type slice_;
+    };
+
+    template <typename Arrnd>
+    class arrnd_slice_reverse_const_iterator;
+
+    template <typename Arrnd>
+    class arrnd_slice_reverse_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = Arrnd;
+        using reference = Arrnd&;
+
+        using windows_slider_type = typename Arrnd::windows_slider_type;
+
+        friend arrnd_slice_reverse_const_iterator<Arrnd>;
+
+        explicit constexpr arrnd_slice_reverse_iterator(const value_type& arrnd_ref, const windows_slider_type& far)
+            : arrnd_ref_(arrnd_ref)
+            , far_(far)
+        {
+            if (far) {
+                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            }
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator^=(const U& value) &&
+        constexpr arrnd_slice_reverse_iterator() = default;
+
+        constexpr arrnd_slice_reverse_iterator(const arrnd_slice_reverse_iterator& other) = default;
+        constexpr arrnd_slice_reverse_iterator& operator=(const arrnd_slice_reverse_iterator& other) = default;
+
+        constexpr arrnd_slice_reverse_iterator(arrnd_slice_reverse_iterator&& other) noexcept = default;
+        constexpr arrnd_slice_reverse_iterator& operator=(arrnd_slice_reverse_iterator&& other) noexcept = default;
+
+        constexpr ~arrnd_slice_reverse_iterator() = default;
+
+        constexpr arrnd_slice_reverse_iterator& operator--() noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ ^ value, constraint_);
+            ++far_;
             return *this;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator&=(const U& value) &&
+        constexpr arrnd_slice_reverse_iterator operator--(int) noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ & value, constraint_);
-            return *this;
+            arrnd_slice_reverse_iterator temp{*this};
+            ++(*this);
+            return temp;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator|=(const U& value) &&
+        constexpr arrnd_slice_reverse_iterator& operator-=(difference_type count) noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ | value, constraint_);
+            far_ += count;
             return *this;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator<<=(const U& value) &&
+        constexpr arrnd_slice_reverse_iterator operator-(difference_type count) const noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ << value, constraint_);
-            return *this;
+            arrnd_slice_reverse_iterator temp{*this};
+            temp += count;
+            return temp;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator>>=(const U& value) &&
+        constexpr arrnd_slice_reverse_iterator& operator++() noexcept
         {
-            *this = arrnd_lazy_filter(arr_ref_ >> value, constraint_);
+            --far_;
             return *this;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator++() &&
+        constexpr arrnd_slice_reverse_iterator operator++(int) noexcept
         {
-            auto c = arr_ref_.clone();
-            *this = arrnd_lazy_filter(++c, constraint_);
-            return *this;
+            arrnd_slice_reverse_iterator temp{*this};
+            --(*this);
+            return temp;
         }
 
-        template <arrnd_type Arrnd>
-        constexpr arrnd_lazy_filter& operator--() &&
+        constexpr arrnd_slice_reverse_iterator& operator+=(difference_type count) noexcept
         {
-            auto c = arr_ref_.clone();
-            *this = arrnd_lazy_filter(--c, constraint_);
+            far_ -= count;
             return *this;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd_lazy_filter& operator=(const U& value) &&
+        constexpr arrnd_slice_reverse_iterator operator+(difference_type count) const noexcept
         {
-            if (arr_ref_.empty()) {
-                return *this;
-            }
+            arrnd_slice_reverse_iterator temp{*this};
+            temp -= count;
+            return temp;
+        }
 
-            if constexpr (arrnd_type<Constraint>) {
-                // constraint is a mask
-                if constexpr (std::is_same_v<bool, typename Constraint::value_type>) {
-                    if (!std::equal(std::begin(arr_ref_.info().dims()), std::end(arr_ref_.info().dims()),
-                            std::begin(constraint_.info().dims()), std::end(constraint_.info().dims()))) {
-                        throw std::invalid_argument("invalid mask constraint");
-                    }
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            return slice_;
+        }
 
-                    for (auto t : zip(zipped(arr_ref_), zipped(constraint_))) {
-                        if (std::get<1>(t)) {
-                            std::get<0>(t) = value;
-                        }
-                    }
-                }
-                // constraint is indices
-                else if constexpr (arrnd_type<Constraint>) {
-                    for (auto index : constraint_) {
-                        arr_ref_[index] = value;
-                    }
-                }
-            }
-            // constraint might be predicator
-            else {
-                for (auto& element : arr_ref_) {
-                    if (constraint_(element)) {
-                        element = value;
-                    }
-                }
-            }
+        [[nodiscard]] constexpr bool operator==(const arrnd_slice_reverse_iterator& iter) const noexcept
+        {
+            return far_ == iter.far_;
+        }
 
-            return *this;
+        [[nodiscard]] constexpr bool operator<(const arrnd_slice_reverse_iterator& iter) const noexcept
+        {
+            return far_ > iter.far_;
         }
 
-        virtual constexpr ~arrnd_lazy_filter() = default;
+        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_reverse_iterator& iter) const noexcept
+        {
+            return far_ >= iter.far_;
+        }
 
-    private:
-        Arrnd arr_ref_;
-        Constraint constraint_;
-    };
+        [[nodiscard]] constexpr reference operator[](difference_type index) const noexcept
+        {
+            auto ranges = far_[index];
+            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+        }
 
-    template <arrnd_type Arrnd, iterator_of_type_integral DimsIt>
-    [[nodiscard]] inline constexpr auto zeros(DimsIt first_dim, DimsIt last_dim)
-    {
-        return Arrnd(first_dim, last_dim, 0);
-    }
+        [[nodiscard]] constexpr difference_type operator-(const arrnd_slice_reverse_iterator& other) const noexcept
+        {
+            return far_ - other.far_;
+        }
 
-    template <arrnd_type Arrnd, iterable_of_type_integral Cont>
-    [[nodiscard]] inline constexpr auto zeros(const Cont& dims)
-    {
-        return zeros<Arrnd>(std::begin(dims), std::end(dims));
-    }
+    private:
+        value_type arrnd_ref_;
+        windows_slider_type far_;
 
-    template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto zeros(std::initializer_list<typename Arrnd::size_type> dims)
-    {
-        return zeros<Arrnd>(dims.begin(), dims.end());
-    }
+        mutable value_type slice_;
+    };
 
-    template <arrnd_type Arrnd, iterator_of_type_integral DimsIt>
-    [[nodiscard]] inline constexpr auto eye(DimsIt first_dim, DimsIt last_dim)
-    {
-        auto ndims = std::distance(first_dim, last_dim);
+    template <typename Arrnd>
+    class arrnd_slice_reverse_const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = typename Arrnd::difference_type;
+        using value_type = Arrnd;
+        using const_reference = const Arrnd&;
 
-        if (ndims < 2) {
-            throw std::invalid_argument("invalid dims - should be at least matrix");
-        }
+        using windows_slider_type = typename Arrnd::windows_slider_type;
 
-        auto eye_impl = [](typename Arrnd::size_type r, typename Arrnd::size_type c) {
-            if (r == 0 || c == 0) {
-                return Arrnd{};
+        explicit constexpr arrnd_slice_reverse_const_iterator(
+            const value_type& arrnd_ref, const windows_slider_type& far)
+            : arrnd_ref_(arrnd_ref)
+            , far_(far)
+        {
+            if (far) {
+                slice_ = arrnd_ref[std::make_pair((*far_).cbegin(), (*far_).cend())];
             }
-            Arrnd res({r, c}, typename Arrnd::value_type{0});
+        }
 
-            auto n = std::min(r, c);
+        constexpr arrnd_slice_reverse_const_iterator() = default;
 
-            typename Arrnd::size_type one_ind = 0;
+        constexpr arrnd_slice_reverse_const_iterator(const arrnd_slice_reverse_const_iterator& other) = default;
+        constexpr arrnd_slice_reverse_const_iterator& operator=(const arrnd_slice_reverse_const_iterator& other)
+            = default;
 
-            for (typename Arrnd::size_type i = 0; i < n; ++i) {
-                res[one_ind] = typename Arrnd::value_type{1};
-                one_ind += c + 1;
-            }
+        constexpr arrnd_slice_reverse_const_iterator(arrnd_slice_reverse_const_iterator&& other) noexcept = default;
+        constexpr arrnd_slice_reverse_const_iterator& operator=(arrnd_slice_reverse_const_iterator&& other) noexcept
+            = default;
 
-            return res;
-        };
+        constexpr ~arrnd_slice_reverse_const_iterator() = default;
 
-        if (ndims == 2) {
-            return eye_impl(*first_dim, *std::next(first_dim, 1));
+        constexpr arrnd_slice_reverse_const_iterator(const arrnd_slice_reverse_iterator<Arrnd>& other)
+            : arrnd_ref_(other.arrnd_ref_)
+            , far_(other.far_)
+            , slice_(other.slice_)
+        { }
+        constexpr arrnd_slice_reverse_const_iterator& operator=(const arrnd_slice_reverse_iterator<Arrnd>& other)
+        {
+            arrnd_ref_ = other.arrnd_ref_;
+            far_ = other.far_;
+            slice_ = other.slice_;
+            return *this;
         }
 
-        Arrnd res(first_dim, last_dim, typename Arrnd::value_type{0});
-        return res.browse(2, [eye_impl](auto page) {
-            return eye_impl(page.info().dims().front(), page.info().dims().back());
-        });
-    }
+        constexpr arrnd_slice_reverse_const_iterator(arrnd_slice_reverse_iterator<Arrnd>&& other)
+            : arrnd_ref_(std::move(other.arrnd_ref_))
+            , far_(std::move(other.far_))
+            , slice_(std::move(other.slice_))
+        { }
+        constexpr arrnd_slice_reverse_const_iterator& operator=(arrnd_slice_reverse_iterator<Arrnd>&& other)
+        {
+            arrnd_ref_ = std::move(other.arrnd_ref_);
+            far_ = std::move(other.far_);
+            slice_ = std::move(other.slice_);
+            return *this;
+        }
 
-    template <arrnd_type Arrnd, iterable_of_type_integral Cont>
-    [[nodiscard]] inline constexpr auto eye(const Cont& dims)
-    {
-        return eye<Arrnd>(std::begin(dims), std::end(dims));
-    }
+        constexpr arrnd_slice_reverse_const_iterator& operator--() noexcept
+        {
+            ++far_;
+            return *this;
+        }
 
-    template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto eye(std::initializer_list<typename Arrnd::size_type> dims)
-    {
-        return eye<Arrnd>(dims.begin(), dims.end());
-    }
+        constexpr arrnd_slice_reverse_const_iterator operator--(int) noexcept
+        {
+            arrnd_slice_reverse_const_iterator temp{*this};
+            ++(*this);
+            return temp;
+        }
 
-    enum class arrnd_traversal_type { dfs, bfs };
-    enum class arrnd_traversal_result { apply, transform };
-    enum class arrnd_traversal_container { carry, propagate };
+        constexpr arrnd_slice_reverse_const_iterator& operator-=(difference_type count) noexcept
+        {
+            far_ += count;
+            return *this;
+        }
 
-    template <typename T, typename DataStorageTraits = simple_vector_traits<T>, typename ArrndInfo = arrnd_info<>>
-    class arrnd {
-        static_assert(std::is_same_v<T, typename DataStorageTraits::storage_type::value_type>);
+        constexpr arrnd_slice_reverse_const_iterator operator-(difference_type count) const noexcept
+        {
+            arrnd_slice_reverse_const_iterator temp{*this};
+            temp += count;
+            return temp;
+        }
 
-    public:
-        using tag = arrnd_tag;
+        constexpr arrnd_slice_reverse_const_iterator& operator++() noexcept
+        {
+            --far_;
+            return *this;
+        }
 
-        using data_storage_traits_type = DataStorageTraits;
+        constexpr arrnd_slice_reverse_const_iterator operator++(int) noexcept
+        {
+            arrnd_slice_reverse_const_iterator temp{*this};
+            --(*this);
+            return temp;
+        }
 
-        using storage_type = typename data_storage_traits_type::storage_type;
+        constexpr arrnd_slice_reverse_const_iterator& operator+=(difference_type count) noexcept
+        {
+            far_ -= count;
+            return *this;
+        }
 
-        template <typename U>
-        using allocator_template_type = typename data_storage_traits_type::template allocator_template_type<U>;
+        constexpr arrnd_slice_reverse_const_iterator operator+(difference_type count) const noexcept
+        {
+            arrnd_slice_reverse_const_iterator temp{*this};
+            temp -= count;
+            return temp;
+        }
 
-        using value_type = typename storage_type::value_type;
-        using size_type = typename storage_type::size_type;
-        using difference_type = typename storage_type::difference_type;
-        using reference = typename storage_type::reference;
-        using const_reference = typename storage_type::const_reference;
-        using pointer = typename storage_type::pointer;
-        using const_pointer = typename storage_type::const_pointer;
+        [[nodiscard]] constexpr const_reference operator*() const noexcept
+        {
+            slice_ = arrnd_ref_[std::make_pair((*far_).cbegin(), (*far_).cend())];
+            return slice_;
+        }
 
-        using info_type = ArrndInfo;
+        [[nodiscard]] constexpr bool operator==(const arrnd_slice_reverse_const_iterator& iter) const noexcept
+        {
+            return far_ == iter.far_;
+        }
 
-        using indexer_type = arrnd_indexer<info_type>;
-        using windows_slider_type = arrnd_windows_slider<info_type>;
+        [[nodiscard]] constexpr bool operator<(const arrnd_slice_reverse_const_iterator& iter) const noexcept
+        {
+            return far_ > iter.far_;
+        }
 
-        using boundary_type = typename info_type::boundary_type;
-        using window_type = typename windows_slider_type::window_type;
+        [[nodiscard]] constexpr bool operator<=(const arrnd_slice_reverse_const_iterator& iter) const noexcept
+        {
+            return far_ >= iter.far_;
+        }
 
-        using this_type = arrnd<T, data_storage_traits_type, info_type>;
-        template <typename U>
-        using replaced_type = arrnd<U, typename data_storage_traits_type::template replaced_type<U>, info_type>;
+        [[nodiscard]] constexpr const_reference operator[](difference_type index) const noexcept
+        {
+            auto ranges = far_[index];
+            return arrnd_ref_[std::make_pair(ranges.cbegin(), ranges.cend())];
+        }
 
-        template <std::size_t Depth>
-        using inner_type = arrnd_inner_t<this_type, Depth>;
-        template <typename U, std::size_t Depth>
-        using replaced_inner_type = arrnd_replaced_inner_type_t<this_type, U, Depth>;
+        [[nodiscard]] constexpr difference_type operator-(
+            const arrnd_slice_reverse_const_iterator& other) const noexcept
+        {
+            return far_ - other.far_;
+        }
 
-        using iterator = arrnd_iterator<this_type>;
-        using const_iterator = arrnd_const_iterator<this_type>;
-        using reverse_iterator = arrnd_reverse_iterator<this_type>;
-        using const_reverse_iterator = arrnd_const_reverse_iterator<this_type>;
+    private:
+        value_type arrnd_ref_;
+        windows_slider_type far_;
 
-        using slice_iterator = arrnd_slice_iterator<this_type>;
-        using const_slice_iterator = arrnd_slice_const_iterator<this_type>;
-        using reverse_slice_iterator = arrnd_slice_reverse_iterator<this_type>;
-        using const_reverse_slice_iterator = arrnd_slice_reverse_const_iterator<this_type>;
+        mutable value_type slice_;
+    };
 
-        constexpr static std::size_t depth = arrnd_depth<T>();
-        constexpr static bool is_flat = (depth == 0);
+    template <typename Arrnd>
+    class arrnd_back_insert_iterator {
+    public:
+        using iterator_category = std::output_iterator_tag;
 
-        template <std::size_t Depth>
-        using nested_t = arrnd_nested_t<this_type, Depth>;
+        constexpr arrnd_back_insert_iterator() noexcept = default;
 
-        constexpr arrnd() = default;
+        explicit arrnd_back_insert_iterator(Arrnd& cont) noexcept
+            : cont_(std::addressof(cont))
+        { }
 
-        constexpr arrnd(arrnd&& other) = default;
-        template <arrnd_type Arrnd>
-            requires arrnd_depths_match<arrnd, Arrnd>
-        constexpr arrnd(Arrnd&& other)
+        arrnd_back_insert_iterator& operator=(const Arrnd& cont)
         {
-            *this = other.clone<this_type>();
-            (void)Arrnd(std::move(other));
+            cont_->push_back(cont);
+            return *this;
         }
-        constexpr arrnd& operator=(arrnd&& other) & = default;
-        constexpr arrnd& operator=(arrnd&& other) &&
-        {
-            if (&other == this) {
-                return *this;
-            }
 
-            copy_from(other);
-            (void)arrnd(std::move(other));
+        arrnd_back_insert_iterator& operator=(Arrnd&& cont)
+        {
+            cont_->push_back(std::move(cont));
             return *this;
         }
-        template <arrnd_type Arrnd>
-            requires arrnd_depths_match<arrnd, Arrnd>
-        constexpr arrnd& operator=(Arrnd&& other) &
+
+        arrnd_back_insert_iterator& operator=(const typename Arrnd::value_type& value)
         {
-            *this = other.clone<this_type>();
-            (void)Arrnd(std::move(other));
+            cont_->push_back(Arrnd({1}, value));
             return *this;
         }
-        template <arrnd_type Arrnd>
-            requires arrnd_depths_match<arrnd, Arrnd>
-        constexpr arrnd& operator=(Arrnd&& other) &&
+
+        arrnd_back_insert_iterator& operator=(typename Arrnd::value_type&& value)
         {
-            copy_from(other);
-            (void)Arrnd(std::move(other));
+            cont_->push_back(std::move(Arrnd({1}, value)));
             return *this;
         }
 
-        constexpr arrnd(const arrnd& other) = default;
-        template <arrnd_type Arrnd>
-            requires arrnd_depths_match<arrnd, Arrnd>
-        constexpr arrnd(const Arrnd& other)
+        [[nodiscard]] arrnd_back_insert_iterator& operator*() noexcept
         {
-            *this = other.clone<this_type>();
+            return *this;
         }
-        constexpr arrnd& operator=(const arrnd& other) & = default;
-        constexpr arrnd& operator=(const arrnd& other) &&
+
+        arrnd_back_insert_iterator& operator++() noexcept
         {
-            if (&other == this) {
-                return *this;
-            }
+            return *this;
+        }
 
-            copy_from(other);
+        arrnd_back_insert_iterator operator++(int) noexcept
+        {
             return *this;
         }
-        template <arrnd_type Arrnd>
-            requires arrnd_depths_match<arrnd, Arrnd>
-        constexpr arrnd& operator=(const Arrnd& other) &
+
+    protected:
+        Arrnd* cont_ = nullptr;
+    };
+
+    template <typename Arrnd>
+    [[nodiscard]] inline constexpr arrnd_back_insert_iterator<Arrnd> arrnd_back_inserter(Arrnd& cont) noexcept
+    {
+        return arrnd_back_insert_iterator<Arrnd>(cont);
+    }
+
+    template <typename Arrnd>
+    class arrnd_front_insert_iterator {
+    public:
+        using iterator_category = std::output_iterator_tag;
+
+        constexpr arrnd_front_insert_iterator() noexcept = default;
+
+        explicit arrnd_front_insert_iterator(Arrnd& cont)
+            : cont_(std::addressof(cont))
+        { }
+
+        arrnd_front_insert_iterator& operator=(const Arrnd& cont)
         {
-            *this = other.clone<this_type>();
+            cont_->push_front(cont);
             return *this;
         }
-        template <arrnd_type Arrnd>
-            requires arrnd_depths_match<arrnd, Arrnd>
-        constexpr arrnd& operator=(const Arrnd& other) &&
+
+        arrnd_front_insert_iterator& operator=(Arrnd&& cont)
         {
-            copy_from(other);
+            cont_->push_front(std::move(cont));
             return *this;
         }
 
-        template <typename U>
-            requires(!arrnd_type<U>)
-        constexpr arrnd& operator=(const U& value)
+        arrnd_front_insert_iterator& operator=(const typename Arrnd::value_type& value)
         {
-            if (empty()) {
-                return *this;
-            }
+            cont_->push_front(Arrnd({1}, value));
+            return *this;
+        }
 
-            std::fill(begin(), end(), value);
+        arrnd_front_insert_iterator& operator=(typename Arrnd::value_type&& value)
+        {
+            cont_->push_front(std::move(Arrnd({1}, value)));
+            return *this;
+        }
 
+        [[nodiscard]] arrnd_front_insert_iterator& operator*()
+        {
             return *this;
         }
 
-        virtual constexpr ~arrnd() = default;
+        arrnd_front_insert_iterator& operator++()
+        {
+            return *this;
+        }
 
-        explicit constexpr arrnd(const info_type& info, std::shared_ptr<storage_type> shared_storage)
-            : info_(info)
-            , shared_storage_(shared_storage)
+        arrnd_front_insert_iterator operator++(int)
         {
-            // check if the arrnd type invariant is legal.
-            if (!oc::arrnd::empty(info)) {
-                if (!shared_storage || std::empty(*shared_storage)) {
-                    throw std::invalid_argument("invalid null or empty shared storage");
-                }
-                if (!(info.indices_boundary().start() < shared_storage->size()
-                        && info.indices_boundary().stop() <= shared_storage->size())) {
-                    throw std::invalid_argument("invalid shared storage size not in indices boundaries");
-                }
-            }
+            return *this;
         }
 
-        template <iterator_of_type_integral InputDimsIt, iterator_type InputDataIt>
-        explicit constexpr arrnd(
-            InputDimsIt first_dim, InputDimsIt last_dim, InputDataIt first_data, InputDataIt last_data)
-            : info_(first_dim, last_dim)
-            , shared_storage_(oc::arrnd::empty(info_)
-                      ? nullptr
-                      : std::allocate_shared<storage_type>(
-                          allocator_template_type<storage_type>(), first_data, last_data))
-        {
-            // in case that data buffer allocated, check the number of data elements is valid
-            if (shared_storage_ && std::distance(first_data, last_data) != oc::arrnd::total(info_)) {
-                throw std::invalid_argument("number of elements by dims is not match to the number of data elements");
-            }
-        }
+    protected:
+        Arrnd* cont_ = nullptr;
+    };
 
-        template <typename U>
-        explicit constexpr arrnd(std::initializer_list<size_type> dims, std::initializer_list<U> data)
-            : arrnd(dims.begin(), dims.end(), data.begin(), data.end())
-        { }
+    template <typename Arrnd>
+    [[nodiscard]] inline constexpr arrnd_front_insert_iterator<Arrnd> arrnd_front_inserter(Arrnd& cont)
+    {
+        return arrnd_front_insert_iterator<Arrnd>(cont);
+    }
 
-        template <iterable_of_type_integral Cont, iterable_type DataCont>
-            requires(!template_type<DataCont, std::initializer_list>)
-        explicit constexpr arrnd(const Cont& dims, const DataCont& data)
-            : arrnd(std::begin(dims), std::end(dims), std::begin(data), std::end(data))
-        { }
+    template <typename Arrnd>
+    class arrnd_insert_iterator {
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using size_type = typename Arrnd::size_type;
 
-        template <iterator_of_type_integral InputDimsIt>
-        explicit constexpr arrnd(const InputDimsIt& first_dim, const InputDimsIt& last_dim)
-            : info_(first_dim, last_dim)
-            , shared_storage_(oc::arrnd::empty(info_)
-                      ? nullptr
-                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
-        { }
-        template <iterable_of_type_integral Cont>
-        explicit constexpr arrnd(const Cont& dims)
-            : arrnd(std::begin(dims), std::end(dims))
-        { }
-        explicit constexpr arrnd(std::initializer_list<size_type> dims)
-            : arrnd(dims.begin(), dims.end())
+        constexpr arrnd_insert_iterator() noexcept = default;
+
+        explicit arrnd_insert_iterator(Arrnd& cont, size_type ind = 0)
+            : cont_(std::addressof(cont))
+            , ind_(ind)
         { }
 
-        template <iterator_of_type_integral InputDimsIt>
-        explicit constexpr arrnd(InputDimsIt first_dim, InputDimsIt last_dim, const_reference value)
-            : info_(first_dim, last_dim)
-            , shared_storage_(oc::arrnd::empty(info_)
-                      ? nullptr
-                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        arrnd_insert_iterator& operator=(const Arrnd& cont)
         {
-            if (shared_storage_) {
-                std::fill(shared_storage_->begin(), shared_storage_->end(), value);
-            }
+            cont_->insert(cont, ind_);
+            ind_ += cont.info().numel();
+            return *this;
         }
-        template <iterable_of_type_integral Cont>
-        explicit constexpr arrnd(const Cont& dims, const_reference value)
-            : arrnd(std::begin(dims), std::end(dims), value)
-        { }
-        explicit constexpr arrnd(std::initializer_list<size_type> dims, const_reference value)
-            : arrnd(dims.begin(), dims.end(), value)
-        { }
 
-        template <iterator_of_type_integral InputDimsIt, typename U>
-        explicit constexpr arrnd(InputDimsIt first_dim, InputDimsIt last_dim, const U& value)
-            : info_(first_dim, last_dim)
-            , shared_storage_(oc::arrnd::empty(info_)
-                      ? nullptr
-                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        arrnd_insert_iterator& operator=(Arrnd&& cont)
         {
-            if (shared_storage_) {
-                std::fill(shared_storage_->begin(), shared_storage_->end(), value);
-            }
+            cont_->insert(std::move(cont), ind_);
+            ind_ += cont.info().numel();
+            return *this;
         }
-        template <iterable_of_type_integral Cont, typename U>
-        explicit constexpr arrnd(const Cont& dims, const U& value)
-            : arrnd(std::begin(dims), std::end(dims), value)
-        { }
-        template <typename U>
-        explicit constexpr arrnd(std::initializer_list<size_type> dims, const U& value)
-            : arrnd(dims.begin(), dims.end(), value)
-        { }
 
-        template <iterator_of_type_integral InputDimsIt, typename Func>
-            requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
-        explicit constexpr arrnd(InputDimsIt first_dim, InputDimsIt last_dim, Func&& func)
-            : info_(first_dim, last_dim)
-            , shared_storage_(oc::arrnd::empty(info_)
-                      ? nullptr
-                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        arrnd_insert_iterator& operator=(const typename Arrnd::value_type& value)
         {
-            if (shared_storage_) {
-                std::for_each(shared_storage_->begin(), shared_storage_->end(), [&func](auto& value) {
-                    value = static_cast<value_type>(func());
-                });
-            }
+            cont_->insert(Arrnd({1}, value), ind_);
+            ind_ += 1;
+            return *this;
         }
-        template <iterable_of_type_integral Cont, typename Func>
-            requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
-        explicit constexpr arrnd(const Cont& dims, Func&& func)
-            : arrnd(std::begin(dims), std::end(dims), std::forward<Func>(func))
-        { }
-        template <typename Func>
-            requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
-        explicit constexpr arrnd(std::initializer_list<size_type> dims, Func&& func)
-            : arrnd(dims.begin(), dims.end(), std::forward<Func>(func))
-        { }
 
-        [[nodiscard]] constexpr const info_type& info() const noexcept
+        arrnd_insert_iterator& operator=(typename Arrnd::value_type&& value)
         {
-            return info_;
+            cont_->insert(std::move(Arrnd({1}, value)), ind_);
+            ind_ += 1;
+            return *this;
         }
 
-        [[nodiscard]] constexpr info_type& info() noexcept
+        [[nodiscard]] arrnd_insert_iterator& operator*()
         {
-            return info_;
+            return *this;
         }
 
-        [[nodiscard]] constexpr const auto& shared_storage() const noexcept
+        arrnd_insert_iterator& operator++()
         {
-            return shared_storage_;
+            return *this;
         }
 
-        [[nodiscard]] constexpr auto& shared_storage() noexcept
+        arrnd_insert_iterator operator++(int)
         {
-            return shared_storage_;
+            return *this;
         }
 
-        [[nodiscard]] constexpr const this_type* creator() const noexcept
+    protected:
+        Arrnd* cont_ = nullptr;
+        size_type ind_;
+    };
+
+    template <typename Arrnd>
+    [[nodiscard]] inline constexpr arrnd_insert_iterator<Arrnd> arrnd_inserter(
+        Arrnd& cont, typename Arrnd::size_type ind = 0)
+    {
+        return arrnd_insert_iterator<Arrnd>(cont, ind);
+    }
+
+    template <typename Arrnd>
+    class arrnd_slice_back_insert_iterator {
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using size_type = typename Arrnd::size_type;
+
+        constexpr arrnd_slice_back_insert_iterator() noexcept = default;
+
+        explicit arrnd_slice_back_insert_iterator(Arrnd& cont, size_type axis = 0) noexcept
+            : cont_(std::addressof(cont))
+            , axis_(axis)
+        { }
+
+        arrnd_slice_back_insert_iterator& operator=(const Arrnd& cont)
         {
-            return creators_.is_creator_valid.expired() ? nullptr : creators_.latest_creator;
+            cont_->push_back(cont, axis_);
+            return *this;
         }
 
-        [[nodiscard]] explicit constexpr operator value_type() const
+        arrnd_slice_back_insert_iterator& operator=(Arrnd&& cont)
         {
-            if (!oc::arrnd::isscalar(info_)) {
-                throw std::exception("info is not scalar");
-            }
-            return (*this)[info_.indices_boundary().start()];
+            cont_->push_back(std::move(cont), axis_);
+            return *this;
         }
 
-        [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+        [[nodiscard]] arrnd_slice_back_insert_iterator& operator*() noexcept
         {
-            assert(shared_storage_);
-            assert(index >= info_.indices_boundary().start() && index < info_.indices_boundary().stop());
-            return shared_storage_->data()[index];
+            return *this;
         }
-        [[nodiscard]] constexpr reference operator[](size_type index) noexcept
+
+        arrnd_slice_back_insert_iterator& operator++() noexcept
         {
-            assert(shared_storage_);
-            assert(index >= info_.indices_boundary().start() && index < info_.indices_boundary().stop());
-            return shared_storage_->data()[index];
+            return *this;
         }
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr const_reference operator[](std::pair<InputIt, InputIt> subs) const noexcept
+        arrnd_slice_back_insert_iterator operator++(int) noexcept
         {
-            assert(shared_storage_);
-            return shared_storage_->data()[oc::arrnd::sub2ind(info_, subs.first, subs.second)];
+            return *this;
         }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr const_reference operator[](const Cont& subs) const noexcept
+
+    protected:
+        Arrnd* cont_ = nullptr;
+        size_type axis_;
+    };
+
+    template <typename Arrnd>
+    [[nodiscard]] inline constexpr arrnd_slice_back_insert_iterator<Arrnd> arrnd_slice_back_inserter(
+        Arrnd& cont, typename Arrnd::size_type axis = 0) noexcept
+    {
+        return arrnd_slice_back_insert_iterator<Arrnd>(cont, axis);
+    }
+
+    template <typename Arrnd>
+    class arrnd_slice_front_insert_iterator {
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using size_type = typename Arrnd::size_type;
+
+        constexpr arrnd_slice_front_insert_iterator() noexcept = default;
+
+        explicit arrnd_slice_front_insert_iterator(Arrnd& cont, size_type axis = 0)
+            : cont_(std::addressof(cont))
+            , axis_(axis)
+        { }
+
+        arrnd_slice_front_insert_iterator& operator=(const Arrnd& cont)
         {
-            return (*this)[std::make_pair(std::begin(subs), std::end(subs))];
+            cont_->insert(cont, 0, axis_);
+            return *this;
         }
-        [[nodiscard]] constexpr const_reference operator[](std::initializer_list<size_type> subs) const noexcept
+
+        arrnd_slice_front_insert_iterator& operator=(Arrnd&& cont)
         {
-            return (*this)[std::make_pair(subs.begin(), subs.end())];
+            cont_->insert(std::move(cont), 0, axis_);
+            return *this;
         }
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr reference operator[](std::pair<InputIt, InputIt> subs) noexcept
+        [[nodiscard]] arrnd_slice_front_insert_iterator& operator*()
         {
-            assert(shared_storage_);
-            return shared_storage_->data()[oc::arrnd::sub2ind(info_, subs.first, subs.second)];
+            return *this;
         }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr reference operator[](const Cont& subs) noexcept
+
+        arrnd_slice_front_insert_iterator& operator++()
         {
-            return (*this)[std::make_pair(std::begin(subs), std::end(subs))];
-        }
-        [[nodiscard]] constexpr reference operator[](std::initializer_list<size_type> subs) noexcept
-        {
-            return (*this)[std::make_pair(subs.begin(), subs.end())];
+            return *this;
         }
 
-        template <iterator_of_type_interval InputIt>
-        [[nodiscard]] constexpr this_type operator[](std::pair<InputIt, InputIt> boundaries) const&
-        {
-            this_type slice(oc::arrnd::slice(info_, boundaries.first, boundaries.second), shared_storage_);
-            slice.creators_.is_creator_valid = creators_.has_original_creator;
-            slice.creators_.latest_creator = this;
-            return slice;
-        }
-        template <iterator_of_type_interval InputIt>
-        [[nodiscard]] constexpr this_type operator[](std::pair<InputIt, InputIt> boundaries) const&&
-        {
-            return this_type(oc::arrnd::slice(info_, boundaries.first, boundaries.second), shared_storage_);
-        }
-        template <iterable_of_type_interval Cont>
-        [[nodiscard]] constexpr this_type operator[](const Cont& boundaries) const&
-        {
-            return (*this)[std::make_pair(std::cbegin(boundaries), std::cend(boundaries))];
-        }
-        template <iterable_of_type_interval Cont>
-        [[nodiscard]] constexpr this_type operator[](const Cont& boundaries) const&&
-        {
-            return std::move(*this)[std::make_pair(std::begin(boundaries), std::end(boundaries))];
-        }
-        [[nodiscard]] constexpr this_type operator[](std::initializer_list<boundary_type> boundaries) const&
-        {
-            return (*this)[std::make_pair(boundaries.begin(), boundaries.end())];
-        }
-        [[nodiscard]] constexpr this_type operator[](
-            std::initializer_list<boundary_type> boundaries) const&&
+        arrnd_slice_front_insert_iterator operator++(int)
         {
-            return std::move(*this)[std::make_pair(boundaries.begin(), boundaries.end())];
+            return *this;
         }
 
-        [[nodiscard]] constexpr this_type operator[](boundary_type boundary) const&
-        {
-            this_type slice(
-                oc::arrnd::squeeze(oc::arrnd::slice(info_, boundary, 0), arrnd_squeeze_type::left, 1), shared_storage_);
-            slice.creators_.is_creator_valid = creators_.has_original_creator;
-            slice.creators_.latest_creator = this;
-            return slice;
-        }
-        [[nodiscard]] constexpr this_type operator[](boundary_type boundary) const&&
-        {
-            return this_type(
-                oc::arrnd::squeeze(oc::arrnd::slice(info_, boundary, 0), arrnd_squeeze_type::left, 1), shared_storage_);
-        }
+    protected:
+        Arrnd* cont_ = nullptr;
+        size_type axis_;
+    };
 
-        [[nodiscard]] constexpr this_type operator()(boundary_type boundary, size_type axis) const&
-        {
-            this_type slice(oc::arrnd::slice(info_, boundary, axis), shared_storage_);
-            slice.creators_.is_creator_valid = creators_.has_original_creator;
-            slice.creators_.latest_creator = this;
-            return slice;
-        }
-        [[nodiscard]] constexpr this_type operator()(boundary_type boundary, size_type axis) const&&
-        {
-            return this_type(oc::arrnd::slice(info_, boundary, axis), shared_storage_);
-        }
+    template <typename Arrnd>
+    [[nodiscard]] inline constexpr arrnd_slice_front_insert_iterator<Arrnd> arrnd_slice_front_inserter(
+        Arrnd& cont, typename Arrnd::size_type axis = 0)
+    {
+        return arrnd_slice_front_insert_iterator<Arrnd>(cont, axis);
+    }
 
-        // access relative array indices, might be slow for slices
-        [[nodiscard]] constexpr const_reference operator()(size_type index) const noexcept
-        {
-            assert(index >= 0 && index <= total(info_));
-            return issliced(info_) ? shared_storage_->data()[oc::arrnd::ind2ind(info_, index)]
-                                   : shared_storage_->data()[index];
-        }
-        [[nodiscard]] constexpr reference operator()(size_type index) noexcept
-        {
-            assert(index >= 0 && index <= total(info_));
-            return issliced(info_) ? shared_storage_->data()[oc::arrnd::ind2ind(info_, index)]
-                                   : shared_storage_->data()[index];
-        }
+    template <typename Arrnd>
+    class arrnd_slice_insert_iterator {
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using size_type = typename Arrnd::size_type;
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto operator()(std::pair<InputIt, InputIt> indices) const
-        {
-            return std::move(*this)(replaced_type<size_type>(
-                {std::distance(indices.first, indices.second)}, indices.first, indices.second));
-        }
-        template <iterable_of_type_integral Cont>
-            requires(!arrnd_type<Cont>)
-        [[nodiscard]] constexpr auto operator()(const Cont& indices) const
-        {
-            return (*this)(replaced_type<size_type>({std::ssize(indices)}, std::begin(indices), std::end(indices)));
-        }
-        // more strict function than filter. in case of logical type arrnd, its being treated as mask
-        template <arrnd_type Arrnd>
-            requires(std::integral<typename Arrnd::value_type>)
-        [[nodiscard]] constexpr auto operator()(const Arrnd& selector) const
-        {
-            return arrnd_lazy_filter(*this, selector);
-        }
-        [[nodiscard]] constexpr auto operator()(std::initializer_list<size_type> indices) const
-        {
-            std::initializer_list<size_type> dims{std::size(indices)};
-            return (*this)(replaced_type<size_type>(dims.begin(), dims.end(), indices.begin(), indices.end()));
-        }
+        constexpr arrnd_slice_insert_iterator() noexcept = default;
 
-        [[nodiscard]] constexpr auto operator()(arrnd_common_shape shape) const
-        {
-            return reshape(shape);
-        }
+        explicit arrnd_slice_insert_iterator(Arrnd& cont, size_type ind = 0, size_type axis = 0)
+            : cont_(std::addressof(cont))
+            , ind_(ind)
+            , axis_(axis)
+        { }
 
-        template <typename Pred>
-            requires(!arrnd_type<Pred> && std::is_invocable_v<Pred, value_type>)
-        [[nodiscard]] constexpr auto operator()(Pred&& pred) const
+        arrnd_slice_insert_iterator& operator=(const Arrnd& cont)
         {
-            auto selector = [&pred](const value_type& value) {
-                return pred(value);
-            };
-
-            return arrnd_lazy_filter(*this, selector);
+            cont_->insert(cont, ind_, axis_);
+            ind_ += cont.info().dims()[axis_];
+            return *this;
         }
 
-        [[nodiscard]] constexpr bool empty() const noexcept
+        arrnd_slice_insert_iterator& operator=(Arrnd&& cont)
         {
-            return oc::arrnd::empty(info_);
+            cont_->insert(std::move(cont), ind_, axis_);
+            ind_ += cont.info().dims()[axis_];
+            return *this;
         }
 
-        template <iterator_type InputIt>
-        constexpr this_type& copy_from(InputIt first_data, InputIt last_data)
+        [[nodiscard]] arrnd_slice_insert_iterator& operator*()
         {
-            if (empty() || std::distance(first_data, last_data) <= 0) {
-                return *this;
-            }
-
-            for (auto t : zip(zipped(*this), zipped(first_data, last_data))) {
-                if constexpr (arrnd_type<value_type> && arrnd_type<decltype(std::get<1>(t))>) {
-                    std::get<0>(t).copy_from(std::begin(std::get<1>(t)), std::end(std::get<1>(t)));
-                } else {
-                    std::get<0>(t) = std::get<1>(t);
-                }
-            }
-
             return *this;
         }
 
-        template <iterable_type Cont>
-        constexpr this_type& copy_from(const Cont& data)
+        arrnd_slice_insert_iterator& operator++()
         {
-            return copy_from(std::begin(data), std::end(data));
+            return *this;
         }
 
-        template <typename U>
-        constexpr this_type& copy_from(std::initializer_list<U> data)
+        arrnd_slice_insert_iterator operator++(int)
         {
-            return copy_from(data.begin(), data.end());
+            return *this;
         }
 
-        template <iterator_type InputIt1, iterator_of_type_integral InputIt2>
-        constexpr this_type& copy_from(
-            InputIt1 first_data, InputIt1 last_data, InputIt2 first_index, InputIt2 last_index)
-        {
-            if (empty() || std::distance(first_data, last_data) <= 0 || std::distance(first_index, last_index) <= 0) {
-                return *this;
-            }
-
-            if (std::any_of(first_index, last_index, [&](auto index) {
-                    return index < info_.indices_boundary().start() || index >= info_.indices_boundary().stop();
-                })) {
-                throw std::invalid_argument("invalid input indices");
-            }
+    protected:
+        Arrnd* cont_ = nullptr;
+        size_type ind_;
+        size_type axis_;
+    };
 
-            for (auto t : zip(zipped(first_data, last_data), zipped(first_index, last_index))) {
-                if constexpr (arrnd_type<value_type> && arrnd_type<decltype(std::get<0>(t))>) {
-                    (*this)[std::get<1>(t)].copy_from(std::get<0>(t));
-                } else {
-                    (*this)[std::get<1>(t)] = std::get<0>(t);
-                }
-            }
+    template <typename Arrnd>
+    [[nodiscard]] inline constexpr arrnd_slice_insert_iterator<Arrnd> arrnd_slice_inserter(
+        Arrnd& cont, typename Arrnd::size_type ind = 0, typename Arrnd::size_type axis = 0)
+    {
+        return arrnd_slice_insert_iterator<Arrnd>(cont, ind, axis);
+    }
+}
 
-            return *this;
-        }
+using details::arrnd_returned_element_iterator_tag;
+using details::arrnd_returned_slice_iterator_tag;
 
-        template <iterable_type Cont1, iterable_of_type_integral Cont2>
-            requires(!std::is_same_v<bool, iterable_value_t<Cont2>>) // to prevent ambiguity with mask
-        constexpr this_type& copy_from(const Cont1& data, const Cont2& indices)
-        {
-            return copy_from(std::begin(data), std::end(data), std::begin(indices), std::end(indices));
-        }
+using details::arrnd_iterator;
+using details::arrnd_const_iterator;
+using details::arrnd_reverse_iterator;
+using details::arrnd_const_reverse_iterator;
 
-        template <typename U>
-        constexpr this_type& copy_from(std::initializer_list<U> data, std::initializer_list<size_type> indices)
-        {
-            return copy_from(data.begin(), data.end(), indices.begin(), indices.end());
-        }
+using details::arrnd_slice_iterator;
+using details::arrnd_slice_const_iterator;
+using details::arrnd_slice_reverse_iterator;
+using details::arrnd_slice_reverse_const_iterator;
 
-        template <arrnd_type Arrnd1, arrnd_type Arrnd2>
-            requires(std::is_same_v<bool, typename Arrnd2::value_type>)
-        constexpr this_type& copy_from(const Arrnd1& data, const Arrnd2& mask)
-        {
-            if (empty() || data.empty() || mask.empty()) {
-                return *this;
-            }
+using details::arrnd_back_inserter;
+using details::arrnd_front_inserter;
+using details::arrnd_inserter;
 
-            if (!std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(mask.info().dims()),
-                    std::end(mask.info().dims()))) {
-                throw std::invalid_argument("invalid mask dims");
-            }
+using details::arrnd_slice_back_inserter;
+using details::arrnd_slice_front_inserter;
+using details::arrnd_slice_inserter;
+}
 
-            auto dst_it = begin();
-            auto src_it = data.begin();
-            auto msk_it = mask.begin();
+namespace oc::arrnd {
+namespace details {
+    struct arrnd_tag { };
+    template <typename T>
+    concept arrnd_type = std::is_same_v<typename std::remove_cvref_t<T>::tag, arrnd_tag>;
 
-            for (; dst_it != end() && src_it != data.end() && msk_it != mask.end(); ++dst_it, ++msk_it) {
-                if (*msk_it) {
-                    if constexpr (arrnd_type<value_type> && arrnd_type<decltype(*src_it)>) {
-                        (*dst_it).copy_from(*src_it);
-                    } else {
-                        *dst_it = *src_it;
-                    }
-                    ++src_it;
-                }
-            }
-        }
+    struct arrnd_lazy_expr_tag { };
+    template <typename T>
+    concept arrnd_lazy_expr_type = std::is_same_v<typename std::remove_cvref_t<T>::tag, arrnd_lazy_expr_tag>;
 
-        template <iterator_type InputIt, typename Pred>
-            requires(std::is_invocable_v<Pred, value_type> && !arrnd_type<Pred>)
-        constexpr this_type& copy_from(InputIt first_data, InputIt last_data, Pred pred)
-        {
-            if (empty() || std::distance(first_data, last_data) <= 0) {
-                return *this;
-            }
+    template <arrnd_type T>
+    [[nodiscard]] inline constexpr std::size_t arrnd_depth()
+    {
+        return T::depth + 1;
+    }
+    template <typename T>
+    [[nodiscard]] inline constexpr std::size_t arrnd_depth()
+    {
+        return 0;
+    }
 
-            if (total(info_) < std::distance(first_data, last_data)) {
-                throw std::invalid_argument("invalid input data - number of input data might be small for array");
-            }
+    template <typename Arrnd1, typename Arrnd2>
+    concept arrnd_depths_match = arrnd_type<Arrnd1> && arrnd_type<Arrnd2> && (Arrnd1::depth == Arrnd2::depth);
 
-            auto dst_it = begin();
-            auto src_it = first_data;
+    template <typename T, std::int64_t Depth>
+        requires(Depth >= 0 && Depth <= T::depth)
+    struct arrnd_inner {
+        using type = arrnd_inner<typename T::value_type, Depth - 1>::type;
+    };
+    template <typename T>
+    struct arrnd_inner<T, 0> {
+        using type = T;
+    };
+    template <typename Arrnd, std::int64_t Level = Arrnd::depth>
+        requires std::is_same_v<typename Arrnd::tag, arrnd_tag>
+    using arrnd_inner_t = arrnd_inner<Arrnd, Level>::type;
 
-            for (; dst_it != end() && src_it != last_data; ++dst_it) {
-                if (pred(*dst_it)) {
-                    if constexpr (arrnd_type<value_type> && arrnd_type<decltype(*src_it)>) {
-                        (*dst_it).copy_from(*src_it);
-                    } else {
-                        *dst_it = *src_it;
-                    }
-                    ++src_it;
-                }
-            }
+    template <typename T>
+    struct typed {
+        using type = T;
+    };
 
-            return *this;
-        }
+    // Replace type in nested arrnd at specific depth
 
-        template <iterable_type Cont, typename Pred>
-            requires(std::is_invocable_v<Pred, value_type> && !arrnd_type<Pred>)
-        constexpr this_type& copy_from(const Cont& data, Pred&& pred)
-        {
-            return copy_from(std::begin(data), std::end(data), std::forward<Pred>(pred));
-        }
+    template <typename T, typename R, std::size_t Depth>
+    struct arrnd_last_replaced_type_nested_tuple {
+        template <typename UT>
+        struct typed {
+            using type = UT;
+        };
 
-        template <typename U, typename Pred>
-            requires(std::is_invocable_v<Pred, value_type> && !arrnd_type<Pred>)
-        constexpr this_type& copy_from(std::initializer_list<U> data, Pred&& pred)
-        {
-            return copy_from(data.begin(), data.end(), std::forward<Pred>(pred));
-        }
+        template <typename UT, typename UR, std::size_t UDepth>
+        struct impl {
+            using type = std::tuple<UT, typename impl<typename UT::value_type, UR, UDepth - 1>::type>;
+        };
 
-        template <iterator_type InputIt1, iterator_of_type_interval InputIt2>
-        constexpr this_type& copy_from(
-            InputIt1 first_data, InputIt1 last_data, InputIt2 first_boundary, InputIt2 last_boundary)
-        {
-            (*this)[std::make_pair(first_boundary, last_boundary)].copy_from(first_data, last_data);
-            return *this;
-        }
+        template <typename UT, typename UR>
+        struct impl<UT, UR, 0> {
+            using type = typename UT::template replaced_type<UR>;
+        };
 
-        template <iterable_type Cont1, iterable_of_type_interval Cont2>
-        constexpr this_type& copy_from(const Cont1& data, const Cont2& boundaries)
-        {
-            return copy_from(std::begin(data), std::end(data), std::begin(boundaries), std::end(boundaries));
-        }
+        using type
+            = std::conditional_t<Depth == 0, std::tuple<typename T::template replaced_type<R>>, typename impl<T, R, Depth>::type>;
+    };
 
-        template <typename U, arrnd_type Arrnd>
-        constexpr this_type& copy_from(std::initializer_list<U> data, std::initializer_list<boundary_type> boundaries)
-        {
-            return copy_from(data.begin(), data.end(), boundaries.begin(), boundaries.end());
-        }
+    template <typename T, typename R, std::size_t Depth>
+    using arrnd_last_replaced_type_nested_tuple_t = typename arrnd_last_replaced_type_nested_tuple<T, R, Depth>::type;
 
-        // Modify array by simplifying info and by squeeze internal buffer
-        // data in the front of it for efficient internal buffer usage.
-        constexpr this_type& refresh()
-        {
-            // continuous array, which is not sliced or transposed
-            if (empty() || info_.hints() == arrnd_hint::continuous) {
-                return *this;
-            }
+    template <typename T>
+    struct flat_tuple {
+        using type = std::tuple<T>;
+    };
 
-            // in order to perform the rearranging of the array elements
-            // without using temporary buffer, a unstranspose of the array
-            // info is required.
-            this_type tmp(unstranspose(info_), shared_storage_);
+    template <typename... Args>
+    struct flat_tuple<std::tuple<Args...>> {
+        using type = decltype(std::tuple_cat(typename flat_tuple<Args>::type{}...));
+    };
 
-            std::move(tmp.begin(), tmp.end(), std::begin(*shared_storage_));
-            tmp.shared_storage_->resize(total(tmp.info_));
+    template <typename Tuple>
+    using flat_tuple_t = typename flat_tuple<Tuple>::type;
 
-            *this = this_type(simplify(info_), shared_storage_);
+    template <typename Tuple, std::size_t Depth>
+    struct arrnd_fold_tuple {
+        static constexpr std::size_t idx = std::tuple_size_v<Tuple> - 1;
+        using type = typename std::tuple_element_t<idx - Depth,
+            Tuple>::template replaced_type<typename arrnd_fold_tuple<Tuple, Depth - 1>::type>;
+    };
 
-            return *this;
-        }
+    template <typename Tuple>
+    struct arrnd_fold_tuple<Tuple, 1> {
+        static constexpr std::size_t idx = std::tuple_size_v<Tuple> - 1;
+        using type =
+            typename std::tuple_element_t<idx - 1, Tuple>::template replaced_type<std::tuple_element_t<idx - 0, Tuple>>;
+    };
 
-        // Ensures a full copy of this array and its inner arrays.
-        template <arrnd_type Arrnd = this_type>
-        [[nodiscard]] constexpr Arrnd clone() const
-        {
-            if (empty()) {
-                return Arrnd();
-            }
+    template <typename Tuple>
+    struct arrnd_fold_tuple<Tuple, 0> {
+        static constexpr int idx = std::tuple_size_v<Tuple> - 1;
+        using type = std::tuple_element_t<idx - 0, Tuple>;
+    };
 
-            Arrnd c{};
+    template <typename Tuple>
+    using arrnd_fold_tuple_t = typename arrnd_fold_tuple<Tuple, std::tuple_size_v<Tuple> - 1>::type;
 
-            c.info() =
-                typename Arrnd::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-            if constexpr (this_type::is_flat) {
-                c.shared_storage() = std::allocate_shared<typename Arrnd::storage_type>(
-                    typename Arrnd::template allocator_template_type<typename Arrnd::storage_type>(), *shared_storage_);
-                c.shared_storage()->reserve(shared_storage_->capacity());
-            } else {
-                c.shared_storage() = std::allocate_shared<typename Arrnd::storage_type>(
-                    typename Arrnd::template allocator_template_type<typename Arrnd::storage_type>(),
-                    shared_storage_->size());
-                c.shared_storage()->reserve(shared_storage_->capacity());
+    template <typename T, typename R, std::size_t Depth>
+    struct arrnd_replaced_inner_type {
+        using type = arrnd_fold_tuple_t<flat_tuple_t<arrnd_last_replaced_type_nested_tuple_t<T, R, Depth>>>;
+    };
 
-                for (auto t : zip(zipped(*this), zipped(c))) {
-                    std::get<1>(t) = std::get<0>(t).template clone<typename Arrnd::value_type>();
-                }
-            }
+    template <typename T, typename R, std::size_t Depth>
+    using arrnd_replaced_inner_type_t = arrnd_replaced_inner_type<T, R, Depth>::type;
 
-            return c;
-        }
+    // ----------------------------------------------
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr this_type reshape(InputIt first_dim, InputIt last_dim) const
-        {
-            if (total(info_) != total(info_type(first_dim, last_dim))) {
-                throw std::invalid_argument("invalid input dims - different total size from array");
-            }
+    template <typename Arrnd, std::size_t Depth>
+        requires(Depth >= 0)
+    struct arrnd_nested {
+        using type = typename Arrnd::template replaced_type<typename arrnd_nested<Arrnd, Depth - 1>::type>;
+    };
 
-            // no reshape
-            if (std::equal(std::begin(info_.dims()), std::end(info_.dims()), first_dim, last_dim)) {
-                return *this;
-            }
+    template <typename Arrnd>
+    struct arrnd_nested<Arrnd, 0> {
+        using type = Arrnd;
+    };
 
-            if (info_.hints() != arrnd_hint::continuous) {
-                throw std::invalid_argument("invalid reshape operation for non-standard array (might be "
-                                            "sliced/transposed) - try to use refresh()");
-            }
+    template <typename Arrnd, std::size_t Depth>
+    using arrnd_nested_t = arrnd_nested<Arrnd, Depth>::type;
 
-            return this_type(info_type(first_dim, last_dim), shared_storage_);
-        }
+    template <typename Arrnd1, typename Arrnd2, std::size_t Depth = std::min(Arrnd1::depth, Arrnd2::depth)>
+    using arrnd_tol_type = decltype(typename std::remove_cvref_t<Arrnd1>::template inner_type<Depth>::value_type{} -
+        typename std::remove_cvref_t<Arrnd2>::template inner_type<Depth>::value_type{});
 
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr this_type reshape(const Cont& dims) const
+    template <typename Arrnd1, typename T, std::size_t Depth = Arrnd1::depth>
+    using arrnd_lhs_tol_type
+        = decltype(typename std::remove_cvref_t<Arrnd1>::template inner_type<Depth>::value_type{} - std::remove_cvref_t<T>{});
+
+    template <typename T, typename Arrnd2, std::size_t Depth = Arrnd2::depth>
+    using arrnd_rhs_tol_type
+        = decltype(std::remove_cvref_t<T>{} - typename std::remove_cvref_t<Arrnd2>::template inner_type<Depth>::value_type{});
+
+    enum class arrnd_common_shape { vector, row, column };
+
+    template <arrnd_type Arrnd, typename Constraint>
+    class arrnd_lazy_filter {
+    public:
+        constexpr arrnd_lazy_filter() = delete;
+
+        explicit constexpr arrnd_lazy_filter(Arrnd arr_ref, Constraint constraint)
+            : arr_ref_(arr_ref)
+            , constraint_(constraint)
+        { }
+
+        [[nodiscard]] constexpr operator Arrnd() const
         {
-            return reshape(std::begin(dims), std::end(dims));
+            return arr_ref_.filter(constraint_);
         }
 
-        [[nodiscard]] constexpr this_type reshape(std::initializer_list<size_type> dims) const
+        [[nodiscard]] constexpr Arrnd operator()() const
         {
-            return reshape(dims.begin(), dims.end());
+            return arr_ref_.filter(constraint_);
         }
 
-        [[nodiscard]] constexpr this_type reshape(arrnd_common_shape shape) const
+        constexpr arrnd_lazy_filter(arrnd_lazy_filter&& other) = default;
+        template <arrnd_type OtherArrnd, typename OtherConstraint>
+        constexpr arrnd_lazy_filter& operator=(arrnd_lazy_filter<OtherArrnd, OtherConstraint>&& other)
         {
-            if (empty()) {
-                return *this;
-            }
+            // copy array elements from one proxy to another according to mask
 
-            switch (shape) {
-            case arrnd_common_shape::vector:
-                return reshape({total(info_)});
-            case arrnd_common_shape::row:
-                return reshape({size_type{1}, total(info_)});
-            case arrnd_common_shape::column:
-                return reshape({total(info_), size_type{1}});
-            default:
-                assert(false && "unknown arrnd_common_shape value");
+            if (arr_ref_.empty()) {
                 return *this;
             }
-        }
 
-        // Similar to std::vector, resize inner buffer to suitable input dims
-        // and arrange array elements according to it.
-        template <iterator_of_type_integral InputIt>
-        constexpr this_type& resize(InputIt first_dim, InputIt last_dim)
-        {
-            if (empty()) {
-                *this = this_type(first_dim, last_dim);
-                return *this;
-            }
-
-            info_type new_info(first_dim, last_dim);
-
-            // in case of same number of elements and standard array, resize can be done by reshape operation
-            if (total(info_) == total(new_info) && info_.hints() == arrnd_hint::continuous) {
-                *this = reshape(first_dim, last_dim);
-                return *this;
-            }
-
-            // check if there's enough space to arrange elements, and resize internal buffer if not
-            bool is_post_resize_required = total(new_info) <= shared_storage_->size();
-            if (!is_post_resize_required) {
-                shared_storage_->resize(total(new_info));
-            }
-
-            this_type res(new_info, shared_storage_);
-
-            size_type min_num_dims = std::min(size(info_), size(new_info));
+            // the user is responsible that the number of elements in both constraints is the same
 
-            typename info_type::storage_traits_type::template replaced_type<boundary_type>::storage_type boundaries(
-                size(info_), boundary_type::full());
+            auto other_filtered = static_cast<OtherArrnd>(other);
 
-            typename info_type::storage_traits_type::template replaced_type<boundary_type>::storage_type new_boundaries(
-                size(new_info), boundary_type::full());
+            arr_ref_.copy_from(other_filtered, constraint_);
 
-            auto z = zip(zipped(boundaries), zipped(new_boundaries), zipped(info_.dims()), zipped(new_info.dims()));
+            (void)arrnd_lazy_filter<OtherArrnd, OtherConstraint>(std::move(other));
 
-            std::for_each(std::rbegin(z), std::next(std::rbegin(z), min_num_dims), [](auto t) {
-                auto dim = std::get<2>(t);
-                auto new_dim = std::get<3>(t);
+            return *this;
+        }
 
-                auto& boundary = std::get<0>(t);
-                boundary = boundary_type::to(std::min(dim, new_dim));
+        constexpr arrnd_lazy_filter(const arrnd_lazy_filter& other) = delete;
+        constexpr arrnd_lazy_filter& operator=(const arrnd_lazy_filter& other) = delete;
 
-                auto& new_boundary = std::get<1>(t);
-                new_boundary = boundary_type::to(std::min(dim, new_dim));
-            });
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator=(const Arrnd& other) &&
+        {
+            arr_ref_.copy_from(other, constraint_);
+            return *this;
+        }
 
-            res[new_boundaries] = (*this)[boundaries];
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator+=(const Arrnd& other) &&
+        {
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) + other, constraint_);
+            return *this;
+        }
 
-            if (is_post_resize_required) {
-                shared_storage_->resize(total(new_info));
-            }
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator-=(const Arrnd& other) &&
+        {
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) - other, constraint_);
+            return *this;
+        }
 
-            *this = std::move(res);
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator*=(const Arrnd& other) &&
+        {
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) * other, constraint_);
+            return *this;
+        }
 
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator/=(const Arrnd& other) &&
+        {
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) / other, constraint_);
             return *this;
         }
 
-        template <iterable_of_type_integral Cont>
-        constexpr this_type& resize(const Cont& dims)
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator%=(const Arrnd& other) &&
         {
-            return resize(std::begin(dims), std::end(dims));
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) % other, constraint_);
+            return *this;
         }
 
-        constexpr this_type& resize(std::initializer_list<size_type> dims)
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator^=(const Arrnd& other) &&
         {
-            return resize(dims.begin(), dims.end());
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) ^ other, constraint_);
+            return *this;
         }
 
         template <arrnd_type Arrnd>
-        constexpr this_type& push_back(const Arrnd& arr, size_type axis = 0)
+        constexpr arrnd_lazy_filter& operator&=(const Arrnd& other) &&
         {
-            size_type index = empty() ? 0 : info_.dims()[axis];
-            return insert<Arrnd>(arr, index, axis);
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) & other, constraint_);
+            return *this;
         }
 
         template <arrnd_type Arrnd>
-        constexpr this_type& push_front(const Arrnd& arr, size_type axis = 0)
+        constexpr arrnd_lazy_filter& operator|=(const Arrnd& other) &&
         {
-            return insert<Arrnd>(arr, 0, axis);
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) | other, constraint_);
+            return *this;
         }
 
-        /*
-        * Insert arr as set of values at index/axis, such that 0<=index<=dims[axis] and 0<=axis<size(dims)
-        * Algorithm:
-        * - if array and arr are empty:
-        *   - index should be valid and axis is irrelevant
-        *   - return *this
-        * - if arr is empty:
-        *   - index and axis are irrelevant
-        *   - return *this
-        * - if array is empty:
-        *   - index should be valid and axis is irrelevant
-        *   - return clone(arr)
-        * - else (both array and arr contain values):
-        *   - check arr size validity (should be the same as array except at axis)
-        *   - refresh array for space efficiency
-        *   - calculate new info, and new total
-        *   - append capacity according to (total(new) - total(prev))
-        *   - build ref with new info
-        *   - copy values
-        */
         template <arrnd_type Arrnd>
-        constexpr this_type& insert(const Arrnd& arr, size_type index, size_type axis = 0)
+        constexpr arrnd_lazy_filter& operator<<=(const Arrnd& other) &&
         {
-            if (empty() && arr.empty()) {
-                if (index != 0) {
-                    throw std::invalid_argument("invalid index for empty arrays");
-                }
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) << other, constraint_);
+            return *this;
+        }
 
-                return *this;
-            }
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator>>=(const Arrnd& other) &&
+        {
+            arr_ref_.copy_from(arr_ref_.filter(constraint_) >> other, constraint_);
+            return *this;
+        }
 
-            if (arr.empty()) {
-                if (axis < 0 || axis >= size(info_)) {
-                    throw std::invalid_argument("invalid axis for empty input");
-                }
-                if (index < 0 || index > info_.dims()[axis]) {
-                    throw std::invalid_argument("invalid index for empty input");
-                }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator+=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ + value, constraint_);
+            return *this;
+        }
 
-                return *this;
-            }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator-=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ - value, constraint_);
+            return *this;
+        }
 
-            if (empty()) {
-                if (index != 0) {
-                    throw std::invalid_argument("invalid index for empty array");
-                }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator*=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ * value, constraint_);
+            return *this;
+        }
 
-                *this = arr.template clone<this_type>();
-                return *this;
-            }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator/=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ / value, constraint_);
+            return *this;
+        }
 
-            if (axis < 0 || axis >= size(info_)) {
-                throw std::invalid_argument("invalid axis");
-            }
-            if (index < 0 || index > info_.dims()[axis]) {
-                throw std::invalid_argument("invalid index");
-            }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator%=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ % value, constraint_);
+            return *this;
+        }
 
-            if (size(info_) != size(arr.info())) {
-                throw std::invalid_argument("invalid input - different number of dims");
-            }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator^=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ ^ value, constraint_);
+            return *this;
+        }
 
-            auto dims = info_.dims();
-            dims[axis] = arr.info().dims()[axis];
-            if (!std::equal(
-                    std::begin(arr.info().dims()), std::end(arr.info().dims()), std::begin(dims), std::end(dims))) {
-                throw std::invalid_argument("invalid input - dims should be the same except at axis");
-            }
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator&=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ & value, constraint_);
+            return *this;
+        }
 
-            refresh();
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator|=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ | value, constraint_);
+            return *this;
+        }
 
-            auto& new_dims = dims;
-            new_dims[axis] += info_.dims()[axis];
-            info_type new_info(new_dims);
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator<<=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ << value, constraint_);
+            return *this;
+        }
 
-            auto total_diff = total(new_info) - total(info_);
-            shared_storage_->append(total_diff);
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator>>=(const U& value) &&
+        {
+            *this = arrnd_lazy_filter(arr_ref_ >> value, constraint_);
+            return *this;
+        }
 
-            this_type res(new_info, shared_storage_);
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator++() &&
+        {
+            auto c = arr_ref_.clone();
+            *this = arrnd_lazy_filter(++c, constraint_);
+            return *this;
+        }
 
-            // if push_back at axis zero, no need to move current data in storage
-            if (index == info_.dims()[axis] && axis == 0) {
-                std::copy(arr.cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    arr.cend(axis, arrnd_returned_element_iterator_tag{}),
-                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}), total(info_)));
-            }
-            // if there's enough capacity in data storage, use if for temp data
-            else if (shared_storage_->capacity() - shared_storage_->size() >= total(info_)) {
-                auto current_shared_storage_size = shared_storage_->size();
-
-                // temporarily resize data storage to its capacity size
-                shared_storage_->resize(shared_storage_->capacity());
+        template <arrnd_type Arrnd>
+        constexpr arrnd_lazy_filter& operator--() &&
+        {
+            auto c = arr_ref_.clone();
+            *this = arrnd_lazy_filter(--c, constraint_);
+            return *this;
+        }
 
-                auto tmp_it = std::next(std::begin(*shared_storage_), current_shared_storage_size);
-                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    cend(axis, arrnd_returned_element_iterator_tag{}), tmp_it);
+        template <typename U>
+            requires(!arrnd_type<U>)
+        constexpr arrnd_lazy_filter& operator=(const U& value) &&
+        {
+            if (arr_ref_.empty()) {
+                return *this;
+            }
 
-                auto num_pre_input_copies = index * (total(res.info_) / res.info_.dims()[axis]);
+            if constexpr (arrnd_type<Constraint>) {
+                // constraint is a mask
+                if constexpr (std::is_same_v<bool, typename Constraint::value_type>) {
+                    if (!std::equal(std::begin(arr_ref_.info().dims()), std::end(arr_ref_.info().dims()),
+                            std::begin(constraint_.info().dims()), std::end(constraint_.info().dims()))) {
+                        throw std::invalid_argument("invalid mask constraint");
+                    }
 
-                std::move(tmp_it, std::next(tmp_it, num_pre_input_copies),
-                    res.begin(axis, arrnd_returned_element_iterator_tag{}));
+                    for (auto t : zip(zipped(arr_ref_), zipped(constraint_))) {
+                        if (std::get<1>(t)) {
+                            std::get<0>(t) = value;
+                        }
+                    }
+                }
+                // constraint is indices
+                else if constexpr (arrnd_type<Constraint>) {
+                    for (auto index : constraint_) {
+                        arr_ref_[index] = value;
+                    }
+                }
+            }
+            // constraint might be predicator
+            else {
+                for (auto& element : arr_ref_) {
+                    if (constraint_(element)) {
+                        element = value;
+                    }
+                }
+            }
 
-                std::copy(arr.cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    arr.cend(axis, arrnd_returned_element_iterator_tag{}),
-                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}), num_pre_input_copies));
+            return *this;
+        }
 
-                std::move(std::next(tmp_it, num_pre_input_copies), std::next(tmp_it, total(info_)),
-                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}),
-                        num_pre_input_copies + total(arr.info())));
+        virtual constexpr ~arrnd_lazy_filter() = default;
 
-                shared_storage_->resize(current_shared_storage_size);
-            }
-            // else create a temporary data storage
-            else {
-                storage_type tmp(total(info_));
-                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    cend(axis, arrnd_returned_element_iterator_tag{}), std::begin(tmp));
+    private:
+        Arrnd arr_ref_;
+        Constraint constraint_;
+    };
 
-                auto num_pre_input_copies = index * (total(res.info_) / res.info_.dims()[axis]);
+    template <arrnd_type Arrnd, iterator_of_type_integral DimsIt>
+    [[nodiscard]] inline constexpr auto zeros(DimsIt first_dim, DimsIt last_dim)
+    {
+        return Arrnd(first_dim, last_dim, 0);
+    }
 
-                std::move(std::begin(tmp), std::next(std::begin(tmp), num_pre_input_copies),
-                    res.begin(axis, arrnd_returned_element_iterator_tag{}));
+    template <arrnd_type Arrnd, iterable_of_type_integral Cont>
+    [[nodiscard]] inline constexpr auto zeros(const Cont& dims)
+    {
+        return zeros<Arrnd>(std::begin(dims), std::end(dims));
+    }
 
-                std::copy(arr.cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    arr.cend(axis, arrnd_returned_element_iterator_tag{}),
-                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}), num_pre_input_copies));
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto zeros(std::initializer_list<typename Arrnd::size_type> dims)
+    {
+        return zeros<Arrnd>(dims.begin(), dims.end());
+    }
 
-                std::move(std::next(std::begin(tmp), num_pre_input_copies), std::end(tmp),
-                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}),
-                        num_pre_input_copies + total(arr.info())));
-            }
+    template <arrnd_type Arrnd, iterator_of_type_integral DimsIt>
+    [[nodiscard]] inline constexpr auto eye(DimsIt first_dim, DimsIt last_dim)
+    {
+        auto ndims = std::distance(first_dim, last_dim);
 
-            *this = std::move(res);
-            return *this;
+        if (ndims < 2) {
+            throw std::invalid_argument("invalid dims - should be at least matrix");
         }
 
-        template <iterator_of_template_type<std::tuple> InputIt>
-        constexpr this_type& repeat(InputIt first_tuple, InputIt last_tuple)
-        {
-            if (std::distance(first_tuple, last_tuple) <= 0) {
-                return *this;
+        auto eye_impl = [](typename Arrnd::size_type r, typename Arrnd::size_type c) {
+            if (r == 0 || c == 0) {
+                return Arrnd{};
             }
+            Arrnd res({r, c}, typename Arrnd::value_type{0});
 
-            auto res = *this;
-            auto mid = res.clone();
+            auto n = std::min(r, c);
 
-            for (auto t_it = first_tuple; t_it != last_tuple; ++t_it) {
-                const auto& t = *t_it;
-                for (size_type i = 0; i < std::get<0>(t) - 1; ++i) {
-                    res.push_back(mid, std::get<1>(t));
-                }
-                mid = res.clone();
+            typename Arrnd::size_type one_ind = 0;
+
+            for (typename Arrnd::size_type i = 0; i < n; ++i) {
+                res[one_ind] = typename Arrnd::value_type{1};
+                one_ind += c + 1;
             }
 
-            *this = std::move(res);
+            return res;
+        };
 
-            return *this;
+        if (ndims == 2) {
+            return eye_impl(*first_dim, *std::next(first_dim, 1));
         }
 
-        template <template_type<std::tuple> Tuple>
-        constexpr this_type& repeat(std::initializer_list<Tuple> count_axis_tuples)
-        {
-            return repeat(count_axis_tuples.begin(), count_axis_tuples.end());
+        Arrnd res(first_dim, last_dim, typename Arrnd::value_type{0});
+        return res.browse(2, [eye_impl](auto page) {
+            return eye_impl(page.info().dims().front(), page.info().dims().back());
+        });
+    }
+
+    template <arrnd_type Arrnd, iterable_of_type_integral Cont>
+    [[nodiscard]] inline constexpr auto eye(const Cont& dims)
+    {
+        return eye<Arrnd>(std::begin(dims), std::end(dims));
+    }
+
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto eye(std::initializer_list<typename Arrnd::size_type> dims)
+    {
+        return eye<Arrnd>(dims.begin(), dims.end());
+    }
+
+#ifdef OC_ARRND_HAS_MMAP
+    // array of dims over the elements of a file from offset, without copying them - the file is mapped
+    // into the array storage (see simple_file_mapping). copies of the array storage are not mapped.
+    // the elements of read_only mappings are not writable - writing them raises SIGSEGV.
+    template <arrnd_type Arrnd, iterator_of_type_integral InputIt>
+        requires(std::is_fundamental_v<typename Arrnd::value_type>
+            && std::is_same_v<typename Arrnd::storage_type::allocator_type,
+                simple_mapped_allocator<typename Arrnd::value_type>>)
+    [[nodiscard]] inline Arrnd map_file(const std::string& path, InputIt first_dim, InputIt last_dim,
+        simple_file_map_mode mode = simple_file_map_mode::read_only,
+        simple_file_map_advice advice = simple_file_map_advice::normal, std::size_t offset = 0)
+    {
+        using storage_type = typename Arrnd::storage_type;
+
+        if (offset % alignof(typename Arrnd::value_type) != 0) {
+            throw std::invalid_argument("invalid offset - not aligned to the value type");
         }
 
-        template <iterable_of_template_type<std::tuple> Cont>
-        constexpr this_type& repeat(const Cont& count_axis_tuples)
-        {
-            return repeat(std::begin(count_axis_tuples), std::end(count_axis_tuples));
+        typename Arrnd::info_type info(first_dim, last_dim);
+        if (empty(info)) {
+            return Arrnd();
         }
 
-        template <iterator_of_type_integral InputIt>
-        constexpr this_type& repeat(InputIt first_rep, InputIt last_rep)
-        {
-            if (std::distance(first_rep, last_rep) > info_.dims().size()) {
-                throw std::invalid_argument("invalid number of input reps");
-            }
+        auto mapping = std::make_shared<simple_file_mapping>(
+            path, mode, advice, offset, total(info) * sizeof(typename Arrnd::value_type));
 
-            auto res = *this;
-            auto mid = res.clone();
+        return Arrnd(info,
+            std::allocate_shared<storage_type>(
+                typename Arrnd::template allocator_template_type<storage_type>(), total(info),
+                typename storage_type::allocator_type(mapping)));
+    }
 
-            size_type curr_axis = 0;
+    template <arrnd_type Arrnd, iterable_of_type_integral Cont>
+    [[nodiscard]] inline Arrnd map_file(const std::string& path, const Cont& dims,
+        simple_file_map_mode mode = simple_file_map_mode::read_only,
+        simple_file_map_advice advice = simple_file_map_advice::normal, std::size_t offset = 0)
+    {
+        return map_file<Arrnd>(path, std::begin(dims), std::end(dims), mode, advice, offset);
+    }
 
-            for (auto r_it = first_rep; r_it != last_rep; ++r_it) {
-                for (size_type i = 0; i < *r_it - 1; ++i) {
-                    res.push_back(mid, curr_axis);
-                }
-                ++curr_axis;
-                mid = res.clone();
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline Arrnd map_file(const std::string& path, std::initializer_list<typename Arrnd::size_type> dims,
+        simple_file_map_mode mode = simple_file_map_mode::read_only,
+        simple_file_map_advice advice = simple_file_map_advice::normal, std::size_t offset = 0)
+    {
+        return map_file<Arrnd>(path, dims.begin(), dims.end(), mode, advice, offset);
+    }
+#endif // OC_ARRND_HAS_MMAP
+
+    // continuous arrays (i.e. not sliced or transposed) elements might be iterated
+    // by plain pointers, which saves the per element overhead of the n-dimensional indexer.
+    template <typename Cont>
+    [[nodiscard]] inline constexpr bool has_plain_elements(const Cont& cont) noexcept
+    {
+        if constexpr (arrnd_type<Cont>) {
+            return cont.empty() || cont.info().hints() == arrnd_hint::continuous;
+        } else {
+            return true;
+        }
+    }
+
+    template <typename Cont>
+    [[nodiscard]] inline constexpr auto plain_zipped(Cont&& cont)
+    {
+        if constexpr (arrnd_type<Cont>) {
+            auto first = cont.empty() ? nullptr
+                                      : cont.shared_storage()->data() + cont.info().indices_boundary().start();
+            return zipped(first, first + (cont.empty() ? 0 : total(cont.info())));
+        } else {
+            return zipped(std::forward<Cont>(cont));
+        }
+    }
+
+    // invoke func with zipped elements of the containers - by plain pointers
+    // if all of the arrays are continuous, or by the arrays iterators otherwise.
+    template <typename Func, typename... Conts>
+    inline constexpr decltype(auto) zipped_invoke(Func&& func, Conts&&... conts)
+    {
+        if ((has_plain_elements(conts) && ...)) {
+            return func(plain_zipped(std::forward<Conts>(conts))...);
+        }
+        return func(zipped(std::forward<Conts>(conts))...);
+    }
+
+    // invoke func with zipped elements of the containers in the relative range [first, last).
+    // non continuous arrays iterators are seeked directly to first, without iterating over previous elements.
+    template <typename Func, typename... Conts>
+    inline constexpr decltype(auto) chunk_invoke(Func&& func, std::size_t first, std::size_t last, Conts&&... conts)
+    {
+        auto plain_chunk = [first, last](auto&& cont) {
+            if constexpr (arrnd_type<decltype(cont)>) {
+                auto elems = plain_zipped(cont);
+                return zipped(std::next(elems.first(), first), std::next(elems.first(), last));
+            } else {
+                return zipped(std::next(std::begin(cont), first), std::next(std::begin(cont), last));
             }
+        };
 
-            *this = std::move(res);
+        if ((has_plain_elements(conts) && ...)) {
+            return func(plain_chunk(std::forward<Conts>(conts))...);
+        }
+        return func(zipped(std::next(std::begin(conts), first), std::next(std::begin(conts), last))...);
+    }
 
-            return *this;
+    // plain buffers kernels - unit stride loops without aliasing, which are vectorized by the compiler
+    template <typename T, typename R, typename UnaryOp>
+    OC_ARRND_VECTORIZED inline void vectorized_transform(
+        const T* __restrict first, R* __restrict res, std::size_t count, UnaryOp op)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            res[i] = op(first[i]);
         }
+    }
 
-        constexpr this_type& repeat(std::initializer_list<size_type> reps)
-        {
-            return repeat(reps.begin(), reps.end());
+    template <typename T, typename U, typename R, typename BinaryOp>
+    OC_ARRND_VECTORIZED inline void vectorized_transform(
+        const T* __restrict lhs, const U* __restrict rhs, R* __restrict res, std::size_t count, BinaryOp op)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            res[i] = op(lhs[i], rhs[i]);
         }
+    }
 
-        template <iterable_of_type_integral Cont>
-        constexpr this_type& repeat(const Cont& reps)
-        {
-            return repeat(std::begin(reps), std::end(reps));
+    // in place kernels - the result is written over the first buffer
+    template <typename T, typename UnaryOp>
+    OC_ARRND_VECTORIZED inline void vectorized_apply(T* __restrict first, std::size_t count, UnaryOp op)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            first[i] = op(first[i]);
         }
+    }
 
-        constexpr this_type& erase(size_type count, size_type index, size_type axis = 0)
-        {
-            if (empty()) {
-                if (index != 0) {
-                    throw std::invalid_argument("invalid index for empty array");
-                }
-                if (count != 0) {
-                    throw std::invalid_argument("invalid count for empty array");
-                }
+    template <typename T, typename U, typename BinaryOp>
+    OC_ARRND_VECTORIZED inline void vectorized_apply(
+        T* __restrict first, const U* __restrict second, std::size_t count, BinaryOp op)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            first[i] = op(first[i], second[i]);
+        }
+    }
 
-                return *this;
-            }
+    // the elements are reduced into independent lanes, which are reduced at the end (op is expected to be
+    // associative and commutative, as in std::reduce).
+    template <typename T, typename BinaryOp>
+    OC_ARRND_VECTORIZED inline T vectorized_reduce(const T* __restrict first, std::size_t count, T init, BinaryOp op)
+    {
+        constexpr std::size_t lanes = 16;
 
-            if (axis < 0 || axis >= size(info_)) {
-                throw std::invalid_argument("invalid axis");
+        std::size_t i = 0;
+        if (count >= lanes) {
+            T acc[lanes];
+            for (std::size_t j = 0; j < lanes; ++j) {
+                acc[j] = first[j];
             }
-            if (index < 0 || index >= info_.dims()[axis]) {
-                throw std::invalid_argument("invalid index");
+            for (i = lanes; i + lanes <= count; i += lanes) {
+                for (std::size_t j = 0; j < lanes; ++j) {
+                    acc[j] = op(acc[j], first[i + j]);
+                }
             }
-            if (index + count > info_.dims()[axis]) {
-                throw std::invalid_argument("invalid count");
+            for (std::size_t j = 0; j < lanes; ++j) {
+                init = op(init, acc[j]);
             }
+        }
+        for (; i < count; ++i) {
+            init = op(init, first[i]);
+        }
+        return init;
+    }
 
-            // check if resulted array is empty
-            auto new_dims = info_.dims();
-            new_dims[axis] -= count;
-            info_type new_info(new_dims);
+    // pairwise summation - each block of elements is summed into independent lanes, which are summed in pairs,
+    // and the blocks sums are summed recursively in pairs. the rounding error grows as O(log(n)) instead of O(n)
+    // of sequential summation, and the summation order (i.e. the result) does not depend on the vector width.
+    template <typename Acc, typename InputIt>
+    OC_ARRND_VECTORIZED inline Acc pairwise_sum_block(InputIt first, std::size_t count)
+    {
+        constexpr std::size_t lanes = 16;
 
-            if (oc::arrnd::empty(new_info)) {
-                *this = this_type{};
-                return *this;
+        Acc acc[lanes]{};
+        std::size_t i = 0;
+        for (; i + lanes <= count; i += lanes) {
+            for (std::size_t j = 0; j < lanes; ++j, ++first) {
+                acc[j] += static_cast<Acc>(*first);
             }
+        }
+        for (std::size_t width = lanes / 2; width > 0; width /= 2) {
+            for (std::size_t j = 0; j < width; ++j) {
+                acc[j] += acc[j + width];
+            }
+        }
 
-            refresh();
-
-            this_type res(new_info, shared_storage_);
+        Acc res = acc[0];
+        for (; i < count; ++i, ++first) {
+            res += static_cast<Acc>(*first);
+        }
+        return res;
+    }
 
-            size_type num_pre_removals = index * (total(res.info_) / res.info_.dims()[axis]);
-            size_type removals = total(info_) - total(res.info_);
+    template <typename Acc, typename InputIt>
+    inline Acc pairwise_sum(InputIt first, std::size_t count)
+    {
+        constexpr std::size_t block_size = 256;
 
-            if (shared_storage_->capacity() - shared_storage_->size() >= total(res.info())) {
-                auto current_shared_storage_size = shared_storage_->size();
+        if (count <= block_size) {
+            return pairwise_sum_block<Acc>(first, count);
+        }
 
-                // temporarily resize data storage to its capacity size
-                shared_storage_->resize(shared_storage_->capacity());
+        std::size_t half = std::max(count / block_size / 2, std::size_t{1}) * block_size;
+        return pairwise_sum<Acc>(first, half) + pairwise_sum<Acc>(std::next(first, half), count - half);
+    }
 
-                auto tmp_it = std::next(std::begin(*shared_storage_), current_shared_storage_size);
-                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals), tmp_it);
-                std::move(std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals + removals),
-                    cend(axis, arrnd_returned_element_iterator_tag{}), std::next(tmp_it, num_pre_removals));
+    // reduction of the middle dim of [outer, reduction, inner] elements, which are streamed once in their order -
+    // instead of striding over the reduced dim, each of its rows is accumulated into the output row
+    // (by the vectorized kernel if the elements are continuous). if InitByFirst, the output rows
+    // are initialized by the first reduced rows.
+    template <bool InitByFirst, typename InputIt, typename R, typename BinaryOp>
+    inline void reduce_rows(
+        InputIt first, R* res, std::size_t outer, std::size_t reduction, std::size_t inner, BinaryOp op)
+    {
+        for (std::size_t i = 0; i < outer; ++i, res += inner) {
+            std::size_t j = 0;
+            if constexpr (InitByFirst) {
+                for (std::size_t k = 0; k < inner; ++k, ++first) {
+                    res[k] = static_cast<R>(*first);
+                }
+                j = 1;
+            }
+            for (; j < reduction; ++j) {
+                if constexpr (std::is_pointer_v<InputIt> && std::is_arithmetic_v<R>
+                    && std::is_arithmetic_v<iterator_value_t<InputIt>>) {
+                    if (inner > 1) {
+                        vectorized_apply(res, first, inner, op);
+                        first += inner;
+                        continue;
+                    }
+                }
+                for (std::size_t k = 0; k < inner; ++k, ++first) {
+                    res[k] = op(res[k], *first);
+                }
+            }
+        }
+    }
 
-                std::move(tmp_it, std::next(tmp_it, total(res.info())), std::begin(*shared_storage_));
+    // position of the first best (by comp) element - the elements are reduced in blocks by the vectorized kernel,
+    // and only the block of the best value is searched for its position.
+    template <typename T, typename Comp>
+    inline std::size_t vectorized_arg_best(const T* first, std::size_t count, Comp comp)
+    {
+        constexpr std::size_t block_size = 1024;
 
-                shared_storage_->resize(current_shared_storage_size);
-            } else {
-                storage_type tmp(total(info_));
-                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
-                    std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals), std::begin(tmp));
-                std::move(std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals + removals),
-                    cend(axis, arrnd_returned_element_iterator_tag{}), std::next(std::begin(tmp), num_pre_removals));
+        auto select = [comp](T a, T b) {
+            return comp(b, a) ? b : a;
+        };
 
-                std::move(std::begin(tmp), std::end(tmp), std::begin(*shared_storage_));
+        T best = first[0];
+        std::size_t best_block = 0;
+        for (std::size_t block = 0; block < count; block += block_size) {
+            std::size_t n = std::min(block_size, count - block);
+            T value = vectorized_reduce(first + block, n, first[block], select);
+            if (comp(value, best)) {
+                best = value;
+                best_block = block;
             }
+        }
 
-            shared_storage_->resize(total(new_info));
-
-            *this = std::move(res);
-            return *this;
+        std::size_t last = std::min(best_block + block_size, count);
+        for (std::size_t i = best_block; i < last; ++i) {
+            if (!comp(first[i], best) && !comp(best, first[i])) {
+                return i;
+            }
         }
+        return best_block;
+    }
 
-        constexpr this_type& pop_front(size_type count = 1, size_type axis = 0)
-        {
-            return erase(empty() ? 0 : count, 0, axis);
+    // update of the best values of inner lanes by the row at position pos
+    template <typename T, typename Comp>
+    OC_ARRND_VECTORIZED inline void vectorized_arg_best_row(const T* __restrict row, T* __restrict best,
+        std::size_t* __restrict res, std::size_t inner, std::size_t pos, Comp comp)
+    {
+        for (std::size_t k = 0; k < inner; ++k) {
+            bool is_better = comp(row[k], best[k]);
+            best[k] = is_better ? row[k] : best[k];
+            res[k] = is_better ? pos : res[k];
         }
+    }
 
-        constexpr this_type& pop_back(size_type count = 1, size_type axis = 0)
-        {
-            size_type fixed_count = empty() ? 0 : count;
-            size_type ind = empty() ? size_type{0} : *std::next(info_.dims().cbegin(), axis) - fixed_count;
-            return erase(fixed_count, ind, axis);
+    // execution policy of element-wise passes - the relative indices range is split
+    // into chunks of at least min_chunk_size elements, each chunk is processed by its own thread.
+    struct arrnd_parallel_policy {
+        // zero means std::thread::hardware_concurrency()
+        std::size_t num_threads = 0;
+        std::size_t min_chunk_size = 16384;
+    };
+
+    [[nodiscard]] inline std::size_t num_chunks(const arrnd_parallel_policy& policy, std::size_t count) noexcept
+    {
+        std::size_t max_chunks
+            = policy.num_threads > 0 ? policy.num_threads : std::max(std::thread::hardware_concurrency(), 1u);
+        return std::clamp(count / std::max(policy.min_chunk_size, std::size_t{1}), std::size_t{1}, max_chunks);
+    }
+
+    // invoke func(first, last, chunk) for each of the chunks of [0, count) - the first chunk
+    // on the calling thread and each of the others on a new thread. the first exception thrown
+    // by any of the chunks is rethrown after all of them are done.
+    template <typename Func>
+    inline void parallel_chunks_invoke(std::size_t chunks, std::size_t count, Func&& func)
+    {
+        if (chunks <= 1) {
+            func(std::size_t{0}, count, std::size_t{0});
+            return;
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
-                && TraversalResult == arrnd_traversal_result::apply)
-        constexpr auto& traverse(UnaryOp op)
+        std::vector<std::exception_ptr> errors(chunks);
+
+        auto chunk_impl = [&func, &errors, chunks, count](std::size_t chunk) {
+            try {
+                func(count * chunk / chunks, count * (chunk + 1) / chunks, chunk);
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
+
         {
-            // Traverse and perform operation on leaves.
-            if constexpr (arrnd_type<value_type>) {
-                for (auto& inner : *this) {
-                    inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
-                        CurrDepth + 1>(op);
-                }
-            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
-                for (auto& value : *this) {
-                    if constexpr (std::is_void_v<decltype(op(value))>) {
-                        op(value);
-                    } else {
-                        value = op(value);
-                    }
-                }
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks - 1);
+            for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                workers.emplace_back(chunk_impl, chunk);
             }
+            chunk_impl(0);
+        }
 
-            // Apply operation on array if depth is relevant
-            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
-                if constexpr (std::is_void_v<decltype(op(*this))>) {
-                    op(*this);
-                } else {
-                    *this = op(*this);
-                }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
             }
+        }
+    }
 
-            return *this;
+    enum class arrnd_scan_type {
+        // the i-th result is of the elements [0, i]
+        inclusive,
+        // the i-th result is of the elements [0, i), starting by init
+        exclusive,
+    };
+
+    // scan of the middle dim of [outer, reduction, inner] elements, which are streamed once in their order -
+    // each output row is combined from the previous output row and the next input row (see reduce_rows).
+    template <bool HasInit, typename InputIt, typename R, typename BinaryOp>
+    inline void scan_rows(InputIt first, R* res, std::size_t outer, std::size_t reduction, std::size_t inner,
+        const R& init, arrnd_scan_type type, BinaryOp op)
+    {
+        if (reduction == 0) {
+            return;
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
-                && TraversalResult == arrnd_traversal_result::apply)
-        constexpr auto& traverse(UnaryOp op)
-        {
-            // Apply operation on array if depth is relevant
-            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
-                if constexpr (std::is_void_v<decltype(op(*this))>) {
-                    op(*this);
+        bool exclusive = (type == arrnd_scan_type::exclusive);
+
+        for (std::size_t i = 0; i < outer; ++i) {
+            for (std::size_t k = 0; k < inner; ++k) {
+                if constexpr (HasInit) {
+                    if (exclusive) {
+                        res[k] = init;
+                        continue;
+                    }
+                    res[k] = op(init, *first);
                 } else {
-                    *this = op(*this);
+                    res[k] = static_cast<R>(*first);
                 }
+                ++first;
             }
+            res += inner;
 
-            // Traverse and perform operation on leaves.
-            if constexpr (arrnd_type<value_type>) {
-                for (auto& inner : *this) {
-                    inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
-                        CurrDepth + 1>(op);
-                }
-            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
-                for (auto& value : *this) {
-                    if constexpr (std::is_void_v<decltype(op(value))>) {
-                        op(value);
-                    } else {
-                        value = op(value);
+            for (std::size_t j = 1; j < reduction; ++j, res += inner) {
+                if constexpr (std::is_pointer_v<InputIt> && std::is_arithmetic_v<R>
+                    && std::is_arithmetic_v<iterator_value_t<InputIt>>) {
+                    if (inner > 1) {
+                        vectorized_transform(res - inner, first, res, inner, op);
+                        first += inner;
+                        continue;
                     }
                 }
+                const R* prev = res - inner;
+                for (std::size_t k = 0; k < inner; ++k, ++first) {
+                    res[k] = op(prev[k], *first);
+                }
             }
 
-            return *this;
+            // the last input row is not part of any exclusive result
+            if (exclusive) {
+                std::advance(first, inner);
+            }
         }
+    }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
-            typename Op, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
-                && TraversalResult == arrnd_traversal_result::apply)
-        constexpr auto& traverse(const Cont& cont, Op op)
-        {
-            // Traverse and perform operation on leaves.
-            if constexpr (arrnd_type<value_type>) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    for (auto& inner : *this) {
-                        inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                            TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
-                    }
-                } else {
-                    for (auto inners : zip(zipped(*this), zipped(cont))) {
-                        std::get<0>(inners)
-                            = std::get<0>(inners)
-                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
-                                      std::remove_reference_t<decltype(std::get<1>(inners))>, Op, CurrDepth + 1>(
-                                      std::get<1>(inners), op);
-                    }
-                }
-            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    for (auto& value : *this) {
-                        if constexpr (std::is_void_v<decltype(op(value, cont))>) {
-                            op(value, cont);
-                        } else {
-                            value = op(value, cont);
-                        }
-                    }
-                } else {
-                    for (auto values : zip(zipped(*this), zipped(cont))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(values), std::get<1>(values)))>) {
-                            op(std::get<0>(values), std::get<1>(values));
-                        } else {
-                            std::get<0>(values) = op(std::get<0>(values), std::get<1>(values));
-                        }
-                    }
+    // if there are less outer blocks than chunks, the reduced dim is split into chunks of rows - each chunk is
+    // scanned locally, the chunks carries are combined sequentially from their totals, and each of the chunks
+    // rows is then combined with its carry (i.e. op is expected to be associative). otherwise, each chunk
+    // scans its own outer blocks.
+    template <bool HasInit, typename T, typename R, typename BinaryOp>
+    inline void parallel_scan_rows(const arrnd_parallel_policy& policy, const T* first, R* res, std::size_t outer,
+        std::size_t reduction, std::size_t inner, const R& init, arrnd_scan_type type, BinaryOp op)
+    {
+        std::size_t block_size = reduction * inner;
+        std::size_t chunks = num_chunks(policy, outer * block_size);
+
+        if (outer >= chunks || reduction < 2) {
+            parallel_chunks_invoke(std::min(chunks, outer), outer,
+                [&](std::size_t first_block, std::size_t last_block, std::size_t) {
+                    scan_rows<HasInit>(first + first_block * block_size, res + first_block * block_size,
+                        last_block - first_block, reduction, inner, init, type, op);
+                });
+            return;
+        }
+
+        chunks = std::min(chunks, reduction);
+        bool exclusive = (type == arrnd_scan_type::exclusive);
+        std::size_t lanes = outer * inner;
+
+        // local scans - the exclusive results of each chunk are shifted by a row, so the
+        // local total of each chunk (but the last) is at the first row of its next chunk
+        std::vector<std::pair<std::size_t, std::size_t>> bounds(chunks);
+        parallel_chunks_invoke(chunks, reduction, [&](std::size_t first_row, std::size_t last_row, std::size_t chunk) {
+            bounds[chunk] = {first_row, last_row};
+            std::size_t count = exclusive && last_row == reduction ? last_row - first_row - 1 : last_row - first_row;
+            for (std::size_t i = 0; i < outer; ++i) {
+                R* block_res = res + i * block_size;
+                if (exclusive && chunk == 0) {
+                    std::fill_n(block_res, inner, init);
                 }
+                scan_rows<false>(first + i * block_size + first_row * inner,
+                    block_res + (first_row + (exclusive ? 1 : 0)) * inner, 1, count, inner, init,
+                    arrnd_scan_type::inclusive, op);
             }
+        });
 
-            // Apply operation on array if depth is relevant
-            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
-                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
-                    op(*this, cont);
-                } else {
-                    *this = op(*this, cont);
+        std::vector<R> carries(chunks * lanes);
+        if constexpr (HasInit) {
+            std::fill_n(carries.begin(), lanes, init);
+        }
+        for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            std::size_t total_row = exclusive ? bounds[chunk - 1].second : bounds[chunk - 1].second - 1;
+            for (std::size_t i = 0; i < outer; ++i) {
+                for (std::size_t k = 0; k < inner; ++k) {
+                    const R& total = res[i * block_size + total_row * inner + k];
+                    R* carry = carries.data() + chunk * lanes + i * inner + k;
+                    *carry = (!HasInit && chunk == 1) ? total : op(*(carry - lanes), total);
                 }
             }
-
-            return *this;
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
-            typename Op, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
-                && TraversalResult == arrnd_traversal_result::apply)
-        constexpr auto& traverse(const Cont& cont, Op op)
-        {
-            // Apply operation on array if depth is relevant
-            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
-                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
-                    op(*this, cont);
-                } else {
-                    *this = op(*this, cont);
-                }
+        parallel_chunks_invoke(chunks, reduction, [&](std::size_t first_row, std::size_t last_row, std::size_t chunk) {
+            if (!HasInit && chunk == 0) {
+                return;
             }
-
-            // Traverse and perform operation on leaves.
-            if constexpr (arrnd_type<value_type>) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    for (auto& inner : *this) {
-                        inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                            TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
-                    }
-                } else {
-                    for (auto inners : zip(zipped(*this), zipped(cont))) {
-                        std::get<0>(inners)
-                            = std::get<0>(inners)
-                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
-                                      std::remove_reference_t<decltype(std::get<1>(inners))>, Op, CurrDepth + 1>(
-                                      std::get<1>(inners), op);
-                    }
-                }
-            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    for (auto& value : *this) {
-                        if constexpr (std::is_void_v<decltype(op(value, cont))>) {
-                            op(value, cont);
-                        } else {
-                            value = op(value, cont);
-                        }
-                    }
-                } else {
-                    for (auto values : zip(zipped(*this), zipped(cont))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(values), std::get<1>(values)))>) {
-                            op(std::get<0>(values), std::get<1>(values));
-                        } else {
-                            std::get<0>(values) = op(std::get<0>(values), std::get<1>(values));
+            if (exclusive) {
+                ++first_row;
+                last_row = std::min(last_row + 1, reduction);
+            }
+            for (std::size_t i = 0; i < outer; ++i) {
+                const R* carry = carries.data() + chunk * lanes + i * inner;
+                for (std::size_t j = first_row; j < last_row; ++j) {
+                    R* row = res + i * block_size + j * inner;
+                    if constexpr (std::is_arithmetic_v<R>) {
+                        vectorized_apply(row, carry, inner, [&op](R value, R carry_value) {
+                            return op(carry_value, value);
+                        });
+                    } else {
+                        for (std::size_t k = 0; k < inner; ++k) {
+                            row[k] = op(carry[k], row[k]);
                         }
                     }
                 }
             }
+        });
+    }
 
-            return *this;
+    // arr scanned along axis into a new Scan array
+    template <bool HasInit, typename Scan, typename Arrnd, typename BinaryOp>
+    [[nodiscard]] inline Scan scan_axis(const Arrnd& arr, std::size_t axis, const typename Scan::value_type& init,
+        arrnd_scan_type type, BinaryOp op)
+    {
+        if (arr.empty()) {
+            return Scan{};
+        }
+        if (axis >= size(arr.info())) {
+            throw std::out_of_range("invalid axis");
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
-                && TraversalResult == arrnd_traversal_result::transform)
-        [[nodiscard]] constexpr auto traverse(UnaryOp op) const
-        {
-            // The main thing done in this function is the returned type deduction.
+        Scan res(arr.info().dims());
+        std::size_t reduction = arr.info().dims()[axis];
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
+        auto* res_first = plain_zipped(res).first();
 
-            // Main compilation branches:
-            // - If arrnd_type<value_type> and relevant(CurrentDepth)
-            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
+        if (has_plain_elements(arr)) {
+            scan_rows<HasInit>(plain_zipped(arr).first(), res_first, outer, reduction, inner, init, type, op);
+        } else {
+            scan_rows<HasInit>(std::begin(arr), res_first, outer, reduction, inner, init, type, op);
+        }
 
-            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
-            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
+        return res;
+    }
 
-            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
-                using transform_t = replaced_type<decltype(std::declval<value_type>()
-                                                               .template traverse<FromDepth, ToDepth, TraversalType,
-                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
+    template <bool HasInit, typename Scan, typename Arrnd, typename BinaryOp>
+    [[nodiscard]] inline Scan scan_axis(const arrnd_parallel_policy& policy, const Arrnd& arr, std::size_t axis,
+        const typename Scan::value_type& init, arrnd_scan_type type, BinaryOp op)
+    {
+        if (arr.empty()) {
+            return Scan{};
+        }
+        if (axis >= size(arr.info())) {
+            throw std::out_of_range("invalid axis");
+        }
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+        auto src = has_plain_elements(arr) ? arr : Arrnd(arr.clone().refresh());
 
-                for (auto t : zip(zipped(*this), zipped(res))) {
-                    std::get<1>(t) = std::get<0>(t)
-                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
-                                             CurrDepth + 1>(op);
-                }
+        Scan res(arr.info().dims());
+        std::size_t reduction = arr.info().dims()[axis];
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
 
-                if constexpr (std::is_void_v<decltype(op(res))>) {
-                    op(res);
-                    return res;
-                } else {
-                    return op(res);
-                }
-            } else if constexpr (arrnd_type<value_type>) {
-                using transform_t = replaced_type<decltype(std::declval<value_type>()
-                                                               .template traverse<FromDepth, ToDepth, TraversalType,
-                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
+        parallel_scan_rows<HasInit>(
+            policy, plain_zipped(src).first(), plain_zipped(res).first(), outer, reduction, inner, init, type, op);
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+        return res;
+    }
 
-                for (auto t : zip(zipped(*this), zipped(res))) {
-                    std::get<1>(t) = std::get<0>(t)
-                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
-                                             CurrDepth + 1>(op);
-                }
+    template <typename T>
+    struct arrnd_lazy_operand {
+        using value_type = T;
+        using leaf_type = void;
+    };
 
-                return res;
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
-                using transform_t
-                    = std::conditional_t<std::is_void_v<decltype(op(*this))>, this_type, decltype(op(*this))>;
+    template <arrnd_type T>
+    struct arrnd_lazy_operand<T> {
+        using value_type = typename T::value_type;
+        using leaf_type = T;
+    };
 
-                transform_t res;
+    template <arrnd_lazy_expr_type T>
+    struct arrnd_lazy_operand<T> {
+        using value_type = typename T::value_type;
+        using leaf_type = typename T::leaf_type;
+    };
 
-                if constexpr (std::is_void_v<decltype(op(*this))>) {
-                    res = *this;
-                    op(res);
-                    return res;
-                } else {
-                    this_type mid = *this;
-                    return op(mid);
-                }
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
-                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this)))>,
-                    value_type, decltype(op(*std::begin(*this)))>>;
+    template <typename T, typename... Ts>
+    struct arrnd_first_leaf {
+        using type = std::conditional_t<std::is_void_v<T>, typename arrnd_first_leaf<Ts...>::type, T>;
+    };
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+    template <typename T>
+    struct arrnd_first_leaf<T> {
+        using type = T;
+    };
 
-                for (auto t : zip(zipped(*this), zipped(res))) {
-                    if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
-                        std::get<1>(t) = std::get<0>(t);
-                        op(std::get<1>(t));
-                    } else {
-                        std::get<1>(t) = op(std::get<0>(t));
-                    }
-                }
+    // element-wise expression, which is evaluated in a single pass over its arrays elements when it is
+    // converted or assigned to an array or reduced, without materializing arrays for its inner nodes.
+    // the operands might be arrays, expressions or scalars, and all of the arrays should have the same dims
+    // (i.e. they are not broadcasted).
+    template <typename Func, typename... Args>
+    class arrnd_lazy_expr {
+    public:
+        using tag = arrnd_lazy_expr_tag;
 
-                if constexpr (std::is_void_v<decltype(op(res))>) {
-                    op(res);
-                    return res;
-                } else {
-                    return op(res);
-                }
-            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
-                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this)))>,
-                    value_type, decltype(op(*std::begin(*this)))>>;
+        using value_type = std::remove_cvref_t<
+            std::invoke_result_t<const Func&, typename arrnd_lazy_operand<Args>::value_type...>>;
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+        using leaf_type = typename arrnd_first_leaf<typename arrnd_lazy_operand<Args>::leaf_type...>::type;
+        static_assert(!std::is_void_v<leaf_type>, "at least one of the operands should be an array");
 
-                for (auto t : zip(zipped(*this), zipped(res))) {
-                    if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
-                        std::get<1>(t) = std::get<0>(t);
-                        op(std::get<1>(t));
-                    } else {
-                        std::get<1>(t) = op(std::get<0>(t));
-                    }
+        using size_type = typename leaf_type::size_type;
+        using info_type = typename leaf_type::info_type;
+        using result_type = typename leaf_type::template replaced_type<value_type>;
+
+        template <typename, typename...>
+        friend class arrnd_lazy_expr;
+
+        explicit constexpr arrnd_lazy_expr(Func func, Args... args)
+            : func_(func)
+            , args_(std::move(args)...)
+        { }
+
+        [[nodiscard]] constexpr const info_type& info() const noexcept
+        {
+            return leading().info();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return leading().empty();
+        }
+
+        [[nodiscard]] constexpr result_type eval() const
+        {
+            return static_cast<result_type>(*this);
+        }
+
+        // evaluate into the elements of dst, which should have the same number of elements as the expression.
+        // in case that dst shares its storage with one of the expression arrays (e.g. an overlapping slice),
+        // the expression is evaluated into a temporary array first.
+        template <arrnd_type Arrnd>
+        constexpr Arrnd& eval(Arrnd& dst) const
+        {
+            validate();
+
+            if (total(dst.info()) != total(info())) {
+                throw std::invalid_argument("invalid input array dims");
+            }
+
+            if (empty()) {
+                return dst;
+            }
+
+            if (shares_storage(dst)) {
+                dst.copy_from(eval());
+                return dst;
+            }
+
+            auto eval_impl = [](auto next, auto dst_elems) {
+                for (auto t : zip(dst_elems)) {
+                    std::get<0>(t) = next();
                 }
+            };
 
-                return res;
+            if (has_plain_leaves()) {
+                zipped_invoke(
+                    [this, &eval_impl](auto dst_elems) {
+                        eval_impl(cursor<true>(), dst_elems);
+                    },
+                    dst);
             } else {
-                // No transformations
-                return *this;
+                zipped_invoke(
+                    [this, &eval_impl](auto dst_elems) {
+                        eval_impl(cursor<false>(), dst_elems);
+                    },
+                    dst);
             }
+
+            return dst;
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
-                && TraversalResult == arrnd_traversal_result::transform)
-        [[nodiscard]] constexpr auto traverse(UnaryOp op) const
+        template <arrnd_type Arrnd>
+            requires(Arrnd::is_flat)
+        [[nodiscard]] constexpr operator Arrnd() const
         {
-            // The main thing done in this function is the returned type deduction.
+            validate();
 
-            // Main compilation branches:
-            // - If arrnd_type<value_type> and relevant(CurrentDepth)
-            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
+            if (empty()) {
+                return Arrnd();
+            }
 
-            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
-            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
+            Arrnd res(info().dims());
+            eval(res);
+            return res;
+        }
 
-            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
-                auto invoke = [&op](auto arr) {
-                    if constexpr (std::is_void_v<decltype(op(arr))>) {
-                        op(arr);
-                        return arr;
-                    } else {
-                        return op(arr);
-                    }
-                };
-                auto mid = invoke(*this);
+        template <typename BinaryOp>
+        [[nodiscard]] constexpr auto reduce(BinaryOp op) const
+        {
+            using reduce_t = std::invoke_result_t<BinaryOp, value_type, value_type>;
 
-                using transform_t = replaced_type<decltype((*std::begin(mid))
-                                                               .template traverse<FromDepth, ToDepth, TraversalType,
-                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
+            validate();
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+            if (empty()) {
+                return reduce_t{};
+            }
 
-                for (auto t : zip(zipped(mid), zipped(res))) {
-                    std::get<1>(t) = std::get<0>(t)
-                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
-                                             CurrDepth + 1>(op);
+            auto reduce_impl = [n = total(info()), &op](auto next) {
+                auto res = static_cast<reduce_t>(next());
+                for (size_type i = 1; i < n; ++i) {
+                    res = op(res, next());
                 }
-
                 return res;
-            } else if constexpr (arrnd_type<value_type>) {
-                using transform_t = replaced_type<decltype(std::declval<value_type>()
-                                                               .template traverse<FromDepth, ToDepth, TraversalType,
-                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
+            };
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+            return has_plain_leaves() ? reduce_impl(cursor<true>()) : reduce_impl(cursor<false>());
+        }
 
-                for (auto t : zip(zipped(*this), zipped(res))) {
-                    std::get<1>(t) = std::get<0>(t)
-                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
-                                             CurrDepth + 1>(op);
-                }
+        template <typename U, typename BinaryOp>
+        [[nodiscard]] constexpr auto fold(const U& init, BinaryOp op) const
+        {
+            using fold_t = std::invoke_result_t<BinaryOp, U, value_type>;
 
-                return res;
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
-                using transform_t
-                    = std::conditional_t<std::is_void_v<decltype(op(*this))>, this_type, decltype(op(*this))>;
+            validate();
 
-                transform_t res;
+            if (empty()) {
+                return fold_t{};
+            }
 
-                if constexpr (std::is_void_v<decltype(op(*this))>) {
-                    res = *this;
-                    op(res);
-                    return res;
-                } else {
-                    this_type mid = *this;
-                    return op(mid);
+            auto fold_impl = [n = total(info()), &init, &op](auto next) {
+                auto res = static_cast<fold_t>(init);
+                for (size_type i = 0; i < n; ++i) {
+                    res = op(res, next());
                 }
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
-                auto invoke = [&op](auto arr) {
-                    if constexpr (std::is_void_v<decltype(op(arr))>) {
-                        op(arr);
-                        return arr;
-                    } else {
-                        return op(arr);
-                    }
-                };
-                auto mid = invoke(*this);
+                return res;
+            };
 
-                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(mid)))>,
-                    value_type, decltype(op(*std::begin(mid)))>>;
+            return has_plain_leaves() ? fold_impl(cursor<true>()) : fold_impl(cursor<false>());
+        }
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+    private:
+        template <std::size_t I = 0>
+        [[nodiscard]] constexpr const leaf_type& leading() const noexcept
+        {
+            using arg_type = std::tuple_element_t<I, std::tuple<Args...>>;
+            if constexpr (arrnd_type<arg_type>) {
+                return std::get<I>(args_);
+            } else if constexpr (arrnd_lazy_expr_type<arg_type>) {
+                return std::get<I>(args_).leading();
+            } else {
+                return leading<I + 1>();
+            }
+        }
 
-                for (auto t : zip(zipped(mid), zipped(res))) {
-                    if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
-                        std::get<1>(t) = std::get<0>(t);
-                        op(std::get<1>(t));
-                    } else {
-                        std::get<1>(t) = op(std::get<0>(t));
-                    }
+        template <typename LeafFunc>
+        constexpr void for_each_leaf(LeafFunc&& func) const
+        {
+            std::apply(
+                [&func](const auto&... args) {
+                    auto visit = [&func](const auto& arg) {
+                        if constexpr (arrnd_lazy_expr_type<decltype(arg)>) {
+                            arg.for_each_leaf(func);
+                        } else if constexpr (arrnd_type<decltype(arg)>) {
+                            func(arg);
+                        }
+                    };
+                    (visit(args), ...);
+                },
+                args_);
+        }
+
+        constexpr void validate() const
+        {
+            for_each_leaf([&dims = info().dims()](const auto& leaf) {
+                if (!std::equal(std::begin(leaf.info().dims()), std::end(leaf.info().dims()), std::begin(dims),
+                        std::end(dims))) {
+                    throw std::invalid_argument("invalid input array dims");
                 }
+            });
+        }
 
-                return res;
-            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
-                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this)))>,
-                    value_type, decltype(op(*std::begin(*this)))>>;
+        template <arrnd_type Arrnd>
+        [[nodiscard]] constexpr bool shares_storage(const Arrnd& arr) const noexcept
+        {
+            bool res = false;
+            for_each_leaf([&res, storage = static_cast<const void*>(arr.shared_storage().get())](const auto& leaf) {
+                res = res || static_cast<const void*>(leaf.shared_storage().get()) == storage;
+            });
+            return res;
+        }
 
-                transform_t res;
-                res.info()
-                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                res.shared_storage() = shared_storage_
-                    ? std::allocate_shared<typename transform_t::storage_type>(
-                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
-                        shared_storage_->size())
-                    : nullptr;
-                if (shared_storage_) {
-                    res.shared_storage()->reserve(shared_storage_->capacity());
-                }
+        [[nodiscard]] constexpr bool has_plain_leaves() const noexcept
+        {
+            bool res = true;
+            for_each_leaf([&res](const auto& leaf) {
+                res = res && has_plain_elements(leaf);
+            });
+            return res;
+        }
 
-                for (auto t : zip(zipped(*this), zipped(res))) {
-                    if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
-                        std::get<1>(t) = std::get<0>(t);
-                        op(std::get<1>(t));
+        // returns a function object, which returns the next element of the expression on each call.
+        // arrays elements are iterated by plain pointers if all of them are continuous.
+        template <bool Plain>
+        [[nodiscard]] constexpr auto cursor() const
+        {
+            auto operand_cursor = [](const auto& arg) {
+                if constexpr (arrnd_lazy_expr_type<decltype(arg)>) {
+                    return arg.template cursor<Plain>();
+                } else if constexpr (arrnd_type<decltype(arg)>) {
+                    if constexpr (Plain) {
+                        return [elem = plain_zipped(arg).first()]() mutable {
+                            return *(elem++);
+                        };
                     } else {
-                        std::get<1>(t) = op(std::get<0>(t));
+                        return [it = std::begin(arg)]() mutable {
+                            auto value = *it;
+                            ++it;
+                            return value;
+                        };
                     }
+                } else {
+                    return [&arg]() {
+                        return arg;
+                    };
                 }
+            };
 
-                return res;
-            } else {
-                // No transformations
-                return *this;
-            }
+            return std::apply(
+                [this, &operand_cursor](const auto&... args) {
+                    return [&func = func_, ... nexts = operand_cursor(args)]() mutable -> value_type {
+                        return func(nexts()...);
+                    };
+                },
+                args_);
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
-            typename Op, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
-                && TraversalResult == arrnd_traversal_result::transform)
-        [[nodiscard]] constexpr auto traverse(const Cont& cont, Op op) const
-        {
-            // The main thing done in this function is the returned type deduction.
+        Func func_;
+        std::tuple<Args...> args_;
+    };
 
-            // Main compilation branches:
-            // - If arrnd_type<value_type> and relevant(CurrentDepth)
-            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
+    // creates a leaf expression of a flat array, which might be combined with arrays,
+    // expressions and scalars by the arithmetic operators into a lazily evaluated expression.
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto lazy(const Arrnd& arr)
+    {
+        return arrnd_lazy_expr<std::identity, Arrnd>(std::identity{}, arr);
+    }
 
-            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
-            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
+    enum class arrnd_traversal_type { dfs, bfs };
+    enum class arrnd_traversal_result { apply, transform };
+    enum class arrnd_traversal_container { carry, propagate };
 
-            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<decltype(std::declval<value_type>()
-                                                     .template traverse<FromDepth, ToDepth, TraversalType,
-                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
-                                                         cont, op))>;
+    template <typename T, typename DataStorageTraits = simple_vector_traits<T>, typename ArrndInfo = arrnd_info<>>
+    class arrnd {
+        static_assert(std::is_same_v<T, typename DataStorageTraits::storage_type::value_type>);
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+    public:
+        using tag = arrnd_tag;
 
-                    for (auto t : zip(zipped(*this), zipped(res))) {
-                        std::get<1>(t) = std::get<0>(t)
-                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
-                    }
+        using data_storage_traits_type = DataStorageTraits;
 
-                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
-                        op(res, cont);
-                        return res;
-                    } else {
-                        return op(res, cont);
-                    }
-                } else {
-                    using transform_t = replaced_type<
-                        decltype(std::declval<value_type>()
-                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
-                                         CurrDepth + 1>(*std::begin(cont), op))>;
+        using storage_type = typename data_storage_traits_type::storage_type;
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <typename U>
+        using allocator_template_type = typename data_storage_traits_type::template allocator_template_type<U>;
 
-                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
-                        std::get<1>(t)
-                            = std::get<0>(t)
-                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
-                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
-                                      std::get<2>(t), op);
-                    }
+        using value_type = typename storage_type::value_type;
+        using size_type = typename storage_type::size_type;
+        using difference_type = typename storage_type::difference_type;
+        using reference = typename storage_type::reference;
+        using const_reference = typename storage_type::const_reference;
+        using pointer = typename storage_type::pointer;
+        using const_pointer = typename storage_type::const_pointer;
 
-                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
-                        op(res, cont);
-                        return res;
-                    } else {
-                        return op(res, cont);
-                    }
-                }
-            } else if constexpr (arrnd_type<value_type>) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<decltype(std::declval<value_type>()
-                                                     .template traverse<FromDepth, ToDepth, TraversalType,
-                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
-                                                         cont, op))>;
+        using info_type = ArrndInfo;
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        using indexer_type = arrnd_indexer<info_type>;
+        using windows_slider_type = arrnd_windows_slider<info_type>;
 
-                    for (auto t : zip(zipped(*this), zipped(res))) {
-                        std::get<1>(t) = std::get<0>(t)
-                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
-                    }
+        using boundary_type = typename info_type::boundary_type;
+        using window_type = typename windows_slider_type::window_type;
 
-                    return res;
-                } else {
-                    using transform_t = replaced_type<
-                        decltype(std::declval<value_type>()
-                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
-                                         CurrDepth + 1>(*std::begin(cont), op))>;
+        using this_type = arrnd<T, data_storage_traits_type, info_type>;
+        template <typename U>
+        using replaced_type = arrnd<U, typename data_storage_traits_type::template replaced_type<U>, info_type>;
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <std::size_t Depth>
+        using inner_type = arrnd_inner_t<this_type, Depth>;
+        template <typename U, std::size_t Depth>
+        using replaced_inner_type = arrnd_replaced_inner_type_t<this_type, U, Depth>;
 
-                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
-                        std::get<1>(t)
-                            = std::get<0>(t)
-                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
-                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
-                                      std::get<2>(t), op);
-                    }
+        using iterator = arrnd_iterator<this_type>;
+        using const_iterator = arrnd_const_iterator<this_type>;
+        using reverse_iterator = arrnd_reverse_iterator<this_type>;
+        using const_reverse_iterator = arrnd_const_reverse_iterator<this_type>;
 
-                    return res;
-                }
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
-                using transform_t = std::conditional_t<std::is_void_v<decltype(op(*this, cont))>, this_type,
-                    decltype(op(*this, cont))>;
+        using slice_iterator = arrnd_slice_iterator<this_type>;
+        using const_slice_iterator = arrnd_slice_const_iterator<this_type>;
+        using reverse_slice_iterator = arrnd_slice_reverse_iterator<this_type>;
+        using const_reverse_slice_iterator = arrnd_slice_reverse_const_iterator<this_type>;
 
-                transform_t res;
+        constexpr static std::size_t depth = arrnd_depth<T>();
+        constexpr static bool is_flat = (depth == 0);
 
-                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
-                    res = *this;
-                    op(res, cont);
-                    return res;
-                } else {
-                    this_type mid = *this;
-                    return op(mid, cont);
-                }
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), cont))>,
-                            value_type, decltype(op(*std::begin(*this), cont))>>;
+        template <std::size_t Depth>
+        using nested_t = arrnd_nested_t<this_type, Depth>;
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        constexpr arrnd() = default;
 
-                    for (auto t : zip(zipped(*this), zipped(res))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), cont);
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), cont);
-                        }
-                    }
+        constexpr arrnd(arrnd&& other) = default;
+        template <arrnd_type Arrnd>
+            requires arrnd_depths_match<arrnd, Arrnd>
+        constexpr arrnd(Arrnd&& other)
+        {
+            *this = other.clone<this_type>();
+            (void)Arrnd(std::move(other));
+        }
+        constexpr arrnd& operator=(arrnd&& other) & = default;
+        constexpr arrnd& operator=(arrnd&& other) &&
+        {
+            if (&other == this) {
+                return *this;
+            }
 
-                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
-                        op(res, cont);
-                        return res;
-                    } else {
-                        return op(res, cont);
-                    }
-                } else {
-                    using transform_t = replaced_type<
-                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), *std::begin(cont)))>,
-                            value_type, decltype(op(*std::begin(*this), *std::begin(cont)))>>;
+            copy_from(other);
+            (void)arrnd(std::move(other));
+            return *this;
+        }
+        template <arrnd_type Arrnd>
+            requires arrnd_depths_match<arrnd, Arrnd>
+        constexpr arrnd& operator=(Arrnd&& other) &
+        {
+            *this = other.clone<this_type>();
+            (void)Arrnd(std::move(other));
+            return *this;
+        }
+        template <arrnd_type Arrnd>
+            requires arrnd_depths_match<arrnd, Arrnd>
+        constexpr arrnd& operator=(Arrnd&& other) &&
+        {
+            copy_from(other);
+            (void)Arrnd(std::move(other));
+            return *this;
+        }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        constexpr arrnd(const arrnd& other) = default;
+        template <arrnd_type Arrnd>
+            requires arrnd_depths_match<arrnd, Arrnd>
+        constexpr arrnd(const Arrnd& other)
+        {
+            *this = other.clone<this_type>();
+        }
+        constexpr arrnd& operator=(const arrnd& other) & = default;
+        constexpr arrnd& operator=(const arrnd& other) &&
+        {
+            if (&other == this) {
+                return *this;
+            }
 
-                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), std::get<2>(t));
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
-                        }
-                    }
+            copy_from(other);
+            return *this;
+        }
+        template <arrnd_type Arrnd>
+            requires arrnd_depths_match<arrnd, Arrnd>
+        constexpr arrnd& operator=(const Arrnd& other) &
+        {
+            *this = other.clone<this_type>();
+            return *this;
+        }
+        template <arrnd_type Arrnd>
+            requires arrnd_depths_match<arrnd, Arrnd>
+        constexpr arrnd& operator=(const Arrnd& other) &&
+        {
+            copy_from(other);
+            return *this;
+        }
 
-                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
-                        op(res, cont);
-                        return res;
-                    } else {
-                        return op(res, cont);
-                    }
-                }
-            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), cont))>,
-                            value_type, decltype(op(*std::begin(*this), cont))>>;
+        // evaluate the expression into this array buffer in case that it's not shared with
+        // other arrays (which includes the expression arrays) and has the expression dims
+        template <arrnd_lazy_expr_type Expr>
+            requires(is_flat)
+        constexpr arrnd& operator=(const Expr& expr) &
+        {
+            if (!empty() && shared_storage_.use_count() == 1 && info_.hints() == arrnd_hint::continuous
+                && std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(expr.info().dims()),
+                    std::end(expr.info().dims()))) {
+                expr.eval(*this);
+                return *this;
+            }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+            *this = static_cast<this_type>(expr);
+            return *this;
+        }
+        template <arrnd_lazy_expr_type Expr>
+            requires(is_flat)
+        constexpr arrnd& operator=(const Expr& expr) &&
+        {
+            expr.eval(*this);
+            return *this;
+        }
 
-                    for (auto t : zip(zipped(*this), zipped(res))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), cont);
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), cont);
-                        }
-                    }
+        template <typename U>
+            requires(!arrnd_type<U> && !arrnd_lazy_expr_type<U>)
+        constexpr arrnd& operator=(const U& value)
+        {
+            if (empty()) {
+                return *this;
+            }
 
-                    return res;
-                } else {
-                    using transform_t = replaced_type<
-                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), *std::begin(cont)))>,
-                            value_type, decltype(op(*std::begin(*this), *std::begin(cont)))>>;
+            std::fill(begin(), end(), value);
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+            return *this;
+        }
 
-                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), std::get<2>(t));
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
-                        }
-                    }
+        virtual constexpr ~arrnd() = default;
 
-                    return res;
+        explicit constexpr arrnd(const info_type& info, std::shared_ptr<storage_type> shared_storage)
+            : info_(info)
+            , shared_storage_(shared_storage)
+        {
+            // check if the arrnd type invariant is legal.
+            if (!oc::arrnd::empty(info)) {
+                if (!shared_storage || std::empty(*shared_storage)) {
+                    throw std::invalid_argument("invalid null or empty shared storage");
+                }
+                if (!(info.indices_boundary().start() < shared_storage->size()
+                        && info.indices_boundary().stop() <= shared_storage->size())) {
+                    throw std::invalid_argument("invalid shared storage size not in indices boundaries");
                 }
-            } else {
-                // No transformations
-                return *this;
             }
         }
 
-        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
-            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
-            typename Op, std::size_t CurrDepth = 0>
-            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
-                && TraversalResult == arrnd_traversal_result::transform)
-        [[nodiscard]] constexpr auto traverse(const Cont& cont, Op op) const
+        template <iterator_of_type_integral InputDimsIt, iterator_type InputDataIt>
+        explicit constexpr arrnd(
+            InputDimsIt first_dim, InputDimsIt last_dim, InputDataIt first_data, InputDataIt last_data)
+            : info_(first_dim, last_dim)
+            , shared_storage_(oc::arrnd::empty(info_)
+                      ? nullptr
+                      : std::allocate_shared<storage_type>(
+                          allocator_template_type<storage_type>(), first_data, last_data))
         {
-            // The main thing done in this function is the returned type deduction.
-
-            // Main compilation branches:
-            // - If arrnd_type<value_type> and relevant(CurrentDepth)
-            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
-            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
-
-            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
-            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
+            // in case that data buffer allocated, check the number of data elements is valid
+            if (shared_storage_ && std::distance(first_data, last_data) != oc::arrnd::total(info_)) {
+                throw std::invalid_argument("number of elements by dims is not match to the number of data elements");
+            }
+        }
 
-            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
-                auto invoke = [&op, &cont](auto arr) {
-                    if constexpr (std::is_void_v<decltype(op(arr, cont))>) {
-                        op(arr, cont);
-                        return arr;
-                    } else {
-                        return op(arr, cont);
-                    }
-                };
-                auto mid = invoke(*this);
+        template <typename U>
+        explicit constexpr arrnd(std::initializer_list<size_type> dims, std::initializer_list<U> data)
+            : arrnd(dims.begin(), dims.end(), data.begin(), data.end())
+        { }
 
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<decltype((*std::begin(mid))
-                                                     .template traverse<FromDepth, ToDepth, TraversalType,
-                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
-                                                         cont, op))>;
+        template <iterable_of_type_integral Cont, iterable_type DataCont>
+            requires(!template_type<DataCont, std::initializer_list>)
+        explicit constexpr arrnd(const Cont& dims, const DataCont& data)
+            : arrnd(std::begin(dims), std::end(dims), std::begin(data), std::end(data))
+        { }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <iterator_of_type_integral InputDimsIt>
+        explicit constexpr arrnd(const InputDimsIt& first_dim, const InputDimsIt& last_dim)
+            : info_(first_dim, last_dim)
+            , shared_storage_(oc::arrnd::empty(info_)
+                      ? nullptr
+                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        { }
+        template <iterable_of_type_integral Cont>
+        explicit constexpr arrnd(const Cont& dims)
+            : arrnd(std::begin(dims), std::end(dims))
+        { }
+        explicit constexpr arrnd(std::initializer_list<size_type> dims)
+            : arrnd(dims.begin(), dims.end())
+        { }
 
-                    for (auto t : zip(zipped(mid), zipped(res))) {
-                        std::get<1>(t) = std::get<0>(t)
-                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
-                    }
+        template <iterator_of_type_integral InputDimsIt>
+        explicit constexpr arrnd(InputDimsIt first_dim, InputDimsIt last_dim, const_reference value)
+            : info_(first_dim, last_dim)
+            , shared_storage_(oc::arrnd::empty(info_)
+                      ? nullptr
+                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        {
+            if (shared_storage_) {
+                std::fill(shared_storage_->begin(), shared_storage_->end(), value);
+            }
+        }
+        template <iterable_of_type_integral Cont>
+        explicit constexpr arrnd(const Cont& dims, const_reference value)
+            : arrnd(std::begin(dims), std::end(dims), value)
+        { }
+        explicit constexpr arrnd(std::initializer_list<size_type> dims, const_reference value)
+            : arrnd(dims.begin(), dims.end(), value)
+        { }
 
-                    return res;
-                } else {
-                    using transform_t = replaced_type<
-                        decltype((*std::begin(mid))
-                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
-                                         CurrDepth + 1>(*std::begin(cont), op))>;
+        template <iterator_of_type_integral InputDimsIt, typename U>
+        explicit constexpr arrnd(InputDimsIt first_dim, InputDimsIt last_dim, const U& value)
+            : info_(first_dim, last_dim)
+            , shared_storage_(oc::arrnd::empty(info_)
+                      ? nullptr
+                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        {
+            if (shared_storage_) {
+                std::fill(shared_storage_->begin(), shared_storage_->end(), value);
+            }
+        }
+        template <iterable_of_type_integral Cont, typename U>
+        explicit constexpr arrnd(const Cont& dims, const U& value)
+            : arrnd(std::begin(dims), std::end(dims), value)
+        { }
+        template <typename U>
+        explicit constexpr arrnd(std::initializer_list<size_type> dims, const U& value)
+            : arrnd(dims.begin(), dims.end(), value)
+        { }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <iterator_of_type_integral InputDimsIt, typename Func>
+            requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
+        explicit constexpr arrnd(InputDimsIt first_dim, InputDimsIt last_dim, Func&& func)
+            : info_(first_dim, last_dim)
+            , shared_storage_(oc::arrnd::empty(info_)
+                      ? nullptr
+                      : std::allocate_shared<storage_type>(allocator_template_type<storage_type>(), total(info_)))
+        {
+            if (shared_storage_) {
+                std::for_each(shared_storage_->begin(), shared_storage_->end(), [&func](auto& value) {
+                    value = static_cast<value_type>(func());
+                });
+            }
+        }
+        template <iterable_of_type_integral Cont, typename Func>
+            requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
+        explicit constexpr arrnd(const Cont& dims, Func&& func)
+            : arrnd(std::begin(dims), std::end(dims), std::forward<Func>(func))
+        { }
+        template <typename Func>
+            requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
+        explicit constexpr arrnd(std::initializer_list<size_type> dims, Func&& func)
+            : arrnd(dims.begin(), dims.end(), std::forward<Func>(func))
+        { }
 
-                    for (auto t : zip(zipped(mid), zipped(res), zipped(cont))) {
-                        std::get<1>(t)
-                            = std::get<0>(t)
-                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
-                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
-                                      std::get<2>(t), op);
-                    }
+        [[nodiscard]] constexpr const info_type& info() const noexcept
+        {
+            return info_;
+        }
 
-                    return res;
-                }
-            } else if constexpr (arrnd_type<value_type>) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<decltype(std::declval<value_type>()
-                                                     .template traverse<FromDepth, ToDepth, TraversalType,
-                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
-                                                         cont, op))>;
+        [[nodiscard]] constexpr info_type& info() noexcept
+        {
+            return info_;
+        }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        [[nodiscard]] constexpr const auto& shared_storage() const noexcept
+        {
+            return shared_storage_;
+        }
 
-                    for (auto t : zip(zipped(*this), zipped(res))) {
-                        std::get<1>(t) = std::get<0>(t)
-                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
-                    }
+        [[nodiscard]] constexpr auto& shared_storage() noexcept
+        {
+            return shared_storage_;
+        }
 
-                    return res;
-                } else {
-                    using transform_t = replaced_type<
-                        decltype(std::declval<value_type>()
-                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
-                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
-                                         CurrDepth + 1>(*std::begin(cont), op))>;
+        [[nodiscard]] constexpr const this_type* creator() const noexcept
+        {
+            return creators_.is_creator_valid.expired() ? nullptr : creators_.latest_creator;
+        }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        [[nodiscard]] explicit constexpr operator value_type() const
+        {
+            if (!oc::arrnd::isscalar(info_)) {
+                throw std::exception("info is not scalar");
+            }
+            return (*this)[info_.indices_boundary().start()];
+        }
 
-                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
-                        std::get<1>(t)
-                            = std::get<0>(t)
-                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
-                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
-                                      std::get<2>(t), op);
-                    }
+        [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+        {
+            assert(shared_storage_);
+            assert(index >= info_.indices_boundary().start() && index < info_.indices_boundary().stop());
+            return shared_storage_->data()[index];
+        }
+        [[nodiscard]] constexpr reference operator[](size_type index) noexcept
+        {
+            assert(shared_storage_);
+            assert(index >= info_.indices_boundary().start() && index < info_.indices_boundary().stop());
+            return shared_storage_->data()[index];
+        }
 
-                    return res;
-                }
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
-                using transform_t = std::conditional_t<std::is_void_v<decltype(op(*this, cont))>, this_type,
-                    decltype(op(*this, cont))>;
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr const_reference operator[](std::pair<InputIt, InputIt> subs) const noexcept
+        {
+            assert(shared_storage_);
+            return shared_storage_->data()[oc::arrnd::sub2ind(info_, subs.first, subs.second)];
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr const_reference operator[](const Cont& subs) const noexcept
+        {
+            return (*this)[std::make_pair(std::begin(subs), std::end(subs))];
+        }
+        [[nodiscard]] constexpr const_reference operator[](std::initializer_list<size_type> subs) const noexcept
+        {
+            return (*this)[std::make_pair(subs.begin(), subs.end())];
+        }
 
-                transform_t res;
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr reference operator[](std::pair<InputIt, InputIt> subs) noexcept
+        {
+            assert(shared_storage_);
+            return shared_storage_->data()[oc::arrnd::sub2ind(info_, subs.first, subs.second)];
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr reference operator[](const Cont& subs) noexcept
+        {
+            return (*this)[std::make_pair(std::begin(subs), std::end(subs))];
+        }
+        [[nodiscard]] constexpr reference operator[](std::initializer_list<size_type> subs) noexcept
+        {
+            return (*this)[std::make_pair(subs.begin(), subs.end())];
+        }
 
-                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
-                    res = *this;
-                    op(res, cont);
-                    return res;
-                } else {
-                    this_type mid = *this;
-                    return op(mid, cont);
-                }
-            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
-                auto invoke = [&op, &cont](auto arr) {
-                    if constexpr (std::is_void_v<decltype(op(arr, cont))>) {
-                        op(arr, cont);
-                        return arr;
-                    } else {
-                        return op(arr, cont);
-                    }
-                };
-                auto mid = invoke(*this);
-
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(mid), cont))>,
-                            value_type, decltype(op(*std::begin(mid), cont))>>;
-
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <iterator_of_type_interval InputIt>
+        [[nodiscard]] constexpr this_type operator[](std::pair<InputIt, InputIt> boundaries) const&
+        {
+            this_type slice(oc::arrnd::slice(info_, boundaries.first, boundaries.second), shared_storage_);
+            link_creator(slice);
+            return slice;
+        }
+        template <iterator_of_type_interval InputIt>
+        [[nodiscard]] constexpr this_type operator[](std::pair<InputIt, InputIt> boundaries) const&&
+        {
+            return this_type(oc::arrnd::slice(info_, boundaries.first, boundaries.second), shared_storage_);
+        }
+        template <iterable_of_type_interval Cont>
+        [[nodiscard]] constexpr this_type operator[](const Cont& boundaries) const&
+        {
+            return (*this)[std::make_pair(std::cbegin(boundaries), std::cend(boundaries))];
+        }
+        template <iterable_of_type_interval Cont>
+        [[nodiscard]] constexpr this_type operator[](const Cont& boundaries) const&&
+        {
+            return std::move(*this)[std::make_pair(std::begin(boundaries), std::end(boundaries))];
+        }
+        [[nodiscard]] constexpr this_type operator[](std::initializer_list<boundary_type> boundaries) const&
+        {
+            return (*this)[std::make_pair(boundaries.begin(), boundaries.end())];
+        }
+        [[nodiscard]] constexpr this_type operator[](
+            std::initializer_list<boundary_type> boundaries) const&&
+        {
+            return std::move(*this)[std::make_pair(boundaries.begin(), boundaries.end())];
+        }
 
-                    for (auto t : zip(zipped(mid), zipped(res))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), cont);
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), cont);
-                        }
-                    }
+        [[nodiscard]] constexpr this_type operator[](boundary_type boundary) const&
+        {
+            this_type slice(
+                oc::arrnd::squeeze(oc::arrnd::slice(info_, boundary, 0), arrnd_squeeze_type::left, 1), shared_storage_);
+            link_creator(slice);
+            return slice;
+        }
+        [[nodiscard]] constexpr this_type operator[](boundary_type boundary) const&&
+        {
+            return this_type(
+                oc::arrnd::squeeze(oc::arrnd::slice(info_, boundary, 0), arrnd_squeeze_type::left, 1), shared_storage_);
+        }
 
-                    return res;
-                } else {
-                    using transform_t = replaced_type<
-                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(mid), *std::begin(cont)))>,
-                            value_type, decltype(op(*std::begin(mid), *std::begin(cont)))>>;
+        [[nodiscard]] constexpr this_type operator()(boundary_type boundary, size_type axis) const&
+        {
+            this_type slice(oc::arrnd::slice(info_, boundary, axis), shared_storage_);
+            link_creator(slice);
+            return slice;
+        }
+        [[nodiscard]] constexpr this_type operator()(boundary_type boundary, size_type axis) const&&
+        {
+            return this_type(oc::arrnd::slice(info_, boundary, axis), shared_storage_);
+        }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        // access relative array indices, might be slow for slices
+        [[nodiscard]] constexpr const_reference operator()(size_type index) const noexcept
+        {
+            assert(index >= 0 && index <= total(info_));
+            return issliced(info_) ? shared_storage_->data()[oc::arrnd::ind2ind(info_, index)]
+                                   : shared_storage_->data()[index];
+        }
+        [[nodiscard]] constexpr reference operator()(size_type index) noexcept
+        {
+            assert(index >= 0 && index <= total(info_));
+            return issliced(info_) ? shared_storage_->data()[oc::arrnd::ind2ind(info_, index)]
+                                   : shared_storage_->data()[index];
+        }
 
-                    for (auto t : zip(zipped(mid), zipped(res), zipped(cont))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), std::get<2>(t));
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
-                        }
-                    }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto operator()(std::pair<InputIt, InputIt> indices) const
+        {
+            return std::move(*this)(replaced_type<size_type>(
+                {std::distance(indices.first, indices.second)}, indices.first, indices.second));
+        }
+        template <iterable_of_type_integral Cont>
+            requires(!arrnd_type<Cont>)
+        [[nodiscard]] constexpr auto operator()(const Cont& indices) const
+        {
+            return (*this)(replaced_type<size_type>({std::ssize(indices)}, std::begin(indices), std::end(indices)));
+        }
+        // more strict function than filter. in case of logical type arrnd, its being treated as mask
+        template <arrnd_type Arrnd>
+            requires(std::integral<typename Arrnd::value_type>)
+        [[nodiscard]] constexpr auto operator()(const Arrnd& selector) const
+        {
+            return arrnd_lazy_filter(*this, selector);
+        }
+        [[nodiscard]] constexpr auto operator()(std::initializer_list<size_type> indices) const
+        {
+            std::initializer_list<size_type> dims{std::size(indices)};
+            return (*this)(replaced_type<size_type>(dims.begin(), dims.end(), indices.begin(), indices.end()));
+        }
 
-                    return res;
-                }
-            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
-                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
-                    using transform_t
-                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), cont))>,
-                            value_type, decltype(op(*std::begin(*this), cont))>>;
+        [[nodiscard]] constexpr auto operator()(arrnd_common_shape shape) const
+        {
+            return reshape(shape);
+        }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <typename Pred>
+            requires(!arrnd_type<Pred> && std::is_invocable_v<Pred, value_type>)
+        [[nodiscard]] constexpr auto operator()(Pred&& pred) const
+        {
+            auto selector = [&pred](const value_type& value) {
+                return pred(value);
+            };
 
-                    for (auto t : zip(zipped(*this), zipped(res))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), cont);
-                        } else {
-                            std::get<1>(t) = op(std::get<0>(t), cont);
-                        }
-                    }
+            return arrnd_lazy_filter(*this, selector);
+        }
 
-                    return res;
-                } else {
-                    using transform_t = replaced_type<
-                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), *std::begin(cont)))>,
-                            value_type, decltype(op(*std::begin(*this), *std::begin(cont)))>>;
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return oc::arrnd::empty(info_);
+        }
 
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
-                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
-                                               typename transform_t::template allocator_template_type<
-                                                   typename transform_t::storage_type>(),
-                                               shared_storage_->size())
-                                                           : nullptr;
-                    if (shared_storage_) {
-                        res.shared_storage()->reserve(shared_storage_->capacity());
-                    }
+        template <iterator_type InputIt>
+        constexpr this_type& copy_from(InputIt first_data, InputIt last_data)
+        {
+            if (empty() || std::distance(first_data, last_data) <= 0) {
+                return *this;
+            }
 
-                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
-                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
-                            std::get<1>(t) = std::get<0>(t);
-                            op(std::get<1>(t), std::get<2>(t));
+            zipped_invoke(
+                [&first_data, &last_data](auto this_elems) {
+                    for (auto t : zip(this_elems, zipped(first_data, last_data))) {
+                        if constexpr (arrnd_type<value_type> && arrnd_type<decltype(std::get<1>(t))>) {
+                            std::get<0>(t).copy_from(std::begin(std::get<1>(t)), std::end(std::get<1>(t)));
                         } else {
-                            std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
+                            std::get<0>(t) = std::get<1>(t);
                         }
                     }
+                },
+                *this);
 
-                    return res;
-                }
-            } else {
-                // No transformations
-                return *this;
-            }
+            return *this;
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename UnaryOp>
-        [[nodiscard]] constexpr auto transform(UnaryOp op) const
+        template <iterable_type Cont>
+        constexpr this_type& copy_from(const Cont& data)
         {
-            return traverse<AtDepth + 1, AtDepth + 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(op);
+            return copy_from(std::begin(data), std::end(data));
         }
 
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryOp>
-        [[nodiscard]] constexpr auto transform(const Arrnd& arr, BinaryOp op) const
+        template <typename U>
+        constexpr this_type& copy_from(std::initializer_list<U> data)
         {
-            auto transform_impl = [&op](const auto& lhs, const auto& rhs) {
-                using transform_t
-                    = decltype(lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
-                               arrnd_traversal_container::propagate>(rhs, op));
+            return copy_from(data.begin(), data.end());
+        }
 
-                if (lhs.empty() && rhs.empty()) {
-                    return transform_t{};
-                }
+        template <iterable_type Cont>
+            requires(this_type::is_flat)
+        constexpr this_type& copy_from(const arrnd_parallel_policy& policy, const Cont& data)
+        {
+            auto count = std::min(static_cast<std::ptrdiff_t>(total(info_)),
+                static_cast<std::ptrdiff_t>(std::distance(std::begin(data), std::end(data))));
 
-                if (isscalar(rhs.info())) {
-                    return lhs.template transform<0>(
-                        [&op, &rval = std::as_const(rhs(0))](const auto& lval) -> typename transform_t::value_type {
-                            if constexpr (std::is_void_v<decltype(op(std::forward<decltype(lval)>(lval), rval))>) {
-                                op(std::forward<decltype(lval)>(lval), rval);
-                            } else {
-                                return op(std::forward<decltype(lval)>(lval), rval);
-                            }
-                        });
-                }
+            if (empty() || count <= 0) {
+                return *this;
+            }
 
-                if (isscalar(lhs.info())) {
-                    return rhs.template transform<0>(
-                        [&op, &lval = std::as_const(lhs(0))](auto&& rval) -> typename transform_t::value_type {
-                            if constexpr (std::is_void_v<decltype(op(lval, std::forward<decltype(rval)>(rval)))>) {
-                                op(lval, std::forward<decltype(rval)>(rval));
-                            } else {
-                                return op(lval, std::forward<decltype(rval)>(rval));
+            parallel_chunks_invoke(num_chunks(policy, count), count,
+                [this, &data](std::size_t first, std::size_t last, std::size_t) {
+                    chunk_invoke(
+                        [](auto this_elems, auto data_elems) {
+                            for (auto t : zip(this_elems, data_elems)) {
+                                std::get<0>(t) = std::get<1>(t);
                             }
-                        });
-                }
-
-                if (total(lhs.info()) == total(rhs.info())) {
-                    return lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
-                        arrnd_traversal_container::propagate>(rhs, op);
-                }
-
-                if (total(lhs.info()) > total(rhs.info()) && size(lhs.info()) == size(rhs.info())) {
-                    auto zipped_dims = (zip(zipped(lhs.info().dims()), zipped(rhs.info().dims())));
-                    if (std::any_of(std::begin(zipped_dims), std::end(zipped_dims), [](auto t) {
-                            return std::get<0>(t) % std::get<1>(t) != 0;
-                        })) {
-                        throw std::invalid_argument("invalid input array dims for boradcast");
-                    }
-
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        lhs.info().dims(), lhs.info().strides(), lhs.info().indices_boundary(), lhs.info().hints());
-                    res.shared_storage() = lhs.shared_storage()
-                        ? std::allocate_shared<typename transform_t::storage_type>(
-                            typename transform_t::template allocator_template_type<
-                                typename transform_t::storage_type>(),
-                            lhs.shared_storage()->size())
-                        : nullptr;
-                    if (lhs.shared_storage()) {
-                        res.shared_storage()->reserve(lhs.shared_storage()->capacity());
-                    }
-
-                    typename transform_t::info_type::storage_traits_type::template replaced_type<
-                        typename transform_t::window_type>::storage_type windows(size(lhs.info()));
-
-                    std::transform(std::begin(rhs.info().dims()), std::end(rhs.info().dims()), std::begin(windows),
-                        [](typename transform_t::difference_type d) {
-                            return typename transform_t::window_type(
-                                typename transform_t::window_type::interval_type{0, d}, arrnd_window_type::complete);
-                        });
-
-                    for (typename transform_t::windows_slider_type slider(lhs.info(), windows); slider; ++slider) {
-                        auto slc = lhs[*slider];
-                        res[*slider] = slc.template traverse<1, 1, arrnd_traversal_type::dfs,
-                            arrnd_traversal_result::transform, arrnd_traversal_container::propagate>(rhs, op);
-                    }
-
-                    return res;
-                }
-
-                if (total(lhs.info()) < total(rhs.info()) && size(lhs.info()) == size(rhs.info())) {
-                    auto zipped_dims = (zip(zipped(lhs.info().dims()), zipped(rhs.info().dims())));
-                    if (std::any_of(std::begin(zipped_dims), std::end(zipped_dims), [](auto t) {
-                            return std::get<1>(t) % std::get<0>(t) != 0;
-                        })) {
-                        throw std::invalid_argument("invalid input array dims for boradcast");
-                    }
-
-                    transform_t res;
-                    res.info() = transform_t::info_type(
-                        rhs.info().dims(), rhs.info().strides(), rhs.info().indices_boundary(), rhs.info().hints());
-                    res.shared_storage() = rhs.shared_storage()
-                        ? std::allocate_shared<typename transform_t::storage_type>(
-                            typename transform_t::template allocator_template_type<
-                                typename transform_t::storage_type>(),
-                            rhs.shared_storage()->size())
-                        : nullptr;
-                    if (rhs.shared_storage()) {
-                        res.shared_storage()->reserve(rhs.shared_storage()->capacity());
-                    }
+                        },
+                        first, last, *this, data);
+                });
 
-                    typename transform_t::info_type::storage_traits_type::template replaced_type<
-                        typename transform_t::window_type>::storage_type windows(size(rhs.info()));
+            return *this;
+        }
 
-                    std::transform(std::begin(lhs.info().dims()), std::end(lhs.info().dims()), std::begin(windows),
-                        [](typename transform_t::difference_type d) {
-                            return typename transform_t::window_type(
-                                typename transform_t::window_type::interval_type{0, d}, arrnd_window_type::complete);
-                        });
+        template <iterator_type InputIt1, iterator_of_type_integral InputIt2>
+        constexpr this_type& copy_from(
+            InputIt1 first_data, InputIt1 last_data, InputIt2 first_index, InputIt2 last_index)
+        {
+            if (empty() || std::distance(first_data, last_data) <= 0 || std::distance(first_index, last_index) <= 0) {
+                return *this;
+            }
 
-                    for (typename transform_t::windows_slider_type slider(rhs.info(), windows); slider; ++slider) {
-                        auto slc = rhs[*slider];
-                        res[*slider] = lhs.template traverse<1, 1, arrnd_traversal_type::dfs,
-                            arrnd_traversal_result::transform, arrnd_traversal_container::propagate>(slc, op);
-                    }
+            if (std::any_of(first_index, last_index, [&](auto index) {
+                    return index < info_.indices_boundary().start() || index >= info_.indices_boundary().stop();
+                })) {
+                throw std::invalid_argument("invalid input indices");
+            }
 
-                    return res;
+            for (auto t : zip(zipped(first_data, last_data), zipped(first_index, last_index))) {
+                if constexpr (arrnd_type<value_type> && arrnd_type<decltype(std::get<0>(t))>) {
+                    (*this)[std::get<1>(t)].copy_from(std::get<0>(t));
+                } else {
+                    (*this)[std::get<1>(t)] = std::get<0>(t);
                 }
+            }
 
-                throw std::invalid_argument("invalid input array dims");
-            };
-
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
-                arrnd_traversal_container::propagate>(arr, transform_impl);
+            return *this;
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename UnaryOp>
-        constexpr auto& apply(UnaryOp op)
+        template <iterable_type Cont1, iterable_of_type_integral Cont2>
+            requires(!std::is_same_v<bool, iterable_value_t<Cont2>>) // to prevent ambiguity with mask
+        constexpr this_type& copy_from(const Cont1& data, const Cont2& indices)
         {
-            return traverse<AtDepth + 1, AtDepth + 1, arrnd_traversal_type::dfs, arrnd_traversal_result::apply>(op);
+            return copy_from(std::begin(data), std::end(data), std::begin(indices), std::end(indices));
         }
 
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryOp>
-        constexpr auto& apply(const Arrnd& arr, BinaryOp op)
+        template <typename U>
+        constexpr this_type& copy_from(std::initializer_list<U> data, std::initializer_list<size_type> indices)
         {
-            auto apply_impl = [&op](auto& lhs, auto& rhs) {
-                if (lhs.empty() && rhs.empty()) {
-                    return lhs;
-                }
+            return copy_from(data.begin(), data.end(), indices.begin(), indices.end());
+        }
 
-                constexpr bool is_void_op = std::is_same_v<
-                    std::invoke_result_t<BinaryOp, decltype(*std::begin(lhs)), decltype(*std::begin(rhs))>, void>;
+        template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+            requires(std::is_same_v<bool, typename Arrnd2::value_type>)
+        constexpr this_type& copy_from(const Arrnd1& data, const Arrnd2& mask)
+        {
+            if (empty() || data.empty() || mask.empty()) {
+                return *this;
+            }
 
-                if (isscalar(rhs.info())) {
-                    return lhs.template apply<0>([&op, &rval = rhs(0)](auto&& lval) {
-                        if constexpr (std::is_void_v<decltype(op(std::forward<decltype(lval)>(lval), rval))>) {
-                            op(std::forward<decltype(lval)>(lval), rval);
-                        } else {
-                            return op(std::forward<decltype(lval)>(lval), rval);
-                        }
-                    });
-                }
+            if (!std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(mask.info().dims()),
+                    std::end(mask.info().dims()))) {
+                throw std::invalid_argument("invalid mask dims");
+            }
 
-                if (total(lhs.info()) == total(rhs.info())) {
-                    return lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::apply,
-                        arrnd_traversal_container::propagate>(rhs, op);
-                }
+            auto dst_it = begin();
+            auto src_it = data.begin();
+            auto msk_it = mask.begin();
 
-                if (total(lhs.info()) > total(rhs.info()) && size(lhs.info()) == size(rhs.info())) {
-                    auto zipped_dims = (zip(zipped(lhs.info().dims()), zipped(rhs.info().dims())));
-                    if (std::any_of(std::begin(zipped_dims), std::end(zipped_dims), [](auto t) {
-                            return std::get<0>(t) % std::get<1>(t) != 0;
-                        })) {
-                        throw std::invalid_argument("invalid input array dims for boradcast");
+            for (; dst_it != end() && src_it != data.end() && msk_it != mask.end(); ++dst_it, ++msk_it) {
+                if (*msk_it) {
+                    if constexpr (arrnd_type<value_type> && arrnd_type<decltype(*src_it)>) {
+                        (*dst_it).copy_from(*src_it);
+                    } else {
+                        *dst_it = *src_it;
                     }
+                    ++src_it;
+                }
+            }
+        }
 
-                    using lhs_t = std::remove_cvref_t<decltype(lhs)>;
+        template <iterator_type InputIt, typename Pred>
+            requires(std::is_invocable_v<Pred, value_type> && !arrnd_type<Pred>)
+        constexpr this_type& copy_from(InputIt first_data, InputIt last_data, Pred pred)
+        {
+            if (empty() || std::distance(first_data, last_data) <= 0) {
+                return *this;
+            }
 
-                    typename lhs_t::info_type::storage_traits_type::template replaced_type<
-                        typename lhs_t::window_type>::storage_type windows(size(lhs.info()));
+            if (total(info_) < std::distance(first_data, last_data)) {
+                throw std::invalid_argument("invalid input data - number of input data might be small for array");
+            }
 
-                    std::transform(std::begin(rhs.info().dims()), std::end(rhs.info().dims()), std::begin(windows),
-                        [](typename lhs_t::difference_type d) {
-                            return typename lhs_t::window_type(
-                                typename lhs_t::window_type::interval_type{0, d}, arrnd_window_type::complete);
-                        });
+            auto dst_it = begin();
+            auto src_it = first_data;
 
-                    for (typename lhs_t::windows_slider_type slider(lhs.info(), windows); slider; ++slider) {
-                        auto slc = lhs[*slider];
-                        slc.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::apply,
-                            arrnd_traversal_container::propagate>(rhs, op);
+            for (; dst_it != end() && src_it != last_data; ++dst_it) {
+                if (pred(*dst_it)) {
+                    if constexpr (arrnd_type<value_type> && arrnd_type<decltype(*src_it)>) {
+                        (*dst_it).copy_from(*src_it);
+                    } else {
+                        *dst_it = *src_it;
                     }
-
-                    return lhs;
+                    ++src_it;
                 }
+            }
 
-                throw std::invalid_argument("invalid input array dims");
-            };
-
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::apply,
-                arrnd_traversal_container::propagate>(arr, apply_impl);
+            return *this;
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename BinaryOp>
-        [[nodiscard]] constexpr auto reduce(BinaryOp op) const
+        template <iterable_type Cont, typename Pred>
+            requires(std::is_invocable_v<Pred, value_type> && !arrnd_type<Pred>)
+        constexpr this_type& copy_from(const Cont& data, Pred&& pred)
         {
-            auto reduce_impl = [&op](const auto& arr) {
-                using reduce_t = std::invoke_result_t<BinaryOp, typename std::remove_cvref_t<decltype(arr)>::value_type,
-                    typename std::remove_cvref_t<decltype(arr)>::value_type>;
-
-                if (arr.empty()) {
-                    return reduce_t{};
-                }
-
-                return std::reduce(std::next(arr.begin(), 1), arr.end(), static_cast<reduce_t>(*(arr.begin())), op);
-            };
-
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
-                reduce_impl);
+            return copy_from(std::begin(data), std::end(data), std::forward<Pred>(pred));
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryOp>
-        [[nodiscard]] constexpr auto fold(const U& init, BinaryOp op) const
+        template <typename U, typename Pred>
+            requires(std::is_invocable_v<Pred, value_type> && !arrnd_type<Pred>)
+        constexpr this_type& copy_from(std::initializer_list<U> data, Pred&& pred)
         {
-            auto fold_impl = [&op, &init](const auto& arr) {
-                using fold_t
-                    = std::invoke_result_t<BinaryOp, U, typename std::remove_cvref_t<decltype(arr)>::value_type>;
-
-                if (arr.empty()) {
-                    return fold_t{};
-                }
-
-                return std::reduce(std::begin(arr), std::end(arr), init, op);
-            };
+            return copy_from(data.begin(), data.end(), std::forward<Pred>(pred));
+        }
 
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(fold_impl);
+        template <iterator_type InputIt1, iterator_of_type_interval InputIt2>
+        constexpr this_type& copy_from(
+            InputIt1 first_data, InputIt1 last_data, InputIt2 first_boundary, InputIt2 last_boundary)
+        {
+            (*this)[std::make_pair(first_boundary, last_boundary)].copy_from(first_data, last_data);
+            return *this;
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename BinaryOp>
-        [[nodiscard]] constexpr auto reduce(size_type axis, BinaryOp op) const
+        template <iterable_type Cont1, iterable_of_type_interval Cont2>
+        constexpr this_type& copy_from(const Cont1& data, const Cont2& boundaries)
         {
-            auto reduce_impl = [axis, &op](const auto& arr) {
-                using reduce_t = typename std::remove_cvref_t<decltype(arr)>::template replaced_type<
-                    std::invoke_result_t<BinaryOp, typename std::remove_cvref_t<decltype(arr)>::value_type,
-                        typename std::remove_cvref_t<decltype(arr)>::value_type>>;
-
-                auto new_info = oc::arrnd::reduce(arr.info(), axis);
-                reduce_t res(std::move(new_info),
-                    std::allocate_shared<typename reduce_t::storage_type>(
-                        typename reduce_t::template allocator_template_type<typename reduce_t::storage_type>(),
-                        total(new_info)));
+            return copy_from(std::begin(data), std::end(data), std::begin(boundaries), std::end(boundaries));
+        }
 
-                assert(total(res.info()) == total(arr.info()) / arr.info().dims()[axis]);
+        template <typename U, arrnd_type Arrnd>
+        constexpr this_type& copy_from(std::initializer_list<U> data, std::initializer_list<boundary_type> boundaries)
+        {
+            return copy_from(data.begin(), data.end(), boundaries.begin(), boundaries.end());
+        }
 
-                size_type reduction_size = arr.info().dims()[axis];
+        // Modify array by simplifying info and by squeeze internal buffer
+        // data in the front of it for efficient internal buffer usage.
+        constexpr this_type& refresh()
+        {
+            // continuous array, which is not sliced or transposed
+            if (empty() || info_.hints() == arrnd_hint::continuous) {
+                return *this;
+            }
 
-                auto ritb = arr.begin(size(arr.info()) - axis - 1, arrnd_returned_element_iterator_tag{});
-                auto rite = ritb + reduction_size;
+            // in order to perform the rearranging of the array elements
+            // without using temporary buffer, a unstranspose of the array
+            // info is required.
+            this_type tmp(unstranspose(info_), shared_storage_);
 
-                for (auto& value : res) {
-                    value = std::reduce(ritb + 1, rite, static_cast<typename reduce_t::value_type>(*ritb), op);
-                    ritb = rite;
-                    rite += reduction_size;
-                }
+            std::move(tmp.begin(), tmp.end(), std::begin(*shared_storage_));
+            tmp.shared_storage_->resize(total(tmp.info_));
 
-                return res;
-            };
+            *this = this_type(simplify(info_), shared_storage_);
 
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
-                reduce_impl);
+            return *this;
         }
 
-        template <std::size_t AtDepth = this_type::depth, iterator_type InputIt, typename BinaryOp>
-        [[nodiscard]] constexpr auto fold(size_type axis, InputIt first_init, InputIt last_init, BinaryOp op) const
+        // Ensures a full copy of this array and its inner arrays.
+        template <arrnd_type Arrnd = this_type>
+        [[nodiscard]] constexpr Arrnd clone() const
         {
-            auto fold_impl = [axis, &op, &first_init, &last_init](const auto& arr) {
-                using fold_t =
-                    typename std::remove_cvref_t<decltype(arr)>::template replaced_type<std::invoke_result_t<BinaryOp,
-                        iterator_value_t<InputIt>, typename std::remove_cvref_t<decltype(arr)>::value_type>>;
+            if (empty()) {
+                return Arrnd();
+            }
 
-                if (total(arr.info()) / arr.info().dims()[axis] != std::distance(first_init, last_init)) {
-                    throw std::invalid_argument("different size inits from input array");
+            Arrnd c{};
+
+            c.info() =
+                typename Arrnd::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+            if constexpr (this_type::is_flat) {
+                c.shared_storage() = std::allocate_shared<typename Arrnd::storage_type>(
+                    typename Arrnd::template allocator_template_type<typename Arrnd::storage_type>(), *shared_storage_);
+                c.shared_storage()->reserve(shared_storage_->capacity());
+            } else {
+                c.shared_storage() = std::allocate_shared<typename Arrnd::storage_type>(
+                    typename Arrnd::template allocator_template_type<typename Arrnd::storage_type>(),
+                    shared_storage_->size());
+                c.shared_storage()->reserve(shared_storage_->capacity());
+
+                for (auto t : zip(zipped(*this), zipped(c))) {
+                    std::get<1>(t) = std::get<0>(t).template clone<typename Arrnd::value_type>();
                 }
+            }
 
-                auto new_info = oc::arrnd::reduce(arr.info(), axis);
-                fold_t res(std::move(new_info),
-                    std::allocate_shared<typename fold_t::storage_type>(
-                        typename fold_t::template allocator_template_type<typename fold_t::storage_type>(),
-                        total(new_info)));
+            return c;
+        }
 
-                assert(total(res.info()) == total(arr.info()) / arr.info().dims()[axis]);
+        template <arrnd_type Arrnd = this_type>
+            requires(this_type::is_flat)
+        [[nodiscard]] constexpr Arrnd clone(const arrnd_parallel_policy& policy) const
+        {
+            if (empty()) {
+                return Arrnd();
+            }
 
-                size_type reduction_size = arr.info().dims()[axis];
+            Arrnd c{};
 
-                auto ritb = arr.begin(size(arr.info()) - axis - 1, arrnd_returned_element_iterator_tag{});
-                auto rite = ritb + reduction_size;
+            c.info() =
+                typename Arrnd::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+            c.shared_storage() = std::allocate_shared<typename Arrnd::storage_type>(
+                typename Arrnd::template allocator_template_type<typename Arrnd::storage_type>(),
+                shared_storage_->size());
+            c.shared_storage()->reserve(shared_storage_->capacity());
+
+            parallel_chunks_invoke(num_chunks(policy, shared_storage_->size()), shared_storage_->size(),
+                [this, &c](std::size_t first, std::size_t last, std::size_t) {
+                    std::copy(std::next(shared_storage_->data(), first), std::next(shared_storage_->data(), last),
+                        std::next(c.shared_storage()->data(), first));
+                });
 
-                auto init = first_init;
+            return c;
+        }
 
-                for (auto& value : res) {
-                    value = std::reduce(ritb, rite, *init, op);
-                    ritb = rite;
-                    rite += reduction_size;
-                    ++init;
-                }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr this_type reshape(InputIt first_dim, InputIt last_dim) const
+        {
+            if (total(info_) != total(info_type(first_dim, last_dim))) {
+                throw std::invalid_argument("invalid input dims - different total size from array");
+            }
 
-                return res;
-            };
+            // no reshape
+            if (std::equal(std::begin(info_.dims()), std::end(info_.dims()), first_dim, last_dim)) {
+                return *this;
+            }
 
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(fold_impl);
+            if (info_.hints() != arrnd_hint::continuous) {
+                throw std::invalid_argument("invalid reshape operation for non-standard array (might be "
+                                            "sliced/transposed) - try to use refresh()");
+            }
+
+            return this_type(info_type(first_dim, last_dim), shared_storage_);
         }
 
-        template <std::size_t AtDepth = this_type::depth, iterable_type Cont, typename BinaryOp>
-        [[nodiscard]] constexpr auto fold(size_type axis, const Cont& inits, BinaryOp&& op) const
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr this_type reshape(const Cont& dims) const
         {
-            return fold<AtDepth>(axis, std::begin(inits), std::end(inits), std::forward<BinaryOp>(op));
+            return reshape(std::begin(dims), std::end(dims));
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryOp>
-        [[nodiscard]] constexpr auto fold(size_type axis, std::initializer_list<U> inits, BinaryOp&& op) const
+        [[nodiscard]] constexpr this_type reshape(std::initializer_list<size_type> dims) const
         {
-            return fold<AtDepth>(axis, inits.begin(), inits.end(), std::forward<BinaryOp>(op));
+            return reshape(dims.begin(), dims.end());
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename Pred>
-            requires(!iterable_type<Pred>)
-        [[nodiscard]] constexpr auto filter(Pred pred) const
+        [[nodiscard]] constexpr this_type reshape(arrnd_common_shape shape) const
         {
-            auto filter_impl = [&pred](const auto& arr) {
-                using filter_t = std::remove_cvref_t<decltype(arr)>;
+            if (empty()) {
+                return *this;
+            }
 
-                if (arr.empty()) {
-                    return filter_t{};
-                }
+            switch (shape) {
+            case arrnd_common_shape::vector:
+                return reshape({total(info_)});
+            case arrnd_common_shape::row:
+                return reshape({size_type{1}, total(info_)});
+            case arrnd_common_shape::column:
+                return reshape({total(info_), size_type{1}});
+            default:
+                assert(false && "unknown arrnd_common_shape value");
+                return *this;
+            }
+        }
 
-                filter_t res({total(arr.info())});
+        // Similar to std::vector, resize inner buffer to suitable input dims
+        // and arrange array elements according to it.
+        template <iterator_of_type_integral InputIt>
+        constexpr this_type& resize(InputIt first_dim, InputIt last_dim)
+        {
+            if (empty()) {
+                *this = this_type(first_dim, last_dim);
+                return *this;
+            }
 
-                size_type count = 0;
+            info_type new_info(first_dim, last_dim);
 
-                std::copy_if(arr.cbegin(), arr.cend(), res.begin(), [&pred, &count](const auto& value) {
-                    if (pred(value)) {
-                        ++count;
-                        return true;
-                    }
-                    return false;
-                });
+            // in case of same number of elements and standard array, resize can be done by reshape operation
+            if (total(info_) == total(new_info) && info_.hints() == arrnd_hint::continuous) {
+                *this = reshape(first_dim, last_dim);
+                return *this;
+            }
 
-                return count == 0 ? filter_t{} : res.resize({count});
-            };
+            // check if there's enough space to arrange elements, and resize internal buffer if not
+            bool is_post_resize_required = total(new_info) <= shared_storage_->size();
+            if (!is_post_resize_required) {
+                shared_storage_->resize(total(new_info));
+            }
 
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
-                filter_impl);
-        }
+            this_type res(new_info, shared_storage_);
 
-        template <std::size_t AtDepth = this_type::depth, iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto filter(InputIt first, InputIt last) const
-        {
-            auto filter_impl = [&first, &last](const auto& arr) {
-                using filter_t = std::remove_cvref_t<decltype(arr)>;
+            size_type min_num_dims = std::min(size(info_), size(new_info));
 
-                if (std::distance(first, last) > total(arr.info())) {
-                    throw std::invalid_argument("different total size between arr and selector");
-                }
+            typename info_type::storage_traits_type::template replaced_type<boundary_type>::storage_type boundaries(
+                size(info_), boundary_type::full());
 
-                if (arr.empty()) {
-                    return filter_t{};
-                }
+            typename info_type::storage_traits_type::template replaced_type<boundary_type>::storage_type new_boundaries(
+                size(new_info), boundary_type::full());
 
-                filter_t res({static_cast<size_type>(std::distance(first, last))});
-                auto rit = std::begin(res);
+            auto z = zip(zipped(boundaries), zipped(new_boundaries), zipped(info_.dims()), zipped(new_info.dims()));
 
-                for (auto ind_it = first; ind_it != last; ++ind_it) {
-                    *rit = arr[*ind_it];
-                    ++rit;
-                }
+            std::for_each(std::rbegin(z), std::next(std::rbegin(z), min_num_dims), [](auto t) {
+                auto dim = std::get<2>(t);
+                auto new_dim = std::get<3>(t);
 
-                return res;
-            };
+                auto& boundary = std::get<0>(t);
+                boundary = boundary_type::to(std::min(dim, new_dim));
 
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
-                filter_impl);
-        }
+                auto& new_boundary = std::get<1>(t);
+                new_boundary = boundary_type::to(std::min(dim, new_dim));
+            });
 
-        template <std::size_t AtDepth = this_type::depth, iterable_of_type_integral Cont>
-            requires(arrnd_type<Cont>)
-        [[nodiscard]] constexpr auto filter(const Cont& selector) const
-        {
-            auto filter_impl = [&selector](const auto& arr) {
-                using filter_t = std::remove_cvref_t<decltype(arr)>;
+            res[new_boundaries] = (*this)[boundaries];
 
-                // mask - should be inside arr dims limit
-                if constexpr (std::is_same_v<bool, typename Cont::value_type>) {
-                    if (!std::equal(std::begin(arr.info().dims()), std::end(arr.info().dims()),
-                            std::begin(selector.info().dims()), std::end(selector.info().dims()))) {
-                        throw std::invalid_argument("different dims between arr and selector");
-                    }
+            if (is_post_resize_required) {
+                shared_storage_->resize(total(new_info));
+            }
 
-                    if (arr.empty()) {
-                        return filter_t{};
-                    }
+            *this = std::move(res);
 
-                    filter_t res({total(arr.info())});
-                    auto rit = res.begin();
-                    size_type count = 0;
+            return *this;
+        }
 
-                    for (auto t : zip(zipped(arr), zipped(selector))) {
-                        if (std::get<1>(t)) {
-                            *rit = std::get<0>(t);
-                            ++rit;
-                            ++count;
-                        }
-                    }
+        template <iterable_of_type_integral Cont>
+        constexpr this_type& resize(const Cont& dims)
+        {
+            return resize(std::begin(dims), std::end(dims));
+        }
 
-                    return count == 0 ? filter_t{} : res.resize({count});
-                } else {
-                    auto first_ind = std::begin(selector);
-                    auto last_ind = std::end(selector);
-
-                    if (std::distance(first_ind, last_ind) > total(arr.info())) {
-                        throw std::invalid_argument("different total size between arr and selector");
-                    }
-
-                    if (arr.empty()) {
-                        return filter_t{};
-                    }
-
-                    filter_t res({static_cast<size_type>(std::distance(first_ind, last_ind))});
-                    auto rit = std::begin(res);
-
-                    for (auto ind : selector) {
-                        *rit = arr[ind];
-                        ++rit;
-                    }
-
-                    return res;
-                }
-            };
-
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
-                filter_impl);
+        constexpr this_type& resize(std::initializer_list<size_type> dims)
+        {
+            return resize(dims.begin(), dims.end());
         }
 
-        template <std::size_t AtDepth = this_type::depth, iterable_of_type_integral Cont>
-            requires(!arrnd_type<Cont>)
-        [[nodiscard]] constexpr auto filter(const Cont& selector) const
+        template <arrnd_type Arrnd>
+        constexpr this_type& push_back(const Arrnd& arr, size_type axis = 0)
         {
-            return filter<AtDepth>(std::begin(selector), std::end(selector));
+            size_type index = empty() ? 0 : info_.dims()[axis];
+            return insert<Arrnd>(arr, index, axis);
         }
 
-        template <std::size_t AtDepth = this_type::depth>
-        [[nodiscard]] constexpr auto filter(std::initializer_list<size_type> inds) const
+        template <arrnd_type Arrnd>
+        constexpr this_type& push_front(const Arrnd& arr, size_type axis = 0)
         {
-            return filter<AtDepth>(inds.begin(), inds.end());
+            return insert<Arrnd>(arr, 0, axis);
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename Pred>
-            requires(!iterable_type<Pred>)
-        [[nodiscard]] constexpr auto find(Pred pred) const
+        /*
+        * Insert arr as set of values at index/axis, such that 0<=index<=dims[axis] and 0<=axis<size(dims)
+        * Algorithm:
+        * - if array and arr are empty:
+        *   - index should be valid and axis is irrelevant
+        *   - return *this
+        * - if arr is empty:
+        *   - index and axis are irrelevant
+        *   - return *this
+        * - if array is empty:
+        *   - index should be valid and axis is irrelevant
+        *   - return clone(arr)
+        * - else (both array and arr contain values):
+        *   - check arr size validity (should be the same as array except at axis)
+        *   - refresh array for space efficiency
+        *   - calculate new info, and new total
+        *   - append capacity according to (total(new) - total(prev))
+        *   - build ref with new info
+        *   - copy values
+        */
+        template <arrnd_type Arrnd>
+        constexpr this_type& insert(const Arrnd& arr, size_type index, size_type axis = 0)
         {
-            auto find_impl = [&pred](const auto& arr) {
-                using find_t = typename std::remove_cvref_t<decltype(arr)>::template replaced_type<size_type>;
-
-                if (arr.empty()) {
-                    return find_t{};
-                }
-
-                find_t res({total(arr.info())});
-
-                size_type count = 0;
-                auto rit = res.begin();
-
-                for (typename std::remove_cvref_t<decltype(arr)>::indexer_type indexer(arr.info()); indexer;
-                     ++indexer) {
-                    if (pred(arr[*indexer])) {
-                        *rit = *indexer;
-                        ++rit;
-                        ++count;
-                    }
+            if (empty() && arr.empty()) {
+                if (index != 0) {
+                    throw std::invalid_argument("invalid index for empty arrays");
                 }
 
-                return count == 0 ? find_t{} : res.resize({count});
-            };
-
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(find_impl);
-        }
-
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd>
-        [[nodiscard]] constexpr auto find(const Arrnd& mask) const
-        {
-            auto find_impl = [&mask](const auto& arr) {
-                using find_t = typename std::remove_cvref_t<decltype(arr)>::template replaced_type<size_type>;
+                return *this;
+            }
 
-                if (!std::equal(std::begin(arr.info().dims()), std::end(arr.info().dims()),
-                        std::begin(mask.info().dims()), std::end(mask.info().dims()))) {
-                    throw std::invalid_argument("different dims between arr and mask");
+            if (arr.empty()) {
+                if (axis < 0 || axis >= size(info_)) {
+                    throw std::invalid_argument("invalid axis for empty input");
                 }
-
-                if (arr.empty()) {
-                    return find_t{};
+                if (index < 0 || index > info_.dims()[axis]) {
+                    throw std::invalid_argument("invalid index for empty input");
                 }
 
-                find_t res({total(arr.info())});
-
-                auto rit = res.begin();
-                size_type count = 0;
-
-                typename std::remove_cvref_t<decltype(arr)>::indexer_type arr_indexer(arr.info());
-                typename Arrnd::indexer_type mask_indexer(mask.info());
+                return *this;
+            }
 
-                for (; arr_indexer && mask_indexer; ++arr_indexer, ++mask_indexer) {
-                    if (mask[*mask_indexer]) {
-                        *rit = *arr_indexer;
-                        ++rit;
-                        ++count;
-                    }
+            if (empty()) {
+                if (index != 0) {
+                    throw std::invalid_argument("invalid index for empty array");
                 }
 
-                return count == 0 ? find_t{} : res.resize({count});
-            };
-
-            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(find_impl);
-        }
-
-        [[nodiscard]] constexpr auto expand(size_type axis, size_type division = 0) const
-        {
-            using expand_t = replaced_type<this_type>;
-
-            if (empty()) {
-                return expand_t{};
+                *this = arr.template clone<this_type>();
+                return *this;
             }
 
             if (axis < 0 || axis >= size(info_)) {
                 throw std::invalid_argument("invalid axis");
             }
+            if (index < 0 || index > info_.dims()[axis]) {
+                throw std::invalid_argument("invalid index");
+            }
 
-            if (division > info_.dims()[axis]) {
-                throw std::invalid_argument("invalid division for axis dim");
+            if (size(info_) != size(arr.info())) {
+                throw std::invalid_argument("invalid input - different number of dims");
             }
 
-            auto fixed_div = division > 0 ? std::min(info_.dims()[axis], division) : info_.dims()[axis];
+            auto dims = info_.dims();
+            dims[axis] = arr.info().dims()[axis];
+            if (!std::equal(
+                    std::begin(arr.info().dims()), std::end(arr.info().dims()), std::begin(dims), std::end(dims))) {
+                throw std::invalid_argument("invalid input - dims should be the same except at axis");
+            }
 
-            typename expand_t::info_type::extent_storage_type new_dims(size(info_), 1);
-            new_dims[axis] = fixed_div;
+            refresh();
 
-            expand_t res(new_dims);
-            auto res_it = res.begin();
+            auto& new_dims = dims;
+            new_dims[axis] += info_.dims()[axis];
+            info_type new_info(new_dims);
 
-            auto curr_div = fixed_div;
-            auto curr_axis_dim = info_.dims()[axis];
-            auto curr_ival_width = static_cast<size_type>(std::ceil(curr_axis_dim / static_cast<double>(curr_div)));
+            auto total_diff = total(new_info) - total(info_);
+            shared_storage_->append(total_diff);
 
-            size_type res_total = 0;
+            this_type res(new_info, shared_storage_);
 
-            windows_slider_type slider(info_, axis,
-                window_type(typename window_type::interval_type(0, curr_ival_width), arrnd_window_type::partial));
+            // if push_back at axis zero, no need to move current data in storage
+            if (index == info_.dims()[axis] && axis == 0) {
+                std::copy(arr.cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    arr.cend(axis, arrnd_returned_element_iterator_tag{}),
+                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}), total(info_)));
+            }
+            // if there's enough capacity in data storage, use if for temp data
+            else if (shared_storage_->capacity() - shared_storage_->size() >= total(info_)) {
+                auto current_shared_storage_size = shared_storage_->size();
 
-            while (curr_div > 0) {
-                *(res_it++) = (*this)[std::make_pair((*slider).cbegin(), (*slider).cend())];
+                // temporarily resize data storage to its capacity size
+                shared_storage_->resize(shared_storage_->capacity());
 
-                slider += curr_ival_width;
+                auto tmp_it = std::next(std::begin(*shared_storage_), current_shared_storage_size);
+                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    cend(axis, arrnd_returned_element_iterator_tag{}), tmp_it);
 
-                --curr_div;
-                curr_axis_dim -= curr_ival_width;
+                auto num_pre_input_copies = index * (total(res.info_) / res.info_.dims()[axis]);
 
-                if (curr_div > 0) {
-                    curr_ival_width = static_cast<size_type>(std::ceil(curr_axis_dim / static_cast<double>(curr_div)));
-                    slider.modify_window(axis,
-                        window_type(
-                            typename window_type::interval_type(0, curr_ival_width), arrnd_window_type::partial));
-                }
+                std::move(tmp_it, std::next(tmp_it, num_pre_input_copies),
+                    res.begin(axis, arrnd_returned_element_iterator_tag{}));
 
-                ++res_total;
+                std::copy(arr.cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    arr.cend(axis, arrnd_returned_element_iterator_tag{}),
+                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}), num_pre_input_copies));
+
+                std::move(std::next(tmp_it, num_pre_input_copies), std::next(tmp_it, total(info_)),
+                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}),
+                        num_pre_input_copies + total(arr.info())));
+
+                shared_storage_->resize(current_shared_storage_size);
             }
+            // else create a temporary data storage
+            else {
+                storage_type tmp(total(info_));
+                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    cend(axis, arrnd_returned_element_iterator_tag{}), std::begin(tmp));
 
-            if (res_total != fixed_div) {
-                new_dims[axis] = res_total;
-                return res.resize(new_dims);
+                auto num_pre_input_copies = index * (total(res.info_) / res.info_.dims()[axis]);
+
+                std::move(std::begin(tmp), std::next(std::begin(tmp), num_pre_input_copies),
+                    res.begin(axis, arrnd_returned_element_iterator_tag{}));
+
+                std::copy(arr.cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    arr.cend(axis, arrnd_returned_element_iterator_tag{}),
+                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}), num_pre_input_copies));
+
+                std::move(std::next(std::begin(tmp), num_pre_input_copies), std::end(tmp),
+                    std::next(res.begin(axis, arrnd_returned_element_iterator_tag{}),
+                        num_pre_input_copies + total(arr.info())));
             }
-            return res;
+
+            *this = std::move(res);
+            return *this;
         }
 
-        // collapse should only used on valid expanded arrays.
-        // returns reference to expanded array creator if
-        // exists, or new collpsed array otherwise.
-        [[nodiscard]] constexpr auto collapse(bool ignore_creators = false) const
-            requires(!this_type::is_flat)
+        template <iterator_of_template_type<std::tuple> InputIt>
+        constexpr this_type& repeat(InputIt first_tuple, InputIt last_tuple)
         {
-            using collpase_t = value_type;
-
-            if (empty()) {
-                return collpase_t{};
+            if (std::distance(first_tuple, last_tuple) <= 0) {
+                return *this;
             }
 
-            // from array creator
+            auto res = *this;
+            auto mid = res.clone();
 
-            if (!ignore_creators) {
-                bool all_nested_values_have_the_same_creator
-                    = std::adjacent_find(cbegin(), cend(),
-                          [](const collpase_t& vt1, const collpase_t& vt2) {
-                              return !vt1.creator() || !vt2.creator() || vt1.creator() != vt2.creator();
-                          })
-                    == cend();
-
-                if (all_nested_values_have_the_same_creator && (*this)(0).creator() != nullptr) {
-                    return *((*this)(0).creator());
+            for (auto t_it = first_tuple; t_it != last_tuple; ++t_it) {
+                const auto& t = *t_it;
+                for (size_type i = 0; i < std::get<0>(t) - 1; ++i) {
+                    res.push_back(mid, std::get<1>(t));
                 }
+                mid = res.clone();
             }
 
-            // from one collapsed array
-
-            if (total(info_) == 1) {
-                return (*this)(0);
-            }
-
-            // from assumed axis hint
-
-            if (std::count(std::begin(info_.dims()), std::end(info_.dims()), 1) != size(info_) - 1) {
-                throw std::exception("invalid exapnded array dims structure");
-            }
-
-            auto assumed_axis
-                = std::find(std::begin(info_.dims()), std::end(info_.dims()), total(info_)) - std::begin(info_.dims());
-
-            auto element_it = begin();
-
-            collpase_t res = (*element_it).clone();
-            ++element_it;
-
-            while (element_it != end()) {
-                res = res.push_back((*element_it).clone(), assumed_axis);
-                ++element_it;
-            }
+            *this = std::move(res);
 
-            return res;
+            return *this;
         }
 
-        template <typename UnaryOp>
-        [[nodiscard]] constexpr auto slide(size_type axis, window_type window, UnaryOp op) const
+        template <template_type<std::tuple> Tuple>
+        constexpr this_type& repeat(std::initializer_list<Tuple> count_axis_tuples)
         {
-            using slide_t = replaced_type<std::invoke_result_t<UnaryOp, this_type>>;
+            return repeat(count_axis_tuples.begin(), count_axis_tuples.end());
+        }
 
-            if (empty()) {
-                return slide_t{};
-            }
+        template <iterable_of_template_type<std::tuple> Cont>
+        constexpr this_type& repeat(const Cont& count_axis_tuples)
+        {
+            return repeat(std::begin(count_axis_tuples), std::end(count_axis_tuples));
+        }
 
-            if (axis < 0 || axis >= size(info_)) {
-                throw std::invalid_argument("invalid axis");
+        template <iterator_of_type_integral InputIt>
+        constexpr this_type& repeat(InputIt first_rep, InputIt last_rep)
+        {
+            if (std::distance(first_rep, last_rep) > info_.dims().size()) {
+                throw std::invalid_argument("invalid number of input reps");
             }
 
-            windows_slider_type slider(info_, axis, window);
+            auto res = *this;
+            auto mid = res.clone();
 
-            size_type res_total = window.type == arrnd_window_type::complete
-                ? info_.dims()[axis] - window.ival.stop() + window.ival.start() + 1
-                : info_.dims()[axis];
+            size_type curr_axis = 0;
 
-            slide_t res({res_total});
-            if (res.empty()) {
-                return res;
+            for (auto r_it = first_rep; r_it != last_rep; ++r_it) {
+                for (size_type i = 0; i < *r_it - 1; ++i) {
+                    res.push_back(mid, curr_axis);
+                }
+                ++curr_axis;
+                mid = res.clone();
             }
 
-            auto res_it = res.begin();
+            *this = std::move(res);
 
-            for (; slider && res_it != res.end(); ++slider, ++res_it) {
-                *res_it = op((*this)[std::make_pair((*slider).cbegin(), (*slider).cend())]);
-            }
+            return *this;
+        }
 
-            return res;
+        constexpr this_type& repeat(std::initializer_list<size_type> reps)
+        {
+            return repeat(reps.begin(), reps.end());
         }
 
-        template <typename BinaryOp, typename UnaryOp>
-        [[nodiscard]] constexpr auto accumulate(
-            size_type axis, window_type window, BinaryOp reduce_op, UnaryOp transform_op) const
+        template <iterable_of_type_integral Cont>
+        constexpr this_type& repeat(const Cont& reps)
         {
-            using transform_t = std::invoke_result_t<UnaryOp, this_type>;
-            using reduce_t = std::invoke_result_t<BinaryOp, transform_t, transform_t>;
-            using accumulate_t = replaced_type<reduce_t>;
+            return repeat(std::begin(reps), std::end(reps));
+        }
 
+        constexpr this_type& erase(size_type count, size_type index, size_type axis = 0)
+        {
             if (empty()) {
-                return accumulate_t{};
+                if (index != 0) {
+                    throw std::invalid_argument("invalid index for empty array");
+                }
+                if (count != 0) {
+                    throw std::invalid_argument("invalid count for empty array");
+                }
+
+                return *this;
             }
 
             if (axis < 0 || axis >= size(info_)) {
                 throw std::invalid_argument("invalid axis");
             }
-
-            size_type axis_dim = *std::next(info_.dims().cbegin(), axis);
-
-            windows_slider_type slider(info_, axis, window);
-
-            size_type res_total = window.type == arrnd_window_type::complete
-                ? info_.dims()[axis] - window.ival.stop() + window.ival.start() + 1
-                : info_.dims()[axis];
-
-            accumulate_t res({res_total});
-            if (res.empty()) {
-                return res;
+            if (index < 0 || index >= info_.dims()[axis]) {
+                throw std::invalid_argument("invalid index");
+            }
+            if (index + count > info_.dims()[axis]) {
+                throw std::invalid_argument("invalid count");
             }
 
-            auto res_it = res.begin();
-
-            *res_it = transform_op((*this)[std::make_pair((*slider).cbegin(), (*slider).cend())]);
-            auto prev = *res_it;
-            ++res_it;
-            ++slider;
+            // check if resulted array is empty
+            auto new_dims = info_.dims();
+            new_dims[axis] -= count;
+            info_type new_info(new_dims);
 
-            for (; slider && res_it != res.end(); ++slider, ++res_it) {
-                *res_it = reduce_op(prev, transform_op((*this)[std::make_pair((*slider).cbegin(), (*slider).cend())]));
-                prev = *res_it;
+            if (oc::arrnd::empty(new_info)) {
+                *this = this_type{};
+                return *this;
             }
 
-            return res;
-        }
+            refresh();
 
-        template <typename UnaryOp>
-        constexpr auto browse(size_type page_size, UnaryOp&& op) const
-        {
-            if constexpr (std::is_void_v<std::invoke_result_t<UnaryOp, this_type>>) {
-                using browse_t = this_type;
+            this_type res(new_info, shared_storage_);
 
-                if (empty()) {
-                    return browse_t{};
-                }
+            size_type num_pre_removals = index * (total(res.info_) / res.info_.dims()[axis]);
+            size_type removals = total(info_) - total(res.info_);
 
-                if (size(info_) < page_size) {
-                    throw std::invalid_argument("invalid page size - smaller than number of dims");
-                }
+            if (shared_storage_->capacity() - shared_storage_->size() >= total(res.info())) {
+                auto current_shared_storage_size = shared_storage_->size();
 
-                if (size(info_) == page_size) {
-                    op(*this);
-                    return *this;
-                }
+                // temporarily resize data storage to its capacity size
+                shared_storage_->resize(shared_storage_->capacity());
 
-                pages(page_size).template apply<0>(std::forward<UnaryOp>(op));
-                return *this;
-            } else {
-                using type_t = std::invoke_result_t<UnaryOp, this_type>;
-                using browse_t = std::conditional_t<arrnd_depths_match<type_t, this_type>, type_t,
-                    replaced_type<type_t>>;
+                auto tmp_it = std::next(std::begin(*shared_storage_), current_shared_storage_size);
+                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals), tmp_it);
+                std::move(std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals + removals),
+                    cend(axis, arrnd_returned_element_iterator_tag{}), std::next(tmp_it, num_pre_removals));
 
-                if (empty()) {
-                    return browse_t{};
-                }
+                std::move(tmp_it, std::next(tmp_it, total(res.info())), std::begin(*shared_storage_));
 
-                if (size(info_) < page_size) {
-                    throw std::invalid_argument("invalid page size - smaller than number of dims");
-                }
+                shared_storage_->resize(current_shared_storage_size);
+            } else {
+                storage_type tmp(total(info_));
+                std::move(cbegin(axis, arrnd_returned_element_iterator_tag{}),
+                    std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals), std::begin(tmp));
+                std::move(std::next(cbegin(axis, arrnd_returned_element_iterator_tag{}), num_pre_removals + removals),
+                    cend(axis, arrnd_returned_element_iterator_tag{}), std::next(std::begin(tmp), num_pre_removals));
 
-                auto invoke = [&op](auto page) {
-                    if constexpr (arrnd_depths_match<type_t, this_type>) {
-                        return op(page);
-                    } else { // in case that the returned type of op is not arrnd_type, then it should not be void returned type
-                        return browse_t({1}, {op(page)});
-                    }
-                };
+                std::move(std::begin(tmp), std::end(tmp), std::begin(*shared_storage_));
+            }
 
-                if (size(info_) == page_size) {
-                    return invoke(*this);
-                }
+            shared_storage_->resize(total(new_info));
 
-                return pages(page_size).template transform<0>(invoke).book();
-            }
+            *this = std::move(res);
+            return *this;
         }
 
-        [[nodiscard]] constexpr auto pages(size_type page_size = 2) const
+        constexpr this_type& pop_front(size_type count = 1, size_type axis = 0)
         {
-            using pages_t = replaced_type<this_type>;
+            return erase(empty() ? 0 : count, 0, axis);
+        }
 
-            if (empty()) {
-                return pages_t{};
-            }
+        constexpr this_type& pop_back(size_type count = 1, size_type axis = 0)
+        {
+            size_type fixed_count = empty() ? 0 : count;
+            size_type ind = empty() ? size_type{0} : *std::next(info_.dims().cbegin(), axis) - fixed_count;
+            return erase(fixed_count, ind, axis);
+        }
 
-            if (page_size <= 0 || page_size > size(info_)) {
-                throw std::invalid_argument("invalid page size");
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
+                && TraversalResult == arrnd_traversal_result::apply)
+        constexpr auto& traverse(UnaryOp op)
+        {
+            // Traverse and perform operation on leaves.
+            if constexpr (arrnd_type<value_type>) {
+                for (auto& inner : *this) {
+                    inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
+                        CurrDepth + 1>(op);
+                }
+            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
+                zipped_invoke(
+                    [&op](auto this_elems) {
+                        for (auto t : zip(this_elems)) {
+                            auto& value = std::get<0>(t);
+                            if constexpr (std::is_void_v<decltype(op(value))>) {
+                                op(value);
+                            } else {
+                                value = op(value);
+                            }
+                        }
+                    },
+                    *this);
             }
 
-            if (page_size == size(info_)) {
-                return pages_t({1}, {*this});
+            // Apply operation on array if depth is relevant
+            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
+                if constexpr (std::is_void_v<decltype(op(*this))>) {
+                    op(*this);
+                } else {
+                    *this = op(*this);
+                }
             }
 
-            pages_t pages(std::begin(info_.dims()), std::next(std::begin(info_.dims()), size(info_) - page_size));
+            return *this;
+        }
 
-            for (auto indexer = typename pages_t::indexer_type(pages.info()); indexer; ++indexer) {
-                const auto& subs = indexer.subs();
-                auto page = *this;
-                for (size_type axis = 0; axis < size(info_) - page_size; ++axis) {
-                    page = page[boundary_type::at(subs[axis])];
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
+                && TraversalResult == arrnd_traversal_result::apply)
+        constexpr auto& traverse(UnaryOp op)
+        {
+            // Apply operation on array if depth is relevant
+            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
+                if constexpr (std::is_void_v<decltype(op(*this))>) {
+                    op(*this);
+                } else {
+                    *this = op(*this);
                 }
+            }
 
-                pages[*indexer] = page;
+            // Traverse and perform operation on leaves.
+            if constexpr (arrnd_type<value_type>) {
+                for (auto& inner : *this) {
+                    inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
+                        CurrDepth + 1>(op);
+                }
+            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
+                zipped_invoke(
+                    [&op](auto this_elems) {
+                        for (auto t : zip(this_elems)) {
+                            auto& value = std::get<0>(t);
+                            if constexpr (std::is_void_v<decltype(op(value))>) {
+                                op(value);
+                            } else {
+                                value = op(value);
+                            }
+                        }
+                    },
+                    *this);
             }
 
-            return pages;
+            return *this;
         }
 
-        [[nodiscard]] constexpr auto book(bool ignore_creators = false) const
-            requires(!this_type::is_flat)
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
+            typename Op, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
+                && TraversalResult == arrnd_traversal_result::apply)
+        constexpr auto& traverse(const Cont& cont, Op op)
         {
-            if (empty()) {
-                return value_type{};
+            // Traverse and perform operation on leaves.
+            if constexpr (arrnd_type<value_type>) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    for (auto& inner : *this) {
+                        inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                            TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
+                    }
+                } else {
+                    for (auto inners : zip(zipped(*this), zipped(cont))) {
+                        std::get<0>(inners)
+                            = std::get<0>(inners)
+                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
+                                      std::remove_reference_t<decltype(std::get<1>(inners))>, Op, CurrDepth + 1>(
+                                      std::get<1>(inners), op);
+                    }
+                }
+            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    zipped_invoke(
+                        [&op, &cont](auto this_elems) {
+                            for (auto t : zip(this_elems)) {
+                                auto& value = std::get<0>(t);
+                                if constexpr (std::is_void_v<decltype(op(value, cont))>) {
+                                    op(value, cont);
+                                } else {
+                                    value = op(value, cont);
+                                }
+                            }
+                        },
+                        *this);
+                } else {
+                    zipped_invoke(
+                        [&op](auto this_elems, auto cont_elems) {
+                            for (auto values : zip(this_elems, cont_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(values), std::get<1>(values)))>) {
+                                    op(std::get<0>(values), std::get<1>(values));
+                                } else {
+                                    std::get<0>(values) = op(std::get<0>(values), std::get<1>(values));
+                                }
+                            }
+                        },
+                        *this, cont);
+                }
             }
 
-            if (!ignore_creators) {
-                bool all_pages_source_known = std::all_of(cbegin(), cend(), [](const auto& page) {
-                    return page.creator() != nullptr;
-                });
-
-                bool all_pages_from_same_source = std::adjacent_find(cbegin(), cend(),
-                                                      [](const auto& page1, const auto& page2) {
-                                                          return page1.creator() != page2.creator();
-                                                      })
-                    == cend();
-
-                if (all_pages_source_known && all_pages_from_same_source) {
-                    return *((*this)(0).creator());
+            // Apply operation on array if depth is relevant
+            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
+                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
+                    op(*this, cont);
+                } else {
+                    *this = op(*this, cont);
                 }
             }
 
-            bool all_pages_with_same_dimes
-                = std::adjacent_find(cbegin(), cend(),
-                      [](const auto& page1, const auto& page2) {
-                          return !std::equal(page1.info().dims().cbegin(), page1.info().dims().cend(),
-                              page2.info().dims().cbegin(), page2.info().dims().cend());
-                      })
-                == cend();
+            return *this;
+        }
 
-            if (!all_pages_with_same_dimes) {
-                throw std::exception("unable to book pages with different dims");
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
+            typename Op, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
+                && TraversalResult == arrnd_traversal_result::apply)
+        constexpr auto& traverse(const Cont& cont, Op op)
+        {
+            // Apply operation on array if depth is relevant
+            if constexpr (CurrDepth >= FromDepth && CurrDepth <= ToDepth) {
+                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
+                    op(*this, cont);
+                } else {
+                    *this = op(*this, cont);
+                }
             }
 
-            size_type this_size = size(info_);
-            size_type page_size = size((*this)(0).info());
-
-            const auto& this_dims = info_.dims();
-            const auto& page_dims = (*this)(0).info().dims();
-
-            typename info_type::extent_storage_type new_dims(this_size + page_size);
-            std::copy(std::begin(this_dims), std::end(this_dims), std::begin(new_dims));
-            std::copy(std::begin(page_dims), std::end(page_dims), std::next(std::begin(new_dims), this_size));
-
-            value_type res(new_dims);
-            auto res_it = res.begin();
-
-            for (const auto& page : *this) {
-                for (auto page_it = page.begin(); page_it != page.end() && res_it != res.end(); ++page_it, ++res_it) {
-                    *res_it = *page_it;
+            // Traverse and perform operation on leaves.
+            if constexpr (arrnd_type<value_type>) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    for (auto& inner : *this) {
+                        inner = inner.template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                            TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
+                    }
+                } else {
+                    for (auto inners : zip(zipped(*this), zipped(cont))) {
+                        std::get<0>(inners)
+                            = std::get<0>(inners)
+                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
+                                      std::remove_reference_t<decltype(std::get<1>(inners))>, Op, CurrDepth + 1>(
+                                      std::get<1>(inners), op);
+                    }
+                }
+            } else if constexpr (CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    zipped_invoke(
+                        [&op, &cont](auto this_elems) {
+                            for (auto t : zip(this_elems)) {
+                                auto& value = std::get<0>(t);
+                                if constexpr (std::is_void_v<decltype(op(value, cont))>) {
+                                    op(value, cont);
+                                } else {
+                                    value = op(value, cont);
+                                }
+                            }
+                        },
+                        *this);
+                } else {
+                    zipped_invoke(
+                        [&op](auto this_elems, auto cont_elems) {
+                            for (auto values : zip(this_elems, cont_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(values), std::get<1>(values)))>) {
+                                    op(std::get<0>(values), std::get<1>(values));
+                                } else {
+                                    std::get<0>(values) = op(std::get<0>(values), std::get<1>(values));
+                                }
+                            }
+                        },
+                        *this, cont);
                 }
             }
 
-            return res;
+            return *this;
         }
 
-        template <iterator_of_type_integral AxesIt>
-        [[nodiscard]] constexpr auto split(AxesIt first_axis, AxesIt last_axis, size_type division) const
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
+                && TraversalResult == arrnd_traversal_result::transform)
+        [[nodiscard]] constexpr auto traverse(UnaryOp op) const
         {
-            using split_t = replaced_type<this_type>;
-
-            if (empty()) {
-                return split_t{};
-            }
+            // The main thing done in this function is the returned type deduction.
 
-            if (!std::is_sorted(first_axis, last_axis)) {
-                throw std::invalid_argument("invalid axes - not sorted");
-            }
+            // Main compilation branches:
+            // - If arrnd_type<value_type> and relevant(CurrentDepth)
+            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
 
-            if (std::adjacent_find(first_axis, last_axis) != last_axis) {
-                throw std::invalid_argument("invalid axes - not unique");
-            }
+            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
+            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
 
-            if (std::distance(first_axis, last_axis) < 0
-                || std::distance(first_axis, last_axis) > info_.dims().size()) {
-                throw std::invalid_argument("invalid number of axes");
-            }
+            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
+                using transform_t = replaced_type<decltype(std::declval<value_type>()
+                                                               .template traverse<FromDepth, ToDepth, TraversalType,
+                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
 
-            if (std::any_of(first_axis, last_axis, [&](auto axis) {
-                    return axis < 0 || axis >= size(info_);
-                })) {
-                throw std::invalid_argument("invalid axes for dims");
-            }
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
+                }
 
-            if (std::any_of(std::begin(info_.dims()), std::end(info_.dims()), [division](auto dim) {
-                    return division <= 0 || division > dim;
-                })) {
-                throw std::invalid_argument("invalid division");
-            }
+                for (auto t : zip(zipped(*this), zipped(res))) {
+                    std::get<1>(t) = std::get<0>(t)
+                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
+                                             CurrDepth + 1>(op);
+                }
 
-            // calculate dimensions according to number of slices in each dimension
+                if constexpr (std::is_void_v<decltype(op(res))>) {
+                    op(res);
+                    return res;
+                } else {
+                    return op(res);
+                }
+            } else if constexpr (arrnd_type<value_type>) {
+                using transform_t = replaced_type<decltype(std::declval<value_type>()
+                                                               .template traverse<FromDepth, ToDepth, TraversalType,
+                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
 
-            typename info_type::extent_storage_type new_dims(size(info_));
-            if (std::distance(first_axis, last_axis) == 0) {
-                std::fill(std::begin(new_dims), std::end(new_dims), division);
-            } else {
-                std::fill(std::begin(new_dims), std::end(new_dims), 1);
-                std::for_each(first_axis, last_axis, [&new_dims, division](auto axis) {
-                    new_dims[axis] = division;
-                });
-            }
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
+                }
 
-            // --------------------------------------------------------------------
+                for (auto t : zip(zipped(*this), zipped(res))) {
+                    std::get<1>(t) = std::get<0>(t)
+                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
+                                             CurrDepth + 1>(op);
+                }
 
-            split_t slices(new_dims);
-            auto slices_it = slices.begin();
-            size_type actual_num_slices = 0;
+                return res;
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
+                using transform_t
+                    = std::conditional_t<std::is_void_v<decltype(op(*this))>, this_type, decltype(op(*this))>;
 
-            std::function<void(this_type, size_type)> split_impl;
+                transform_t res;
 
-            split_impl = [&](this_type arr, size_type current_depth) -> void {
-                if (arr.empty()) {
-                    return;
+                if constexpr (std::is_void_v<decltype(op(*this))>) {
+                    res = *this;
+                    op(res);
+                    return res;
+                } else {
+                    this_type mid = *this;
+                    return op(mid);
                 }
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
+                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this)))>,
+                    value_type, decltype(op(*std::begin(*this)))>>;
 
-                if (current_depth == 0) {
-                    *slices_it = arr;
-                    ++slices_it;
-                    ++actual_num_slices;
-                    return;
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
                 }
 
-                if (std::distance(first_axis, last_axis) > 0
-                    && std::find(first_axis, last_axis, size(arr.info()) - current_depth) == last_axis) {
-                    split_impl(arr(boundary_type::full(), size(arr.info()) - current_depth), current_depth - 1);
-                    return;
-                }
+                zipped_invoke(
+                    [&op](auto this_elems, auto res_elems) {
+                        for (auto t : zip(this_elems, res_elems)) {
+                            if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
+                                std::get<1>(t) = std::get<0>(t);
+                                op(std::get<1>(t));
+                            } else {
+                                std::get<1>(t) = op(std::get<0>(t));
+                            }
+                        }
+                    },
+                    *this, res);
 
-                auto exp = arr.expand(size(arr.info()) - current_depth, division);
-                for (auto value : exp) {
-                    split_impl(value, current_depth - 1);
+                if constexpr (std::is_void_v<decltype(op(res))>) {
+                    op(res);
+                    return res;
+                } else {
+                    return op(res);
                 }
-            };
+            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
+                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this)))>,
+                    value_type, decltype(op(*std::begin(*this)))>>;
 
-            split_impl(*this, size(info_));
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
+                }
 
-            assert(actual_num_slices == total(slices.info()));
+                zipped_invoke(
+                    [&op](auto this_elems, auto res_elems) {
+                        for (auto t : zip(this_elems, res_elems)) {
+                            if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
+                                std::get<1>(t) = std::get<0>(t);
+                                op(std::get<1>(t));
+                            } else {
+                                std::get<1>(t) = op(std::get<0>(t));
+                            }
+                        }
+                    },
+                    *this, res);
 
-            return slices;
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto split(const Cont& axes, size_type division) const
-        {
-            return split(std::begin(axes), std::end(axes), division);
-        }
-        [[nodiscard]] constexpr auto split(std::initializer_list<size_type> axes, size_type division) const
-        {
-            return split(axes.begin(), axes.end(), division);
+                return res;
+            } else {
+                // No transformations
+                return *this;
+            }
         }
 
-        template <iterator_of_type_integral AxesIt, iterator_of_type_integral IndsIt>
-        [[nodiscard]] constexpr auto split(AxesIt first_axis, AxesIt last_axis, IndsIt first_ind, IndsIt last_ind) const
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, typename UnaryOp, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
+                && TraversalResult == arrnd_traversal_result::transform)
+        [[nodiscard]] constexpr auto traverse(UnaryOp op) const
         {
-            using split_t = replaced_type<this_type>;
-
-            if (empty()) {
-                return split_t{};
-            }
+            // The main thing done in this function is the returned type deduction.
 
-            if (!std::is_sorted(first_ind, last_ind)) {
-                throw std::invalid_argument("invalid indices - not sorted");
-            }
+            // Main compilation branches:
+            // - If arrnd_type<value_type> and relevant(CurrentDepth)
+            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
 
-            if (std::adjacent_find(first_ind, last_ind) != last_ind) {
-                throw std::invalid_argument("invalid indices - not unique");
-            }
+            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
+            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
 
-            if (!std::is_sorted(first_axis, last_axis)) {
-                throw std::invalid_argument("invalid axes - not sorted");
-            }
+            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
+                auto invoke = [&op](auto arr) {
+                    if constexpr (std::is_void_v<decltype(op(arr))>) {
+                        op(arr);
+                        return arr;
+                    } else {
+                        return op(arr);
+                    }
+                };
+                auto mid = invoke(*this);
 
-            if (std::adjacent_find(first_axis, last_axis) != last_axis) {
-                throw std::invalid_argument("invalid axes - not unique");
-            }
+                using transform_t = replaced_type<decltype((*std::begin(mid))
+                                                               .template traverse<FromDepth, ToDepth, TraversalType,
+                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
 
-            if (std::distance(first_axis, last_axis) < 0
-                || std::distance(first_axis, last_axis) > info_.dims().size()) {
-                throw std::invalid_argument("invalid number of axes");
-            }
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
+                }
 
-            if (std::any_of(first_axis, last_axis, [&](auto axis) {
-                    return axis < 0 || axis >= size(info_);
-                })) {
-                throw std::invalid_argument("invalid axes for dims");
-            }
+                for (auto t : zip(zipped(mid), zipped(res))) {
+                    std::get<1>(t) = std::get<0>(t)
+                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
+                                             CurrDepth + 1>(op);
+                }
 
-            // calculate dimensions according to number of slices in each dimension
+                return res;
+            } else if constexpr (arrnd_type<value_type>) {
+                using transform_t = replaced_type<decltype(std::declval<value_type>()
+                                                               .template traverse<FromDepth, ToDepth, TraversalType,
+                                                                   TraversalResult, UnaryOp, CurrDepth + 1>(op))>;
 
-            typename info_type::extent_storage_type new_dims(info_.dims().size());
-            std::fill(new_dims.begin(), new_dims.end(), 1);
-            auto calc_num_slices_at_dim = [&](auto indf, auto indl) {
-                if (*indf == 0) {
-                    return std::distance(indf, indl);
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
                 }
-                return std::distance(indf, indl) + 1;
-            };
-            if (std::distance(first_axis, last_axis) == 0) {
-                std::for_each(new_dims.begin(), new_dims.end(), [&](size_type& d) {
-                    d = calc_num_slices_at_dim(first_ind, last_ind);
-                });
-            } else {
-                std::for_each(first_axis, last_axis, [&](size_type axis) {
-                    new_dims[axis] = calc_num_slices_at_dim(first_ind, last_ind);
-                });
-            }
 
-            // --------------------------------------------------------------------
+                for (auto t : zip(zipped(*this), zipped(res))) {
+                    std::get<1>(t) = std::get<0>(t)
+                                         .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, UnaryOp,
+                                             CurrDepth + 1>(op);
+                }
 
-            split_t slices(new_dims);
-            auto slices_it = slices.begin();
-            size_type actual_num_slices = 0;
+                return res;
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
+                using transform_t
+                    = std::conditional_t<std::is_void_v<decltype(op(*this))>, this_type, decltype(op(*this))>;
 
-            std::function<void(this_type, size_type)> split_impl;
+                transform_t res;
 
-            split_impl = [&](this_type arr, size_type current_depth) -> void {
-                if (arr.empty()) {
-                    return;
+                if constexpr (std::is_void_v<decltype(op(*this))>) {
+                    res = *this;
+                    op(res);
+                    return res;
+                } else {
+                    this_type mid = *this;
+                    return op(mid);
                 }
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
+                auto invoke = [&op](auto arr) {
+                    if constexpr (std::is_void_v<decltype(op(arr))>) {
+                        op(arr);
+                        return arr;
+                    } else {
+                        return op(arr);
+                    }
+                };
+                auto mid = invoke(*this);
 
-                if (current_depth == 0) {
-                    *slices_it = arr;
-                    ++slices_it;
-                    ++actual_num_slices;
-                    return;
-                }
+                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(mid)))>,
+                    value_type, decltype(op(*std::begin(mid)))>>;
 
-                if (std::distance(first_axis, last_axis) > 0
-                    && std::find(first_axis, last_axis, size(arr.info()) - current_depth) == last_axis) {
-                    split_impl(arr(boundary_type::full(), size(arr.info()) - current_depth), current_depth - 1);
-                    return;
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
                 }
 
-                size_type current_dim = arr.info().dims()[size(arr.info()) - current_depth];
-
-                if (std::distance(first_ind, last_ind) <= 0 || std::distance(first_ind, last_ind) > current_dim) {
-                    throw std::invalid_argument("invalid number of indices");
-                }
-                if (std::any_of(first_ind, last_ind, [current_dim](size_type ind) {
-                        return ind < 0 || ind >= current_dim;
-                    })) {
-                    throw std::invalid_argument("invalid indices for dims");
+                for (auto t : zip(zipped(mid), zipped(res))) {
+                    if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
+                        std::get<1>(t) = std::get<0>(t);
+                        op(std::get<1>(t));
+                    } else {
+                        std::get<1>(t) = op(std::get<0>(t));
+                    }
                 }
 
-                size_type prev_ind = *first_ind;
-                auto ind_it = first_ind;
-                ++ind_it;
-                if (prev_ind > 0) {
-                    split_impl(arr(boundary_type{0, prev_ind}, size(arr.info()) - current_depth), current_depth - 1);
-                }
-                size_type current_ind = prev_ind;
-                for (; ind_it != last_ind; ++ind_it) {
-                    current_ind = *ind_it;
-                    if (prev_ind < current_ind) {
-                        split_impl(arr(boundary_type{prev_ind, current_ind}, size(arr.info()) - current_depth),
-                            current_depth - 1);
-                    }
-                    prev_ind = current_ind;
-                }
-                if (current_ind < current_dim) {
-                    split_impl(arr(boundary_type{current_ind, current_dim}, size(arr.info()) - current_depth),
-                        current_depth - 1);
-                }
-            };
-
-            split_impl(*this, size(info_));
-
-            assert(actual_num_slices == total(slices.info()));
+                return res;
+            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
+                using transform_t = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this)))>,
+                    value_type, decltype(op(*std::begin(*this)))>>;
 
-            return slices;
-        }
+                transform_t res;
+                res.info()
+                    = transform_t::info_type(info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                res.shared_storage() = shared_storage_
+                    ? std::allocate_shared<typename transform_t::storage_type>(
+                        typename transform_t::template allocator_template_type<typename transform_t::storage_type>(),
+                        shared_storage_->size())
+                    : nullptr;
+                if (shared_storage_) {
+                    res.shared_storage()->reserve(shared_storage_->capacity());
+                }
 
-        template <iterable_of_type_integral AxesCont, iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto split(const AxesCont& axes, const Cont& inds) const
-        {
-            return split(std::begin(axes), std::end(axes), std::begin(inds), std::end(inds));
-        }
+                zipped_invoke(
+                    [&op](auto this_elems, auto res_elems) {
+                        for (auto t : zip(this_elems, res_elems)) {
+                            if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
+                                std::get<1>(t) = std::get<0>(t);
+                                op(std::get<1>(t));
+                            } else {
+                                std::get<1>(t) = op(std::get<0>(t));
+                            }
+                        }
+                    },
+                    *this, res);
 
-        [[nodiscard]] constexpr auto split(
-            std::initializer_list<size_type> axes, std::initializer_list<size_type> inds) const
-        {
-            return split(axes.begin(), axes.end(), inds.begin(), inds.end());
+                return res;
+            } else {
+                // No transformations
+                return *this;
+            }
         }
 
-        template <iterator_of_type_integral AxesIt, iterator_of_type_integral IndsIt>
-        [[nodiscard]] constexpr auto exclude(
-            AxesIt first_axis, AxesIt last_axis, IndsIt first_ind, IndsIt last_ind) const
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
+            typename Op, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::dfs
+                && TraversalResult == arrnd_traversal_result::transform)
+        [[nodiscard]] constexpr auto traverse(const Cont& cont, Op op) const
         {
-            using exclude_t = replaced_type<this_type>;
+            // The main thing done in this function is the returned type deduction.
 
-            if (empty()) {
-                return exclude_t();
-            }
+            // Main compilation branches:
+            // - If arrnd_type<value_type> and relevant(CurrentDepth)
+            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
 
-            if (!std::is_sorted(first_ind, last_ind)) {
-                throw std::invalid_argument("invalid indices - not sorted");
-            }
+            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
+            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
 
-            if (std::adjacent_find(first_ind, last_ind) != last_ind) {
-                throw std::invalid_argument("invalid indices - not unique");
-            }
+            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<decltype(std::declval<value_type>()
+                                                     .template traverse<FromDepth, ToDepth, TraversalType,
+                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
+                                                         cont, op))>;
 
-            if (!std::is_sorted(first_axis, last_axis)) {
-                throw std::invalid_argument("invalid axes - not sorted");
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            if (std::adjacent_find(first_axis, last_axis) != last_axis) {
-                throw std::invalid_argument("invalid axes - not unique");
-            }
+                    for (auto t : zip(zipped(*this), zipped(res))) {
+                        std::get<1>(t) = std::get<0>(t)
+                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
+                    }
 
-            if (std::distance(first_axis, last_axis) < 0
-                || std::distance(first_axis, last_axis) > info_.dims().size()) {
-                throw std::invalid_argument("invalid number of axes");
-            }
+                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
+                        op(res, cont);
+                        return res;
+                    } else {
+                        return op(res, cont);
+                    }
+                } else {
+                    using transform_t = replaced_type<
+                        decltype(std::declval<value_type>()
+                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
+                                         CurrDepth + 1>(*std::begin(cont), op))>;
 
-            if (std::any_of(first_axis, last_axis, [&](auto axis) {
-                    return axis < 0 || axis >= size(info_);
-                })) {
-                throw std::invalid_argument("invalid axes for dims");
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            // calculate dimensions according to number of slices in each dimension
+                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
+                        std::get<1>(t)
+                            = std::get<0>(t)
+                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
+                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
+                                      std::get<2>(t), op);
+                    }
 
-            auto calc_num_slices_at_dim = [](auto indf, auto indl, size_type dim) {
-                size_type num_slices = 0;
-                size_type prev = *indf;
-                if (prev > 0) {
-                    ++num_slices;
-                }
-                ++indf;
-                size_type current_ind = prev;
-                for (auto it = indf; it != indl; ++it) {
-                    current_ind = *it;
-                    if (prev < current_ind + 1) {
-                        ++num_slices;
+                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
+                        op(res, cont);
+                        return res;
+                    } else {
+                        return op(res, cont);
                     }
-                    prev = current_ind;
-                }
-                if (current_ind + 1 < dim) {
-                    ++num_slices;
                 }
-                return num_slices;
-            };
+            } else if constexpr (arrnd_type<value_type>) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<decltype(std::declval<value_type>()
+                                                     .template traverse<FromDepth, ToDepth, TraversalType,
+                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
+                                                         cont, op))>;
 
-            typename info_type::extent_storage_type new_dims(size(info_), 1);
-            if (std::distance(first_axis, last_axis) == 0) {
-                std::transform(std::begin(info_.dims()), std::end(info_.dims()), std::begin(new_dims), [&](auto dim) {
-                    return calc_num_slices_at_dim(first_ind, last_ind, dim);
-                });
-            } else {
-                std::for_each(first_axis, last_axis, [&](auto axis) {
-                    new_dims[axis] = calc_num_slices_at_dim(first_ind, last_ind, info_.dims()[axis]);
-                });
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            // --------------------------------------------------------------------
+                    for (auto t : zip(zipped(*this), zipped(res))) {
+                        std::get<1>(t) = std::get<0>(t)
+                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
+                    }
 
-            exclude_t slices(new_dims);
-            auto slices_it = slices.begin();
-            size_type actual_num_slices = 0;
+                    return res;
+                } else {
+                    using transform_t = replaced_type<
+                        decltype(std::declval<value_type>()
+                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
+                                         CurrDepth + 1>(*std::begin(cont), op))>;
 
-            std::function<void(this_type, size_type)> exclude_impl;
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            exclude_impl = [&](this_type arr, size_type current_depth) -> void {
-                if (arr.empty()) {
-                    return;
+                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
+                        std::get<1>(t)
+                            = std::get<0>(t)
+                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
+                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
+                                      std::get<2>(t), op);
+                    }
+
+                    return res;
                 }
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
+                using transform_t = std::conditional_t<std::is_void_v<decltype(op(*this, cont))>, this_type,
+                    decltype(op(*this, cont))>;
 
-                if (current_depth == 0) {
-                    *slices_it = arr;
-                    ++slices_it;
-                    ++actual_num_slices;
+                transform_t res;
 
-                    return;
+                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
+                    res = *this;
+                    op(res, cont);
+                    return res;
+                } else {
+                    this_type mid = *this;
+                    return op(mid, cont);
                 }
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), cont))>,
+                            value_type, decltype(op(*std::begin(*this), cont))>>;
 
-                if (std::distance(first_axis, last_axis) > 0
-                    && std::find(first_axis, last_axis, size(arr.info()) - current_depth) == last_axis) {
-                    exclude_impl(arr(boundary_type::full(), size(arr.info()) - current_depth), current_depth - 1);
-                    return;
-                }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-                size_type current_dim = arr.info().dims()[size(arr.info()) - current_depth];
+                    zipped_invoke(
+                        [&op, &cont](auto this_elems, auto res_elems) {
+                            for (auto t : zip(this_elems, res_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t), cont);
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t), cont);
+                                }
+                            }
+                        },
+                        *this, res);
 
-                if (std::distance(first_ind, last_ind) <= 0 || std::distance(first_ind, last_ind) > current_dim) {
-                    throw std::invalid_argument("invalid number of indices");
-                }
-                if (std::any_of(first_ind, last_ind, [current_dim](size_type ind) {
-                        return ind < 0 || ind >= current_dim;
-                    })) {
-                    throw std::invalid_argument("invalid indices for dims");
-                }
+                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
+                        op(res, cont);
+                        return res;
+                    } else {
+                        return op(res, cont);
+                    }
+                } else {
+                    using transform_t = replaced_type<
+                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), *std::begin(cont)))>,
+                            value_type, decltype(op(*std::begin(*this), *std::begin(cont)))>>;
 
-                size_type prev_ind = *first_ind;
-                auto ind_it = first_ind;
-                ++ind_it;
-                if (prev_ind > 0) {
-                    exclude_impl(arr(boundary_type{0, prev_ind}, size(arr.info()) - current_depth), current_depth - 1);
-                }
-                size_type current_ind = prev_ind;
-                for (; ind_it != last_ind; ++ind_it) {
-                    current_ind = *ind_it;
-                    if (prev_ind + 1 < current_ind) {
-                        exclude_impl(arr(boundary_type{prev_ind + 1, current_ind}, size(arr.info()) - current_depth),
-                            current_depth - 1);
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
                     }
-                    prev_ind = current_ind;
-                }
-                if (current_ind + 1 < current_dim) {
-                    exclude_impl(arr(boundary_type{current_ind + 1, current_dim}, size(arr.info()) - current_depth),
-                        current_depth - 1);
-                }
-            };
 
-            exclude_impl(*this, size(info_));
+                    zipped_invoke(
+                        [&op](auto this_elems, auto res_elems, auto cont_elems) {
+                            for (auto t : zip(this_elems, res_elems, cont_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t), std::get<2>(t));
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
+                                }
+                            }
+                        },
+                        *this, res, cont);
 
-            assert(actual_num_slices == total(slices.info()));
+                    if constexpr (std::is_void_v<decltype(op(res, cont))>) {
+                        op(res, cont);
+                        return res;
+                    } else {
+                        return op(res, cont);
+                    }
+                }
+            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), cont))>,
+                            value_type, decltype(op(*std::begin(*this), cont))>>;
 
-            return slices;
-        }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-        template <iterable_of_type_integral AxesCont, iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto exclude(const AxesCont& axes, const Cont& inds) const
-        {
-            return exclude(std::begin(axes), std::end(axes), std::begin(inds), std::end(inds));
-        }
+                    zipped_invoke(
+                        [&op, &cont](auto this_elems, auto res_elems) {
+                            for (auto t : zip(this_elems, res_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t), cont);
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t), cont);
+                                }
+                            }
+                        },
+                        *this, res);
 
-        [[nodiscard]] constexpr auto exclude(
-            std::initializer_list<size_type> axes, std::initializer_list<size_type> inds) const
-        {
-            return exclude(axes.begin(), axes.end(), inds.begin(), inds.end());
-        }
+                    return res;
+                } else {
+                    using transform_t = replaced_type<
+                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), *std::begin(cont)))>,
+                            value_type, decltype(op(*std::begin(*this), *std::begin(cont)))>>;
 
-        [[nodiscard]] constexpr auto merge() const
-            requires(!this_type::is_flat)
-        {
-            if (empty()) {
-                return value_type{};
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            this_type res = clone().reduce<0>(size(info_) - 1, [&](value_type a, value_type b) {
-                return a.push_back(b, size(info_) - 1);
-            });
+                    zipped_invoke(
+                        [&op](auto this_elems, auto res_elems, auto cont_elems) {
+                            for (auto t : zip(this_elems, res_elems, cont_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t), std::get<2>(t));
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
+                                }
+                            }
+                        },
+                        *this, res, cont);
 
-            for (difference_type axis = size(info_) - 2; axis >= 0; --axis) {
-                res = res.reduce<0>(axis, [axis](value_type a, value_type b) {
-                    return a.push_back(b, axis);
-                });
+                    return res;
+                }
+            } else {
+                // No transformations
+                return *this;
             }
-
-            assert(total(res.info()) == 1);
-
-            return res(0);
         }
 
-        [[nodiscard]] constexpr this_type squeeze(arrnd_squeeze_type type = arrnd_squeeze_type::full) const
+        template <std::size_t FromDepth, std::size_t ToDepth, arrnd_traversal_type TraversalType,
+            arrnd_traversal_result TraversalResult, arrnd_traversal_container TraversalCont, iterable_type Cont,
+            typename Op, std::size_t CurrDepth = 0>
+            requires(FromDepth <= ToDepth && TraversalType == arrnd_traversal_type::bfs
+                && TraversalResult == arrnd_traversal_result::transform)
+        [[nodiscard]] constexpr auto traverse(const Cont& cont, Op op) const
         {
-            this_type squeezed = *this;
-            squeezed.info_ = oc::arrnd::squeeze(info_, type);
+            // The main thing done in this function is the returned type deduction.
 
-            return squeezed;
-        }
+            // Main compilation branches:
+            // - If arrnd_type<value_type> and relevant(CurrentDepth)
+            // - Else If arrnd_type<value_type>: Do not transform, just recursive call
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and relevant(CurrentDepth) && !relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type> and !relevant(CurrentDepth) && relevant(CurrentDepth + 1)
+            // - Else If !arrnd_type<value_type>: Do not transform, no recursive call
 
-        template <typename Comp>
-        constexpr this_type& sort(Comp comp)
-        {
-            std::sort(begin(), end(), [&comp](const auto& lhs, const auto& rhs) {
-                return comp(lhs, rhs);
-            });
+            constexpr bool is_current_depth_relevant = CurrDepth >= FromDepth && CurrDepth <= ToDepth;
+            constexpr bool is_next_depth_relevant = CurrDepth + 1 >= FromDepth && CurrDepth + 1 <= ToDepth;
 
-            return *this;
-        }
+            if constexpr (arrnd_type<value_type> && is_current_depth_relevant) {
+                auto invoke = [&op, &cont](auto arr) {
+                    if constexpr (std::is_void_v<decltype(op(arr, cont))>) {
+                        op(arr, cont);
+                        return arr;
+                    } else {
+                        return op(arr, cont);
+                    }
+                };
+                auto mid = invoke(*this);
 
-        template <typename Comp>
-        [[nodiscard]] constexpr this_type& sort(size_type axis, Comp&& comp)
-        {
-            if (empty()) {
-                return *this;
-            }
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<decltype((*std::begin(mid))
+                                                     .template traverse<FromDepth, ToDepth, TraversalType,
+                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
+                                                         cont, op))>;
 
-            if (axis < 0 || axis >= size(info_)) {
-                throw std::invalid_argument("invalid axis");
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            auto sorted_tmp = expand(axis).sort(std::forward<Comp>(comp)).collapse(true);
-            std::copy(sorted_tmp.cbegin(), sorted_tmp.cend(), begin());
+                    for (auto t : zip(zipped(mid), zipped(res))) {
+                        std::get<1>(t) = std::get<0>(t)
+                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
+                    }
 
-            return *this;
-        }
+                    return res;
+                } else {
+                    using transform_t = replaced_type<
+                        decltype((*std::begin(mid))
+                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
+                                         CurrDepth + 1>(*std::begin(cont), op))>;
 
-        template <typename Comp>
-        [[nodiscard]] constexpr bool is_sorted(Comp comp) const
-        {
-            if (empty()) {
-                return true;
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            return std::is_sorted(cbegin(), cend(), [&comp](const auto& lhs, const auto& rhs) {
-                return comp(lhs, rhs);
-            });
-        }
+                    for (auto t : zip(zipped(mid), zipped(res), zipped(cont))) {
+                        std::get<1>(t)
+                            = std::get<0>(t)
+                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
+                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
+                                      std::get<2>(t), op);
+                    }
 
-        template <typename Comp>
-        [[nodiscard]] constexpr bool is_sorted(size_type axis, Comp&& comp) const
-        {
-            if (empty()) {
-                return true;
-            }
+                    return res;
+                }
+            } else if constexpr (arrnd_type<value_type>) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<decltype(std::declval<value_type>()
+                                                     .template traverse<FromDepth, ToDepth, TraversalType,
+                                                         TraversalResult, TraversalCont, Cont, Op, CurrDepth + 1>(
+                                                         cont, op))>;
 
-            if (axis < 0 || axis >= size(info_)) {
-                throw std::invalid_argument("invalid axis");
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            return expand(axis).is_sorted(std::forward<Comp>(comp));
-        }
+                    for (auto t : zip(zipped(*this), zipped(res))) {
+                        std::get<1>(t) = std::get<0>(t)
+                                             .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                                 TraversalCont, Cont, Op, CurrDepth + 1>(cont, op);
+                    }
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr this_type& reorder(InputIt first_order, InputIt last_order)
-        {
-            if (empty()) {
-                return *this;
-            }
+                    return res;
+                } else {
+                    using transform_t = replaced_type<
+                        decltype(std::declval<value_type>()
+                                     .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult,
+                                         TraversalCont, std::remove_reference_t<decltype(*std::begin(cont))>, Op,
+                                         CurrDepth + 1>(*std::begin(cont), op))>;
 
-            if (std::distance(first_order, last_order) != total(info_)) {
-                throw std::invalid_argument("invalid order - different from total elements");
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            typename info_type::extent_storage_type order(first_order, last_order);
+                    for (auto t : zip(zipped(*this), zipped(res), zipped(cont))) {
+                        std::get<1>(t)
+                            = std::get<0>(t)
+                                  .template traverse<FromDepth, ToDepth, TraversalType, TraversalResult, TraversalCont,
+                                      std::remove_reference_t<decltype(std::get<2>(t))>, Op, CurrDepth + 1>(
+                                      std::get<2>(t), op);
+                    }
 
-            auto z = zip(zipped(order), zipped(*this));
-            std::sort(z.begin(), z.end(), [](const auto& t1, const auto& t2) {
-                return std::get<0>(t1) < std::get<0>(t2);
-            });
+                    return res;
+                }
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && !is_next_depth_relevant) {
+                using transform_t = std::conditional_t<std::is_void_v<decltype(op(*this, cont))>, this_type,
+                    decltype(op(*this, cont))>;
 
-            return *this;
-        }
+                transform_t res;
 
-        template <iterable_of_type_integral Cont>
-        constexpr this_type& reorder(const Cont& order)
-        {
-            return reorder(std::begin(order), std::end(order));
-        }
+                if constexpr (std::is_void_v<decltype(op(*this, cont))>) {
+                    res = *this;
+                    op(res, cont);
+                    return res;
+                } else {
+                    this_type mid = *this;
+                    return op(mid, cont);
+                }
+            } else if constexpr (!arrnd_type<value_type> && is_current_depth_relevant && is_next_depth_relevant) {
+                auto invoke = [&op, &cont](auto arr) {
+                    if constexpr (std::is_void_v<decltype(op(arr, cont))>) {
+                        op(arr, cont);
+                        return arr;
+                    } else {
+                        return op(arr, cont);
+                    }
+                };
+                auto mid = invoke(*this);
 
-        constexpr this_type& reorder(std::initializer_list<size_type> order)
-        {
-            return reorder(order.begin(), order.end());
-        }
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(mid), cont))>,
+                            value_type, decltype(op(*std::begin(mid), cont))>>;
 
-        template <iterator_of_type_integral InputIt>
-        constexpr this_type& reorder(size_type axis, InputIt first_order, InputIt last_order)
-        {
-            if (empty()) {
-                return *this;
-            }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            if (axis < 0 || axis >= size(info_)) {
-                throw std::invalid_argument("invalid axis");
-            }
+                    for (auto t : zip(zipped(mid), zipped(res))) {
+                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
+                            std::get<1>(t) = std::get<0>(t);
+                            op(std::get<1>(t), cont);
+                        } else {
+                            std::get<1>(t) = op(std::get<0>(t), cont);
+                        }
+                    }
 
-            if (std::distance(first_order, last_order) != info_.dims()[axis]) {
-                throw std::invalid_argument("invalid order - different from total elements at axis");
-            }
+                    return res;
+                } else {
+                    using transform_t = replaced_type<
+                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(mid), *std::begin(cont)))>,
+                            value_type, decltype(op(*std::begin(mid), *std::begin(cont)))>>;
 
-            typename info_type::extent_storage_type order(first_order, last_order);
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            auto expanded = expand(axis);
+                    for (auto t : zip(zipped(mid), zipped(res), zipped(cont))) {
+                        if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
+                            std::get<1>(t) = std::get<0>(t);
+                            op(std::get<1>(t), std::get<2>(t));
+                        } else {
+                            std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
+                        }
+                    }
 
-            auto z = zip(zipped(order), zipped(expanded));
-            std::sort(z.begin(), z.end(), [](const auto& t1, const auto& t2) {
-                return std::get<0>(t1) < std::get<0>(t2);
-            });
+                    return res;
+                }
+            } else if constexpr (!arrnd_type<value_type> && !is_current_depth_relevant && is_next_depth_relevant) {
+                if constexpr (TraversalCont == arrnd_traversal_container::carry) {
+                    using transform_t
+                        = replaced_type<std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), cont))>,
+                            value_type, decltype(op(*std::begin(*this), cont))>>;
 
-            auto sorted_tmp = expanded.collapse(true);
-            std::copy(sorted_tmp.cbegin(), sorted_tmp.cend(), begin());
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
 
-            return *this;
-        }
+                    zipped_invoke(
+                        [&op, &cont](auto this_elems, auto res_elems) {
+                            for (auto t : zip(this_elems, res_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t), cont))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t), cont);
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t), cont);
+                                }
+                            }
+                        },
+                        *this, res);
 
-        template <iterable_of_type_integral Cont>
-        constexpr this_type& reorder(size_type axis, const Cont& order)
-        {
-            return reorder(axis, std::begin(order), std::end(order));
+                    return res;
+                } else {
+                    using transform_t = replaced_type<
+                        std::conditional_t<std::is_void_v<decltype(op(*std::begin(*this), *std::begin(cont)))>,
+                            value_type, decltype(op(*std::begin(*this), *std::begin(cont)))>>;
+
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        info_.dims(), info_.strides(), info_.indices_boundary(), info_.hints());
+                    res.shared_storage() = shared_storage_ ? std::allocate_shared<typename transform_t::storage_type>(
+                                               typename transform_t::template allocator_template_type<
+                                                   typename transform_t::storage_type>(),
+                                               shared_storage_->size())
+                                                           : nullptr;
+                    if (shared_storage_) {
+                        res.shared_storage()->reserve(shared_storage_->capacity());
+                    }
+
+                    zipped_invoke(
+                        [&op](auto this_elems, auto res_elems, auto cont_elems) {
+                            for (auto t : zip(this_elems, res_elems, cont_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t), std::get<2>(t)))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t), std::get<2>(t));
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t), std::get<2>(t));
+                                }
+                            }
+                        },
+                        *this, res, cont);
+
+                    return res;
+                }
+            } else {
+                // No transformations
+                return *this;
+            }
         }
 
-        constexpr this_type& reorder(size_type axis, std::initializer_list<size_type> order)
+        template <std::size_t AtDepth = this_type::depth, typename UnaryOp>
+        [[nodiscard]] constexpr auto transform(UnaryOp op) const
         {
-            return reorder(axis, order.begin(), order.end());
+            return traverse<AtDepth + 1, AtDepth + 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(op);
         }
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto adjacent_indices(InputIt first_sub, InputIt last_sub, size_type offset = 1) const
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryOp>
+        [[nodiscard]] constexpr auto transform(const Arrnd& arr, BinaryOp op) const
         {
-            using adjacent_indices_t = replaced_type<size_type>;
-
-            if (empty()) {
-                return adjacent_indices_t{};
-            }
+            auto transform_impl = [&op](const auto& lhs, const auto& rhs) {
+                using transform_t
+                    = decltype(lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
+                               arrnd_traversal_container::propagate>(rhs, op));
 
-            if (std::distance(first_sub, last_sub) != size(info_)) {
-                throw std::invalid_argument("invalid number of subs");
-            }
+                if (lhs.empty() && rhs.empty()) {
+                    return transform_t{};
+                }
 
-            if (offset <= 0) {
-                throw std::invalid_argument("invalid offset <= 0");
-            }
+                if (isscalar(rhs.info())) {
+                    return lhs.template transform<0>(
+                        [&op, &rval = std::as_const(rhs(0))](const auto& lval) -> typename transform_t::value_type {
+                            if constexpr (std::is_void_v<decltype(op(std::forward<decltype(lval)>(lval), rval))>) {
+                                op(std::forward<decltype(lval)>(lval), rval);
+                            } else {
+                                return op(std::forward<decltype(lval)>(lval), rval);
+                            }
+                        });
+                }
 
-            auto signed_offset = static_cast<difference_type>(offset);
+                if (isscalar(lhs.info())) {
+                    return rhs.template transform<0>(
+                        [&op, &lval = std::as_const(lhs(0))](auto&& rval) -> typename transform_t::value_type {
+                            if constexpr (std::is_void_v<decltype(op(lval, std::forward<decltype(rval)>(rval)))>) {
+                                op(lval, std::forward<decltype(rval)>(rval));
+                            } else {
+                                return op(lval, std::forward<decltype(rval)>(rval));
+                            }
+                        });
+                }
 
-            auto compute_num_adj = [](difference_type ndims, difference_type soffset) {
-                difference_type base1 = 3 + 2 * (soffset - 1);
-                difference_type base2 = 3 + 2 * (soffset - 2);
-                return static_cast<size_type>(std::pow(base1, ndims) - std::pow(base2, ndims));
-            };
+                if (std::equal(std::begin(lhs.info().dims()), std::end(lhs.info().dims()),
+                        std::begin(rhs.info().dims()), std::end(rhs.info().dims()))) {
+                    return lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
+                        arrnd_traversal_container::propagate>(rhs, op);
+                }
 
-            adjacent_indices_t res({compute_num_adj(static_cast<difference_type>(size(info_)), signed_offset)});
-            size_type actual_num_adj = 0;
+                // numpy broadcasting by zero strides views, i.e. the broadcasted operands are not copied.
+                // traverse() returns an array of the lhs layout, therefore a broadcasted lhs is supported
+                // only for arrays of non nested elements.
+                constexpr bool is_flat_elems = !arrnd_type<typename std::remove_cvref_t<decltype(lhs)>::value_type>
+                    && !arrnd_type<typename std::remove_cvref_t<decltype(rhs)>::value_type>;
 
-            std::function<void(adjacent_indices_t, size_type, bool)> impl;
+                if (isbroadcastable(lhs.info(), rhs.info())) {
+                    auto dims = broadcast_dims(lhs.info(), rhs.info());
 
-            impl = [&](adjacent_indices_t subs, size_type perm_pos, bool used_offset) {
-                if (perm_pos == size(info_)) {
-                    return;
-                }
+                    auto rhs_view = rhs;
+                    rhs_view.info() = broadcast(rhs.info(), dims);
 
-                for (difference_type i = -signed_offset; i <= signed_offset; ++i) {
-                    size_type abs_i = static_cast<size_type>(std::abs(i));
+                    if (std::equal(std::begin(dims), std::end(dims), std::begin(lhs.info().dims()),
+                            std::end(lhs.info().dims()))) {
+                        return lhs.template traverse<1, 1, arrnd_traversal_type::dfs,
+                            arrnd_traversal_result::transform, arrnd_traversal_container::propagate>(rhs_view, op);
+                    }
 
-                    if (abs_i > 0 && abs_i <= signed_offset) {
-                        auto new_subs = subs.clone();
-                        new_subs[perm_pos] += i;
-                        if (new_subs[perm_pos] >= 0 && new_subs[perm_pos] < info_.dims()[perm_pos]) {
-                            if (used_offset || abs_i == signed_offset) {
-                                res[actual_num_adj++] = sub2ind(info_, new_subs.cbegin(), new_subs.cend());
+                    if constexpr (is_flat_elems) {
+                        auto lhs_view = lhs;
+                        lhs_view.info() = broadcast(lhs.info(), dims);
+
+                        transform_t res(dims);
+                        for (auto t : zip(zipped(res), zipped(lhs_view), zipped(rhs_view))) {
+                            if constexpr (std::is_void_v<decltype(op(std::get<1>(t), std::get<2>(t)))>) {
+                                std::get<0>(t) = std::get<1>(t);
+                                op(std::get<0>(t), std::get<2>(t));
+                            } else {
+                                std::get<0>(t) = op(std::get<1>(t), std::get<2>(t));
                             }
-                            impl(new_subs, perm_pos + 1, abs_i == signed_offset);
                         }
-                    } else {
-                        impl(subs, perm_pos + 1, used_offset);
+                        return res;
                     }
                 }
-            };
 
-            std::initializer_list<size_type> res_dims{static_cast<size_type>(std::distance(first_sub, last_sub))};
-            impl(adjacent_indices_t(res_dims.begin(), res_dims.end(), first_sub, last_sub), 0, false);
+                // arrays of different dims and the same number of elements, which are not broadcasted,
+                // are transformed element-wise
+                if (total(lhs.info()) == total(rhs.info())) {
+                    return lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
+                        arrnd_traversal_container::propagate>(rhs, op);
+                }
 
-            if (total(res.info()) > actual_num_adj) {
-                return res.resize({actual_num_adj});
-            }
-            return res;
-        }
+                if (total(lhs.info()) > total(rhs.info()) && size(lhs.info()) == size(rhs.info())) {
+                    auto zipped_dims = (zip(zipped(lhs.info().dims()), zipped(rhs.info().dims())));
+                    if (std::any_of(std::begin(zipped_dims), std::end(zipped_dims), [](auto t) {
+                            return std::get<0>(t) % std::get<1>(t) != 0;
+                        })) {
+                        throw std::invalid_argument("invalid input array dims for boradcast");
+                    }
 
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto adjacent_indices(const Cont& subs, difference_type offset = 1) const
-        {
-            return adjacent_indices(std::begin(subs), std::end(subs), offset);
-        }
-        [[nodiscard]] constexpr auto adjacent_indices(
-            std::initializer_list<size_type> subs, difference_type offset = 1) const
-        {
-            return adjacent_indices(subs.begin(), subs.end(), offset);
-        }
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        lhs.info().dims(), lhs.info().strides(), lhs.info().indices_boundary(), lhs.info().hints());
+                    res.shared_storage() = lhs.shared_storage()
+                        ? std::allocate_shared<typename transform_t::storage_type>(
+                            typename transform_t::template allocator_template_type<
+                                typename transform_t::storage_type>(),
+                            lhs.shared_storage()->size())
+                        : nullptr;
+                    if (lhs.shared_storage()) {
+                        res.shared_storage()->reserve(lhs.shared_storage()->capacity());
+                    }
 
-        template <std::size_t AtDepth = this_type::depth, typename Pred>
-        [[nodiscard]] constexpr bool all(Pred&& pred) const
-        {
-            if (empty()) {
-                return true;
-            }
+                    typename transform_t::info_type::storage_traits_type::template replaced_type<
+                        typename transform_t::window_type>::storage_type windows(size(lhs.info()));
 
-            for (auto inner : *this) {
-                if constexpr (AtDepth == 0) {
-                    if (!pred(inner)) {
-                        return false;
+                    std::transform(std::begin(rhs.info().dims()), std::end(rhs.info().dims()), std::begin(windows),
+                        [](typename transform_t::difference_type d) {
+                            return typename transform_t::window_type(
+                                typename transform_t::window_type::interval_type{0, d}, arrnd_window_type::complete);
+                        });
+
+                    for (typename transform_t::windows_slider_type slider(lhs.info(), windows); slider; ++slider) {
+                        auto slc = lhs[*slider];
+                        res[*slider] = slc.template traverse<1, 1, arrnd_traversal_type::dfs,
+                            arrnd_traversal_result::transform, arrnd_traversal_container::propagate>(rhs, op);
                     }
-                } else {
-                    if (!inner.template all<AtDepth - 1, Pred>(std::forward<Pred>(pred))) {
-                        return false;
+
+                    return res;
+                }
+
+                if (total(lhs.info()) < total(rhs.info()) && size(lhs.info()) == size(rhs.info())) {
+                    auto zipped_dims = (zip(zipped(lhs.info().dims()), zipped(rhs.info().dims())));
+                    if (std::any_of(std::begin(zipped_dims), std::end(zipped_dims), [](auto t) {
+                            return std::get<1>(t) % std::get<0>(t) != 0;
+                        })) {
+                        throw std::invalid_argument("invalid input array dims for boradcast");
+                    }
+
+                    transform_t res;
+                    res.info() = transform_t::info_type(
+                        rhs.info().dims(), rhs.info().strides(), rhs.info().indices_boundary(), rhs.info().hints());
+                    res.shared_storage() = rhs.shared_storage()
+                        ? std::allocate_shared<typename transform_t::storage_type>(
+                            typename transform_t::template allocator_template_type<
+                                typename transform_t::storage_type>(),
+                            rhs.shared_storage()->size())
+                        : nullptr;
+                    if (rhs.shared_storage()) {
+                        res.shared_storage()->reserve(rhs.shared_storage()->capacity());
+                    }
+
+                    typename transform_t::info_type::storage_traits_type::template replaced_type<
+                        typename transform_t::window_type>::storage_type windows(size(rhs.info()));
+
+                    std::transform(std::begin(lhs.info().dims()), std::end(lhs.info().dims()), std::begin(windows),
+                        [](typename transform_t::difference_type d) {
+                            return typename transform_t::window_type(
+                                typename transform_t::window_type::interval_type{0, d}, arrnd_window_type::complete);
+                        });
+
+                    for (typename transform_t::windows_slider_type slider(rhs.info(), windows); slider; ++slider) {
+                        auto slc = rhs[*slider];
+                        res[*slider] = lhs.template traverse<1, 1, arrnd_traversal_type::dfs,
+                            arrnd_traversal_result::transform, arrnd_traversal_container::propagate>(slc, op);
                     }
+
+                    return res;
                 }
-            }
 
-            return true;
+                throw std::invalid_argument("invalid input array dims");
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform,
+                arrnd_traversal_container::propagate>(arr, transform_impl);
         }
 
-        template <std::size_t AtDepth = this_type::depth>
-        [[nodiscard]] constexpr bool all() const
+        // element-wise transform split between threads - op is invoked concurrently
+        template <typename UnaryOp>
+            requires(this_type::is_flat)
+        [[nodiscard]] constexpr auto transform(const arrnd_parallel_policy& policy, UnaryOp op) const
         {
-            return all<AtDepth>([](const auto& value) {
-                return static_cast<bool>(value);
-            });
+            using transform_t = decltype(transform(op));
+
+            if (empty()) {
+                return transform_t{};
+            }
+
+            transform_t res(info_.dims());
+
+            parallel_chunks_invoke(num_chunks(policy, total(info_)), total(info_),
+                [this, &res, &op](std::size_t first, std::size_t last, std::size_t) {
+                    chunk_invoke(
+                        [&op](auto this_elems, auto res_elems) {
+                            for (auto t : zip(this_elems, res_elems)) {
+                                if constexpr (std::is_void_v<decltype(op(std::get<0>(t)))>) {
+                                    std::get<1>(t) = std::get<0>(t);
+                                    op(std::get<1>(t));
+                                } else {
+                                    std::get<1>(t) = op(std::get<0>(t));
+                                }
+                            }
+                        },
+                        first, last, *this, res);
+                });
+
+            return res;
         }
 
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryPred>
-        [[nodiscard]] constexpr bool all_match(const Arrnd& arr, BinaryPred&& pred) const
+        // arrays of different dims (unless arr is a scalar) are transformed sequentially, e.g. broadcasted
+        template <arrnd_type Arrnd, typename BinaryOp>
+            requires(this_type::is_flat && Arrnd::is_flat)
+        [[nodiscard]] constexpr auto transform(const arrnd_parallel_policy& policy, const Arrnd& arr, BinaryOp op) const
         {
-            if (empty() && arr.empty()) {
-                return true;
-            }
+            using transform_t = decltype(transform(arr, op));
 
-            if (empty() || arr.empty()) {
-                return false;
-            }
+            bool is_elementwise = std::equal(std::begin(info_.dims()), std::end(info_.dims()),
+                std::begin(arr.info().dims()), std::end(arr.info().dims()));
 
-            if (!std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(arr.info().dims()),
-                    std::end(arr.info().dims()))) {
-                return false;
+            if (empty() || arr.empty() || (!is_elementwise && !isscalar(arr.info()))) {
+                return transform(arr, op);
             }
 
-            for (auto inners : zip(zipped(*this), zipped(arr))) {
-                if constexpr (AtDepth == 0) {
-                    if (!pred(std::get<0>(inners), std::get<1>(inners))) {
-                        return false;
-                    }
-                } else {
-                    if (!std::get<0>(inners).template all_match<AtDepth - 1, typename Arrnd::value_type, BinaryPred>(
-                            std::get<1>(inners), std::forward<BinaryPred>(pred))) {
-                        return false;
-                    }
-                }
-            }
+            transform_t res(info_.dims());
 
-            return true;
-        }
+            parallel_chunks_invoke(num_chunks(policy, total(info_)), total(info_),
+                [this, &arr, &res, &op, is_elementwise](std::size_t first, std::size_t last, std::size_t) {
+                    auto transform_impl = [&op](auto& lval, auto& rval, auto& res_val) {
+                        if constexpr (std::is_void_v<decltype(op(lval, rval))>) {
+                            res_val = lval;
+                            op(res_val, rval);
+                        } else {
+                            res_val = op(lval, rval);
+                        }
+                    };
+
+                    if (!is_elementwise) {
+                        chunk_invoke(
+                            [&transform_impl, &rval = arr(0)](auto this_elems, auto res_elems) {
+                                for (auto t : zip(this_elems, res_elems)) {
+                                    transform_impl(std::get<0>(t), rval, std::get<1>(t));
+                                }
+                            },
+                            first, last, *this, res);
+                    } else {
+                        chunk_invoke(
+                            [&transform_impl](auto this_elems, auto arr_elems, auto res_elems) {
+                                for (auto t : zip(this_elems, arr_elems, res_elems)) {
+                                    transform_impl(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+                                }
+                            },
+                            first, last, *this, arr, res);
+                    }
+                });
 
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd>
-        [[nodiscard]] constexpr bool all_match(const Arrnd& arr) const
-        {
-            return all_match<AtDepth, Arrnd>(arr, [](const auto& a, const auto& b) {
-                if constexpr (arrnd_type<decltype(a)> && arrnd_type<decltype(b)>) {
-                    return (a == b).template all<this_type::depth>();
-                } else {
-                    return a == b;
-                }
-            });
+            return res;
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryPred>
-            requires(!arrnd_type<U>)
-        [[nodiscard]] constexpr bool all_match(const U& u, BinaryPred pred) const
+        template <std::size_t AtDepth = this_type::depth, typename UnaryOp>
+        constexpr auto& apply(UnaryOp op)
         {
-            return all<AtDepth>([&u, &pred](const auto& a) {
-                return pred(a, u);
-            });
+            return traverse<AtDepth + 1, AtDepth + 1, arrnd_traversal_type::dfs, arrnd_traversal_result::apply>(op);
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename U>
-            requires(!arrnd_type<U>)
-        [[nodiscard]] constexpr bool all_match(const U& u) const
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryOp>
+        constexpr auto& apply(const Arrnd& arr, BinaryOp op)
         {
-            return all<AtDepth>([&u](const auto& a) {
-                if constexpr (arrnd_type<decltype(a)>) {
-                    return (a == u).template all<this_type::depth>();
-                } else {
-                    return a == u;
+            auto apply_impl = [&op](auto& lhs, auto& rhs) {
+                if (lhs.empty() && rhs.empty()) {
+                    return lhs;
                 }
-            });
-        }
-
-        template <std::size_t AtDepth = this_type::depth, typename Pred>
-        [[nodiscard]] constexpr bool any(Pred&& pred) const
-        {
-            if (empty()) {
-                return true;
-            }
 
-            for (auto inner : *this) {
-                if constexpr (AtDepth == 0) {
-                    if (pred(inner)) {
-                        return true;
+                constexpr bool is_void_op = std::is_same_v<
+                    std::invoke_result_t<BinaryOp, decltype(*std::begin(lhs)), decltype(*std::begin(rhs))>, void>;
+
+                if (isscalar(rhs.info())) {
+                    return lhs.template apply<0>([&op, &rval = rhs(0)](auto&& lval) {
+                        if constexpr (std::is_void_v<decltype(op(std::forward<decltype(lval)>(lval), rval))>) {
+                            op(std::forward<decltype(lval)>(lval), rval);
+                        } else {
+                            return op(std::forward<decltype(lval)>(lval), rval);
+                        }
+                    });
+                }
+
+                if (total(lhs.info()) == total(rhs.info())) {
+                    return lhs.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::apply,
+                        arrnd_traversal_container::propagate>(rhs, op);
+                }
+
+                if (total(lhs.info()) > total(rhs.info()) && size(lhs.info()) == size(rhs.info())) {
+                    auto zipped_dims = (zip(zipped(lhs.info().dims()), zipped(rhs.info().dims())));
+                    if (std::any_of(std::begin(zipped_dims), std::end(zipped_dims), [](auto t) {
+                            return std::get<0>(t) % std::get<1>(t) != 0;
+                        })) {
+                        throw std::invalid_argument("invalid input array dims for boradcast");
                     }
-                } else {
-                    if (inner.template any<AtDepth - 1, Pred>(std::forward<Pred>(pred))) {
-                        return true;
+
+                    using lhs_t = std::remove_cvref_t<decltype(lhs)>;
+
+                    typename lhs_t::info_type::storage_traits_type::template replaced_type<
+                        typename lhs_t::window_type>::storage_type windows(size(lhs.info()));
+
+                    std::transform(std::begin(rhs.info().dims()), std::end(rhs.info().dims()), std::begin(windows),
+                        [](typename lhs_t::difference_type d) {
+                            return typename lhs_t::window_type(
+                                typename lhs_t::window_type::interval_type{0, d}, arrnd_window_type::complete);
+                        });
+
+                    for (typename lhs_t::windows_slider_type slider(lhs.info(), windows); slider; ++slider) {
+                        auto slc = lhs[*slider];
+                        slc.template traverse<1, 1, arrnd_traversal_type::dfs, arrnd_traversal_result::apply,
+                            arrnd_traversal_container::propagate>(rhs, op);
                     }
+
+                    return lhs;
                 }
-            }
 
-            return false;
-        }
+                throw std::invalid_argument("invalid input array dims");
+            };
 
-        template <std::size_t AtDepth = this_type::depth>
-        [[nodiscard]] constexpr bool any() const
-        {
-            return any<AtDepth>([](const auto& value) {
-                return static_cast<bool>(value);
-            });
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::apply,
+                arrnd_traversal_container::propagate>(arr, apply_impl);
         }
 
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryPred>
-        [[nodiscard]] constexpr bool any_match(const Arrnd& arr, BinaryPred&& pred) const
+        // element-wise apply split between threads - op is invoked concurrently
+        template <typename UnaryOp>
+            requires(this_type::is_flat)
+        constexpr this_type& apply(const arrnd_parallel_policy& policy, UnaryOp op)
         {
-            if (empty() && arr.empty()) {
-                return true;
+            if (empty()) {
+                return *this;
             }
 
-            if (empty() || arr.empty()) {
-                return false;
-            }
+            parallel_chunks_invoke(num_chunks(policy, total(info_)), total(info_),
+                [this, &op](std::size_t first, std::size_t last, std::size_t) {
+                    chunk_invoke(
+                        [&op](auto this_elems) {
+                            for (auto t : zip(this_elems)) {
+                                auto& value = std::get<0>(t);
+                                if constexpr (std::is_void_v<decltype(op(value))>) {
+                                    op(value);
+                                } else {
+                                    value = op(value);
+                                }
+                            }
+                        },
+                        first, last, *this);
+                });
 
-            if (!std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(arr.info().dims()),
-                    std::end(arr.info().dims()))) {
-                return false;
+            return *this;
+        }
+
+        // arrays of different dims (unless arr is a scalar) are applied sequentially (see apply(arr, op))
+        template <arrnd_type Arrnd, typename BinaryOp>
+            requires(this_type::is_flat && Arrnd::is_flat)
+        constexpr this_type& apply(const arrnd_parallel_policy& policy, const Arrnd& arr, BinaryOp op)
+        {
+            bool is_elementwise = std::equal(std::begin(info_.dims()), std::end(info_.dims()),
+                std::begin(arr.info().dims()), std::end(arr.info().dims()));
+
+            if (empty() || arr.empty() || (!is_elementwise && !isscalar(arr.info()))) {
+                return apply(arr, op);
             }
 
-            for (auto inners : zip(zipped(*this), zipped(arr))) {
-                if constexpr (AtDepth == 0) {
-                    if (pred(std::get<0>(inners), std::get<1>(inners))) {
-                        return true;
-                    }
-                } else {
-                    if (std::get<0>(inners).template any_match<AtDepth - 1, typename Arrnd::value_type, BinaryPred>(
-                            std::get<1>(inners), std::forward<BinaryPred>(pred))) {
-                        return true;
+            parallel_chunks_invoke(num_chunks(policy, total(info_)), total(info_),
+                [this, &arr, &op, is_elementwise](std::size_t first, std::size_t last, std::size_t) {
+                    auto apply_impl = [&op](auto& lval, auto& rval) {
+                        if constexpr (std::is_void_v<decltype(op(lval, rval))>) {
+                            op(lval, rval);
+                        } else {
+                            lval = op(lval, rval);
+                        }
+                    };
+
+                    if (!is_elementwise) {
+                        chunk_invoke(
+                            [&apply_impl, &rval = arr(0)](auto this_elems) {
+                                for (auto t : zip(this_elems)) {
+                                    apply_impl(std::get<0>(t), rval);
+                                }
+                            },
+                            first, last, *this);
+                    } else {
+                        chunk_invoke(
+                            [&apply_impl](auto this_elems, auto arr_elems) {
+                                for (auto t : zip(this_elems, arr_elems)) {
+                                    apply_impl(std::get<0>(t), std::get<1>(t));
+                                }
+                            },
+                            first, last, *this, arr);
                     }
-                }
-            }
+                });
 
-            return false;
+            return *this;
         }
 
-        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd>
-        [[nodiscard]] constexpr bool any_match(const Arrnd& arr) const
+        template <std::size_t AtDepth = this_type::depth, typename BinaryOp>
+        [[nodiscard]] constexpr auto reduce(BinaryOp op) const
         {
-            return any_match<AtDepth, Arrnd>(arr, [](const auto& a, const auto& b) {
-                if constexpr (arrnd_type<decltype(a)> && arrnd_type<decltype(b)>) {
-                    return (a == b).template any<this_type::depth>();
-                } else {
-                    return a == b;
+            auto reduce_impl = [&op](const auto& arr) {
+                using reduce_t = std::invoke_result_t<BinaryOp, typename std::remove_cvref_t<decltype(arr)>::value_type,
+                    typename std::remove_cvref_t<decltype(arr)>::value_type>;
+
+                if (arr.empty()) {
+                    return reduce_t{};
                 }
-            });
-        }
 
-        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryPred>
-            requires(!arrnd_type<U>)
-        [[nodiscard]] constexpr bool any_match(const U& u, BinaryPred pred) const
-        {
-            return any<AtDepth>([&u, &pred](const auto& a) {
-                return pred(a, u);
-            });
+                if (has_plain_elements(arr)) {
+                    auto elems = plain_zipped(arr);
+                    if constexpr (std::is_arithmetic_v<reduce_t>
+                        && std::is_same_v<reduce_t, typename std::remove_cvref_t<decltype(arr)>::value_type>) {
+                        return vectorized_reduce(std::next(elems.first(), 1), total(arr.info()) - 1,
+                            static_cast<reduce_t>(*(elems.first())), op);
+                    } else {
+                        return std::reduce(
+                            std::next(elems.first(), 1), elems.last(), static_cast<reduce_t>(*(elems.first())), op);
+                    }
+                }
+
+                return std::reduce(std::next(arr.begin(), 1), arr.end(), static_cast<reduce_t>(*(arr.begin())), op);
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
+                reduce_impl);
         }
 
-        template <std::size_t AtDepth = this_type::depth, typename U>
-            requires(!arrnd_type<U>)
-        [[nodiscard]] constexpr bool any_match(const U& u) const
+        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryOp>
+        [[nodiscard]] constexpr auto fold(const U& init, BinaryOp op) const
         {
-            return any<AtDepth>([&u](const auto& a) {
-                if constexpr (arrnd_type<decltype(a)>) {
-                    return (a == u).template any<this_type::depth>();
-                } else {
-                    return a == u;
+            auto fold_impl = [&op, &init](const auto& arr) {
+                using fold_t
+                    = std::invoke_result_t<BinaryOp, U, typename std::remove_cvref_t<decltype(arr)>::value_type>;
+
+                if (arr.empty()) {
+                    return fold_t{};
                 }
-            });
-        }
 
-        template <std::size_t AtDepth = this_type::depth, typename Pred>
-        [[nodiscard]] constexpr replaced_type<bool> all(size_type axis, Pred pred) const
-        {
-            return reduce<AtDepth>(axis, [&pred](const auto& a, const auto& b) {
-                return a && pred(b);
-            });
-        }
+                if (has_plain_elements(arr)) {
+                    auto elems = plain_zipped(arr);
+                    return std::reduce(elems.first(), elems.last(), init, op);
+                }
 
-        template <std::size_t AtDepth = this_type::depth>
-        [[nodiscard]] constexpr replaced_type<bool> all(size_type axis) const
-        {
-            return all(axis, [](const auto& a) {
-                return a;
-            });
-        }
+                return std::reduce(std::begin(arr), std::end(arr), init, op);
+            };
 
-        template <std::size_t AtDepth = this_type::depth, typename Pred>
-        [[nodiscard]] constexpr replaced_type<bool> any(size_type axis, Pred pred) const
-        {
-            return reduce<AtDepth>(axis, [&pred](const auto& a, const auto& b) {
-                return a || pred(b);
-            });
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(fold_impl);
         }
 
-        template <std::size_t AtDepth = this_type::depth>
-        [[nodiscard]] constexpr replaced_type<bool> any(size_type axis) const
+        // each thread reduces its own chunk and the partial results are reduced at the end,
+        // therefore op is expected to be associative
+        template <typename BinaryOp>
+            requires(this_type::is_flat)
+        [[nodiscard]] constexpr auto reduce(const arrnd_parallel_policy& policy, BinaryOp op) const
         {
-            return any(axis, [](const auto& a) {
-                return a;
-            });
+            using reduce_t = std::invoke_result_t<BinaryOp, value_type, value_type>;
+
+            if (empty()) {
+                return reduce_t{};
+            }
+
+            std::size_t chunks = num_chunks(policy, total(info_));
+            typename replaced_type<reduce_t>::storage_type partials(chunks);
+
+            parallel_chunks_invoke(chunks, total(info_),
+                [this, &op, &partials](std::size_t first, std::size_t last, std::size_t chunk) {
+                    partials[chunk] = chunk_invoke(
+                        [&op](auto this_elems) {
+                            return std::reduce(std::next(this_elems.first(), 1), this_elems.last(),
+                                static_cast<reduce_t>(*(this_elems.first())), op);
+                        },
+                        first, last, *this);
+                });
+
+            return std::reduce(std::next(std::begin(partials), 1), std::end(partials), partials[0], op);
         }
 
-        [[nodiscard]] constexpr auto begin()
+        // the first chunk is folded from init and the others from their first element,
+        // therefore op is expected to be associative and to return the array value type
+        template <typename U, typename BinaryOp>
+            requires(this_type::is_flat && std::is_same_v<std::invoke_result_t<BinaryOp, U, value_type>, value_type>)
+        [[nodiscard]] constexpr auto fold(const arrnd_parallel_policy& policy, const U& init, BinaryOp op) const
         {
-            return begin(0, arrnd_returned_element_iterator_tag{});
+            using fold_t = std::invoke_result_t<BinaryOp, U, value_type>;
+
+            if (empty()) {
+                return fold_t{};
+            }
+
+            std::size_t chunks = num_chunks(policy, total(info_));
+            typename replaced_type<fold_t>::storage_type partials(chunks);
+
+            parallel_chunks_invoke(chunks, total(info_),
+                [this, &op, &init, &partials](std::size_t first, std::size_t last, std::size_t chunk) {
+                    partials[chunk] = chunk_invoke(
+                        [&op, &init, chunk](auto this_elems) {
+                            if (chunk == 0) {
+                                return std::reduce(
+                                    this_elems.first(), this_elems.last(), static_cast<fold_t>(init), op);
+                            }
+                            return std::reduce(std::next(this_elems.first(), 1), this_elems.last(),
+                                static_cast<fold_t>(*(this_elems.first())), op);
+                        },
+                        first, last, *this);
+                });
+
+            return std::reduce(std::next(std::begin(partials), 1), std::end(partials), partials[0], op);
         }
-        [[nodiscard]] constexpr auto begin() const
+
+        // the first chunk is folded from init and the others from a value initialized result,
+        // and the partial results are combined by combine_op, therefore the value initialized
+        // result is expected to be the identity of combine_op (e.g. zero for addition)
+        template <typename U, typename BinaryOp, typename CombineOp>
+            requires(this_type::is_flat)
+        [[nodiscard]] constexpr auto fold(
+            const arrnd_parallel_policy& policy, const U& init, BinaryOp op, CombineOp combine_op) const
         {
-            return begin(0, arrnd_returned_element_iterator_tag{});
+            using fold_t = std::invoke_result_t<BinaryOp, U, value_type>;
+
+            if (empty()) {
+                return fold_t{};
+            }
+
+            std::size_t chunks = num_chunks(policy, total(info_));
+            typename replaced_type<fold_t>::storage_type partials(chunks);
+
+            parallel_chunks_invoke(chunks, total(info_),
+                [this, &op, &init, &partials](std::size_t first, std::size_t last, std::size_t chunk) {
+                    partials[chunk] = chunk_invoke(
+                        [&op, &init, chunk](auto this_elems) {
+                            return std::accumulate(this_elems.first(), this_elems.last(),
+                                chunk == 0 ? static_cast<fold_t>(init) : fold_t{}, op);
+                        },
+                        first, last, *this);
+                });
+
+            return std::reduce(std::next(std::begin(partials), 1), std::end(partials), partials[0], combine_op);
         }
-        [[nodiscard]] constexpr auto cbegin() const
+
+        template <std::size_t AtDepth = this_type::depth, typename BinaryOp>
+        [[nodiscard]] constexpr auto reduce(size_type axis, BinaryOp op) const
         {
-            return cbegin(0, arrnd_returned_element_iterator_tag{});
+            auto reduce_impl = [axis, &op](const auto& arr) {
+                using reduce_t = typename std::remove_cvref_t<decltype(arr)>::template replaced_type<
+                    std::invoke_result_t<BinaryOp, typename std::remove_cvref_t<decltype(arr)>::value_type,
+                        typename std::remove_cvref_t<decltype(arr)>::value_type>>;
+
+                auto new_info = oc::arrnd::reduce(arr.info(), axis);
+                reduce_t res(std::move(new_info),
+                    std::allocate_shared<typename reduce_t::storage_type>(
+                        typename reduce_t::template allocator_template_type<typename reduce_t::storage_type>(),
+                        total(new_info)));
+
+                assert(total(res.info()) == total(arr.info()) / arr.info().dims()[axis]);
+
+                size_type reduction_size = arr.info().dims()[axis];
+                auto [outer, inner] = reduction_extents(arr.info(), axis);
+                auto* res_first = plain_zipped(res).first();
+
+                if (!has_plain_elements(arr)) {
+                    reduce_rows<true>(std::begin(arr), res_first, outer, reduction_size, inner, op);
+                    return res;
+                }
+
+                const auto* first = plain_zipped(arr).first();
+
+                // the reduced rows of the last axis are continuous
+                if constexpr (std::is_arithmetic_v<typename reduce_t::value_type>
+                    && std::is_same_v<typename reduce_t::value_type,
+                        typename std::remove_cvref_t<decltype(arr)>::value_type>) {
+                    if (inner == 1) {
+                        for (size_type i = 0; i < outer; ++i, first += reduction_size) {
+                            res_first[i] = vectorized_reduce(first + 1, reduction_size - 1, *first, op);
+                        }
+                        return res;
+                    }
+                }
+
+                reduce_rows<true>(first, res_first, outer, reduction_size, inner, op);
+                return res;
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
+                reduce_impl);
         }
 
-        [[nodiscard]] constexpr auto end()
+        // the axes are reduced one by one (see reduce(axis, op)), therefore op is expected to be associative
+        template <std::size_t AtDepth = this_type::depth, iterator_of_type_integral InputIt, typename BinaryOp>
+        [[nodiscard]] constexpr auto reduce(InputIt first_axis, InputIt last_axis, BinaryOp op) const
         {
-            return end(0, arrnd_returned_element_iterator_tag{});
+            typename info_type::extent_storage_type axes(first_axis, last_axis);
+            std::sort(std::begin(axes), std::end(axes), std::greater<>{});
+
+            if (std::empty(axes) || std::adjacent_find(std::begin(axes), std::end(axes)) != std::end(axes)) {
+                throw std::invalid_argument("invalid axes - empty or not unique");
+            }
+
+            // reduction of the greater axes first keeps the other axes values
+            auto res = reduce<AtDepth>(axes[0], op);
+            for (size_type i = 1; i < std::size(axes); ++i) {
+                res = res.template reduce<AtDepth>(axes[i], op);
+            }
+            return res;
         }
-        [[nodiscard]] constexpr auto end() const
+
+        template <std::size_t AtDepth = this_type::depth, iterable_of_type_integral Cont, typename BinaryOp>
+        [[nodiscard]] constexpr auto reduce(const Cont& axes, BinaryOp op) const
         {
-            return end(0, arrnd_returned_element_iterator_tag{});
+            return reduce<AtDepth>(std::begin(axes), std::end(axes), op);
         }
-        [[nodiscard]] constexpr auto cend() const
+
+        template <std::size_t AtDepth = this_type::depth, typename BinaryOp>
+        [[nodiscard]] constexpr auto reduce(std::initializer_list<size_type> axes, BinaryOp op) const
         {
-            return cend(0, arrnd_returned_element_iterator_tag{});
+            return reduce<AtDepth>(axes.begin(), axes.end(), op);
         }
 
-        [[nodiscard]] constexpr auto rbegin()
-        {
-            return rbegin(0, arrnd_returned_element_iterator_tag{});
-        }
-        [[nodiscard]] constexpr auto rbegin() const
-        {
-            return rbegin(0, arrnd_returned_element_iterator_tag{});
-        }
-        [[nodiscard]] constexpr auto crbegin() const
+        template <std::size_t AtDepth = this_type::depth, iterator_type InputIt, typename BinaryOp>
+        [[nodiscard]] constexpr auto fold(size_type axis, InputIt first_init, InputIt last_init, BinaryOp op) const
         {
-            return crbegin(0, arrnd_returned_element_iterator_tag{});
-        }
+            auto fold_impl = [axis, &op, &first_init, &last_init](const auto& arr) {
+                using fold_t =
+                    typename std::remove_cvref_t<decltype(arr)>::template replaced_type<std::invoke_result_t<BinaryOp,
+                        iterator_value_t<InputIt>, typename std::remove_cvref_t<decltype(arr)>::value_type>>;
 
-        [[nodiscard]] constexpr auto rend()
-        {
-            return rend(0, arrnd_returned_element_iterator_tag{});
-        }
-        [[nodiscard]] constexpr auto rend() const
-        {
-            return rend(0, arrnd_returned_element_iterator_tag{});
-        }
-        [[nodiscard]] constexpr auto crend() const
-        {
-            return crend(0, arrnd_returned_element_iterator_tag{});
+                if (total(arr.info()) / arr.info().dims()[axis] != std::distance(first_init, last_init)) {
+                    throw std::invalid_argument("different size inits from input array");
+                }
+
+                auto new_info = oc::arrnd::reduce(arr.info(), axis);
+                fold_t res(std::move(new_info),
+                    std::allocate_shared<typename fold_t::storage_type>(
+                        typename fold_t::template allocator_template_type<typename fold_t::storage_type>(),
+                        total(new_info)));
+
+                assert(total(res.info()) == total(arr.info()) / arr.info().dims()[axis]);
+
+                size_type reduction_size = arr.info().dims()[axis];
+                auto [outer, inner] = reduction_extents(arr.info(), axis);
+                auto* res_first = plain_zipped(res).first();
+
+                std::copy(first_init, last_init, res_first);
+
+                if (has_plain_elements(arr)) {
+                    reduce_rows<false>(plain_zipped(arr).first(), res_first, outer, reduction_size, inner, op);
+                } else {
+                    reduce_rows<false>(std::begin(arr), res_first, outer, reduction_size, inner, op);
+                }
+
+                return res;
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(fold_impl);
         }
 
-        [[nodiscard]] constexpr auto begin(arrnd_returned_element_iterator_tag)
+        template <std::size_t AtDepth = this_type::depth, iterable_type Cont, typename BinaryOp>
+        [[nodiscard]] constexpr auto fold(size_type axis, const Cont& inits, BinaryOp&& op) const
         {
-            return begin(0, arrnd_returned_element_iterator_tag{});
+            return fold<AtDepth>(axis, std::begin(inits), std::end(inits), std::forward<BinaryOp>(op));
         }
-        [[nodiscard]] constexpr auto begin(arrnd_returned_element_iterator_tag) const
+
+        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryOp>
+        [[nodiscard]] constexpr auto fold(size_type axis, std::initializer_list<U> inits, BinaryOp&& op) const
         {
-            return begin(0, arrnd_returned_element_iterator_tag{});
+            return fold<AtDepth>(axis, inits.begin(), inits.end(), std::forward<BinaryOp>(op));
         }
-        [[nodiscard]] constexpr auto cbegin(arrnd_returned_element_iterator_tag) const
+
+        // cumulative op along axis - the i-th result is of the i first elements of each lane
+        template <std::size_t AtDepth = this_type::depth, typename BinaryOp>
+        [[nodiscard]] constexpr auto scan(size_type axis, BinaryOp op) const
         {
-            return cbegin(0, arrnd_returned_element_iterator_tag{});
+            auto scan_impl = [axis, &op](const auto& arr) {
+                using arr_t = std::remove_cvref_t<decltype(arr)>;
+                using scan_t = typename arr_t::template replaced_type<
+                    std::invoke_result_t<BinaryOp, typename arr_t::value_type, typename arr_t::value_type>>;
+
+                return scan_axis<false, scan_t>(
+                    arr, axis, typename scan_t::value_type{}, arrnd_scan_type::inclusive, op);
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(scan_impl);
         }
-        [[nodiscard]] constexpr auto end(arrnd_returned_element_iterator_tag)
+
+        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryOp>
+        [[nodiscard]] constexpr auto scan(
+            size_type axis, const U& init, BinaryOp op, arrnd_scan_type type = arrnd_scan_type::inclusive) const
         {
-            return end(0, arrnd_returned_element_iterator_tag{});
+            auto scan_impl = [axis, &init, &op, type](const auto& arr) {
+                using arr_t = std::remove_cvref_t<decltype(arr)>;
+                using scan_t = typename arr_t::template replaced_type<
+                    std::invoke_result_t<BinaryOp, U, typename arr_t::value_type>>;
+
+                return scan_axis<true, scan_t>(arr, axis, static_cast<typename scan_t::value_type>(init), type, op);
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(scan_impl);
         }
-        [[nodiscard]] constexpr auto end(arrnd_returned_element_iterator_tag) const
+
+        // op is expected to be associative
+        template <typename BinaryOp>
+            requires(this_type::is_flat)
+        [[nodiscard]] constexpr auto scan(const arrnd_parallel_policy& policy, size_type axis, BinaryOp op) const
         {
-            return end(0, arrnd_returned_element_iterator_tag{});
+            using scan_t = replaced_type<std::invoke_result_t<BinaryOp, value_type, value_type>>;
+
+            return scan_axis<false, scan_t>(
+                policy, *this, axis, typename scan_t::value_type{}, arrnd_scan_type::inclusive, op);
         }
-        [[nodiscard]] constexpr auto cend(arrnd_returned_element_iterator_tag) const
+
+        template <typename U, typename BinaryOp>
+            requires(this_type::is_flat)
+        [[nodiscard]] constexpr auto scan(const arrnd_parallel_policy& policy, size_type axis, const U& init,
+            BinaryOp op, arrnd_scan_type type = arrnd_scan_type::inclusive) const
         {
-            return cend(0, arrnd_returned_element_iterator_tag{});
+            using scan_t = replaced_type<std::invoke_result_t<BinaryOp, U, value_type>>;
+
+            return scan_axis<true, scan_t>(
+                policy, *this, axis, static_cast<typename scan_t::value_type>(init), type, op);
         }
-        [[nodiscard]] constexpr auto rbegin(arrnd_returned_element_iterator_tag)
+
+        template <std::size_t AtDepth = this_type::depth, typename Pred>
+            requires(!iterable_type<Pred>)
+        [[nodiscard]] constexpr auto filter(Pred pred) const
         {
-            return rbegin(0, arrnd_returned_element_iterator_tag{});
+            auto filter_impl = [&pred](const auto& arr) {
+                using filter_t = std::remove_cvref_t<decltype(arr)>;
+
+                if (arr.empty()) {
+                    return filter_t{};
+                }
+
+                filter_t res({total(arr.info())});
+
+                size_type count = 0;
+
+                std::copy_if(arr.cbegin(), arr.cend(), res.begin(), [&pred, &count](const auto& value) {
+                    if (pred(value)) {
+                        ++count;
+                        return true;
+                    }
+                    return false;
+                });
+
+                return count == 0 ? filter_t{} : res.resize({count});
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
+                filter_impl);
         }
-        [[nodiscard]] constexpr auto rbegin(arrnd_returned_element_iterator_tag) const
+
+        template <std::size_t AtDepth = this_type::depth, iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto filter(InputIt first, InputIt last) const
         {
-            return rbegin(0, arrnd_returned_element_iterator_tag{});
+            auto filter_impl = [&first, &last](const auto& arr) {
+                using filter_t = std::remove_cvref_t<decltype(arr)>;
+
+                if (std::distance(first, last) > total(arr.info())) {
+                    throw std::invalid_argument("different total size between arr and selector");
+                }
+
+                if (arr.empty()) {
+                    return filter_t{};
+                }
+
+                filter_t res({static_cast<size_type>(std::distance(first, last))});
+                auto rit = std::begin(res);
+
+                for (auto ind_it = first; ind_it != last; ++ind_it) {
+                    *rit = arr[*ind_it];
+                    ++rit;
+                }
+
+                return res;
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
+                filter_impl);
         }
-        [[nodiscard]] constexpr auto crbegin(arrnd_returned_element_iterator_tag) const
+
+        template <std::size_t AtDepth = this_type::depth, iterable_of_type_integral Cont>
+            requires(arrnd_type<Cont>)
+        [[nodiscard]] constexpr auto filter(const Cont& selector) const
         {
-            return crbegin(0, arrnd_returned_element_iterator_tag{});
+            auto filter_impl = [&selector](const auto& arr) {
+                using filter_t = std::remove_cvref_t<decltype(arr)>;
+
+                // mask - should be inside arr dims limit
+                if constexpr (std::is_same_v<bool, typename Cont::value_type>) {
+                    if (!std::equal(std::begin(arr.info().dims()), std::end(arr.info().dims()),
+                            std::begin(selector.info().dims()), std::end(selector.info().dims()))) {
+                        throw std::invalid_argument("different dims between arr and selector");
+                    }
+
+                    if (arr.empty()) {
+                        return filter_t{};
+                    }
+
+                    filter_t res({total(arr.info())});
+                    auto rit = res.begin();
+                    size_type count = 0;
+
+                    for (auto t : zip(zipped(arr), zipped(selector))) {
+                        if (std::get<1>(t)) {
+                            *rit = std::get<0>(t);
+                            ++rit;
+                            ++count;
+                        }
+                    }
+
+                    return count == 0 ? filter_t{} : res.resize({count});
+                } else {
+                    auto first_ind = std::begin(selector);
+                    auto last_ind = std::end(selector);
+
+                    if (std::distance(first_ind, last_ind) > total(arr.info())) {
+                        throw std::invalid_argument("different total size between arr and selector");
+                    }
+
+                    if (arr.empty()) {
+                        return filter_t{};
+                    }
+
+                    filter_t res({static_cast<size_type>(std::distance(first_ind, last_ind))});
+                    auto rit = std::begin(res);
+
+                    for (auto ind : selector) {
+                        *rit = arr[ind];
+                        ++rit;
+                    }
+
+                    return res;
+                }
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(
+                filter_impl);
         }
-        [[nodiscard]] constexpr auto rend(arrnd_returned_element_iterator_tag)
+
+        template <std::size_t AtDepth = this_type::depth, iterable_of_type_integral Cont>
+            requires(!arrnd_type<Cont>)
+        [[nodiscard]] constexpr auto filter(const Cont& selector) const
         {
-            return rend(0, arrnd_returned_element_iterator_tag{});
+            return filter<AtDepth>(std::begin(selector), std::end(selector));
         }
-        [[nodiscard]] constexpr auto rend(arrnd_returned_element_iterator_tag) const
+
+        template <std::size_t AtDepth = this_type::depth>
+        [[nodiscard]] constexpr auto filter(std::initializer_list<size_type> inds) const
         {
-            return rend(0, arrnd_returned_element_iterator_tag{});
+            return filter<AtDepth>(inds.begin(), inds.end());
         }
-        [[nodiscard]] constexpr auto crend(arrnd_returned_element_iterator_tag) const
+
+        template <std::size_t AtDepth = this_type::depth, typename Pred>
+            requires(!iterable_type<Pred>)
+        [[nodiscard]] constexpr auto find(Pred pred) const
         {
-            return crend(0, arrnd_returned_element_iterator_tag{});
-        }
+            auto find_impl = [&pred](const auto& arr) {
+                using find_t = typename std::remove_cvref_t<decltype(arr)>::template replaced_type<size_type>;
 
-        // by axis iterator functions
+                if (arr.empty()) {
+                    return find_t{};
+                }
 
-        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_element_iterator_tag)
-        {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::begin));
+                find_t res({total(arr.info())});
+
+                size_type count = 0;
+                auto rit = res.begin();
+
+                for (typename std::remove_cvref_t<decltype(arr)>::indexer_type indexer(arr.info()); indexer;
+                     ++indexer) {
+                    if (pred(arr[*indexer])) {
+                        *rit = *indexer;
+                        ++rit;
+                        ++count;
+                    }
+                }
+
+                return count == 0 ? find_t{} : res.resize({count});
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(find_impl);
         }
-        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_element_iterator_tag) const
+
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd>
+        [[nodiscard]] constexpr auto find(const Arrnd& mask) const
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::begin));
-        }
+            auto find_impl = [&mask](const auto& arr) {
+                using find_t = typename std::remove_cvref_t<decltype(arr)>::template replaced_type<size_type>;
+
+                if (!std::equal(std::begin(arr.info().dims()), std::end(arr.info().dims()),
+                        std::begin(mask.info().dims()), std::end(mask.info().dims()))) {
+                    throw std::invalid_argument("different dims between arr and mask");
+                }
+
+                if (arr.empty()) {
+                    return find_t{};
+                }
+
+                find_t res({total(arr.info())});
+
+                auto rit = res.begin();
+                size_type count = 0;
+
+                typename std::remove_cvref_t<decltype(arr)>::indexer_type arr_indexer(arr.info());
+                typename Arrnd::indexer_type mask_indexer(mask.info());
+
+                for (; arr_indexer && mask_indexer; ++arr_indexer, ++mask_indexer) {
+                    if (mask[*mask_indexer]) {
+                        *rit = *arr_indexer;
+                        ++rit;
+                        ++count;
+                    }
+                }
+
+                return count == 0 ? find_t{} : res.resize({count});
+            };
+
+            return traverse<AtDepth, AtDepth, arrnd_traversal_type::dfs, arrnd_traversal_result::transform>(find_impl);
+        }
+
+        [[nodiscard]] constexpr auto expand(size_type axis, size_type division = 0) const
+        {
+            using expand_t = replaced_type<this_type>;
+
+            if (empty()) {
+                return expand_t{};
+            }
+
+            if (axis < 0 || axis >= size(info_)) {
+                throw std::invalid_argument("invalid axis");
+            }
+
+            if (division > info_.dims()[axis]) {
+                throw std::invalid_argument("invalid division for axis dim");
+            }
+
+            auto fixed_div = division > 0 ? std::min(info_.dims()[axis], division) : info_.dims()[axis];
+
+            typename expand_t::info_type::extent_storage_type new_dims(size(info_), 1);
+            new_dims[axis] = fixed_div;
+
+            expand_t res(new_dims);
+            auto res_it = res.begin();
+
+            auto curr_div = fixed_div;
+            auto curr_axis_dim = info_.dims()[axis];
+            auto curr_ival_width = static_cast<size_type>(std::ceil(curr_axis_dim / static_cast<double>(curr_div)));
+
+            size_type res_total = 0;
+
+            windows_slider_type slider(info_, axis,
+                window_type(typename window_type::interval_type(0, curr_ival_width), arrnd_window_type::partial));
+
+            while (curr_div > 0) {
+                *(res_it++) = (*this)[std::make_pair((*slider).cbegin(), (*slider).cend())];
+
+                slider += curr_ival_width;
+
+                --curr_div;
+                curr_axis_dim -= curr_ival_width;
+
+                if (curr_div > 0) {
+                    curr_ival_width = static_cast<size_type>(std::ceil(curr_axis_dim / static_cast<double>(curr_div)));
+                    slider.modify_window(axis,
+                        window_type(
+                            typename window_type::interval_type(0, curr_ival_width), arrnd_window_type::partial));
+                }
+
+                ++res_total;
+            }
+
+            if (res_total != fixed_div) {
+                new_dims[axis] = res_total;
+                return res.resize(new_dims);
+            }
+            return res;
+        }
+
+        // collapse should only used on valid expanded arrays.
+        // returns reference to expanded array creator if
+        // exists, or new collpsed array otherwise.
+        [[nodiscard]] constexpr auto collapse(bool ignore_creators = false) const
+            requires(!this_type::is_flat)
+        {
+            using collpase_t = value_type;
+
+            if (empty()) {
+                return collpase_t{};
+            }
+
+            // from array creator
+
+            if (!ignore_creators) {
+                bool all_nested_values_have_the_same_creator
+                    = std::adjacent_find(cbegin(), cend(),
+                          [](const collpase_t& vt1, const collpase_t& vt2) {
+                              return !vt1.creator() || !vt2.creator() || vt1.creator() != vt2.creator();
+                          })
+                    == cend();
+
+                if (all_nested_values_have_the_same_creator && (*this)(0).creator() != nullptr) {
+                    return *((*this)(0).creator());
+                }
+            }
+
+            // from one collapsed array
+
+            if (total(info_) == 1) {
+                return (*this)(0);
+            }
+
+            // from assumed axis hint
+
+            if (std::count(std::begin(info_.dims()), std::end(info_.dims()), 1) != size(info_) - 1) {
+                throw std::exception("invalid exapnded array dims structure");
+            }
+
+            auto assumed_axis
+                = std::find(std::begin(info_.dims()), std::end(info_.dims()), total(info_)) - std::begin(info_.dims());
+
+            auto element_it = begin();
+
+            collpase_t res = (*element_it).clone();
+            ++element_it;
+
+            while (element_it != end()) {
+                res = res.push_back((*element_it).clone(), assumed_axis);
+                ++element_it;
+            }
+
+            return res;
+        }
+
+        template <typename UnaryOp>
+        [[nodiscard]] constexpr auto slide(size_type axis, window_type window, UnaryOp op) const
+        {
+            using slide_t = replaced_type<std::invoke_result_t<UnaryOp, this_type>>;
+
+            if (empty()) {
+                return slide_t{};
+            }
+
+            if (axis < 0 || axis >= size(info_)) {
+                throw std::invalid_argument("invalid axis");
+            }
+
+            windows_slider_type slider(info_, axis, window);
+
+            size_type res_total = window.type == arrnd_window_type::complete
+                ? info_.dims()[axis] - window.ival.stop() + window.ival.start() + 1
+                : info_.dims()[axis];
+
+            slide_t res({res_total});
+            if (res.empty()) {
+                return res;
+            }
+
+            auto res_it = res.begin();
+
+            for (; slider && res_it != res.end(); ++slider, ++res_it) {
+                *res_it = op((*this)[std::make_pair((*slider).cbegin(), (*slider).cend())]);
+            }
+
+            return res;
+        }
+
+        template <typename BinaryOp, typename UnaryOp>
+        [[nodiscard]] constexpr auto accumulate(
+            size_type axis, window_type window, BinaryOp reduce_op, UnaryOp transform_op) const
+        {
+            using transform_t = std::invoke_result_t<UnaryOp, this_type>;
+            using reduce_t = std::invoke_result_t<BinaryOp, transform_t, transform_t>;
+            using accumulate_t = replaced_type<reduce_t>;
+
+            if (empty()) {
+                return accumulate_t{};
+            }
+
+            if (axis < 0 || axis >= size(info_)) {
+                throw std::invalid_argument("invalid axis");
+            }
+
+            size_type axis_dim = *std::next(info_.dims().cbegin(), axis);
+
+            windows_slider_type slider(info_, axis, window);
+
+            size_type res_total = window.type == arrnd_window_type::complete
+                ? info_.dims()[axis] - window.ival.stop() + window.ival.start() + 1
+                : info_.dims()[axis];
+
+            accumulate_t res({res_total});
+            if (res.empty()) {
+                return res;
+            }
+
+            auto res_it = res.begin();
+
+            *res_it = transform_op((*this)[std::make_pair((*slider).cbegin(), (*slider).cend())]);
+            auto prev = *res_it;
+            ++res_it;
+            ++slider;
+
+            for (; slider && res_it != res.end(); ++slider, ++res_it) {
+                *res_it = reduce_op(prev, transform_op((*this)[std::make_pair((*slider).cbegin(), (*slider).cend())]));
+                prev = *res_it;
+            }
+
+            return res;
+        }
+
+        template <typename UnaryOp>
+        constexpr auto browse(size_type page_size, UnaryOp&& op) const
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<UnaryOp, this_type>>) {
+                using browse_t = this_type;
+
+                if (empty()) {
+                    return browse_t{};
+                }
+
+                if (size(info_) < page_size) {
+                    throw std::invalid_argument("invalid page size - smaller than number of dims");
+                }
+
+                if (size(info_) == page_size) {
+                    op(*this);
+                    return *this;
+                }
+
+                pages(page_size).template apply<0>(std::forward<UnaryOp>(op));
+                return *this;
+            } else {
+                using type_t = std::invoke_result_t<UnaryOp, this_type>;
+                using browse_t = std::conditional_t<arrnd_depths_match<type_t, this_type>, type_t,
+                    replaced_type<type_t>>;
+
+                if (empty()) {
+                    return browse_t{};
+                }
+
+                if (size(info_) < page_size) {
+                    throw std::invalid_argument("invalid page size - smaller than number of dims");
+                }
+
+                auto invoke = [&op](auto page) {
+                    if constexpr (arrnd_depths_match<type_t, this_type>) {
+                        return op(page);
+                    } else { // in case that the returned type of op is not arrnd_type, then it should not be void returned type
+                        return browse_t({1}, {op(page)});
+                    }
+                };
+
+                if (size(info_) == page_size) {
+                    return invoke(*this);
+                }
+
+                return pages(page_size).template transform<0>(invoke).book();
+            }
+        }
+
+        [[nodiscard]] constexpr auto pages(size_type page_size = 2) const
+        {
+            using pages_t = replaced_type<this_type>;
+
+            if (empty()) {
+                return pages_t{};
+            }
+
+            if (page_size <= 0 || page_size > size(info_)) {
+                throw std::invalid_argument("invalid page size");
+            }
+
+            if (page_size == size(info_)) {
+                return pages_t({1}, {*this});
+            }
+
+            pages_t pages(std::begin(info_.dims()), std::next(std::begin(info_.dims()), size(info_) - page_size));
+
+            for (auto indexer = typename pages_t::indexer_type(pages.info()); indexer; ++indexer) {
+                const auto& subs = indexer.subs();
+                auto page = *this;
+                for (size_type axis = 0; axis < size(info_) - page_size; ++axis) {
+                    page = page[boundary_type::at(subs[axis])];
+                }
+
+                pages[*indexer] = page;
+            }
+
+            return pages;
+        }
+
+        [[nodiscard]] constexpr auto book(bool ignore_creators = false) const
+            requires(!this_type::is_flat)
+        {
+            if (empty()) {
+                return value_type{};
+            }
+
+            if (!ignore_creators) {
+                bool all_pages_source_known = std::all_of(cbegin(), cend(), [](const auto& page) {
+                    return page.creator() != nullptr;
+                });
+
+                bool all_pages_from_same_source = std::adjacent_find(cbegin(), cend(),
+                                                      [](const auto& page1, const auto& page2) {
+                                                          return page1.creator() != page2.creator();
+                                                      })
+                    == cend();
+
+                if (all_pages_source_known && all_pages_from_same_source) {
+                    return *((*this)(0).creator());
+                }
+            }
+
+            bool all_pages_with_same_dimes
+                = std::adjacent_find(cbegin(), cend(),
+                      [](const auto& page1, const auto& page2) {
+                          return !std::equal(page1.info().dims().cbegin(), page1.info().dims().cend(),
+                              page2.info().dims().cbegin(), page2.info().dims().cend());
+                      })
+                == cend();
+
+            if (!all_pages_with_same_dimes) {
+                throw std::exception("unable to book pages with different dims");
+            }
+
+            size_type this_size = size(info_);
+            size_type page_size = size((*this)(0).info());
+
+            const auto& this_dims = info_.dims();
+            const auto& page_dims = (*this)(0).info().dims();
+
+            typename info_type::extent_storage_type new_dims(this_size + page_size);
+            std::copy(std::begin(this_dims), std::end(this_dims), std::begin(new_dims));
+            std::copy(std::begin(page_dims), std::end(page_dims), std::next(std::begin(new_dims), this_size));
+
+            value_type res(new_dims);
+            auto res_it = res.begin();
+
+            for (const auto& page : *this) {
+                for (auto page_it = page.begin(); page_it != page.end() && res_it != res.end(); ++page_it, ++res_it) {
+                    *res_it = *page_it;
+                }
+            }
+
+            return res;
+        }
+
+        template <iterator_of_type_integral AxesIt>
+        [[nodiscard]] constexpr auto split(AxesIt first_axis, AxesIt last_axis, size_type division) const
+        {
+            using split_t = replaced_type<this_type>;
+
+            if (empty()) {
+                return split_t{};
+            }
+
+            if (!std::is_sorted(first_axis, last_axis)) {
+                throw std::invalid_argument("invalid axes - not sorted");
+            }
+
+            if (std::adjacent_find(first_axis, last_axis) != last_axis) {
+                throw std::invalid_argument("invalid axes - not unique");
+            }
+
+            if (std::distance(first_axis, last_axis) < 0
+                || std::distance(first_axis, last_axis) > info_.dims().size()) {
+                throw std::invalid_argument("invalid number of axes");
+            }
+
+            if (std::any_of(first_axis, last_axis, [&](auto axis) {
+                    return axis < 0 || axis >= size(info_);
+                })) {
+                throw std::invalid_argument("invalid axes for dims");
+            }
+
+            if (std::any_of(std::begin(info_.dims()), std::end(info_.dims()), [division](auto dim) {
+                    return division <= 0 || division > dim;
+                })) {
+                throw std::invalid_argument("invalid division");
+            }
+
+            // calculate dimensions according to number of slices in each dimension
+
+            typename info_type::extent_storage_type new_dims(size(info_));
+            if (std::distance(first_axis, last_axis) == 0) {
+                std::fill(std::begin(new_dims), std::end(new_dims), division);
+            } else {
+                std::fill(std::begin(new_dims), std::end(new_dims), 1);
+                std::for_each(first_axis, last_axis, [&new_dims, division](auto axis) {
+                    new_dims[axis] = division;
+                });
+            }
+
+            // --------------------------------------------------------------------
+
+            split_t slices(new_dims);
+            auto slices_it = slices.begin();
+            size_type actual_num_slices = 0;
+
+            std::function<void(this_type, size_type)> split_impl;
+
+            split_impl = [&](this_type arr, size_type current_depth) -> void {
+                if (arr.empty()) {
+                    return;
+                }
+
+                if (current_depth == 0) {
+                    *slices_it = arr;
+                    ++slices_it;
+                    ++actual_num_slices;
+                    return;
+                }
+
+                if (std::distance(first_axis, last_axis) > 0
+                    && std::find(first_axis, last_axis, size(arr.info()) - current_depth) == last_axis) {
+                    split_impl(arr(boundary_type::full(), size(arr.info()) - current_depth), current_depth - 1);
+                    return;
+                }
+
+                auto exp = arr.expand(size(arr.info()) - current_depth, division);
+                for (auto value : exp) {
+                    split_impl(value, current_depth - 1);
+                }
+            };
+
+            split_impl(*this, size(info_));
+
+            assert(actual_num_slices == total(slices.info()));
+
+            return slices;
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto split(const Cont& axes, size_type division) const
+        {
+            return split(std::begin(axes), std::end(axes), division);
+        }
+        [[nodiscard]] constexpr auto split(std::initializer_list<size_type> axes, size_type division) const
+        {
+            return split(axes.begin(), axes.end(), division);
+        }
+
+        template <iterator_of_type_integral AxesIt, iterator_of_type_integral IndsIt>
+        [[nodiscard]] constexpr auto split(AxesIt first_axis, AxesIt last_axis, IndsIt first_ind, IndsIt last_ind) const
+        {
+            using split_t = replaced_type<this_type>;
+
+            if (empty()) {
+                return split_t{};
+            }
+
+            if (!std::is_sorted(first_ind, last_ind)) {
+                throw std::invalid_argument("invalid indices - not sorted");
+            }
+
+            if (std::adjacent_find(first_ind, last_ind) != last_ind) {
+                throw std::invalid_argument("invalid indices - not unique");
+            }
+
+            if (!std::is_sorted(first_axis, last_axis)) {
+                throw std::invalid_argument("invalid axes - not sorted");
+            }
+
+            if (std::adjacent_find(first_axis, last_axis) != last_axis) {
+                throw std::invalid_argument("invalid axes - not unique");
+            }
+
+            if (std::distance(first_axis, last_axis) < 0
+                || std::distance(first_axis, last_axis) > info_.dims().size()) {
+                throw std::invalid_argument("invalid number of axes");
+            }
+
+            if (std::any_of(first_axis, last_axis, [&](auto axis) {
+                    return axis < 0 || axis >= size(info_);
+                })) {
+                throw std::invalid_argument("invalid axes for dims");
+            }
+
+            // calculate dimensions according to number of slices in each dimension
+
+            typename info_type::extent_storage_type new_dims(info_.dims().size());
+            std::fill(new_dims.begin(), new_dims.end(), 1);
+            auto calc_num_slices_at_dim = [&](auto indf, auto indl) {
+                if (*indf == 0) {
+                    return std::distance(indf, indl);
+                }
+                return std::distance(indf, indl) + 1;
+            };
+            if (std::distance(first_axis, last_axis) == 0) {
+                std::for_each(new_dims.begin(), new_dims.end(), [&](size_type& d) {
+                    d = calc_num_slices_at_dim(first_ind, last_ind);
+                });
+            } else {
+                std::for_each(first_axis, last_axis, [&](size_type axis) {
+                    new_dims[axis] = calc_num_slices_at_dim(first_ind, last_ind);
+                });
+            }
+
+            // --------------------------------------------------------------------
+
+            split_t slices(new_dims);
+            auto slices_it = slices.begin();
+            size_type actual_num_slices = 0;
+
+            std::function<void(this_type, size_type)> split_impl;
+
+            split_impl = [&](this_type arr, size_type current_depth) -> void {
+                if (arr.empty()) {
+                    return;
+                }
+
+                if (current_depth == 0) {
+                    *slices_it = arr;
+                    ++slices_it;
+                    ++actual_num_slices;
+                    return;
+                }
+
+                if (std::distance(first_axis, last_axis) > 0
+                    && std::find(first_axis, last_axis, size(arr.info()) - current_depth) == last_axis) {
+                    split_impl(arr(boundary_type::full(), size(arr.info()) - current_depth), current_depth - 1);
+                    return;
+                }
+
+                size_type current_dim = arr.info().dims()[size(arr.info()) - current_depth];
+
+                if (std::distance(first_ind, last_ind) <= 0 || std::distance(first_ind, last_ind) > current_dim) {
+                    throw std::invalid_argument("invalid number of indices");
+                }
+                if (std::any_of(first_ind, last_ind, [current_dim](size_type ind) {
+                        return ind < 0 || ind >= current_dim;
+                    })) {
+                    throw std::invalid_argument("invalid indices for dims");
+                }
+
+                size_type prev_ind = *first_ind;
+                auto ind_it = first_ind;
+                ++ind_it;
+                if (prev_ind > 0) {
+                    split_impl(arr(boundary_type{0, prev_ind}, size(arr.info()) - current_depth), current_depth - 1);
+                }
+                size_type current_ind = prev_ind;
+                for (; ind_it != last_ind; ++ind_it) {
+                    current_ind = *ind_it;
+                    if (prev_ind < current_ind) {
+                        split_impl(arr(boundary_type{prev_ind, current_ind}, size(arr.info()) - current_depth),
+                            current_depth - 1);
+                    }
+                    prev_ind = current_ind;
+                }
+                if (current_ind < current_dim) {
+                    split_impl(arr(boundary_type{current_ind, current_dim}, size(arr.info()) - current_depth),
+                        current_depth - 1);
+                }
+            };
+
+            split_impl(*this, size(info_));
+
+            assert(actual_num_slices == total(slices.info()));
+
+            return slices;
+        }
+
+        template <iterable_of_type_integral AxesCont, iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto split(const AxesCont& axes, const Cont& inds) const
+        {
+            return split(std::begin(axes), std::end(axes), std::begin(inds), std::end(inds));
+        }
+
+        [[nodiscard]] constexpr auto split(
+            std::initializer_list<size_type> axes, std::initializer_list<size_type> inds) const
+        {
+            return split(axes.begin(), axes.end(), inds.begin(), inds.end());
+        }
+
+        template <iterator_of_type_integral AxesIt, iterator_of_type_integral IndsIt>
+        [[nodiscard]] constexpr auto exclude(
+            AxesIt first_axis, AxesIt last_axis, IndsIt first_ind, IndsIt last_ind) const
+        {
+            using exclude_t = replaced_type<this_type>;
+
+            if (empty()) {
+                return exclude_t();
+            }
+
+            if (!std::is_sorted(first_ind, last_ind)) {
+                throw std::invalid_argument("invalid indices - not sorted");
+            }
+
+            if (std::adjacent_find(first_ind, last_ind) != last_ind) {
+                throw std::invalid_argument("invalid indices - not unique");
+            }
+
+            if (!std::is_sorted(first_axis, last_axis)) {
+                throw std::invalid_argument("invalid axes - not sorted");
+            }
+
+            if (std::adjacent_find(first_axis, last_axis) != last_axis) {
+                throw std::invalid_argument("invalid axes - not unique");
+            }
+
+            if (std::distance(first_axis, last_axis) < 0
+                || std::distance(first_axis, last_axis) > info_.dims().size()) {
+                throw std::invalid_argument("invalid number of axes");
+            }
+
+            if (std::any_of(first_axis, last_axis, [&](auto axis) {
+                    return axis < 0 || axis >= size(info_);
+                })) {
+                throw std::invalid_argument("invalid axes for dims");
+            }
+
+            // calculate dimensions according to number of slices in each dimension
+
+            auto calc_num_slices_at_dim = [](auto indf, auto indl, size_type dim) {
+                size_type num_slices = 0;
+                size_type prev = *indf;
+                if (prev > 0) {
+                    ++num_slices;
+                }
+                ++indf;
+                size_type current_ind = prev;
+                for (auto it = indf; it != indl; ++it) {
+                    current_ind = *it;
+                    if (prev < current_ind + 1) {
+                        ++num_slices;
+                    }
+                    prev = current_ind;
+                }
+                if (current_ind + 1 < dim) {
+                    ++num_slices;
+                }
+                return num_slices;
+            };
+
+            typename info_type::extent_storage_type new_dims(size(info_), 1);
+            if (std::distance(first_axis, last_axis) == 0) {
+                std::transform(std::begin(info_.dims()), std::end(info_.dims()), std::begin(new_dims), [&](auto dim) {
+                    return calc_num_slices_at_dim(first_ind, last_ind, dim);
+                });
+            } else {
+                std::for_each(first_axis, last_axis, [&](auto axis) {
+                    new_dims[axis] = calc_num_slices_at_dim(first_ind, last_ind, info_.dims()[axis]);
+                });
+            }
+
+            // --------------------------------------------------------------------
+
+            exclude_t slices(new_dims);
+            auto slices_it = slices.begin();
+            size_type actual_num_slices = 0;
+
+            std::function<void(this_type, size_type)> exclude_impl;
+
+            exclude_impl = [&](this_type arr, size_type current_depth) -> void {
+                if (arr.empty()) {
+                    return;
+                }
+
+                if (current_depth == 0) {
+                    *slices_it = arr;
+                    ++slices_it;
+                    ++actual_num_slices;
+
+                    return;
+                }
+
+                if (std::distance(first_axis, last_axis) > 0
+                    && std::find(first_axis, last_axis, size(arr.info()) - current_depth) == last_axis) {
+                    exclude_impl(arr(boundary_type::full(), size(arr.info()) - current_depth), current_depth - 1);
+                    return;
+                }
+
+                size_type current_dim = arr.info().dims()[size(arr.info()) - current_depth];
+
+                if (std::distance(first_ind, last_ind) <= 0 || std::distance(first_ind, last_ind) > current_dim) {
+                    throw std::invalid_argument("invalid number of indices");
+                }
+                if (std::any_of(first_ind, last_ind, [current_dim](size_type ind) {
+                        return ind < 0 || ind >= current_dim;
+                    })) {
+                    throw std::invalid_argument("invalid indices for dims");
+                }
+
+                size_type prev_ind = *first_ind;
+                auto ind_it = first_ind;
+                ++ind_it;
+                if (prev_ind > 0) {
+                    exclude_impl(arr(boundary_type{0, prev_ind}, size(arr.info()) - current_depth), current_depth - 1);
+                }
+                size_type current_ind = prev_ind;
+                for (; ind_it != last_ind; ++ind_it) {
+                    current_ind = *ind_it;
+                    if (prev_ind + 1 < current_ind) {
+                        exclude_impl(arr(boundary_type{prev_ind + 1, current_ind}, size(arr.info()) - current_depth),
+                            current_depth - 1);
+                    }
+                    prev_ind = current_ind;
+                }
+                if (current_ind + 1 < current_dim) {
+                    exclude_impl(arr(boundary_type{current_ind + 1, current_dim}, size(arr.info()) - current_depth),
+                        current_depth - 1);
+                }
+            };
+
+            exclude_impl(*this, size(info_));
+
+            assert(actual_num_slices == total(slices.info()));
+
+            return slices;
+        }
+
+        template <iterable_of_type_integral AxesCont, iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto exclude(const AxesCont& axes, const Cont& inds) const
+        {
+            return exclude(std::begin(axes), std::end(axes), std::begin(inds), std::end(inds));
+        }
+
+        [[nodiscard]] constexpr auto exclude(
+            std::initializer_list<size_type> axes, std::initializer_list<size_type> inds) const
+        {
+            return exclude(axes.begin(), axes.end(), inds.begin(), inds.end());
+        }
+
+        [[nodiscard]] constexpr auto merge() const
+            requires(!this_type::is_flat)
+        {
+            if (empty()) {
+                return value_type{};
+            }
+
+            this_type res = clone().reduce<0>(size(info_) - 1, [&](value_type a, value_type b) {
+                return a.push_back(b, size(info_) - 1);
+            });
+
+            for (difference_type axis = size(info_) - 2; axis >= 0; --axis) {
+                res = res.reduce<0>(axis, [axis](value_type a, value_type b) {
+                    return a.push_back(b, axis);
+                });
+            }
+
+            assert(total(res.info()) == 1);
+
+            return res(0);
+        }
+
+        [[nodiscard]] constexpr this_type squeeze(arrnd_squeeze_type type = arrnd_squeeze_type::full) const
+        {
+            this_type squeezed = *this;
+            squeezed.info_ = oc::arrnd::squeeze(info_, type);
+
+            return squeezed;
+        }
+
+        template <typename Comp>
+        constexpr this_type& sort(Comp comp)
+        {
+            std::sort(begin(), end(), [&comp](const auto& lhs, const auto& rhs) {
+                return comp(lhs, rhs);
+            });
+
+            return *this;
+        }
+
+        template <typename Comp>
+        [[nodiscard]] constexpr this_type& sort(size_type axis, Comp&& comp)
+        {
+            if (empty()) {
+                return *this;
+            }
+
+            if (axis < 0 || axis >= size(info_)) {
+                throw std::invalid_argument("invalid axis");
+            }
+
+            auto sorted_tmp = expand(axis).sort(std::forward<Comp>(comp)).collapse(true);
+            std::copy(sorted_tmp.cbegin(), sorted_tmp.cend(), begin());
+
+            return *this;
+        }
+
+        template <typename Comp>
+        [[nodiscard]] constexpr bool is_sorted(Comp comp) const
+        {
+            if (empty()) {
+                return true;
+            }
+
+            return std::is_sorted(cbegin(), cend(), [&comp](const auto& lhs, const auto& rhs) {
+                return comp(lhs, rhs);
+            });
+        }
+
+        template <typename Comp>
+        [[nodiscard]] constexpr bool is_sorted(size_type axis, Comp&& comp) const
+        {
+            if (empty()) {
+                return true;
+            }
+
+            if (axis < 0 || axis >= size(info_)) {
+                throw std::invalid_argument("invalid axis");
+            }
+
+            return expand(axis).is_sorted(std::forward<Comp>(comp));
+        }
+
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr this_type& reorder(InputIt first_order, InputIt last_order)
+        {
+            if (empty()) {
+                return *this;
+            }
+
+            if (std::distance(first_order, last_order) != total(info_)) {
+                throw std::invalid_argument("invalid order - different from total elements");
+            }
+
+            typename info_type::extent_storage_type order(first_order, last_order);
+
+            auto z = zip(zipped(order), zipped(*this));
+            std::sort(z.begin(), z.end(), [](const auto& t1, const auto& t2) {
+                return std::get<0>(t1) < std::get<0>(t2);
+            });
+
+            return *this;
+        }
+
+        template <iterable_of_type_integral Cont>
+        constexpr this_type& reorder(const Cont& order)
+        {
+            return reorder(std::begin(order), std::end(order));
+        }
+
+        constexpr this_type& reorder(std::initializer_list<size_type> order)
+        {
+            return reorder(order.begin(), order.end());
+        }
+
+        template <iterator_of_type_integral InputIt>
+        constexpr this_type& reorder(size_type axis, InputIt first_order, InputIt last_order)
+        {
+            if (empty()) {
+                return *this;
+            }
+
+            if (axis < 0 || axis >= size(info_)) {
+                throw std::invalid_argument("invalid axis");
+            }
+
+            if (std::distance(first_order, last_order) != info_.dims()[axis]) {
+                throw std::invalid_argument("invalid order - different from total elements at axis");
+            }
+
+            typename info_type::extent_storage_type order(first_order, last_order);
+
+            auto expanded = expand(axis);
+
+            auto z = zip(zipped(order), zipped(expanded));
+            std::sort(z.begin(), z.end(), [](const auto& t1, const auto& t2) {
+                return std::get<0>(t1) < std::get<0>(t2);
+            });
+
+            auto sorted_tmp = expanded.collapse(true);
+            std::copy(sorted_tmp.cbegin(), sorted_tmp.cend(), begin());
+
+            return *this;
+        }
+
+        template <iterable_of_type_integral Cont>
+        constexpr this_type& reorder(size_type axis, const Cont& order)
+        {
+            return reorder(axis, std::begin(order), std::end(order));
+        }
+
+        constexpr this_type& reorder(size_type axis, std::initializer_list<size_type> order)
+        {
+            return reorder(axis, order.begin(), order.end());
+        }
+
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto adjacent_indices(InputIt first_sub, InputIt last_sub, size_type offset = 1) const
+        {
+            using adjacent_indices_t = replaced_type<size_type>;
+
+            if (empty()) {
+                return adjacent_indices_t{};
+            }
+
+            if (std::distance(first_sub, last_sub) != size(info_)) {
+                throw std::invalid_argument("invalid number of subs");
+            }
+
+            if (offset <= 0) {
+                throw std::invalid_argument("invalid offset <= 0");
+            }
+
+            auto signed_offset = static_cast<difference_type>(offset);
+
+            auto compute_num_adj = [](difference_type ndims, difference_type soffset) {
+                difference_type base1 = 3 + 2 * (soffset - 1);
+                difference_type base2 = 3 + 2 * (soffset - 2);
+                return static_cast<size_type>(std::pow(base1, ndims) - std::pow(base2, ndims));
+            };
+
+            adjacent_indices_t res({compute_num_adj(static_cast<difference_type>(size(info_)), signed_offset)});
+            size_type actual_num_adj = 0;
+
+            std::function<void(adjacent_indices_t, size_type, bool)> impl;
+
+            impl = [&](adjacent_indices_t subs, size_type perm_pos, bool used_offset) {
+                if (perm_pos == size(info_)) {
+                    return;
+                }
+
+                for (difference_type i = -signed_offset; i <= signed_offset; ++i) {
+                    size_type abs_i = static_cast<size_type>(std::abs(i));
+
+                    if (abs_i > 0 && abs_i <= signed_offset) {
+                        auto new_subs = subs.clone();
+                        new_subs[perm_pos] += i;
+                        if (new_subs[perm_pos] >= 0 && new_subs[perm_pos] < info_.dims()[perm_pos]) {
+                            if (used_offset || abs_i == signed_offset) {
+                                res[actual_num_adj++] = sub2ind(info_, new_subs.cbegin(), new_subs.cend());
+                            }
+                            impl(new_subs, perm_pos + 1, abs_i == signed_offset);
+                        }
+                    } else {
+                        impl(subs, perm_pos + 1, used_offset);
+                    }
+                }
+            };
+
+            std::initializer_list<size_type> res_dims{static_cast<size_type>(std::distance(first_sub, last_sub))};
+            impl(adjacent_indices_t(res_dims.begin(), res_dims.end(), first_sub, last_sub), 0, false);
+
+            if (total(res.info()) > actual_num_adj) {
+                return res.resize({actual_num_adj});
+            }
+            return res;
+        }
+
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto adjacent_indices(const Cont& subs, difference_type offset = 1) const
+        {
+            return adjacent_indices(std::begin(subs), std::end(subs), offset);
+        }
+        [[nodiscard]] constexpr auto adjacent_indices(
+            std::initializer_list<size_type> subs, difference_type offset = 1) const
+        {
+            return adjacent_indices(subs.begin(), subs.end(), offset);
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename Pred>
+        [[nodiscard]] constexpr bool all(Pred&& pred) const
+        {
+            if (empty()) {
+                return true;
+            }
+
+            for (auto inner : *this) {
+                if constexpr (AtDepth == 0) {
+                    if (!pred(inner)) {
+                        return false;
+                    }
+                } else {
+                    if (!inner.template all<AtDepth - 1, Pred>(std::forward<Pred>(pred))) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        template <std::size_t AtDepth = this_type::depth>
+        [[nodiscard]] constexpr bool all() const
+        {
+            return all<AtDepth>([](const auto& value) {
+                return static_cast<bool>(value);
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryPred>
+        [[nodiscard]] constexpr bool all_match(const Arrnd& arr, BinaryPred&& pred) const
+        {
+            if (empty() && arr.empty()) {
+                return true;
+            }
+
+            if (empty() || arr.empty()) {
+                return false;
+            }
+
+            if (!std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(arr.info().dims()),
+                    std::end(arr.info().dims()))) {
+                return false;
+            }
+
+            for (auto inners : zip(zipped(*this), zipped(arr))) {
+                if constexpr (AtDepth == 0) {
+                    if (!pred(std::get<0>(inners), std::get<1>(inners))) {
+                        return false;
+                    }
+                } else {
+                    if (!std::get<0>(inners).template all_match<AtDepth - 1, typename Arrnd::value_type, BinaryPred>(
+                            std::get<1>(inners), std::forward<BinaryPred>(pred))) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd>
+        [[nodiscard]] constexpr bool all_match(const Arrnd& arr) const
+        {
+            return all_match<AtDepth, Arrnd>(arr, [](const auto& a, const auto& b) {
+                if constexpr (arrnd_type<decltype(a)> && arrnd_type<decltype(b)>) {
+                    return (a == b).template all<this_type::depth>();
+                } else {
+                    return a == b;
+                }
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryPred>
+            requires(!arrnd_type<U>)
+        [[nodiscard]] constexpr bool all_match(const U& u, BinaryPred pred) const
+        {
+            return all<AtDepth>([&u, &pred](const auto& a) {
+                return pred(a, u);
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename U>
+            requires(!arrnd_type<U>)
+        [[nodiscard]] constexpr bool all_match(const U& u) const
+        {
+            return all<AtDepth>([&u](const auto& a) {
+                if constexpr (arrnd_type<decltype(a)>) {
+                    return (a == u).template all<this_type::depth>();
+                } else {
+                    return a == u;
+                }
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename Pred>
+        [[nodiscard]] constexpr bool any(Pred&& pred) const
+        {
+            if (empty()) {
+                return true;
+            }
+
+            for (auto inner : *this) {
+                if constexpr (AtDepth == 0) {
+                    if (pred(inner)) {
+                        return true;
+                    }
+                } else {
+                    if (inner.template any<AtDepth - 1, Pred>(std::forward<Pred>(pred))) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        template <std::size_t AtDepth = this_type::depth>
+        [[nodiscard]] constexpr bool any() const
+        {
+            return any<AtDepth>([](const auto& value) {
+                return static_cast<bool>(value);
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd, typename BinaryPred>
+        [[nodiscard]] constexpr bool any_match(const Arrnd& arr, BinaryPred&& pred) const
+        {
+            if (empty() && arr.empty()) {
+                return true;
+            }
+
+            if (empty() || arr.empty()) {
+                return false;
+            }
+
+            if (!std::equal(std::begin(info_.dims()), std::end(info_.dims()), std::begin(arr.info().dims()),
+                    std::end(arr.info().dims()))) {
+                return false;
+            }
+
+            for (auto inners : zip(zipped(*this), zipped(arr))) {
+                if constexpr (AtDepth == 0) {
+                    if (pred(std::get<0>(inners), std::get<1>(inners))) {
+                        return true;
+                    }
+                } else {
+                    if (std::get<0>(inners).template any_match<AtDepth - 1, typename Arrnd::value_type, BinaryPred>(
+                            std::get<1>(inners), std::forward<BinaryPred>(pred))) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        template <std::size_t AtDepth = this_type::depth, arrnd_type Arrnd>
+        [[nodiscard]] constexpr bool any_match(const Arrnd& arr) const
+        {
+            return any_match<AtDepth, Arrnd>(arr, [](const auto& a, const auto& b) {
+                if constexpr (arrnd_type<decltype(a)> && arrnd_type<decltype(b)>) {
+                    return (a == b).template any<this_type::depth>();
+                } else {
+                    return a == b;
+                }
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename U, typename BinaryPred>
+            requires(!arrnd_type<U>)
+        [[nodiscard]] constexpr bool any_match(const U& u, BinaryPred pred) const
+        {
+            return any<AtDepth>([&u, &pred](const auto& a) {
+                return pred(a, u);
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename U>
+            requires(!arrnd_type<U>)
+        [[nodiscard]] constexpr bool any_match(const U& u) const
+        {
+            return any<AtDepth>([&u](const auto& a) {
+                if constexpr (arrnd_type<decltype(a)>) {
+                    return (a == u).template any<this_type::depth>();
+                } else {
+                    return a == u;
+                }
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename Pred>
+        [[nodiscard]] constexpr replaced_type<bool> all(size_type axis, Pred pred) const
+        {
+            return reduce<AtDepth>(axis, [&pred](const auto& a, const auto& b) {
+                return a && pred(b);
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth>
+        [[nodiscard]] constexpr replaced_type<bool> all(size_type axis) const
+        {
+            return all(axis, [](const auto& a) {
+                return a;
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth, typename Pred>
+        [[nodiscard]] constexpr replaced_type<bool> any(size_type axis, Pred pred) const
+        {
+            return reduce<AtDepth>(axis, [&pred](const auto& a, const auto& b) {
+                return a || pred(b);
+            });
+        }
+
+        template <std::size_t AtDepth = this_type::depth>
+        [[nodiscard]] constexpr replaced_type<bool> any(size_type axis) const
+        {
+            return any(axis, [](const auto& a) {
+                return a;
+            });
+        }
+
+        [[nodiscard]] constexpr auto begin()
+        {
+            return begin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto begin() const
+        {
+            return begin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto cbegin() const
+        {
+            return cbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+
+        [[nodiscard]] constexpr auto end()
+        {
+            return end(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto end() const
+        {
+            return end(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto cend() const
+        {
+            return cend(0, arrnd_returned_element_iterator_tag{});
+        }
+
+        [[nodiscard]] constexpr auto rbegin()
+        {
+            return rbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto rbegin() const
+        {
+            return rbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto crbegin() const
+        {
+            return crbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+
+        [[nodiscard]] constexpr auto rend()
+        {
+            return rend(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto rend() const
+        {
+            return rend(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto crend() const
+        {
+            return crend(0, arrnd_returned_element_iterator_tag{});
+        }
+
+        [[nodiscard]] constexpr auto begin(arrnd_returned_element_iterator_tag)
+        {
+            return begin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto begin(arrnd_returned_element_iterator_tag) const
+        {
+            return begin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto cbegin(arrnd_returned_element_iterator_tag) const
+        {
+            return cbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto end(arrnd_returned_element_iterator_tag)
+        {
+            return end(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto end(arrnd_returned_element_iterator_tag) const
+        {
+            return end(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto cend(arrnd_returned_element_iterator_tag) const
+        {
+            return cend(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto rbegin(arrnd_returned_element_iterator_tag)
+        {
+            return rbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto rbegin(arrnd_returned_element_iterator_tag) const
+        {
+            return rbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto crbegin(arrnd_returned_element_iterator_tag) const
+        {
+            return crbegin(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto rend(arrnd_returned_element_iterator_tag)
+        {
+            return rend(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto rend(arrnd_returned_element_iterator_tag) const
+        {
+            return rend(0, arrnd_returned_element_iterator_tag{});
+        }
+        [[nodiscard]] constexpr auto crend(arrnd_returned_element_iterator_tag) const
+        {
+            return crend(0, arrnd_returned_element_iterator_tag{});
+        }
+
+        // by axis iterator functions
+
+        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_element_iterator_tag)
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::begin));
+        }
+        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::begin));
+        }
         [[nodiscard]] constexpr auto cbegin(size_type axis, arrnd_returned_element_iterator_tag) const
         {
-            return empty() ? const_iterator()
-                           : const_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::begin));
+            return empty() ? const_iterator()
+                           : const_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::begin));
+        }
+        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_element_iterator_tag)
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::end));
+        }
+        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::end));
+        }
+        [[nodiscard]] constexpr auto cend(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty() ? const_iterator()
+                           : const_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::end));
+        }
+        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_element_iterator_tag)
+        {
+            return empty() ? reverse_iterator()
+                           : reverse_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rbegin));
+        }
+        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty() ? reverse_iterator()
+                           : reverse_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rbegin));
+        }
+        [[nodiscard]] constexpr auto crbegin(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty() ? const_reverse_iterator()
+                           : const_reverse_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rbegin));
+        }
+        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_element_iterator_tag)
+        {
+            return empty() ? reverse_iterator()
+                           : reverse_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rend));
+        }
+        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty() ? reverse_iterator()
+                           : reverse_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rend));
+        }
+        [[nodiscard]] constexpr auto crend(size_type axis, arrnd_returned_element_iterator_tag) const
+        {
+            return empty() ? const_reverse_iterator()
+                           : const_reverse_iterator(shared_storage_->data(),
+                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rend));
+        }
+
+        // by order iterator functions
+
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto begin(InputIt first_order, InputIt last_order)
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(), indexer_type(oc::arrnd::transpose(info_, first_order, last_order)));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto begin(InputIt first_order, InputIt last_order) const
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(), indexer_type(oc::arrnd::transpose(info_, first_order, last_order)));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto cbegin(InputIt first_order, InputIt last_order) const
+        {
+            return empty() ? const_iterator()
+                           : const_iterator(shared_storage_->data(),
+                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order)));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto end(InputIt first_order, InputIt last_order)
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(),
+                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::end));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto end(InputIt first_order, InputIt last_order) const
+        {
+            return empty()
+                ? iterator()
+                : iterator(shared_storage_->data(),
+                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::end));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto cend(InputIt first_order, InputIt last_order) const
+        {
+            return empty()
+                ? const_iterator()
+                : const_iterator(shared_storage_->data(),
+                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::end));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto rbegin(InputIt first_order, InputIt last_order)
+        {
+            return empty() ? reverse_iterator()
+                           : reverse_iterator(shared_storage_->data(),
+                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order),
+                                   arrnd_iterator_position::rbegin));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto rbegin(InputIt first_order, InputIt last_order) const
+        {
+            return empty() ? reverse_iterator()
+                           : reverse_iterator(shared_storage_->data(),
+                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order),
+                                   arrnd_iterator_position::rbegin));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto crbegin(InputIt first_order, InputIt last_order) const
+        {
+            return empty() ? const_reverse_iterator()
+                           : const_reverse_iterator(shared_storage_->data(),
+                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order),
+                                   arrnd_iterator_position::rbegin));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto rend(InputIt first_order, InputIt last_order)
+        {
+            return empty()
+                ? reverse_iterator()
+                : reverse_iterator(shared_storage_->data(),
+                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::rend));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto rend(InputIt first_order, InputIt last_order) const
+        {
+            return empty()
+                ? reverse_iterator()
+                : reverse_iterator(shared_storage_->data(),
+                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::rend));
+        }
+        template <iterator_of_type_integral InputIt>
+        [[nodiscard]] constexpr auto crend(InputIt first_order, InputIt last_order) const
+        {
+            return empty()
+                ? const_reverse_iterator()
+                : const_reverse_iterator(shared_storage_->data(),
+                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::rend));
+        }
+
+        [[nodiscard]] constexpr auto begin(std::initializer_list<size_type> order)
+        {
+            return begin(order.begin(), order.end());
+        }
+        [[nodiscard]] constexpr auto begin(std::initializer_list<size_type> order) const
+        {
+            return begin(order.begin(), order.end());
+        }
+        [[nodiscard]] constexpr auto cbegin(std::initializer_list<size_type> order) const
+        {
+            return cbegin(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_element_iterator_tag)
+        [[nodiscard]] constexpr auto end(std::initializer_list<size_type> order)
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::end));
+            return end(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_element_iterator_tag) const
+        [[nodiscard]] constexpr auto end(std::initializer_list<size_type> order) const
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(), indexer_type(move(info_, axis, 0), arrnd_iterator_position::end));
+            return end(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto cend(size_type axis, arrnd_returned_element_iterator_tag) const
+        [[nodiscard]] constexpr auto cend(std::initializer_list<size_type> order) const
         {
-            return empty() ? const_iterator()
-                           : const_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::end));
+            return cend(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_element_iterator_tag)
+        [[nodiscard]] constexpr auto rbegin(std::initializer_list<size_type> order)
         {
-            return empty() ? reverse_iterator()
-                           : reverse_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rbegin));
+            return rbegin(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_element_iterator_tag) const
+        [[nodiscard]] constexpr auto rbegin(std::initializer_list<size_type> order) const
         {
-            return empty() ? reverse_iterator()
-                           : reverse_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rbegin));
+            return rbegin(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto crbegin(size_type axis, arrnd_returned_element_iterator_tag) const
+        [[nodiscard]] constexpr auto crbegin(std::initializer_list<size_type> order) const
         {
-            return empty() ? const_reverse_iterator()
-                           : const_reverse_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rbegin));
+            return crbegin(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_element_iterator_tag)
+        [[nodiscard]] constexpr auto rend(std::initializer_list<size_type> order)
         {
-            return empty() ? reverse_iterator()
-                           : reverse_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rend));
+            return rend(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_element_iterator_tag) const
+        [[nodiscard]] constexpr auto rend(std::initializer_list<size_type> order) const
         {
-            return empty() ? reverse_iterator()
-                           : reverse_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rend));
+            return rend(order.begin(), order.end());
         }
-        [[nodiscard]] constexpr auto crend(size_type axis, arrnd_returned_element_iterator_tag) const
+        [[nodiscard]] constexpr auto crend(std::initializer_list<size_type> order) const
         {
-            return empty() ? const_reverse_iterator()
-                           : const_reverse_iterator(shared_storage_->data(),
-                               indexer_type(move(info_, axis, 0), arrnd_iterator_position::rend));
+            return crend(order.begin(), order.end());
         }
 
-        // by order iterator functions
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto begin(const Cont& order)
+        {
+            return begin(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto begin(const Cont& order) const
+        {
+            return begin(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto cbegin(const Cont& order) const
+        {
+            return cbegin(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto end(const Cont& order)
+        {
+            return end(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto end(const Cont& order) const
+        {
+            return end(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto cend(const Cont& order) const
+        {
+            return cend(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto rbegin(const Cont& order)
+        {
+            return rbegin(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto rbegin(const Cont& order) const
+        {
+            return rbegin(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto crbegin(const Cont& order) const
+        {
+            return crbegin(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto rend(const Cont& order)
+        {
+            return rend(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto rend(const Cont& order) const
+        {
+            return rend(std::begin(order), std::end(order));
+        }
+        template <iterable_of_type_integral Cont>
+        [[nodiscard]] constexpr auto crend(const Cont& order) const
+        {
+            return crend(std::begin(order), std::end(order));
+        }
 
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto begin(InputIt first_order, InputIt last_order)
+        // slice iterator functions
+
+        [[nodiscard]] constexpr auto begin(arrnd_returned_slice_iterator_tag)
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(), indexer_type(oc::arrnd::transpose(info_, first_order, last_order)));
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
+                                   arrnd_iterator_position::begin));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto begin(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto begin(arrnd_returned_slice_iterator_tag) const
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(), indexer_type(oc::arrnd::transpose(info_, first_order, last_order)));
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
+                                   arrnd_iterator_position::begin));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto cbegin(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto cbegin(arrnd_returned_slice_iterator_tag) const
         {
-            return empty() ? const_iterator()
-                           : const_iterator(shared_storage_->data(),
-                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order)));
+            return empty() ? const_slice_iterator()
+                           : const_slice_iterator(*this,
+                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
+                                   arrnd_iterator_position::begin));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto end(InputIt first_order, InputIt last_order)
+        [[nodiscard]] constexpr auto end(arrnd_returned_slice_iterator_tag)
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(),
-                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::end));
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
+                                   arrnd_iterator_position::end));
+        }
+        [[nodiscard]] constexpr auto end(arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
+                                   arrnd_iterator_position::end));
+        }
+        [[nodiscard]] constexpr auto cend(arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? const_slice_iterator()
+                           : const_slice_iterator(*this,
+                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
+                                   arrnd_iterator_position::end));
+        }
+        [[nodiscard]] constexpr auto rbegin(arrnd_returned_slice_iterator_tag)
+        {
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, 0,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rbegin));
+        }
+        [[nodiscard]] constexpr auto rbegin(arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, 0,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rbegin));
+        }
+        [[nodiscard]] constexpr auto crbegin(arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? const_reverse_slice_iterator()
+                           : const_reverse_slice_iterator(*this,
+                               windows_slider_type(info_, 0,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rbegin));
+        }
+        [[nodiscard]] constexpr auto rend(arrnd_returned_slice_iterator_tag)
+        {
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, 0,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rend));
+        }
+        [[nodiscard]] constexpr auto rend(arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, 0,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rend));
+        }
+        [[nodiscard]] constexpr auto crend(arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? const_reverse_slice_iterator()
+                           : const_reverse_slice_iterator(*this,
+                               windows_slider_type(info_, 0,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rend));
+        }
+
+        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_slice_iterator_tag)
+        {
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::begin));
+        }
+        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::begin));
+        }
+        [[nodiscard]] constexpr auto cbegin(size_type axis, arrnd_returned_slice_iterator_tag) const
+        {
+            return empty() ? const_slice_iterator()
+                           : const_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::begin));
+        }
+        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_slice_iterator_tag)
+        {
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::end));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto end(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_slice_iterator_tag) const
         {
-            return empty()
-                ? iterator()
-                : iterator(shared_storage_->data(),
-                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::end));
+            return empty() ? slice_iterator()
+                           : slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::end));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto cend(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto cend(size_type axis, arrnd_returned_slice_iterator_tag) const
         {
-            return empty()
-                ? const_iterator()
-                : const_iterator(shared_storage_->data(),
-                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::end));
+            return empty() ? const_slice_iterator()
+                           : const_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::end));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto rbegin(InputIt first_order, InputIt last_order)
+        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_slice_iterator_tag)
         {
-            return empty() ? reverse_iterator()
-                           : reverse_iterator(shared_storage_->data(),
-                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order),
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
                                    arrnd_iterator_position::rbegin));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto rbegin(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_slice_iterator_tag) const
         {
-            return empty() ? reverse_iterator()
-                           : reverse_iterator(shared_storage_->data(),
-                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order),
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
                                    arrnd_iterator_position::rbegin));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto crbegin(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto crbegin(size_type axis, arrnd_returned_slice_iterator_tag) const
         {
-            return empty() ? const_reverse_iterator()
-                           : const_reverse_iterator(shared_storage_->data(),
-                               indexer_type(oc::arrnd::transpose(info_, first_order, last_order),
+            return empty() ? const_reverse_slice_iterator()
+                           : const_reverse_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
                                    arrnd_iterator_position::rbegin));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto rend(InputIt first_order, InputIt last_order)
+        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_slice_iterator_tag)
         {
-            return empty()
-                ? reverse_iterator()
-                : reverse_iterator(shared_storage_->data(),
-                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::rend));
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rend));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto rend(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_slice_iterator_tag) const
         {
-            return empty()
-                ? reverse_iterator()
-                : reverse_iterator(shared_storage_->data(),
-                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::rend));
+            return empty() ? reverse_slice_iterator()
+                           : reverse_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rend));
         }
-        template <iterator_of_type_integral InputIt>
-        [[nodiscard]] constexpr auto crend(InputIt first_order, InputIt last_order) const
+        [[nodiscard]] constexpr auto crend(size_type axis, arrnd_returned_slice_iterator_tag) const
         {
-            return empty()
-                ? const_reverse_iterator()
-                : const_reverse_iterator(shared_storage_->data(),
-                    indexer_type(oc::arrnd::transpose(info_, first_order, last_order), arrnd_iterator_position::rend));
+            return empty() ? const_reverse_slice_iterator()
+                           : const_reverse_slice_iterator(*this,
+                               windows_slider_type(info_, axis,
+                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
+                                   arrnd_iterator_position::rend));
+        }
+
+    private:
+        // the validity token is allocated lazily - by the first slice or copy of the array (copies share it).
+        // const arrays might be sliced and copied concurrently, therefore the token is published atomically.
+        struct creators_chain {
+#ifdef __cpp_lib_atomic_shared_ptr
+            using token_type = std::atomic<std::shared_ptr<bool>>;
+
+            [[nodiscard]] static std::shared_ptr<bool> load(const token_type& token) noexcept
+            {
+                return token.load();
+            }
+            static void store(token_type& token, std::shared_ptr<bool> value) noexcept
+            {
+                token.store(std::move(value));
+            }
+            [[nodiscard]] static std::shared_ptr<bool> take(token_type& token) noexcept
+            {
+                return token.exchange(nullptr);
+            }
+            static bool publish(token_type& token, std::shared_ptr<bool>& expected, std::shared_ptr<bool> value)
+            {
+                return token.compare_exchange_strong(expected, std::move(value));
+            }
+#else
+            using token_type = std::shared_ptr<bool>;
+
+            [[nodiscard]] static std::shared_ptr<bool> load(const token_type& token) noexcept
+            {
+                return std::atomic_load(&token);
+            }
+            static void store(token_type& token, std::shared_ptr<bool> value) noexcept
+            {
+                std::atomic_store(&token, std::move(value));
+            }
+            [[nodiscard]] static std::shared_ptr<bool> take(token_type& token) noexcept
+            {
+                return std::atomic_exchange(&token, std::shared_ptr<bool>{});
+            }
+            static bool publish(token_type& token, std::shared_ptr<bool>& expected, std::shared_ptr<bool> value)
+            {
+                return std::atomic_compare_exchange_strong(&token, &expected, std::move(value));
+            }
+#endif
+
+            creators_chain() = default;
+
+            creators_chain(const creators_chain& other)
+                : has_original_creator(other.token())
+                , is_creator_valid(other.is_creator_valid)
+                , latest_creator(other.latest_creator)
+            { }
+
+            creators_chain(creators_chain&& other) noexcept
+                : has_original_creator(take(other.has_original_creator))
+                , is_creator_valid(std::move(other.is_creator_valid))
+                , latest_creator(other.latest_creator)
+            { }
+
+            creators_chain& operator=(const creators_chain& other)
+            {
+                if (&other != this) {
+                    store(has_original_creator, other.token());
+                    is_creator_valid = other.is_creator_valid;
+                    latest_creator = other.latest_creator;
+                }
+                return *this;
+            }
+
+            creators_chain& operator=(creators_chain&& other) noexcept
+            {
+                if (&other != this) {
+                    store(has_original_creator, take(other.has_original_creator));
+                    is_creator_valid = std::move(other.is_creator_valid);
+                    latest_creator = other.latest_creator;
+                }
+                return *this;
+            }
+
+            // the token of the array, which is allocated if not exists yet
+            [[nodiscard]] std::shared_ptr<bool> token() const
+            {
+                auto res = load(has_original_creator);
+                if (!res) {
+                    auto new_token = std::allocate_shared<bool>(allocator_template_type<bool>());
+                    // in case of failure, res is the token that was published by another thread
+                    if (publish(has_original_creator, res, new_token)) {
+                        res = std::move(new_token);
+                    }
+                }
+                return res;
+            }
+
+            mutable token_type has_original_creator{};
+            std::weak_ptr<bool> is_creator_valid{};
+            const this_type* latest_creator = nullptr;
+        };
+
+        constexpr void link_creator(this_type& slice) const
+        {
+            slice.creators_.is_creator_valid = creators_.token();
+            slice.creators_.latest_creator = this;
         }
 
-        [[nodiscard]] constexpr auto begin(std::initializer_list<size_type> order)
-        {
-            return begin(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto begin(std::initializer_list<size_type> order) const
-        {
-            return begin(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto cbegin(std::initializer_list<size_type> order) const
-        {
-            return cbegin(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto end(std::initializer_list<size_type> order)
-        {
-            return end(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto end(std::initializer_list<size_type> order) const
-        {
-            return end(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto cend(std::initializer_list<size_type> order) const
-        {
-            return cend(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto rbegin(std::initializer_list<size_type> order)
-        {
-            return rbegin(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto rbegin(std::initializer_list<size_type> order) const
-        {
-            return rbegin(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto crbegin(std::initializer_list<size_type> order) const
-        {
-            return crbegin(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto rend(std::initializer_list<size_type> order)
-        {
-            return rend(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto rend(std::initializer_list<size_type> order) const
-        {
-            return rend(order.begin(), order.end());
-        }
-        [[nodiscard]] constexpr auto crend(std::initializer_list<size_type> order) const
-        {
-            return crend(order.begin(), order.end());
-        }
+        info_type info_{};
+        std::shared_ptr<storage_type> shared_storage_{nullptr};
+
+        creators_chain creators_{};
+    };
+
+    // arrnd type deduction by constructors
+
+    template <iterator_of_type_integral InputDimsIt, iterator_type InputDataIt,
+        typename DataStorageTraits = simple_vector_traits<iterator_value_t<InputDataIt>>,
+        typename ArrndInfo = arrnd_info<>>
+    arrnd(const InputDimsIt&, const InputDimsIt&, const InputDataIt&, const InputDataIt&)
+        -> arrnd<iterator_value_t<InputDataIt>, DataStorageTraits, ArrndInfo>;
+
+    template <iterator_of_type_integral InputDimsIt, typename U, typename DataStorageTraits = simple_vector_traits<U>,
+        typename ArrndInfo = arrnd_info<>>
+    arrnd(const InputDimsIt&, const InputDimsIt&, const U&) -> arrnd<U, DataStorageTraits, ArrndInfo>;
+    template <iterable_of_type_integral Cont, typename U, typename DataStorageTraits = simple_vector_traits<U>,
+        typename ArrndInfo = arrnd_info<>>
+    arrnd(const Cont&, const U&) -> arrnd<U, DataStorageTraits, ArrndInfo>;
+    template <typename U, typename DataStorageTraits = simple_vector_traits<U>, typename ArrndInfo = arrnd_info<>>
+    arrnd(std::initializer_list<typename DataStorageTraits::storage_type::size_type>, const U&)
+        -> arrnd<U, DataStorageTraits, ArrndInfo>;
+
+    template <typename U, typename DataStorageTraits = simple_vector_traits<U>, typename ArrndInfo = arrnd_info<>>
+    arrnd(std::initializer_list<typename DataStorageTraits::storage_type::size_type>, std::initializer_list<U>)
+        -> arrnd<U, DataStorageTraits, ArrndInfo>;
+
+    template <iterable_of_type_integral Cont, iterable_type DataCont,
+        typename DataStorageTraits = simple_vector_traits<iterable_value_t<DataCont>>,
+        typename ArrndInfo = arrnd_info<>>
+    arrnd(const Cont&, const DataCont&) -> arrnd<iterable_value_t<DataCont>, DataStorageTraits, ArrndInfo>;
+
+    template <typename Func, typename DataStorageTraits = simple_vector_traits<std::invoke_result_t<Func>>,
+        typename ArrndInfo = arrnd_info<>, iterator_of_type_integral InputDimsIt>
+        requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
+    arrnd(const InputDimsIt&, const InputDimsIt&, Func&&)
+        -> arrnd<std::invoke_result_t<Func>, DataStorageTraits, ArrndInfo>;
+    template <typename Func, typename DataStorageTraits = simple_vector_traits<std::invoke_result_t<Func>>,
+        typename ArrndInfo = arrnd_info<>, iterable_of_type_integral Cont>
+        requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
+    arrnd(const Cont&, Func&&) -> arrnd<std::invoke_result_t<Func>, DataStorageTraits, ArrndInfo>;
+    template <typename Func, typename DataStorageTraits = simple_vector_traits<std::invoke_result_t<Func>>,
+        typename ArrndInfo = arrnd_info<>>
+        requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
+    arrnd(std::initializer_list<typename DataStorageTraits::storage_type::size_type>, Func&&)
+        -> arrnd<std::invoke_result_t<Func>, DataStorageTraits, ArrndInfo>;
+
+    template <typename T, typename DataStorageTraits = simple_vector_traits<typename T::value_type>,
+        typename ArrndInfo = arrnd_info<>>
+    arrnd(const ArrndInfo&, std::shared_ptr<T>) -> arrnd<typename T::value_type, DataStorageTraits, ArrndInfo>;
+
+    // free arrnd iterator functions
+
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto begin(Arrnd& c, Args&&... args)
+    {
+        return c.begin(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto begin(const Arrnd& c, Args&&... args)
+    {
+        return c.begin(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto cbegin(const Arrnd& c, Args&&... args)
+    {
+        return c.cbegin(std::forward<Args>(args)...);
+    }
+
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto end(Arrnd& c, Args&&... args)
+    {
+        return c.end(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto end(const Arrnd& c, Args&&... args)
+    {
+        return c.end(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto cend(const Arrnd& c, Args&&... args)
+    {
+        return c.cend(std::forward<Args>(args)...);
+    }
+
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto rbegin(Arrnd& c, Args&&... args)
+    {
+        return c.rbegin(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto rbegin(const Arrnd& c, Args&&... args)
+    {
+        return c.rbegin(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto crbegin(const Arrnd& c, Args&&... args)
+    {
+        return c.crbegin(std::forward<Args>(args)...);
+    }
+
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto rend(Arrnd& c, Args&&... args)
+    {
+        return c.rend(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto rend(const Arrnd& c, Args&&... args)
+    {
+        return c.rend(std::forward<Args>(args)...);
+    }
+    template <arrnd_type Arrnd, typename... Args>
+    [[nodiscard]] inline constexpr auto crend(const Arrnd& c, Args&&... args)
+    {
+        return c.crend(std::forward<Args>(args)...);
+    }
+
+    template <arrnd_type First, arrnd_type Second>
+    [[nodiscard]] inline constexpr First concat(const First& first, const Second& second)
+    {
+        return first.clone().push_back(second);
+    }
 
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto begin(const Cont& order)
-        {
-            return begin(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto begin(const Cont& order) const
-        {
-            return begin(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto cbegin(const Cont& order) const
-        {
-            return cbegin(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto end(const Cont& order)
-        {
-            return end(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto end(const Cont& order) const
-        {
-            return end(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto cend(const Cont& order) const
-        {
-            return cend(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto rbegin(const Cont& order)
-        {
-            return rbegin(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto rbegin(const Cont& order) const
-        {
-            return rbegin(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto crbegin(const Cont& order) const
-        {
-            return crbegin(std::begin(order), std::end(order));
-        }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto rend(const Cont& order)
-        {
-            return rend(std::begin(order), std::end(order));
+    template <arrnd_type First, arrnd_type Second, typename Third, typename... Others>
+        requires(arrnd_type<Third> || std::signed_integral<Third>)
+    [[nodiscard]] inline constexpr First
+        concat(const First& first, const Second& second, const Third& third, Others&&... others)
+    {
+        if constexpr (sizeof...(Others) == 0) {
+            if constexpr (std::signed_integral<Third>) {
+                return first.clone().push_back(second, third);
+            } else {
+                return first.clone().push_back(second).push_back(third);
+            }
+        } else {
+            if constexpr (std::signed_integral<Third>) {
+                return concat(first.clone().push_back(second, third), std::forward<Others>(others)...);
+            } else {
+                return concat(first.clone().push_back(second), third, std::forward<Others>(others)...);
+            }
         }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto rend(const Cont& order) const
-        {
-            return rend(std::begin(order), std::end(order));
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+    [[nodiscard]] inline constexpr auto dot(const Arrnd1& lhs, const Arrnd2& rhs)
+    {
+        using dot_t = typename Arrnd1::template replaced_type<decltype((typename Arrnd1::value_type{})
+            * (typename Arrnd2::value_type{}))>;
+
+        if (size(lhs.info()) < 2 || size(rhs.info()) < 2) {
+            throw std::invalid_argument("invalid inputs - should be at least matrices");
         }
-        template <iterable_of_type_integral Cont>
-        [[nodiscard]] constexpr auto crend(const Cont& order) const
-        {
-            return crend(std::begin(order), std::end(order));
+
+        auto dot_impl = [](const auto& lmat, const auto& rmat) {
+            if (!ismatrix(lmat.info()) || !ismatrix(rmat.info())) {
+                throw std::invalid_argument("invalid inputs - not matrices");
+            }
+
+            if (lmat.info().dims().back() != rmat.info().dims().front()) {
+                throw std::invalid_argument("invalid inputs - matrices size not suitable for multiplication");
+            }
+
+            dot_t res({lmat.info().dims().front(), rmat.info().dims().back()});
+
+            if constexpr (std::is_arithmetic_v<typename Arrnd1::value_type>
+                && std::is_arithmetic_v<typename Arrnd2::value_type>) {
+                using size_type = typename dot_t::size_type;
+                using value_type = typename dot_t::value_type;
+
+                // blocks sizes are chosen such that a block of the packed right matrix
+                // fits in L2 cache, and a row of the left matrix block fits in L1 cache.
+                constexpr size_type block_rows = 64;
+                constexpr size_type block_inner = 128;
+                constexpr size_type block_cols = 256;
+
+                // pack the matrices into continuous row major buffers of the result type,
+                // which also handles sliced or transposed inputs.
+                dot_t lpack(lmat.info().dims());
+                lpack.copy_from(lmat);
+                dot_t rpack(rmat.info().dims());
+                rpack.copy_from(rmat);
+
+                size_type m = lmat.info().dims().front();
+                size_type k = lmat.info().dims().back();
+                size_type n = rmat.info().dims().back();
+
+                const value_type* lbuf = lpack.shared_storage()->data();
+                const value_type* rbuf = rpack.shared_storage()->data();
+                value_type* buf = res.shared_storage()->data();
+
+                std::fill(buf, buf + m * n, value_type{0});
+
+                for (size_type kk = 0; kk < k; kk += block_inner) {
+                    size_type kend = std::min(kk + block_inner, k);
+                    for (size_type ii = 0; ii < m; ii += block_rows) {
+                        size_type iend = std::min(ii + block_rows, m);
+                        for (size_type jj = 0; jj < n; jj += block_cols) {
+                            size_type jend = std::min(jj + block_cols, n);
+                            for (size_type i = ii; i < iend; ++i) {
+                                value_type* res_row = buf + i * n;
+                                for (size_type p = kk; p < kend; ++p) {
+                                    // unit stride inner loop, which is suitable for auto vectorization
+                                    const value_type lval = lbuf[i * k + p];
+                                    const value_type* rrow = rbuf + p * n;
+                                    for (size_type j = jj; j < jend; ++j) {
+                                        res_row[j] += lval * rrow[j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            } else {
+                typename Arrnd1::size_type element_index = 0;
+
+                auto trmat = transpose(rmat, {1, 0});
+
+                std::for_each(lmat.cbegin(arrnd_returned_slice_iterator_tag{}),
+                    lmat.cend(arrnd_returned_slice_iterator_tag{}), [&res, &trmat, &element_index](const auto& row) {
+                        std::for_each(trmat.cbegin(arrnd_returned_slice_iterator_tag{}),
+                            trmat.cend(arrnd_returned_slice_iterator_tag{}),
+                            [&res, &element_index, &row](const auto& col) {
+                                res[element_index++] = (row * col).template reduce<0>(std::plus<>{});
+                            });
+                    });
+            }
+
+            return res;
+        };
+
+        if (ismatrix(lhs.info()) && ismatrix(rhs.info())) {
+            return dot_impl(lhs, rhs);
         }
 
-        // slice iterator functions
+        if (ismatrix(rhs.info())) {
+            return lhs.browse(2, [&rhs, dot_impl](const auto& mat) {
+                return dot_impl(mat, rhs);
+            });
+        } else {
+            auto lhs_num_pages
+                = total(lhs.info()) / (lhs.info().dims()[size(lhs.info()) - 2] * lhs.info().dims().back());
+            auto rhs_num_pages
+                = total(rhs.info()) / (rhs.info().dims()[size(rhs.info()) - 2] * rhs.info().dims().back());
 
-        [[nodiscard]] constexpr auto begin(arrnd_returned_slice_iterator_tag)
-        {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
-                                   arrnd_iterator_position::begin));
+            if (lhs_num_pages != rhs_num_pages) {
+                std::invalid_argument("invalid inputs - arrays does not have the same number of pages");
+            }
+
+            auto rhs_pages = rhs.pages(2);
+            auto rhs_pages_it = rhs_pages.begin();
+
+            return lhs.browse(2, [&rhs_pages_it, &dot_impl](const auto& mat) {
+                return dot_impl(mat, *(rhs_pages_it++));
+            });
         }
-        [[nodiscard]] constexpr auto begin(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
-                                   arrnd_iterator_position::begin));
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2, arrnd_type... Arrnds>
+    [[nodiscard]] inline constexpr auto dot(const Arrnd1& arr1, const Arrnd2& arr2, Arrnds&&... others)
+    {
+        if constexpr (sizeof...(others) == 0) {
+            return dot(arr1, arr2);
+        } else {
+            return dot(dot(arr1, arr2), std::forward<Arrnds>(others)...);
         }
-        [[nodiscard]] constexpr auto cbegin(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? const_slice_iterator()
-                           : const_slice_iterator(*this,
-                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
-                                   arrnd_iterator_position::begin));
+    }
+
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto det(const Arrnd& arr)
+    {
+        if (size(arr.info()) < 2) {
+            throw std::invalid_argument("invalid input - should be at least matrix");
         }
-        [[nodiscard]] constexpr auto end(arrnd_returned_slice_iterator_tag)
-        {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
-                                   arrnd_iterator_position::end));
+
+        auto det_impl = [](const auto& arr) {
+            if (!ismatrix(arr.info())) {
+                throw std::invalid_argument("invalid input - not matrix");
+            }
+
+            if (arr.info().dims().front() != arr.info().dims().back()) {
+                throw std::invalid_argument("invalid input - not squared");
+            }
+
+            using value_type = typename Arrnd::value_type;
+            using size_type = typename Arrnd::size_type;
+
+            size_type n = arr.info().dims().front();
+
+            // the elimination is done in place of a continuous copy of the matrix
+            typename Arrnd::this_type lu(arr.info().dims());
+            lu.copy_from(arr);
+            value_type* buf = lu.shared_storage()->data();
+
+            if constexpr (std::is_integral_v<value_type>) {
+                // fraction free (Bareiss) elimination, which keeps integral determinants exact
+                value_type sign{1};
+                value_type prev{1};
+
+                for (size_type k = 0; k + 1 < n; ++k) {
+                    if (buf[k * n + k] == value_type{0}) {
+                        size_type r = k + 1;
+                        while (r < n && buf[r * n + k] == value_type{0}) {
+                            ++r;
+                        }
+                        if (r == n) {
+                            return value_type{0};
+                        }
+                        std::swap_ranges(buf + k * n, buf + (k + 1) * n, buf + r * n);
+                        sign = -sign;
+                    }
+
+                    for (size_type i = k + 1; i < n; ++i) {
+                        for (size_type j = k + 1; j < n; ++j) {
+                            buf[i * n + j] = (buf[i * n + j] * buf[k * n + k] - buf[i * n + k] * buf[k * n + j]) / prev;
+                        }
+                    }
+                    prev = buf[k * n + k];
+                }
+
+                return static_cast<value_type>(sign * buf[n * n - 1]);
+            } else {
+                // LU decomposition with partial pivoting
+                using std::abs;
+
+                value_type d{1};
+
+                for (size_type k = 0; k < n; ++k) {
+                    size_type pivot_row = k;
+                    for (size_type r = k + 1; r < n; ++r) {
+                        if (abs(buf[r * n + k]) > abs(buf[pivot_row * n + k])) {
+                            pivot_row = r;
+                        }
+                    }
+
+                    if (buf[pivot_row * n + k] == value_type{0}) {
+                        return value_type{0};
+                    }
+
+                    if (pivot_row != k) {
+                        std::swap_ranges(buf + k * n, buf + (k + 1) * n, buf + pivot_row * n);
+                        d = -d;
+                    }
+
+                    const value_type pivot = buf[k * n + k];
+                    d *= pivot;
+
+                    for (size_type i = k + 1; i < n; ++i) {
+                        const value_type factor = buf[i * n + k] / pivot;
+                        for (size_type j = k + 1; j < n; ++j) {
+                            buf[i * n + j] -= factor * buf[k * n + j];
+                        }
+                    }
+                }
+
+                return d;
+            }
+        };
+
+        if (ismatrix(arr.info())) {
+            return Arrnd({1}, det_impl(arr));
         }
-        [[nodiscard]] constexpr auto end(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
-                                   arrnd_iterator_position::end));
+
+        return arr.browse(2, [det_impl](auto page) {
+            return det_impl(page);
+        });
+    }
+
+    // matrices factorizations are computed in floating point for integral value types
+    template <arrnd_type Arrnd>
+    using arrnd_factor_t = typename Arrnd::template replaced_type<
+        std::conditional_t<std::is_integral_v<typename Arrnd::value_type>, double, typename Arrnd::value_type>>;
+
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto inv(const Arrnd& arr)
+    {
+        if (size(arr.info()) < 2) {
+            throw std::invalid_argument("invalid input - should be at least matrix");
         }
-        [[nodiscard]] constexpr auto cend(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? const_slice_iterator()
-                           : const_slice_iterator(*this,
-                               windows_slider_type(info_, 0, window_type(typename window_type::interval_type{0, 1}),
-                                   arrnd_iterator_position::end));
+
+        // the elimination is computed in floating point for integral value types (see arrnd_factor_t),
+        // and its workspace is reused across pages of the same size
+        using factor_type = arrnd_factor_t<Arrnd>;
+        factor_type work;
+
+        auto inv_impl = [&work](const auto& arr) {
+            if (!ismatrix(arr.info())) {
+                throw std::invalid_argument("invalid input - not matrix");
+            }
+
+            if (arr.info().dims().front() != arr.info().dims().back()) {
+                throw std::invalid_argument("invalid input - not squared");
+            }
+
+            using value_type = typename factor_type::value_type;
+            using size_type = typename Arrnd::size_type;
+            using std::abs;
+
+            size_type n = arr.info().dims().front();
+
+            if (work.empty() || !std::equal(std::begin(work.info().dims()), std::end(work.info().dims()),
+                    std::begin(arr.info().dims()), std::end(arr.info().dims()))) {
+                work = factor_type(arr.info().dims());
+            }
+            work.copy_from(arr);
+            value_type* buf = work.shared_storage()->data();
+
+            factor_type res(arr.info().dims(), value_type{0});
+            value_type* inv_buf = res.shared_storage()->data();
+            for (size_type i = 0; i < n; ++i) {
+                inv_buf[i * n + i] = value_type{1};
+            }
+
+            // Gauss-Jordan elimination with partial pivoting
+            for (size_type k = 0; k < n; ++k) {
+                size_type pivot_row = k;
+                for (size_type r = k + 1; r < n; ++r) {
+                    if (abs(buf[r * n + k]) > abs(buf[pivot_row * n + k])) {
+                        pivot_row = r;
+                    }
+                }
+
+                if (buf[pivot_row * n + k] == value_type{0}) {
+                    throw std::invalid_argument("invalid input - zero determinant");
+                }
+
+                if (pivot_row != k) {
+                    std::swap_ranges(buf + k * n, buf + (k + 1) * n, buf + pivot_row * n);
+                    std::swap_ranges(inv_buf + k * n, inv_buf + (k + 1) * n, inv_buf + pivot_row * n);
+                }
+
+                const value_type pivot = buf[k * n + k];
+                for (size_type j = k; j < n; ++j) {
+                    buf[k * n + j] /= pivot;
+                }
+                for (size_type j = 0; j < n; ++j) {
+                    inv_buf[k * n + j] /= pivot;
+                }
+
+                for (size_type i = 0; i < n; ++i) {
+                    const value_type factor = buf[i * n + k];
+                    if (i == k || factor == value_type{0}) {
+                        continue;
+                    }
+                    for (size_type j = k; j < n; ++j) {
+                        buf[i * n + j] -= factor * buf[k * n + j];
+                    }
+                    for (size_type j = 0; j < n; ++j) {
+                        inv_buf[i * n + j] -= factor * inv_buf[k * n + j];
+                    }
+                }
+            }
+
+            if constexpr (std::is_same_v<factor_type, typename Arrnd::this_type>) {
+                return res;
+            } else {
+                // the integral inverse is exact only for unimodular matrices, and otherwise rounded
+                return res.transform([](value_type value) {
+                    return static_cast<typename Arrnd::value_type>(std::round(value));
+                });
+            }
+        };
+
+        if (ismatrix(arr.info())) {
+            return inv_impl(arr);
         }
-        [[nodiscard]] constexpr auto rbegin(arrnd_returned_slice_iterator_tag)
-        {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, 0,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rbegin));
+
+        return arr.browse(2, [&inv_impl](auto page) {
+            return inv_impl(page);
+        });
+    }
+
+    // solve each page of rhs by page_solver, which works in place on a continuous page of rhs.
+    // in case that one of the factorized or rhs arrays is a single matrix, it is used for all of the pages of the other.
+    template <arrnd_type Factor, arrnd_type Rhs, typename PageSolver>
+    [[nodiscard]] inline constexpr Factor solve_pages(const typename Factor::info_type& info,
+        typename Factor::size_type x_rows, const Rhs& rhs, PageSolver&& page_solver)
+    {
+        using size_type = typename Factor::size_type;
+
+        if (rhs.empty()) {
+            return Factor{};
         }
-        [[nodiscard]] constexpr auto rbegin(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, 0,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rbegin));
+
+        if (size(rhs.info()) < 2) {
+            throw std::invalid_argument("invalid input - should be at least matrix");
         }
-        [[nodiscard]] constexpr auto crbegin(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? const_reverse_slice_iterator()
-                           : const_reverse_slice_iterator(*this,
-                               windows_slider_type(info_, 0,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rbegin));
+
+        size_type rows = info.dims()[size(info) - 2];
+        size_type cols = info.dims().back();
+        size_type rhs_cols = rhs.info().dims().back();
+
+        if (rhs.info().dims()[size(rhs.info()) - 2] != rows) {
+            throw std::invalid_argument("invalid inputs - matrices size not suitable for solving");
         }
-        [[nodiscard]] constexpr auto rend(arrnd_returned_slice_iterator_tag)
-        {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, 0,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rend));
+
+        size_type num_pages = total(info) / (rows * cols);
+        size_type rhs_num_pages = total(rhs.info()) / (rows * rhs_cols);
+
+        if (num_pages != rhs_num_pages && num_pages != 1 && rhs_num_pages != 1) {
+            throw std::invalid_argument("invalid inputs - arrays does not have the same number of pages");
         }
-        [[nodiscard]] constexpr auto rend(arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, 0,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rend));
+
+        // the pages dims are of the array with more pages (or with more dims, for the same number of pages)
+        bool rhs_pages_dims
+            = rhs_num_pages > num_pages || (rhs_num_pages == num_pages && size(rhs.info()) >= size(info));
+        const auto& pages_dims = rhs_pages_dims ? rhs.info().dims() : info.dims();
+        size_type pages_size = rhs_pages_dims ? size(rhs.info()) : size(info);
+
+        typename Factor::info_type::extent_storage_type x_dims(pages_size);
+        std::copy(std::begin(pages_dims), std::next(std::begin(pages_dims), pages_size - 2), std::begin(x_dims));
+        x_dims[pages_size - 2] = x_rows;
+        x_dims[pages_size - 1] = rhs_cols;
+
+        Factor x(x_dims);
+        auto x_buf = x.shared_storage()->data();
+
+        // workspace for the solution of a single page, which is reused across pages
+        Factor work({rows, rhs_cols});
+        auto work_buf = work.shared_storage()->data();
+
+        auto rhs_pages = rhs.pages(2);
+
+        for (size_type page = 0; page < std::max(num_pages, rhs_num_pages); ++page) {
+            work.copy_from(rhs_pages[rhs_num_pages == 1 ? 0 : page]);
+            page_solver(num_pages == 1 ? 0 : page, work_buf, rhs_cols);
+            std::copy_n(work_buf, x_rows * rhs_cols, std::next(x_buf, page * x_rows * rhs_cols));
         }
-        [[nodiscard]] constexpr auto crend(arrnd_returned_slice_iterator_tag) const
+
+        return x;
+    }
+
+    // LU decomposition with partial pivoting of each page - p * a = l * u.
+    // the decomposition is kept packed, and might be reused for solving many right hand sides.
+    template <arrnd_type Arrnd>
+    class arrnd_lu {
+    public:
+        using factor_type = arrnd_factor_t<Arrnd>;
+        using size_type = typename factor_type::size_type;
+        using value_type = typename factor_type::value_type;
+        using pivots_type = typename factor_type::template replaced_type<size_type>;
+
+        constexpr arrnd_lu() = default;
+
+        explicit constexpr arrnd_lu(const Arrnd& arr)
         {
-            return empty() ? const_reverse_slice_iterator()
-                           : const_reverse_slice_iterator(*this,
-                               windows_slider_type(info_, 0,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rend));
+            if (size(arr.info()) < 2) {
+                throw std::invalid_argument("invalid input - should be at least matrix");
+            }
+
+            n_ = arr.info().dims().back();
+
+            if (arr.info().dims()[size(arr.info()) - 2] != n_) {
+                throw std::invalid_argument("invalid input - not squared");
+            }
+
+            factors_ = factor_type(arr.info().dims());
+            factors_.copy_from(arr);
+
+            num_pages_ = total(factors_.info()) / (n_ * n_);
+            pivots_ = pivots_type({num_pages_ * n_});
+
+            using std::abs;
+
+            for (size_type page = 0; page < num_pages_; ++page) {
+                auto buf = std::next(factors_.shared_storage()->data(), page * n_ * n_);
+                auto perm = std::next(pivots_.shared_storage()->data(), page * n_);
+                std::iota(perm, perm + n_, size_type{0});
+
+                for (size_type k = 0; k < n_; ++k) {
+                    size_type pivot_row = k;
+                    for (size_type r = k + 1; r < n_; ++r) {
+                        if (abs(buf[r * n_ + k]) > abs(buf[pivot_row * n_ + k])) {
+                            pivot_row = r;
+                        }
+                    }
+
+                    if (pivot_row != k) {
+                        std::swap_ranges(buf + k * n_, buf + (k + 1) * n_, buf + pivot_row * n_);
+                        std::swap(perm[k], perm[pivot_row]);
+                    }
+
+                    // singular matrix - zero column below the diagonal, nothing to eliminate
+                    if (buf[k * n_ + k] == value_type{0}) {
+                        continue;
+                    }
+
+                    for (size_type i = k + 1; i < n_; ++i) {
+                        buf[i * n_ + k] /= buf[k * n_ + k];
+                        for (size_type j = k + 1; j < n_; ++j) {
+                            buf[i * n_ + j] -= buf[i * n_ + k] * buf[k * n_ + j];
+                        }
+                    }
+                }
+            }
         }
 
-        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_slice_iterator_tag)
+        // unit lower triangular matrices
+        [[nodiscard]] constexpr factor_type l() const
         {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::begin));
+            return triangular(true);
         }
-        [[nodiscard]] constexpr auto begin(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+        // upper triangular matrices
+        [[nodiscard]] constexpr factor_type u() const
         {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::begin));
+            return triangular(false);
         }
-        [[nodiscard]] constexpr auto cbegin(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+        // permutation matrices
+        [[nodiscard]] constexpr factor_type p() const
         {
-            return empty() ? const_slice_iterator()
-                           : const_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::begin));
+            factor_type res(factors_.info().dims(), value_type{0});
+
+            for (size_type page = 0; page < num_pages_; ++page) {
+                auto buf = std::next(res.shared_storage()->data(), page * n_ * n_);
+                auto perm = std::next(pivots_.shared_storage()->data(), page * n_);
+                for (size_type i = 0; i < n_; ++i) {
+                    buf[i * n_ + perm[i]] = value_type{1};
+                }
+            }
+
+            return res;
         }
-        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_slice_iterator_tag)
+
+        template <arrnd_type Rhs>
+        [[nodiscard]] constexpr factor_type solve(const Rhs& rhs) const
         {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::end));
+            return solve_pages<factor_type>(
+                factors_.info(), n_, rhs, [this](size_type page, value_type* x, size_type cols) {
+                    auto buf = std::next(factors_.shared_storage()->data(), page * n_ * n_);
+                    auto perm = std::next(pivots_.shared_storage()->data(), page * n_);
+
+                    for (size_type k = 0; k < n_; ++k) {
+                        if (buf[k * n_ + k] == value_type{0}) {
+                            throw std::invalid_argument("invalid input - singular matrix");
+                        }
+                    }
+
+                    // apply row permutation on rhs
+                    factor_type permuted({n_, cols});
+                    auto pbuf = permuted.shared_storage()->data();
+                    for (size_type i = 0; i < n_; ++i) {
+                        std::copy_n(x + perm[i] * cols, cols, pbuf + i * cols);
+                    }
+                    std::copy_n(pbuf, n_ * cols, x);
+
+                    // forward substitution with unit diagonal
+                    for (size_type i = 0; i < n_; ++i) {
+                        for (size_type k = 0; k < i; ++k) {
+                            for (size_type j = 0; j < cols; ++j) {
+                                x[i * cols + j] -= buf[i * n_ + k] * x[k * cols + j];
+                            }
+                        }
+                    }
+
+                    // back substitution
+                    for (size_type i = n_; i > 0; --i) {
+                        for (size_type k = i; k < n_; ++k) {
+                            for (size_type j = 0; j < cols; ++j) {
+                                x[(i - 1) * cols + j] -= buf[(i - 1) * n_ + k] * x[k * cols + j];
+                            }
+                        }
+                        for (size_type j = 0; j < cols; ++j) {
+                            x[(i - 1) * cols + j] /= buf[(i - 1) * n_ + (i - 1)];
+                        }
+                    }
+                });
         }
-        [[nodiscard]] constexpr auto end(size_type axis, arrnd_returned_slice_iterator_tag) const
-        {
-            return empty() ? slice_iterator()
-                           : slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::end));
+
+    private:
+        [[nodiscard]] constexpr factor_type triangular(bool lower) const
+        {
+            factor_type res(factors_.info().dims());
+            res.copy_from(factors_);
+
+            for (size_type page = 0; page < num_pages_; ++page) {
+                auto buf = std::next(res.shared_storage()->data(), page * n_ * n_);
+                for (size_type i = 0; i < n_; ++i) {
+                    for (size_type j = 0; j < n_; ++j) {
+                        if (lower && i == j) {
+                            buf[i * n_ + j] = value_type{1};
+                        } else if ((lower && j > i) || (!lower && j < i)) {
+                            buf[i * n_ + j] = value_type{0};
+                        }
+                    }
+                }
+            }
+
+            return res;
         }
-        [[nodiscard]] constexpr auto cend(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+        factor_type factors_;
+        pivots_type pivots_;
+        size_type n_{0};
+        size_type num_pages_{0};
+    };
+
+    // Cholesky decomposition of each symmetric positive definite page - a = l * transpose(l).
+    template <arrnd_type Arrnd>
+    class arrnd_cholesky {
+    public:
+        using factor_type = arrnd_factor_t<Arrnd>;
+        using size_type = typename factor_type::size_type;
+        using value_type = typename factor_type::value_type;
+
+        constexpr arrnd_cholesky() = default;
+
+        explicit constexpr arrnd_cholesky(const Arrnd& arr)
         {
-            return empty() ? const_slice_iterator()
-                           : const_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::end));
+            if (size(arr.info()) < 2) {
+                throw std::invalid_argument("invalid input - should be at least matrix");
+            }
+
+            n_ = arr.info().dims().back();
+
+            if (arr.info().dims()[size(arr.info()) - 2] != n_) {
+                throw std::invalid_argument("invalid input - not squared");
+            }
+
+            factors_ = factor_type(arr.info().dims());
+            factors_.copy_from(arr);
+
+            num_pages_ = total(factors_.info()) / (n_ * n_);
+
+            using std::sqrt;
+
+            for (size_type page = 0; page < num_pages_; ++page) {
+                auto buf = std::next(factors_.shared_storage()->data(), page * n_ * n_);
+
+                for (size_type j = 0; j < n_; ++j) {
+                    value_type d = buf[j * n_ + j];
+                    for (size_type k = 0; k < j; ++k) {
+                        d -= buf[j * n_ + k] * buf[j * n_ + k];
+                    }
+
+                    if (d <= value_type{0}) {
+                        throw std::invalid_argument("invalid input - not positive definite");
+                    }
+
+                    buf[j * n_ + j] = sqrt(d);
+
+                    for (size_type i = j + 1; i < n_; ++i) {
+                        value_type s = buf[i * n_ + j];
+                        for (size_type k = 0; k < j; ++k) {
+                            s -= buf[i * n_ + k] * buf[j * n_ + k];
+                        }
+                        buf[i * n_ + j] = s / buf[j * n_ + j];
+                    }
+
+                    std::fill(buf + j * n_ + j + 1, buf + (j + 1) * n_, value_type{0});
+                }
+            }
         }
-        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_slice_iterator_tag)
+
+        // lower triangular matrices
+        [[nodiscard]] constexpr const factor_type& l() const noexcept
         {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rbegin));
+            return factors_;
         }
-        [[nodiscard]] constexpr auto rbegin(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+        template <arrnd_type Rhs>
+        [[nodiscard]] constexpr factor_type solve(const Rhs& rhs) const
         {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rbegin));
+            return solve_pages<factor_type>(
+                factors_.info(), n_, rhs, [this](size_type page, value_type* x, size_type cols) {
+                    auto buf = std::next(factors_.shared_storage()->data(), page * n_ * n_);
+
+                    // forward substitution - l * y = b
+                    for (size_type i = 0; i < n_; ++i) {
+                        for (size_type k = 0; k < i; ++k) {
+                            for (size_type j = 0; j < cols; ++j) {
+                                x[i * cols + j] -= buf[i * n_ + k] * x[k * cols + j];
+                            }
+                        }
+                        for (size_type j = 0; j < cols; ++j) {
+                            x[i * cols + j] /= buf[i * n_ + i];
+                        }
+                    }
+
+                    // back substitution - transpose(l) * x = y
+                    for (size_type i = n_; i > 0; --i) {
+                        for (size_type k = i; k < n_; ++k) {
+                            for (size_type j = 0; j < cols; ++j) {
+                                x[(i - 1) * cols + j] -= buf[k * n_ + (i - 1)] * x[k * cols + j];
+                            }
+                        }
+                        for (size_type j = 0; j < cols; ++j) {
+                            x[(i - 1) * cols + j] /= buf[(i - 1) * n_ + (i - 1)];
+                        }
+                    }
+                });
         }
-        [[nodiscard]] constexpr auto crbegin(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+    private:
+        factor_type factors_;
+        size_type n_{0};
+        size_type num_pages_{0};
+    };
+
+    // QR decomposition by Householder reflections of each page - a = q * r.
+    // solving with QR decomposition returns the least squares solution for pages with more rows than columns.
+    template <arrnd_type Arrnd>
+    class arrnd_qr {
+    public:
+        using factor_type = arrnd_factor_t<Arrnd>;
+        using size_type = typename factor_type::size_type;
+        using value_type = typename factor_type::value_type;
+
+        constexpr arrnd_qr() = default;
+
+        explicit constexpr arrnd_qr(const Arrnd& arr)
         {
-            return empty() ? const_reverse_slice_iterator()
-                           : const_reverse_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rbegin));
+            if (size(arr.info()) < 2) {
+                throw std::invalid_argument("invalid input - should be at least matrix");
+            }
+
+            m_ = arr.info().dims()[size(arr.info()) - 2];
+            n_ = arr.info().dims().back();
+
+            r_ = factor_type(arr.info().dims());
+            r_.copy_from(arr);
+
+            num_pages_ = total(r_.info()) / (m_ * n_);
+
+            typename factor_type::info_type::extent_storage_type q_dims(r_.info().dims());
+            q_dims[size(r_.info()) - 1] = m_;
+            q_ = factor_type(q_dims, value_type{0});
+
+            factor_type v({m_});
+            auto vbuf = v.shared_storage()->data();
+
+            using std::abs;
+            using std::sqrt;
+
+            for (size_type page = 0; page < num_pages_; ++page) {
+                auto rbuf = std::next(r_.shared_storage()->data(), page * m_ * n_);
+                auto qbuf = std::next(q_.shared_storage()->data(), page * m_ * m_);
+
+                for (size_type i = 0; i < m_; ++i) {
+                    qbuf[i * m_ + i] = value_type{1};
+                }
+
+                for (size_type k = 0; k < std::min(m_ - 1, n_); ++k) {
+                    value_type norm2{0};
+                    for (size_type i = k; i < m_; ++i) {
+                        norm2 += rbuf[i * n_ + k] * rbuf[i * n_ + k];
+                    }
+
+                    if (norm2 == value_type{0}) {
+                        continue;
+                    }
+
+                    value_type alpha = rbuf[k * n_ + k] > value_type{0} ? -sqrt(norm2) : sqrt(norm2);
+
+                    for (size_type i = k; i < m_; ++i) {
+                        vbuf[i] = rbuf[i * n_ + k];
+                    }
+                    vbuf[k] -= alpha;
+
+                    value_type vnorm2{0};
+                    for (size_type i = k; i < m_; ++i) {
+                        vnorm2 += vbuf[i] * vbuf[i];
+                    }
+
+                    // r = h * r
+                    for (size_type j = k; j < n_; ++j) {
+                        value_type s{0};
+                        for (size_type i = k; i < m_; ++i) {
+                            s += vbuf[i] * rbuf[i * n_ + j];
+                        }
+                        s = value_type{2} * s / vnorm2;
+                        for (size_type i = k; i < m_; ++i) {
+                            rbuf[i * n_ + j] -= s * vbuf[i];
+                        }
+                    }
+
+                    // q = q * h
+                    for (size_type r = 0; r < m_; ++r) {
+                        value_type s{0};
+                        for (size_type i = k; i < m_; ++i) {
+                            s += qbuf[r * m_ + i] * vbuf[i];
+                        }
+                        s = value_type{2} * s / vnorm2;
+                        for (size_type i = k; i < m_; ++i) {
+                            qbuf[r * m_ + i] -= s * vbuf[i];
+                        }
+                    }
+
+                    rbuf[k * n_ + k] = alpha;
+                    for (size_type i = k + 1; i < m_; ++i) {
+                        rbuf[i * n_ + k] = value_type{0};
+                    }
+                }
+            }
         }
-        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_slice_iterator_tag)
+
+        // orthogonal matrices
+        [[nodiscard]] constexpr const factor_type& q() const noexcept
         {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rend));
+            return q_;
         }
-        [[nodiscard]] constexpr auto rend(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+        // upper triangular matrices
+        [[nodiscard]] constexpr const factor_type& r() const noexcept
         {
-            return empty() ? reverse_slice_iterator()
-                           : reverse_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rend));
+            return r_;
         }
-        [[nodiscard]] constexpr auto crend(size_type axis, arrnd_returned_slice_iterator_tag) const
+
+        template <arrnd_type Rhs>
+        [[nodiscard]] constexpr factor_type solve(const Rhs& rhs) const
         {
-            return empty() ? const_reverse_slice_iterator()
-                           : const_reverse_slice_iterator(*this,
-                               windows_slider_type(info_, axis,
-                                   window_type(typename window_type::interval_type{0, 1}, arrnd_window_type::partial),
-                                   arrnd_iterator_position::rend));
+            if (m_ < n_) {
+                throw std::invalid_argument("invalid input - underdetermined system");
+            }
+
+            return solve_pages<factor_type>(
+                r_.info(), n_, rhs, [this](size_type page, value_type* x, size_type cols) {
+                    auto rbuf = std::next(r_.shared_storage()->data(), page * m_ * n_);
+                    auto qbuf = std::next(q_.shared_storage()->data(), page * m_ * m_);
+
+                    for (size_type k = 0; k < n_; ++k) {
+                        if (rbuf[k * n_ + k] == value_type{0}) {
+                            throw std::invalid_argument("invalid input - rank deficient matrix");
+                        }
+                    }
+
+                    // y = transpose(q) * b, only the first n rows are required
+                    factor_type y({n_, cols}, value_type{0});
+                    auto ybuf = y.shared_storage()->data();
+                    for (size_type i = 0; i < m_; ++i) {
+                        for (size_type k = 0; k < n_; ++k) {
+                            for (size_type j = 0; j < cols; ++j) {
+                                ybuf[k * cols + j] += qbuf[i * m_ + k] * x[i * cols + j];
+                            }
+                        }
+                    }
+
+                    // back substitution - r * x = y
+                    for (size_type i = n_; i > 0; --i) {
+                        for (size_type k = i; k < n_; ++k) {
+                            for (size_type j = 0; j < cols; ++j) {
+                                ybuf[(i - 1) * cols + j] -= rbuf[(i - 1) * n_ + k] * ybuf[k * cols + j];
+                            }
+                        }
+                        for (size_type j = 0; j < cols; ++j) {
+                            ybuf[(i - 1) * cols + j] /= rbuf[(i - 1) * n_ + (i - 1)];
+                        }
+                    }
+
+                    std::copy_n(ybuf, n_ * cols, x);
+                });
         }
 
     private:
-        struct creators_chain {
-            std::shared_ptr<bool> has_original_creator = std::allocate_shared<bool>(allocator_template_type<bool>());
-            std::weak_ptr<bool> is_creator_valid{};
-            const this_type* latest_creator = nullptr;
-        };
+        factor_type q_;
+        factor_type r_;
+        size_type m_{0};
+        size_type n_{0};
+        size_type num_pages_{0};
+    };
 
-        info_type info_{};
-        std::shared_ptr<storage_type> shared_storage_{nullptr};
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto lu(const Arrnd& arr)
+    {
+        return arrnd_lu<Arrnd>(arr);
+    }
 
-        creators_chain creators_{};
-    };
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto cholesky(const Arrnd& arr)
+    {
+        return arrnd_cholesky<Arrnd>(arr);
+    }
 
-    // arrnd type deduction by constructors
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto qr(const Arrnd& arr)
+    {
+        return arrnd_qr<Arrnd>(arr);
+    }
 
-    template <iterator_of_type_integral InputDimsIt, iterator_type InputDataIt,
-        typename DataStorageTraits = simple_vector_traits<iterator_value_t<InputDataIt>>,
-        typename ArrndInfo = arrnd_info<>>
-    arrnd(const InputDimsIt&, const InputDimsIt&, const InputDataIt&, const InputDataIt&)
-        -> arrnd<iterator_value_t<InputDataIt>, DataStorageTraits, ArrndInfo>;
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+    [[nodiscard]] inline constexpr auto solve(const Arrnd1& lhs, const Arrnd2& rhs)
+    {
+        return lu(lhs).solve(rhs);
+    }
 
-    template <iterator_of_type_integral InputDimsIt, typename U, typename DataStorageTraits = simple_vector_traits<U>,
-        typename ArrndInfo = arrnd_info<>>
-    arrnd(const InputDimsIt&, const InputDimsIt&, const U&) -> arrnd<U, DataStorageTraits, ArrndInfo>;
-    template <iterable_of_type_integral Cont, typename U, typename DataStorageTraits = simple_vector_traits<U>,
-        typename ArrndInfo = arrnd_info<>>
-    arrnd(const Cont&, const U&) -> arrnd<U, DataStorageTraits, ArrndInfo>;
-    template <typename U, typename DataStorageTraits = simple_vector_traits<U>, typename ArrndInfo = arrnd_info<>>
-    arrnd(std::initializer_list<typename DataStorageTraits::storage_type::size_type>, const U&)
-        -> arrnd<U, DataStorageTraits, ArrndInfo>;
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto all(const Arrnd& arr, typename Arrnd::size_type axis)
+    {
+        return arr.template all<Arrnd::depth>(axis);
+    }
 
-    template <typename U, typename DataStorageTraits = simple_vector_traits<U>, typename ArrndInfo = arrnd_info<>>
-    arrnd(std::initializer_list<typename DataStorageTraits::storage_type::size_type>, std::initializer_list<U>)
-        -> arrnd<U, DataStorageTraits, ArrndInfo>;
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto any(const Arrnd& arr, typename Arrnd::size_type axis)
+    {
+        return arr.template any<Arrnd::depth>(axis);
+    }
 
-    template <iterable_of_type_integral Cont, iterable_type DataCont,
-        typename DataStorageTraits = simple_vector_traits<iterable_value_t<DataCont>>,
-        typename ArrndInfo = arrnd_info<>>
-    arrnd(const Cont&, const DataCont&) -> arrnd<iterable_value_t<DataCont>, DataStorageTraits, ArrndInfo>;
+    // accumulator type of sum() e.g. sum<accumulate_as<double>>(arr) of float array
+    template <typename T>
+    struct accumulate_as {
+        using type = T;
+    };
 
-    template <typename Func, typename DataStorageTraits = simple_vector_traits<std::invoke_result_t<Func>>,
-        typename ArrndInfo = arrnd_info<>, iterator_of_type_integral InputDimsIt>
-        requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
-    arrnd(const InputDimsIt&, const InputDimsIt&, Func&&)
-        -> arrnd<std::invoke_result_t<Func>, DataStorageTraits, ArrndInfo>;
-    template <typename Func, typename DataStorageTraits = simple_vector_traits<std::invoke_result_t<Func>>,
-        typename ArrndInfo = arrnd_info<>, iterable_of_type_integral Cont>
-        requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
-    arrnd(const Cont&, Func&&) -> arrnd<std::invoke_result_t<Func>, DataStorageTraits, ArrndInfo>;
-    template <typename Func, typename DataStorageTraits = simple_vector_traits<std::invoke_result_t<Func>>,
-        typename ArrndInfo = arrnd_info<>>
-        requires(!arrnd_type<Func> && std::is_invocable_v<Func>)
-    arrnd(std::initializer_list<typename DataStorageTraits::storage_type::size_type>, Func&&)
-        -> arrnd<std::invoke_result_t<Func>, DataStorageTraits, ArrndInfo>;
+    template <typename Acc, arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr Acc pairwise_sum(const Arrnd& arr)
+    {
+        if (arr.empty()) {
+            return Acc{0};
+        }
 
-    template <typename T, typename DataStorageTraits = simple_vector_traits<typename T::value_type>,
-        typename ArrndInfo = arrnd_info<>>
-    arrnd(const ArrndInfo&, std::shared_ptr<T>) -> arrnd<typename T::value_type, DataStorageTraits, ArrndInfo>;
+        if (has_plain_elements(arr)) {
+            return pairwise_sum<Acc>(plain_zipped(arr).first(), total(arr.info()));
+        }
+        return pairwise_sum<Acc>(std::begin(arr), total(arr.info()));
+    }
 
-    // free arrnd iterator functions
+    // floating point elements are summed pairwise (see pairwise_sum)
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr)
+    {
+        if constexpr (Arrnd::is_flat && std::is_floating_point_v<typename Arrnd::value_type>) {
+            return pairwise_sum<typename Arrnd::value_type>(arr);
+        } else {
+            return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
+                return a + b;
+            });
+        }
+    }
 
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto begin(Arrnd& c, Args&&... args)
+    template <template_type<accumulate_as> Acc, arrnd_type Arrnd>
+        requires(Arrnd::is_flat && std::is_arithmetic_v<typename Arrnd::value_type>)
+    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr)
     {
-        return c.begin(std::forward<Args>(args)...);
+        return pairwise_sum<typename Acc::type>(arr);
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto begin(const Arrnd& c, Args&&... args)
+
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return c.begin(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
+            return a + b;
+        });
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto cbegin(const Arrnd& c, Args&&... args)
+
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto min(const Arrnd& arr)
     {
-        return c.cbegin(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
+            using std::min;
+            return min(a, b);
+        });
     }
 
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto end(Arrnd& c, Args&&... args)
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto min(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return c.end(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
+            using std::min;
+            return min(a, b);
+        });
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto end(const Arrnd& c, Args&&... args)
+
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto max(const Arrnd& arr)
     {
-        return c.end(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
+            using std::max;
+            return max(a, b);
+        });
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto cend(const Arrnd& c, Args&&... args)
+
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto max(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return c.cend(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
+            using std::max;
+            return max(a, b);
+        });
     }
 
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto rbegin(Arrnd& c, Args&&... args)
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr)
     {
-        return c.rbegin(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
+            return a * b;
+        });
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto rbegin(const Arrnd& c, Args&&... args)
+
+    template <std::size_t AtDepth, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return c.rbegin(std::forward<Args>(args)...);
+        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
+            return a * b;
+        });
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto crbegin(const Arrnd& c, Args&&... args)
+
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr)
     {
-        return c.crbegin(std::forward<Args>(args)...);
+        return sum<Arrnd::depth, Arrnd>(arr);
     }
 
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto rend(Arrnd& c, Args&&... args)
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return c.rend(std::forward<Args>(args)...);
+        return sum<Arrnd::depth, Arrnd>(arr, axis);
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto rend(const Arrnd& c, Args&&... args)
+
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto min(const Arrnd& arr)
     {
-        return c.rend(std::forward<Args>(args)...);
+        return min<Arrnd::depth, Arrnd>(arr);
     }
-    template <arrnd_type Arrnd, typename... Args>
-    [[nodiscard]] inline constexpr auto crend(const Arrnd& c, Args&&... args)
+
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto min(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return c.crend(std::forward<Args>(args)...);
+        return min<Arrnd::depth, Arrnd>(arr, axis);
     }
 
-    template <arrnd_type First, arrnd_type Second>
-    [[nodiscard]] inline constexpr First concat(const First& first, const Second& second)
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto max(const Arrnd& arr)
     {
-        return first.clone().push_back(second);
+        return max<Arrnd::depth, Arrnd>(arr);
     }
 
-    template <arrnd_type First, arrnd_type Second, typename Third, typename... Others>
-        requires(arrnd_type<Third> || std::signed_integral<Third>)
-    [[nodiscard]] inline constexpr First
-        concat(const First& first, const Second& second, const Third& third, Others&&... others)
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto max(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        if constexpr (sizeof...(Others) == 0) {
-            if constexpr (std::signed_integral<Third>) {
-                return first.clone().push_back(second, third);
-            } else {
-                return first.clone().push_back(second).push_back(third);
-            }
-        } else {
-            if constexpr (std::signed_integral<Third>) {
-                return concat(first.clone().push_back(second, third), std::forward<Others>(others)...);
-            } else {
-                return concat(first.clone().push_back(second), third, std::forward<Others>(others)...);
-            }
-        }
+        return max<Arrnd::depth, Arrnd>(arr, axis);
     }
 
-    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
-    [[nodiscard]] inline constexpr auto dot(const Arrnd1& lhs, const Arrnd2& rhs)
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr)
     {
-        using dot_t = typename Arrnd1::template replaced_type<decltype((typename Arrnd1::value_type{})
-            * (typename Arrnd2::value_type{}))>;
-
-        if (size(lhs.info()) < 2 || size(rhs.info()) < 2) {
-            throw std::invalid_argument("invalid inputs - should be at least matrices");
-        }
-
-        auto dot_impl = [](const auto& lmat, const auto& rmat) {
-            if (!ismatrix(lmat.info()) || !ismatrix(rmat.info())) {
-                throw std::invalid_argument("invalid inputs - not matrices");
-            }
+        return prod<Arrnd::depth, Arrnd>(arr);
+    }
 
-            if (lmat.info().dims().back() != rmat.info().dims().front()) {
-                throw std::invalid_argument("invalid inputs - matrices size not suitable for multiplication");
-            }
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr, typename Arrnd::size_type axis)
+    {
+        return prod<Arrnd::depth, Arrnd>(arr, axis);
+    }
 
-            dot_t res({lmat.info().dims().front(), rmat.info().dims().back()});
+    // single pass statistics of elements - mean and variance are updated by welford's method.
+    // statistics of different elements (e.g. of chunks or pages) might be merged.
+    template <typename T>
+        requires(std::is_floating_point_v<T>)
+    struct arrnd_moments {
+        using value_type = T;
 
-            typename Arrnd1::size_type element_index = 0;
+        std::size_t count = 0;
+        value_type min = std::numeric_limits<value_type>::infinity();
+        value_type max = -std::numeric_limits<value_type>::infinity();
+        value_type sum = 0;
+        value_type mean = 0;
+        // sum of squared deviations from the mean
+        value_type m2 = 0;
 
-            auto trmat = transpose(rmat, {1, 0});
+        template <typename U>
+        constexpr arrnd_moments& push(const U& value) noexcept
+        {
+            auto x = static_cast<value_type>(value);
 
-            std::for_each(lmat.cbegin(arrnd_returned_slice_iterator_tag{}),
-                lmat.cend(arrnd_returned_slice_iterator_tag{}), [&res, &trmat, &element_index](const auto& row) {
-                    std::for_each(trmat.cbegin(arrnd_returned_slice_iterator_tag{}),
-                        trmat.cend(arrnd_returned_slice_iterator_tag{}), [&res, &element_index, &row](const auto& col) {
-                            res[element_index++] = (row * col).template reduce<0>(std::plus<>{});
-                        });
-                });
+            ++count;
+            min = x < min ? x : min;
+            max = x > max ? x : max;
+            sum += x;
 
-            return res;
-        };
+            value_type delta = x - mean;
+            mean += delta / static_cast<value_type>(count);
+            m2 += delta * (x - mean);
 
-        if (ismatrix(lhs.info()) && ismatrix(rhs.info())) {
-            return dot_impl(lhs, rhs);
+            return *this;
         }
 
-        if (ismatrix(rhs.info())) {
-            return lhs.browse(2, [&rhs, dot_impl](const auto& mat) {
-                return dot_impl(mat, rhs);
-            });
-        } else {
-            auto lhs_num_pages
-                = total(lhs.info()) / (lhs.info().dims()[size(lhs.info()) - 2] * lhs.info().dims().back());
-            auto rhs_num_pages
-                = total(rhs.info()) / (rhs.info().dims()[size(rhs.info()) - 2] * rhs.info().dims().back());
-
-            if (lhs_num_pages != rhs_num_pages) {
-                std::invalid_argument("invalid inputs - arrays does not have the same number of pages");
+        // chan et al. pairwise update
+        constexpr arrnd_moments& merge(const arrnd_moments& other) noexcept
+        {
+            if (other.count == 0) {
+                return *this;
+            }
+            if (count == 0) {
+                return (*this = other);
             }
 
-            auto rhs_pages = rhs.pages(2);
-            auto rhs_pages_it = rhs_pages.begin();
+            auto n = static_cast<value_type>(count + other.count);
+            auto na = static_cast<value_type>(count);
+            auto nb = static_cast<value_type>(other.count);
+            value_type delta = other.mean - mean;
 
-            return lhs.browse(2, [&rhs_pages_it, &dot_impl](const auto& mat) {
-                return dot_impl(mat, *(rhs_pages_it++));
-            });
+            count += other.count;
+            min = other.min < min ? other.min : min;
+            max = other.max > max ? other.max : max;
+            sum += other.sum;
+            mean += delta * nb / n;
+            m2 += other.m2 + delta * delta * na * nb / n;
+
+            return *this;
         }
-    }
 
-    template <arrnd_type Arrnd1, arrnd_type Arrnd2, arrnd_type... Arrnds>
-    [[nodiscard]] inline constexpr auto dot(const Arrnd1& arr1, const Arrnd2& arr2, Arrnds&&... others)
-    {
-        if constexpr (sizeof...(others) == 0) {
-            return dot(arr1, arr2);
-        } else {
-            return dot(dot(arr1, arr2), std::forward<Arrnds>(others)...);
+        // ddof is the delta degrees of freedom e.g. 1 for the sample variance
+        [[nodiscard]] constexpr value_type variance(std::size_t ddof = 0) const noexcept
+        {
+            return count > ddof ? m2 / static_cast<value_type>(count - ddof)
+                                : std::numeric_limits<value_type>::quiet_NaN();
         }
-    }
 
-    template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto det(const Arrnd& arr)
-    {
-        if (size(arr.info()) < 2) {
-            throw std::invalid_argument("invalid input - should be at least matrix");
+        [[nodiscard]] value_type stddev(std::size_t ddof = 0) const noexcept
+        {
+            return std::sqrt(variance(ddof));
         }
+    };
 
-        std::function<typename Arrnd::value_type(Arrnd)> det_impl;
+    // integral elements statistics are computed as double
+    template <arrnd_type Arrnd>
+    using arrnd_moments_t = arrnd_moments<std::conditional_t<std::is_floating_point_v<typename Arrnd::value_type>,
+        typename Arrnd::value_type, double>>;
 
-        det_impl = [&](const auto& arr) {
-            if (!ismatrix(arr.info())) {
-                throw std::invalid_argument("invalid input - not matrix");
-            }
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto moments(const Arrnd& arr)
+    {
+        arrnd_moments_t<Arrnd> res;
 
-            if (arr.info().dims().front() != arr.info().dims().back()) {
-                throw std::invalid_argument("invalid input - not squared");
-            }
+        zipped_invoke(
+            [&res](auto elems) {
+                for (auto t : zip(elems)) {
+                    res.push(std::get<0>(t));
+                }
+            },
+            arr);
 
-            auto n = arr.info().dims().front();
+        return res;
+    }
 
-            if (n == 1) {
-                return arr(0);
-            }
+    // the elements of each chunk are summarized by its own thread, and the results are merged
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto moments(const arrnd_parallel_policy& policy, const Arrnd& arr)
+    {
+        using moments_t = arrnd_moments_t<Arrnd>;
 
-            if (n == 2) {
-                return arr(0) * arr(3) - arr(1) * arr(2);
-            }
+        if (arr.empty()) {
+            return moments_t{};
+        }
 
-            typename Arrnd::value_type sign{1};
-            typename Arrnd::value_type d{0};
+        std::size_t chunks = num_chunks(policy, total(arr.info()));
+        typename Arrnd::template replaced_type<moments_t>::storage_type partials(chunks);
 
-            for (typename Arrnd::size_type j = 0; j < n; ++j) {
-                typename Arrnd::value_type p{arr[{0, j}]};
-                if (p != typename Arrnd::value_type{0}) {
-                    d += sign * p
-                        * det_impl(arr.exclude({0}, {0})
-                                       .template transform<0>([j](const auto& val) {
-                                           return val.exclude({1}, {j});
-                                       })
-                                       .merge()
-                                       .merge());
-                }
-                sign *= typename Arrnd::value_type{-1};
-            }
-            return d;
-        };
+        parallel_chunks_invoke(
+            chunks, total(arr.info()), [&arr, &partials](std::size_t first, std::size_t last, std::size_t chunk) {
+                chunk_invoke(
+                    [&partials, chunk](auto elems) {
+                        for (auto t : zip(elems)) {
+                            partials[chunk].push(std::get<0>(t));
+                        }
+                    },
+                    first, last, arr);
+            });
 
-        if (ismatrix(arr.info())) {
-            return Arrnd({1}, det_impl(arr));
+        moments_t res;
+        for (const auto& partial : partials) {
+            res.merge(partial);
         }
+        return res;
+    }
 
-        return arr.browse(2, [det_impl](auto page) {
-            return det_impl(page);
+    // array of the statistics of each of the reduced rows (see reduce(axis, op))
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto moments(const Arrnd& arr, typename Arrnd::size_type axis)
+    {
+        using moments_t = arrnd_moments_t<Arrnd>;
+
+        typename Arrnd::template replaced_type<moments_t>::storage_type inits(
+            arr.empty() ? 0 : total(arr.info()) / arr.info().dims()[axis]);
+
+        return arr.fold(axis, inits, [](moments_t acc, const typename Arrnd::value_type& value) {
+            return acc.push(value);
         });
     }
 
-    template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto inv(const Arrnd& arr)
+    // positions (in elements order, and not storage indices as of find) of the first best elements by comp
+    template <arrnd_type Arrnd, typename Comp>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr typename Arrnd::size_type arg_best(const Arrnd& arr, Comp comp)
     {
-        if (size(arr.info()) < 2) {
-            throw std::invalid_argument("invalid input - should be at least matrix");
+        if (arr.empty()) {
+            throw std::invalid_argument("invalid empty array");
         }
 
-        std::function<Arrnd(Arrnd)> inv_impl;
-
-        inv_impl = [&](const auto& arr) {
-            if (!ismatrix(arr.info())) {
-                throw std::invalid_argument("invalid input - not matrix");
+        if constexpr (std::is_arithmetic_v<typename Arrnd::value_type>) {
+            if (has_plain_elements(arr)) {
+                return vectorized_arg_best(plain_zipped(arr).first(), total(arr.info()), comp);
             }
+        }
 
-            if (arr.info().dims().front() != arr.info().dims().back()) {
-                throw std::invalid_argument("invalid input - not squared");
+        typename Arrnd::size_type res = 0;
+        typename Arrnd::size_type pos = 0;
+        auto it = std::begin(arr);
+        auto best = *it;
+        for (++it, ++pos; it != std::end(arr); ++it, ++pos) {
+            if (comp(*it, best)) {
+                best = *it;
+                res = pos;
             }
+        }
+        return res;
+    }
 
-            typename Arrnd::value_type d = det(arr)(0);
-            if (d == typename Arrnd::value_type{0}) {
-                throw std::invalid_argument("invalid input - zero determinant");
-            }
+    template <arrnd_type Arrnd, typename Comp>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto arg_best(const Arrnd& arr, typename Arrnd::size_type axis, Comp comp)
+    {
+        using size_type = typename Arrnd::size_type;
+        using arg_t = typename Arrnd::template replaced_type<size_type>;
 
-            auto n = arr.info().dims().front();
+        if (arr.empty()) {
+            throw std::invalid_argument("invalid empty array");
+        }
+        if (axis >= size(arr.info())) {
+            throw std::out_of_range("invalid axis");
+        }
 
-            typename Arrnd::this_type res(arr.info().dims());
+        arg_t res(reduce(arr.info(), axis).dims(), size_type{0});
+        size_type reduction = arr.info().dims()[axis];
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
+        auto* res_first = plain_zipped(res).first();
 
-            for (typename Arrnd::size_type i = 0; i < n; ++i) {
-                typename Arrnd::value_type sign
-                    = (i + 1) % 2 == 0 ? typename Arrnd::value_type{-1} : typename Arrnd::value_type{1};
-                for (typename Arrnd::size_type j = 0; j < n; ++j) {
+        if constexpr (std::is_arithmetic_v<typename Arrnd::value_type>) {
+            if (has_plain_elements(arr)) {
+                const auto* first = plain_zipped(arr).first();
+                if (inner == 1) {
+                    for (size_type i = 0; i < outer; ++i, first += reduction) {
+                        res_first[i] = vectorized_arg_best(first, reduction, comp);
+                    }
+                    return res;
+                }
 
-                    res[{i, j}] = sign
-                        * det(arr.exclude({0}, {i})
-                                  .template transform<0>([j](const auto& val) {
-                                      return val.exclude({1}, {j});
-                                  })
-                                  .merge()
-                                  .merge())(0);
-                    sign *= typename Arrnd::value_type{-1};
+                typename Arrnd::storage_type best(inner);
+                for (size_type i = 0; i < outer; ++i, res_first += inner) {
+                    std::copy_n(first, inner, best.data());
+                    first += inner;
+                    for (size_type j = 1; j < reduction; ++j, first += inner) {
+                        vectorized_arg_best_row(first, best.data(), res_first, inner, j, comp);
+                    }
                 }
+                return res;
             }
-
-            return (typename Arrnd::value_type{1} / d) * transpose(res, {1, 0});
-        };
-
-        if (ismatrix(arr.info())) {
-            return inv_impl(arr);
         }
 
-        return arr.browse(2, [inv_impl](auto page) {
-            return inv_impl(page);
-        });
+        typename Arrnd::storage_type best(inner);
+        auto it = std::begin(arr);
+        for (size_type i = 0; i < outer; ++i, res_first += inner) {
+            for (size_type j = 0; j < reduction; ++j) {
+                for (size_type k = 0; k < inner; ++k, ++it) {
+                    if (j == 0 || comp(*it, best[k])) {
+                        best[k] = *it;
+                        res_first[k] = j;
+                    }
+                }
+            }
+        }
+        return res;
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto all(const Arrnd& arr, typename Arrnd::size_type axis)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto argmin(const Arrnd& arr)
     {
-        return arr.template all<Arrnd::depth>(axis);
+        return arg_best(arr, std::less<>{});
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto any(const Arrnd& arr, typename Arrnd::size_type axis)
-    {
-        return arr.template any<Arrnd::depth>(axis);
-    }
-
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr)
-    {
-        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
-            return a + b;
-        });
-    }
-
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr, typename Arrnd::size_type axis)
-    {
-        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
-            return a + b;
-        });
-    }
-
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto min(const Arrnd& arr)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto argmin(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
-            using std::min;
-            return min(a, b);
-        });
+        return arg_best(arr, axis, std::less<>{});
     }
 
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto min(const Arrnd& arr, typename Arrnd::size_type axis)
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto argmax(const Arrnd& arr)
     {
-        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
-            using std::min;
-            return min(a, b);
-        });
+        return arg_best(arr, std::greater<>{});
     }
 
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto max(const Arrnd& arr)
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto argmax(const Arrnd& arr, typename Arrnd::size_type axis)
     {
-        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
-            using std::max;
-            return max(a, b);
-        });
+        return arg_best(arr, axis, std::greater<>{});
     }
 
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto max(const Arrnd& arr, typename Arrnd::size_type axis)
+    // the k best (by comp, the largest by default) elements along axis and their positions, ordered from the best
+    // (equivalent elements by their positions). each lane is selected by a partial heap sort if k is small
+    // relatively to the lane size, or by nth_element and a sort of the selected elements otherwise.
+    template <arrnd_type Arrnd, typename Comp = std::greater<>>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto topk(
+        const Arrnd& arr, typename Arrnd::size_type k, typename Arrnd::size_type axis, Comp comp = Comp{})
     {
-        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
-            using std::max;
-            return max(a, b);
-        });
+        using size_type = typename Arrnd::size_type;
+        using indices_t = typename Arrnd::template replaced_type<size_type>;
+
+        if (axis >= size(arr.info())) {
+            throw std::out_of_range("invalid axis");
+        }
+        if (k > arr.info().dims()[axis]) {
+            throw std::invalid_argument("invalid k - larger than axis dim");
+        }
+
+        typename Arrnd::info_type::extent_storage_type res_dims = arr.info().dims();
+        res_dims[axis] = k;
+
+        Arrnd values(res_dims);
+        indices_t indices(res_dims);
+        if (values.empty()) {
+            return std::make_pair(values, indices);
+        }
+
+        auto src = has_plain_elements(arr) ? arr : Arrnd(arr.clone().refresh());
+        const auto* first = plain_zipped(src).first();
+        auto* values_first = plain_zipped(values).first();
+        auto* indices_first = plain_zipped(indices).first();
+
+        size_type reduction = arr.info().dims()[axis];
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
+
+        typename indices_t::storage_type lane(reduction);
+        auto lane_comp = [&comp, &first, inner](size_type a, size_type b) {
+            return comp(first[a * inner], first[b * inner])
+                || (!comp(first[b * inner], first[a * inner]) && a < b);
+        };
+
+        for (size_type i = 0; i < outer; ++i) {
+            for (size_type j = 0; j < inner; ++j, ++first) {
+                std::iota(lane.begin(), lane.end(), size_type{0});
+                if (k * 8 < reduction) {
+                    std::partial_sort(lane.begin(), std::next(lane.begin(), k), lane.end(), lane_comp);
+                } else {
+                    std::nth_element(lane.begin(), std::next(lane.begin(), k - 1), lane.end(), lane_comp);
+                    std::sort(lane.begin(), std::next(lane.begin(), k), lane_comp);
+                }
+                for (size_type n = 0; n < k; ++n) {
+                    values_first[(i * k + n) * inner + j] = first[lane[n] * inner];
+                    indices_first[(i * k + n) * inner + j] = lane[n];
+                }
+            }
+            first += (reduction - 1) * inner;
+        }
+
+        return std::make_pair(values, indices);
     }
 
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr)
+    // the k best elements of the whole array, by their positions in elements order
+    template <arrnd_type Arrnd, typename Comp = std::greater<>>
+        requires(Arrnd::is_flat && !std::integral<Comp>)
+    [[nodiscard]] inline constexpr auto topk(const Arrnd& arr, typename Arrnd::size_type k, Comp comp = Comp{})
     {
-        return arr.template reduce<AtDepth>([](const auto& a, const auto& b) {
-            return a * b;
-        });
+        auto src = has_plain_elements(arr) ? arr : Arrnd(arr.clone().refresh());
+        return topk(src.reshape({total(arr.info())}), k, 0, comp);
     }
 
-    template <std::size_t AtDepth, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr, typename Arrnd::size_type axis)
+    template <arrnd_type Arrnd>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto cumsum(
+        const Arrnd& arr, typename Arrnd::size_type axis, arrnd_scan_type type = arrnd_scan_type::inclusive)
     {
-        return arr.template reduce<AtDepth>(axis, [](const auto& a, const auto& b) {
-            return a * b;
-        });
+        return arr.scan(axis, typename Arrnd::value_type{0}, std::plus<>{}, type);
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto cumsum(const arrnd_parallel_policy& policy, const Arrnd& arr,
+        typename Arrnd::size_type axis, arrnd_scan_type type = arrnd_scan_type::inclusive)
     {
-        return sum<Arrnd::depth, Arrnd>(arr);
+        return arr.scan(policy, axis, typename Arrnd::value_type{0}, std::plus<>{}, type);
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto sum(const Arrnd& arr, typename Arrnd::size_type axis)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto cumprod(
+        const Arrnd& arr, typename Arrnd::size_type axis, arrnd_scan_type type = arrnd_scan_type::inclusive)
     {
-        return sum<Arrnd::depth, Arrnd>(arr, axis);
+        return arr.scan(axis, typename Arrnd::value_type{1}, std::multiplies<>{}, type);
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto min(const Arrnd& arr)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline constexpr auto cumprod(const arrnd_parallel_policy& policy, const Arrnd& arr,
+        typename Arrnd::size_type axis, arrnd_scan_type type = arrnd_scan_type::inclusive)
     {
-        return min<Arrnd::depth, Arrnd>(arr);
+        return arr.scan(policy, axis, typename Arrnd::value_type{1}, std::multiplies<>{}, type);
+    }
+
+    // incremental states of rolling windows - elements enter a window by push and leave it by pop
+    template <typename T>
+    struct rolling_sum_state {
+        T sum{};
+
+        constexpr void clear() noexcept
+        {
+            sum = T{};
+        }
+        constexpr void push(const T& value, std::size_t) noexcept
+        {
+            sum += value;
+        }
+        constexpr void pop(const T& value, std::size_t) noexcept
+        {
+            sum -= value;
+        }
+        [[nodiscard]] constexpr T value() const noexcept
+        {
+            return sum;
+        }
+    };
+
+    // welford's method with removals
+    template <typename T>
+        requires(std::is_floating_point_v<T>)
+    struct rolling_moments_state {
+        std::size_t ddof = 0;
+        bool is_variance = false;
+
+        std::size_t count = 0;
+        T mean = 0;
+        T m2 = 0;
+
+        constexpr void clear() noexcept
+        {
+            count = 0;
+            mean = 0;
+            m2 = 0;
+        }
+        template <typename U>
+        constexpr void push(const U& value, std::size_t) noexcept
+        {
+            auto x = static_cast<T>(value);
+            ++count;
+            T delta = x - mean;
+            mean += delta / static_cast<T>(count);
+            m2 += delta * (x - mean);
+        }
+        template <typename U>
+        constexpr void pop(const U& value, std::size_t) noexcept
+        {
+            auto x = static_cast<T>(value);
+            if (--count == 0) {
+                clear();
+                return;
+            }
+            T delta = x - mean;
+            mean -= delta / static_cast<T>(count);
+            m2 -= delta * (x - mean);
+        }
+        [[nodiscard]] constexpr T value() const noexcept
+        {
+            if (!is_variance) {
+                return count > 0 ? mean : std::numeric_limits<T>::quiet_NaN();
+            }
+            return count > ddof ? std::max(m2, T{0}) / static_cast<T>(count - ddof)
+                                : std::numeric_limits<T>::quiet_NaN();
+        }
+    };
+
+    // monotonic queue of the window elements - each element is dropped once a better (by comp)
+    // element enters the window after it, so the front is the best element of the window.
+    template <typename T, typename Comp>
+    struct rolling_best_state {
+        std::vector<std::pair<T, std::size_t>> queue;
+        std::size_t head = 0;
+        Comp comp{};
+
+        constexpr void clear() noexcept
+        {
+            queue.clear();
+            head = 0;
+        }
+        constexpr void push(const T& value, std::size_t pos)
+        {
+            while (queue.size() > head && !comp(queue.back().first, value)) {
+                queue.pop_back();
+            }
+            queue.emplace_back(value, pos);
+        }
+        constexpr void pop(const T&, std::size_t pos) noexcept
+        {
+            if (queue.size() > head && queue[head].second == pos) {
+                ++head;
+            }
+        }
+        [[nodiscard]] constexpr T value() const noexcept
+        {
+            return queue[head].first;
+        }
+    };
+
+    // each lane along axis is rolled separately (unlike slide, which applies op to the whole hyperplane slices),
+    // and its windows are updated incrementally - at O(1) amortized cost per element.
+    // the windows are of arrnd_window semantics - for a partial window, position i covers the lane elements
+    // [i - |start|, i + stop) clipped to the lane, and for a complete window, it covers [i, i + stop - start).
+    template <typename R, arrnd_type Arrnd, typename State>
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline auto rolling(
+        const Arrnd& arr, typename Arrnd::size_type axis, const typename Arrnd::window_type& window, State state)
+    {
+        using size_type = typename Arrnd::size_type;
+        using rolling_t = typename Arrnd::template replaced_type<R>;
+
+        if (arr.empty()) {
+            return rolling_t{};
+        }
+        if (axis >= size(arr.info())) {
+            throw std::out_of_range("invalid axis");
+        }
+
+        size_type dim = arr.info().dims()[axis];
+        const auto& ival = window.ival;
+
+        if (!isunbound(ival) && ival.step() != 1) {
+            throw std::invalid_argument("invalid window interval - steps currently not supported");
+        }
+
+        // position p covers [max(p - before, 0), min(p + after, dim))
+        size_type count = dim;
+        size_type before = 0;
+        size_type after = dim;
+        if (isunbound(ival)) {
+            count = 1;
+        } else if (window.type == arrnd_window_type::complete) {
+            if (ival.start() > 0 || ival.stop() < 0 || static_cast<size_type>(absdiff(ival)) > dim) {
+                throw std::invalid_argument("invalid window interval");
+            }
+            after = static_cast<size_type>(absdiff(ival));
+            count = dim - after + 1;
+        } else {
+            before = static_cast<size_type>(std::abs(ival.start()));
+            after = static_cast<size_type>(std::max(ival.stop(), decltype(ival.stop()){0}));
+        }
+
+        // windows that don't cover their position (e.g. the first window of [p - 3, p)) might be empty
+        if (after == 0) {
+            throw std::invalid_argument("invalid window interval - empty windows not supported");
+        }
+
+        typename Arrnd::info_type::extent_storage_type res_dims = arr.info().dims();
+        res_dims[axis] = count;
+        rolling_t res(res_dims);
+
+        auto src = has_plain_elements(arr) ? arr : Arrnd(arr.clone().refresh());
+        const auto* first = plain_zipped(src).first();
+        auto* res_first = plain_zipped(res).first();
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
+
+        for (size_type i = 0; i < outer; ++i) {
+            for (size_type k = 0; k < inner; ++k) {
+                const auto* lane = first + i * dim * inner + k;
+                auto* res_lane = res_first + i * count * inner + k;
+
+                state.clear();
+                size_type lo = 0;
+                size_type hi = 0;
+                for (size_type p = 0; p < count; ++p) {
+                    for (size_type last = std::min(p + after, dim); hi < last; ++hi) {
+                        state.push(lane[hi * inner], hi);
+                    }
+                    for (size_type start = p > before ? p - before : 0; lo < start; ++lo) {
+                        state.pop(lane[lo * inner], lo);
+                    }
+                    res_lane[p * inner] = static_cast<R>(state.value());
+                }
+            }
+        }
+
+        return res;
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto min(const Arrnd& arr, typename Arrnd::size_type axis)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline auto rolling_sum(
+        const Arrnd& arr, typename Arrnd::size_type axis, const typename Arrnd::window_type& window)
     {
-        return min<Arrnd::depth, Arrnd>(arr, axis);
+        using value_type = typename Arrnd::value_type;
+        return rolling<value_type>(arr, axis, window, rolling_sum_state<value_type>{});
     }
 
+    // integral elements are averaged as double
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto max(const Arrnd& arr)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline auto rolling_mean(
+        const Arrnd& arr, typename Arrnd::size_type axis, const typename Arrnd::window_type& window)
     {
-        return max<Arrnd::depth, Arrnd>(arr);
+        using mean_t = typename arrnd_moments_t<Arrnd>::value_type;
+        return rolling<mean_t>(arr, axis, window, rolling_moments_state<mean_t>{});
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto max(const Arrnd& arr, typename Arrnd::size_type axis)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline auto rolling_var(const Arrnd& arr, typename Arrnd::size_type axis,
+        const typename Arrnd::window_type& window, std::size_t ddof = 0)
     {
-        return max<Arrnd::depth, Arrnd>(arr, axis);
+        using var_t = typename arrnd_moments_t<Arrnd>::value_type;
+        return rolling<var_t>(arr, axis, window, rolling_moments_state<var_t>{.ddof = ddof, .is_variance = true});
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline auto rolling_min(
+        const Arrnd& arr, typename Arrnd::size_type axis, const typename Arrnd::window_type& window)
     {
-        return prod<Arrnd::depth, Arrnd>(arr);
+        using value_type = typename Arrnd::value_type;
+        return rolling<value_type>(arr, axis, window, rolling_best_state<value_type, std::less<>>{});
     }
 
     template <arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto prod(const Arrnd& arr, typename Arrnd::size_type axis)
+        requires(Arrnd::is_flat)
+    [[nodiscard]] inline auto rolling_max(
+        const Arrnd& arr, typename Arrnd::size_type axis, const typename Arrnd::window_type& window)
     {
-        return prod<Arrnd::depth, Arrnd>(arr, axis);
+        using value_type = typename Arrnd::value_type;
+        return rolling<value_type>(arr, axis, window, rolling_best_state<value_type, std::greater<>>{});
     }
 
     template <arrnd_type Arrnd, iterator_of_type_integral InputIt>
@@ -10409,10 +14555,120 @@ namespace details {
         return transpose(arr, axes);
     }
 
+    // continuous flat arrays of arithmetic types are transformed by the vectorized kernels,
+    // other arrays (e.g. slices, nested or non arithmetic arrays) by transform()
+    template <arrnd_type Arrnd, typename UnaryOp>
+    [[nodiscard]] inline constexpr auto elementwise(const Arrnd& arr, UnaryOp op)
+    {
+        using transform_t = decltype(arr.transform(op));
+
+        if constexpr (Arrnd::is_flat && std::is_arithmetic_v<typename Arrnd::value_type>
+            && std::is_arithmetic_v<typename transform_t::value_type>) {
+            if (!arr.empty() && has_plain_elements(arr)) {
+                transform_t res(arr.info().dims());
+                vectorized_transform(plain_zipped(arr).first(), plain_zipped(res).first(), total(arr.info()), op);
+                return res;
+            }
+        }
+
+        return arr.transform(op);
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2, typename BinaryOp>
+    [[nodiscard]] inline constexpr auto elementwise(const Arrnd1& lhs, const Arrnd2& rhs, BinaryOp op)
+    {
+        using transform_t = decltype(lhs.transform(rhs, op));
+
+        if constexpr (Arrnd1::is_flat && Arrnd2::is_flat && std::is_arithmetic_v<typename Arrnd1::value_type>
+            && std::is_arithmetic_v<typename Arrnd2::value_type>
+            && std::is_arithmetic_v<typename transform_t::value_type>) {
+            // arrays of different dims might be broadcasted (see transform())
+            bool is_elementwise = std::equal(std::begin(lhs.info().dims()), std::end(lhs.info().dims()),
+                                      std::begin(rhs.info().dims()), std::end(rhs.info().dims()))
+                || (total(lhs.info()) == total(rhs.info()) && !isbroadcastable(lhs.info(), rhs.info()));
+
+            if (!lhs.empty() && has_plain_elements(lhs) && has_plain_elements(rhs) && is_elementwise) {
+                transform_t res(lhs.info().dims());
+                vectorized_transform(plain_zipped(lhs).first(), plain_zipped(rhs).first(), plain_zipped(res).first(),
+                    total(lhs.info()), op);
+                return res;
+            }
+        }
+
+        return lhs.transform(rhs, op);
+    }
+
+    // a temporary array (i.e. an rvalue, whose storage is not shared with other arrays) might be reused
+    // as the result buffer, if it is continuous and of the result type.
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr bool is_reusable(const Arrnd& arr) noexcept
+    {
+        if constexpr (!std::is_const_v<Arrnd> && Arrnd::is_flat && std::is_arithmetic_v<typename Arrnd::value_type>) {
+            return !arr.empty() && has_plain_elements(arr) && arr.shared_storage().use_count() == 1;
+        } else {
+            return false;
+        }
+    }
+
+    template <arrnd_type Arrnd, typename UnaryOp>
+        requires(!std::is_reference_v<Arrnd>)
+    [[nodiscard]] inline constexpr auto elementwise(Arrnd&& arr, UnaryOp op)
+    {
+        using transform_t = decltype(arr.transform(op));
+
+        if constexpr (std::is_same_v<transform_t, Arrnd>) {
+            if (is_reusable<Arrnd>(arr)) {
+                vectorized_apply(plain_zipped(arr).first(), total(arr.info()), op);
+                return transform_t(std::move(arr));
+            }
+        }
+
+        return elementwise(std::as_const(arr), op);
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2, typename BinaryOp>
+        requires(!std::is_reference_v<Arrnd1> || !std::is_reference_v<Arrnd2>)
+    [[nodiscard]] inline constexpr auto elementwise(Arrnd1&& lhs, Arrnd2&& rhs, BinaryOp op)
+    {
+        using lhs_t = std::remove_reference_t<Arrnd1>;
+        using rhs_t = std::remove_reference_t<Arrnd2>;
+        using transform_t = decltype(lhs.transform(rhs, op));
+
+        auto reusable_with = [](const auto& arr, const auto& other) {
+            return has_plain_elements(other)
+                && std::equal(std::begin(arr.info().dims()), std::end(arr.info().dims()),
+                    std::begin(other.info().dims()), std::end(other.info().dims()))
+                && static_cast<const void*>(arr.shared_storage().get())
+                != static_cast<const void*>(other.shared_storage().get());
+        };
+
+        // only rvalues (i.e. not deduced as references) are reused
+        if constexpr (!std::is_reference_v<Arrnd1> && std::is_same_v<transform_t, lhs_t> && rhs_t::is_flat
+            && std::is_arithmetic_v<typename rhs_t::value_type>) {
+            if (is_reusable<lhs_t>(lhs) && reusable_with(lhs, rhs)) {
+                vectorized_apply(plain_zipped(lhs).first(), plain_zipped(rhs).first(), total(lhs.info()), op);
+                return transform_t(std::move(lhs));
+            }
+        }
+
+        if constexpr (!std::is_reference_v<Arrnd2> && std::is_same_v<transform_t, rhs_t> && lhs_t::is_flat
+            && std::is_arithmetic_v<typename lhs_t::value_type>) {
+            if (is_reusable<rhs_t>(rhs) && reusable_with(rhs, lhs)) {
+                vectorized_apply(plain_zipped(rhs).first(), plain_zipped(lhs).first(), total(rhs.info()),
+                    [&op](const auto& b, const auto& a) {
+                        return op(a, b);
+                    });
+                return transform_t(std::move(rhs));
+            }
+        }
+
+        return elementwise(std::as_const(lhs), std::as_const(rhs), op);
+    }
+
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator==(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a == b;
         });
     }
@@ -10420,7 +14676,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator==(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a == rhs;
         });
     }
@@ -10428,7 +14684,7 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator==(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
             return lhs == b;
         });
     }
@@ -10436,7 +14692,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator!=(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a != b;
         });
     }
@@ -10444,7 +14700,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator!=(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a != rhs;
         });
     }
@@ -10452,7 +14708,7 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator!=(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
             return lhs != b;
         });
     }
@@ -10490,7 +14746,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator>(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a > b;
         });
     }
@@ -10498,7 +14754,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator>(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a > rhs;
         });
     }
@@ -10506,7 +14762,7 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator>(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
             return lhs > b;
         });
     }
@@ -10514,7 +14770,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator>=(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a >= b;
         });
     }
@@ -10522,7 +14778,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator>=(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a >= rhs;
         });
     }
@@ -10530,7 +14786,7 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator>=(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
             return lhs >= b;
         });
     }
@@ -10538,7 +14794,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator<(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a < b;
         });
     }
@@ -10546,7 +14802,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator<(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a < rhs;
         });
     }
@@ -10554,7 +14810,7 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator<(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
             return lhs < b;
         });
     }
@@ -10562,7 +14818,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator<=(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a <= b;
         });
     }
@@ -10570,7 +14826,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator<=(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a <= rhs;
         });
     }
@@ -10578,7 +14834,7 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator<=(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
             return lhs <= b;
         });
     }
@@ -10586,7 +14842,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator+(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a + b;
         });
     }
@@ -10594,7 +14850,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator+(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a + rhs;
         });
     }
@@ -10602,7 +14858,34 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator+(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
+            return lhs + b;
+        });
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+        requires(!std::is_reference_v<Arrnd1> || !std::is_reference_v<Arrnd2>)
+    [[nodiscard]] inline constexpr auto operator+(Arrnd1&& lhs, Arrnd2&& rhs)
+    {
+        return elementwise(std::forward<Arrnd1>(lhs), std::forward<Arrnd2>(rhs), [](const auto& a, const auto& b) {
+            return a + b;
+        });
+    }
+
+    template <arrnd_type Arrnd, typename T>
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator+(Arrnd&& lhs, const T& rhs)
+    {
+        return elementwise(std::move(lhs), [&rhs](const auto& a) {
+            return a + rhs;
+        });
+    }
+
+    template <typename T, arrnd_type Arrnd>
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator+(const T& lhs, Arrnd&& rhs)
+    {
+        return elementwise(std::move(rhs), [&lhs](const auto& b) {
             return lhs + b;
         });
     }
@@ -10626,7 +14909,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator-(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a - b;
         });
     }
@@ -10634,7 +14917,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator-(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a - rhs;
         });
     }
@@ -10642,7 +14925,34 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator-(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
+            return lhs - b;
+        });
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+        requires(!std::is_reference_v<Arrnd1> || !std::is_reference_v<Arrnd2>)
+    [[nodiscard]] inline constexpr auto operator-(Arrnd1&& lhs, Arrnd2&& rhs)
+    {
+        return elementwise(std::forward<Arrnd1>(lhs), std::forward<Arrnd2>(rhs), [](const auto& a, const auto& b) {
+            return a - b;
+        });
+    }
+
+    template <arrnd_type Arrnd, typename T>
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator-(Arrnd&& lhs, const T& rhs)
+    {
+        return elementwise(std::move(lhs), [&rhs](const auto& a) {
+            return a - rhs;
+        });
+    }
+
+    template <typename T, arrnd_type Arrnd>
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator-(const T& lhs, Arrnd&& rhs)
+    {
+        return elementwise(std::move(rhs), [&lhs](const auto& b) {
             return lhs - b;
         });
     }
@@ -10656,33 +14966,60 @@ namespace details {
     }
 
     template <arrnd_type Arrnd, typename T>
-    inline constexpr auto& operator-=(Arrnd& lhs, const T& rhs)
+    inline constexpr auto& operator-=(Arrnd& lhs, const T& rhs)
+    {
+        return lhs.apply([&rhs](const auto& a) {
+            return a - rhs;
+        });
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+    [[nodiscard]] inline constexpr auto operator*(const Arrnd1& lhs, const Arrnd2& rhs)
+    {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
+            return a * b;
+        });
+    }
+
+    template <arrnd_type Arrnd, typename T>
+    [[nodiscard]] inline constexpr auto operator*(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.apply([&rhs](const auto& a) {
-            return a - rhs;
+        return elementwise(lhs, [&rhs](const auto& a) {
+            return a * rhs;
+        });
+    }
+
+    template <typename T, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto operator*(const T& lhs, const Arrnd& rhs)
+    {
+        return elementwise(rhs, [&lhs](const auto& b) {
+            return lhs * b;
         });
     }
 
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
-    [[nodiscard]] inline constexpr auto operator*(const Arrnd1& lhs, const Arrnd2& rhs)
+        requires(!std::is_reference_v<Arrnd1> || !std::is_reference_v<Arrnd2>)
+    [[nodiscard]] inline constexpr auto operator*(Arrnd1&& lhs, Arrnd2&& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(std::forward<Arrnd1>(lhs), std::forward<Arrnd2>(rhs), [](const auto& a, const auto& b) {
             return a * b;
         });
     }
 
     template <arrnd_type Arrnd, typename T>
-    [[nodiscard]] inline constexpr auto operator*(const Arrnd& lhs, const T& rhs)
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator*(Arrnd&& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(std::move(lhs), [&rhs](const auto& a) {
             return a * rhs;
         });
     }
 
     template <typename T, arrnd_type Arrnd>
-    [[nodiscard]] inline constexpr auto operator*(const T& lhs, const Arrnd& rhs)
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator*(const T& lhs, Arrnd&& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(std::move(rhs), [&lhs](const auto& b) {
             return lhs * b;
         });
     }
@@ -10706,7 +15043,7 @@ namespace details {
     template <arrnd_type Arrnd1, arrnd_type Arrnd2>
     [[nodiscard]] inline constexpr auto operator/(const Arrnd1& lhs, const Arrnd2& rhs)
     {
-        return lhs.transform(rhs, [](const auto& a, const auto& b) {
+        return elementwise(lhs, rhs, [](const auto& a, const auto& b) {
             return a / b;
         });
     }
@@ -10714,7 +15051,7 @@ namespace details {
     template <arrnd_type Arrnd, typename T>
     [[nodiscard]] inline constexpr auto operator/(const Arrnd& lhs, const T& rhs)
     {
-        return lhs.transform([&rhs](const auto& a) {
+        return elementwise(lhs, [&rhs](const auto& a) {
             return a / rhs;
         });
     }
@@ -10722,7 +15059,34 @@ namespace details {
     template <typename T, arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator/(const T& lhs, const Arrnd& rhs)
     {
-        return rhs.transform([&lhs](const auto& b) {
+        return elementwise(rhs, [&lhs](const auto& b) {
+            return lhs / b;
+        });
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+        requires(!std::is_reference_v<Arrnd1> || !std::is_reference_v<Arrnd2>)
+    [[nodiscard]] inline constexpr auto operator/(Arrnd1&& lhs, Arrnd2&& rhs)
+    {
+        return elementwise(std::forward<Arrnd1>(lhs), std::forward<Arrnd2>(rhs), [](const auto& a, const auto& b) {
+            return a / b;
+        });
+    }
+
+    template <arrnd_type Arrnd, typename T>
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator/(Arrnd&& lhs, const T& rhs)
+    {
+        return elementwise(std::move(lhs), [&rhs](const auto& a) {
+            return a / rhs;
+        });
+    }
+
+    template <typename T, arrnd_type Arrnd>
+        requires(!std::is_reference_v<Arrnd> && !arrnd_type<T> && !arrnd_lazy_expr_type<T>)
+    [[nodiscard]] inline constexpr auto operator/(const T& lhs, Arrnd&& rhs)
+    {
+        return elementwise(std::move(rhs), [&lhs](const auto& b) {
             return lhs / b;
         });
     }
@@ -11011,20 +15375,432 @@ namespace details {
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto operator-(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             return -a;
         });
     }
 
+    template <arrnd_type Arrnd>
+        requires(!std::is_reference_v<Arrnd>)
+    [[nodiscard]] inline constexpr auto operator-(Arrnd&& arr)
+    {
+        return elementwise(std::move(arr), [](const auto& a) {
+            return -a;
+        });
+    }
+
+    // lazy expressions operators - each of them creates an expression node
+    // instead of evaluating its operands into a new array
+
+    template <arrnd_lazy_expr_type Expr1, arrnd_lazy_expr_type Expr2>
+    [[nodiscard]] inline constexpr auto operator+(const Expr1& lhs, const Expr2& rhs)
+    {
+        return arrnd_lazy_expr<std::plus<>, Expr1, Expr2>(std::plus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto operator+(const Expr& lhs, const Arrnd& rhs)
+    {
+        return arrnd_lazy_expr<std::plus<>, Expr, Arrnd>(std::plus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_type Arrnd, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator+(const Arrnd& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::plus<>, Arrnd, Expr>(std::plus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, typename T>
+    [[nodiscard]] inline constexpr auto operator+(const Expr& lhs, const T& rhs)
+    {
+        return arrnd_lazy_expr<std::plus<>, Expr, T>(std::plus<>{}, lhs, rhs);
+    }
+
+    template <typename T, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator+(const T& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::plus<>, T, Expr>(std::plus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr1, arrnd_lazy_expr_type Expr2>
+    [[nodiscard]] inline constexpr auto operator-(const Expr1& lhs, const Expr2& rhs)
+    {
+        return arrnd_lazy_expr<std::minus<>, Expr1, Expr2>(std::minus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto operator-(const Expr& lhs, const Arrnd& rhs)
+    {
+        return arrnd_lazy_expr<std::minus<>, Expr, Arrnd>(std::minus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_type Arrnd, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator-(const Arrnd& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::minus<>, Arrnd, Expr>(std::minus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, typename T>
+    [[nodiscard]] inline constexpr auto operator-(const Expr& lhs, const T& rhs)
+    {
+        return arrnd_lazy_expr<std::minus<>, Expr, T>(std::minus<>{}, lhs, rhs);
+    }
+
+    template <typename T, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator-(const T& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::minus<>, T, Expr>(std::minus<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr1, arrnd_lazy_expr_type Expr2>
+    [[nodiscard]] inline constexpr auto operator*(const Expr1& lhs, const Expr2& rhs)
+    {
+        return arrnd_lazy_expr<std::multiplies<>, Expr1, Expr2>(std::multiplies<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto operator*(const Expr& lhs, const Arrnd& rhs)
+    {
+        return arrnd_lazy_expr<std::multiplies<>, Expr, Arrnd>(std::multiplies<>{}, lhs, rhs);
+    }
+
+    template <arrnd_type Arrnd, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator*(const Arrnd& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::multiplies<>, Arrnd, Expr>(std::multiplies<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, typename T>
+    [[nodiscard]] inline constexpr auto operator*(const Expr& lhs, const T& rhs)
+    {
+        return arrnd_lazy_expr<std::multiplies<>, Expr, T>(std::multiplies<>{}, lhs, rhs);
+    }
+
+    template <typename T, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator*(const T& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::multiplies<>, T, Expr>(std::multiplies<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr1, arrnd_lazy_expr_type Expr2>
+    [[nodiscard]] inline constexpr auto operator/(const Expr1& lhs, const Expr2& rhs)
+    {
+        return arrnd_lazy_expr<std::divides<>, Expr1, Expr2>(std::divides<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto operator/(const Expr& lhs, const Arrnd& rhs)
+    {
+        return arrnd_lazy_expr<std::divides<>, Expr, Arrnd>(std::divides<>{}, lhs, rhs);
+    }
+
+    template <arrnd_type Arrnd, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator/(const Arrnd& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::divides<>, Arrnd, Expr>(std::divides<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr, typename T>
+    [[nodiscard]] inline constexpr auto operator/(const Expr& lhs, const T& rhs)
+    {
+        return arrnd_lazy_expr<std::divides<>, Expr, T>(std::divides<>{}, lhs, rhs);
+    }
+
+    template <typename T, arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator/(const T& lhs, const Expr& rhs)
+    {
+        return arrnd_lazy_expr<std::divides<>, T, Expr>(std::divides<>{}, lhs, rhs);
+    }
+
+    template <arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto operator-(const Expr& expr)
+    {
+        return arrnd_lazy_expr<std::negate<>, Expr>(std::negate<>{}, expr);
+    }
+
+    template <arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto sum(const Expr& expr)
+    {
+        return expr.reduce(std::plus<>{});
+    }
+
+    template <arrnd_lazy_expr_type Expr>
+    [[nodiscard]] inline constexpr auto prod(const Expr& expr)
+    {
+        return expr.reduce(std::multiplies<>{});
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto abs(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::abs;
             return abs(a);
         });
     }
 
+    enum class arrnd_math_accuracy { strict, fast };
+
+    template <typename T>
+    concept fast_math_type = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    template <fast_math_type T>
+    struct fast_math_constants;
+
+    template <>
+    struct fast_math_constants<float> {
+        using int_type = std::int32_t;
+        using bits_type = std::uint32_t;
+        static constexpr int mantissa_bits = 23;
+        static constexpr int exponent_bias = 127;
+        static constexpr bits_type exponent_mask = 0xff;
+        static constexpr bits_type mantissa_mask = 0x7fffff;
+
+        static constexpr float min_normal = 1.17549435e-38f;
+        static constexpr float subnormal_scale = 8388608.0f;
+
+        static constexpr float ln2_hi = 0.693359375f;
+        static constexpr float ln2_lo = -2.12194440e-4f;
+        static constexpr float log2e = 1.44269504f;
+        static constexpr float sqrt2 = 1.41421356f;
+
+        static constexpr float exp_max = 88.7228391f;
+        static constexpr float exp_min = -103.972077f;
+
+        static constexpr float two_over_pi = 0.636619772f;
+        static constexpr float pio2_1 = 1.5703125f;
+        static constexpr float pio2_2 = 4.837512969970703125e-4f;
+        static constexpr float pio2_3 = 7.54978995489188216e-8f;
+        static constexpr float trig_max = 8192.0f;
+
+        static constexpr float tanh_small = 0.5f;
+
+        static constexpr float exp_coeffs[] = {1.0f, 1.0f, 0.5f, 0.16666666666666666f, 0.041666666666666664f,
+            0.008333333333333333f, 0.001388888888888889f, 0.0001984126984126984f};
+        static constexpr float expm1_coeffs[] = {1.0f, 0.5f, 0.16666666666666666f, 0.041666666666666664f,
+            0.008333333333333333f, 0.001388888888888889f, 0.0001984126984126984f, 2.48015873015873e-05f,
+            2.7557319223985893e-06f, 2.755731922398589e-07f};
+        static constexpr float log_coeffs[] = {2.0f, 0.6666666666666666f, 0.4f, 0.2857142857142857f,
+            0.2222222222222222f, 0.18181818181818182f};
+        static constexpr float sin_coeffs[] = {1.0f, -0.16666666666666666f, 0.008333333333333333f,
+            -0.0001984126984126984f, 2.7557319223985893e-06f};
+        static constexpr float cos_coeffs[] = {1.0f, -0.5f, 0.041666666666666664f, -0.001388888888888889f,
+            2.48015873015873e-05f, -2.755731922398589e-07f};
+    };
+
+    template <>
+    struct fast_math_constants<double> {
+        using int_type = std::int64_t;
+        using bits_type = std::uint64_t;
+        static constexpr int mantissa_bits = 52;
+        static constexpr int exponent_bias = 1023;
+        static constexpr bits_type exponent_mask = 0x7ff;
+        static constexpr bits_type mantissa_mask = 0xfffffffffffff;
+
+        static constexpr double min_normal = 2.2250738585072014e-308;
+        static constexpr double subnormal_scale = 4503599627370496.0;
+
+        static constexpr double ln2_hi = 6.93147180369123816490e-01;
+        static constexpr double ln2_lo = 1.90821492927058770002e-10;
+        static constexpr double log2e = 1.4426950408889634;
+        static constexpr double sqrt2 = 1.4142135623730951;
+
+        static constexpr double exp_max = 709.782712893384;
+        static constexpr double exp_min = -745.1332191019411;
+
+        static constexpr double two_over_pi = 0.6366197723675814;
+        static constexpr double pio2_1 = 1.57079632673412561417e+00;
+        static constexpr double pio2_2 = 6.07710050630396597660e-11;
+        static constexpr double pio2_3 = 2.02226624879595063154e-21;
+        static constexpr double trig_max = 100000.0;
+
+        static constexpr double tanh_small = 0.5;
+
+        static constexpr double exp_coeffs[] = {1.0, 1.0, 0.5, 0.16666666666666666, 0.041666666666666664,
+            0.008333333333333333, 0.001388888888888889, 0.0001984126984126984, 2.48015873015873e-05,
+            2.7557319223985893e-06, 2.755731922398589e-07, 2.505210838544172e-08, 2.08767569878681e-09,
+            1.6059043836821613e-10};
+        static constexpr double expm1_coeffs[] = {1.0, 0.5, 0.16666666666666666, 0.041666666666666664,
+            0.008333333333333333, 0.001388888888888889, 0.0001984126984126984, 2.48015873015873e-05,
+            2.7557319223985893e-06, 2.755731922398589e-07, 2.505210838544172e-08, 2.08767569878681e-09,
+            1.6059043836821613e-10, 1.1470745597729725e-11, 7.647163731819816e-13, 4.779477332387385e-14,
+            2.8114572543455206e-15, 1.5619206968586225e-16};
+        static constexpr double log_coeffs[] = {2.0, 0.6666666666666666, 0.4, 0.2857142857142857, 0.2222222222222222,
+            0.18181818181818182, 0.15384615384615385, 0.13333333333333333, 0.11764705882352941,
+            0.10526315789473684, 0.09523809523809523};
+        static constexpr double sin_coeffs[] = {1.0, -0.16666666666666666, 0.008333333333333333,
+            -0.0001984126984126984, 2.7557319223985893e-06, -2.505210838544172e-08, 1.6059043836821613e-10,
+            -7.647163731819816e-13};
+        static constexpr double cos_coeffs[] = {1.0, -0.5, 0.041666666666666664, -0.001388888888888889,
+            2.48015873015873e-05, -2.755731922398589e-07, 2.08767569878681e-09, -1.1470745597729725e-11,
+            4.779477332387385e-14};
+    };
+
+    // coeffs[0] + coeffs[1] * x + ... + coeffs[N - 1] * x^(N - 1)
+    template <fast_math_type T, std::size_t N>
+    [[nodiscard]] inline T polynomial(T x, const T (&coeffs)[N]) noexcept
+    {
+        T res = coeffs[N - 1];
+        for (std::size_t i = N - 1; i > 0; --i) {
+            res = res * x + coeffs[i - 1];
+        }
+        return res;
+    }
+
+    // the following functions are branch free (i.e. vectorizable), and their results are
+    // within a few ulps from the std functions results.
+
+    // e^x = 2^k * e^r, where k = round(x / ln2) and |r| <= ln2 / 2
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_exp(T x) noexcept
+    {
+        using consts = fast_math_constants<T>;
+        using int_type = typename consts::int_type;
+
+        T xc = x > consts::exp_max ? consts::exp_max : (x < consts::exp_min ? consts::exp_min : x);
+        xc = xc == xc ? xc : T{0};
+
+        T kf = xc * consts::log2e;
+        auto k = static_cast<std::int32_t>(kf + (kf >= T{0} ? T{0.5} : T{-0.5}));
+        T kt = static_cast<T>(k);
+        T r = (xc - kt * consts::ln2_hi) - kt * consts::ln2_lo;
+
+        // 2^k is applied in two steps, to cover the subnormal results and the largest finite results
+        std::int32_t k1 = k / 2;
+        std::int32_t k2 = k - k1;
+        T scale1 = std::bit_cast<T>(static_cast<int_type>(static_cast<int_type>(k1) + consts::exponent_bias)
+            << consts::mantissa_bits);
+        T scale2 = std::bit_cast<T>(static_cast<int_type>(static_cast<int_type>(k2) + consts::exponent_bias)
+            << consts::mantissa_bits);
+
+        T res = polynomial(r, consts::exp_coeffs) * scale1 * scale2;
+
+        res = x > consts::exp_max ? std::numeric_limits<T>::infinity() : res;
+        res = x < consts::exp_min ? T{0} : res;
+        return x == x ? res : x;
+    }
+
+    // log(x) = e * ln2 + log(m), where sqrt(2) / 2 < m <= sqrt(2),
+    // and log(m) = 2 * atanh(s), where s = (m - 1) / (m + 1)
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_log(T x) noexcept
+    {
+        using consts = fast_math_constants<T>;
+        using bits_type = typename consts::bits_type;
+
+        bool subnormal = x < consts::min_normal;
+        T xs = subnormal ? x * consts::subnormal_scale : x;
+
+        auto bits = std::bit_cast<bits_type>(xs);
+        auto e = static_cast<std::int32_t>((bits >> consts::mantissa_bits) & consts::exponent_mask)
+            - consts::exponent_bias - (subnormal ? consts::mantissa_bits : 0);
+        T m = std::bit_cast<T>(static_cast<bits_type>(
+            (bits & consts::mantissa_mask) | (static_cast<bits_type>(consts::exponent_bias) << consts::mantissa_bits)));
+
+        bool above_sqrt2 = m > consts::sqrt2;
+        m = above_sqrt2 ? m * T{0.5} : m;
+        e = above_sqrt2 ? e + 1 : e;
+
+        T f = m - T{1};
+        T s = f / (T{2} + f);
+        T ef = static_cast<T>(e);
+
+        T res = ef * consts::ln2_hi + (s * polynomial(s * s, consts::log_coeffs) + ef * consts::ln2_lo);
+
+        res = x == std::numeric_limits<T>::infinity() ? x : res;
+        res = x == T{0} ? -std::numeric_limits<T>::infinity() : res;
+        res = x < T{0} ? std::numeric_limits<T>::quiet_NaN() : res;
+        return x == x ? res : x;
+    }
+
+    // tanh(x) = (e^2x - 1) / (e^2x + 1), where e^2x - 1 of small arguments is computed
+    // by its taylor series to avoid cancellation
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_tanh(T x) noexcept
+    {
+        using consts = fast_math_constants<T>;
+
+        T a = std::abs(x);
+        T y = T{2} * a;
+
+        T expm1 = y * polynomial(y, consts::expm1_coeffs);
+        T small = expm1 / (expm1 + T{2});
+        T large = T{1} - T{2} / (fast_exp(y) + T{1});
+
+        return std::copysign(a < consts::tanh_small ? small : large, x);
+    }
+
+    // sin and cos of |x| <= trig_max are reduced by x = k * pi / 2 + r, where |r| <= pi / 4.
+    // other arguments are not supported (see fast_trig_domain).
+    template <fast_math_type T>
+    [[nodiscard]] inline bool fast_trig_domain(T x) noexcept
+    {
+        return std::abs(x) <= fast_math_constants<T>::trig_max;
+    }
+
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_sincos(T x, bool is_cos) noexcept
+    {
+        using consts = fast_math_constants<T>;
+
+        T xc = fast_trig_domain(x) ? x : T{0};
+
+        T kf = xc * consts::two_over_pi;
+        auto k = static_cast<std::int32_t>(kf + (kf >= T{0} ? T{0.5} : T{-0.5}));
+        T kt = static_cast<T>(k);
+        T r = ((xc - kt * consts::pio2_1) - kt * consts::pio2_2) - kt * consts::pio2_3;
+        T r2 = r * r;
+
+        T sin_r = r * polynomial(r2, consts::sin_coeffs);
+        T cos_r = polynomial(r2, consts::cos_coeffs);
+
+        // quadrant of x, shifted by one for cos(x) = sin(x + pi / 2)
+        std::int32_t q = is_cos ? k + 1 : k;
+        T res = (q & 1) ? cos_r : sin_r;
+        return (q & 2) ? -res : res;
+    }
+
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_sin(T x) noexcept
+    {
+        return fast_sincos(x, false);
+    }
+
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_cos(T x) noexcept
+    {
+        return fast_sincos(x, true);
+    }
+
+    // pow(x, y) = e^(y * log(x)) of positive and finite x and finite y (see fast_pow_domain),
+    // the relative error grows with |y * log(x)|
+    template <fast_math_type T>
+    [[nodiscard]] inline bool fast_pow_domain(T x, T y) noexcept
+    {
+        return x > T{0} && x < std::numeric_limits<T>::infinity() && std::abs(y) < std::numeric_limits<T>::infinity();
+    }
+
+    template <fast_math_type T>
+    [[nodiscard]] inline T fast_pow(T x, T y) noexcept
+    {
+        return fast_exp(y * fast_log(fast_pow_domain(x, y) ? x : T{1}));
+    }
+
+    // elements, which are out of the fast functions domain, are recomputed by the std functions
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2, typename Pred, typename Func>
+    inline constexpr void fast_math_fixup(const Arrnd1& arr, Arrnd2& res, Pred pred, Func func)
+    {
+        zipped_invoke(
+            [&pred, &func](auto arr_elems, auto res_elems) {
+                for (auto t : zip(arr_elems, res_elems)) {
+                    if (!pred(std::get<0>(t))) {
+                        std::get<1>(t) = func(std::get<0>(t));
+                    }
+                }
+            },
+            arr, res);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto acos(const Arrnd& arr)
     {
@@ -11082,12 +15858,35 @@ namespace details {
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto cos(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::cos;
             return cos(a);
         });
     }
 
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto cos(const Arrnd& arr, arrnd_math_accuracy accuracy)
+    {
+        if constexpr (Arrnd::is_flat && fast_math_type<typename Arrnd::value_type>) {
+            if (accuracy == arrnd_math_accuracy::fast) {
+                auto res = elementwise(arr, [](const auto& a) {
+                    return fast_cos(a);
+                });
+                fast_math_fixup(
+                    arr, res,
+                    [](const auto& a) {
+                        return fast_trig_domain(a);
+                    },
+                    [](const auto& a) {
+                        using std::cos;
+                        return cos(a);
+                    });
+                return res;
+            }
+        }
+        return cos(arr);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto cosh(const Arrnd& arr)
     {
@@ -11100,21 +15899,47 @@ namespace details {
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto exp(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::exp;
             return exp(a);
         });
     }
 
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto exp(const Arrnd& arr, arrnd_math_accuracy accuracy)
+    {
+        if constexpr (Arrnd::is_flat && fast_math_type<typename Arrnd::value_type>) {
+            if (accuracy == arrnd_math_accuracy::fast) {
+                return elementwise(arr, [](const auto& a) {
+                    return fast_exp(a);
+                });
+            }
+        }
+        return exp(arr);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto log(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::log;
             return log(a);
         });
     }
 
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto log(const Arrnd& arr, arrnd_math_accuracy accuracy)
+    {
+        if constexpr (Arrnd::is_flat && fast_math_type<typename Arrnd::value_type>) {
+            if (accuracy == arrnd_math_accuracy::fast) {
+                return elementwise(arr, [](const auto& a) {
+                    return fast_log(a);
+                });
+            }
+        }
+        return log(arr);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto log10(const Arrnd& arr)
     {
@@ -11143,15 +15968,92 @@ namespace details {
         });
     }
 
+    template <arrnd_type Arrnd, typename U>
+        requires(!arrnd_type<U>)
+    [[nodiscard]] inline constexpr auto pow(const Arrnd& arr, const U& value, arrnd_math_accuracy accuracy)
+    {
+        using value_type = typename Arrnd::value_type;
+
+        if constexpr (Arrnd::is_flat && fast_math_type<value_type> && std::is_arithmetic_v<U>) {
+            if (accuracy == arrnd_math_accuracy::fast) {
+                auto y = static_cast<value_type>(value);
+                auto res = elementwise(arr, [y](const auto& a) {
+                    return fast_pow(a, y);
+                });
+                fast_math_fixup(
+                    arr, res,
+                    [y](const auto& a) {
+                        return fast_pow_domain(a, y);
+                    },
+                    [y](const auto& a) {
+                        using std::pow;
+                        return pow(a, y);
+                    });
+                return res;
+            }
+        }
+        return pow(arr, value);
+    }
+
+    template <arrnd_type Arrnd1, arrnd_type Arrnd2>
+    [[nodiscard]] inline constexpr auto pow(const Arrnd1& arr, const Arrnd2& values, arrnd_math_accuracy accuracy)
+    {
+        using value_type = typename Arrnd1::value_type;
+
+        if constexpr (Arrnd1::is_flat && Arrnd2::is_flat && fast_math_type<value_type>
+            && std::is_same_v<value_type, typename Arrnd2::value_type>) {
+            if (accuracy == arrnd_math_accuracy::fast && total(arr.info()) == total(values.info())) {
+                auto res = elementwise(arr, values, [](const auto& a, const auto& b) {
+                    return fast_pow(a, b);
+                });
+                zipped_invoke(
+                    [](auto arr_elems, auto values_elems, auto res_elems) {
+                        for (auto t : zip(arr_elems, values_elems, res_elems)) {
+                            if (!fast_pow_domain(std::get<0>(t), std::get<1>(t))) {
+                                using std::pow;
+                                std::get<2>(t) = pow(std::get<0>(t), std::get<1>(t));
+                            }
+                        }
+                    },
+                    arr, values, res);
+                return res;
+            }
+        }
+        return pow(arr, values);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto sin(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::sin;
             return sin(a);
         });
     }
 
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto sin(const Arrnd& arr, arrnd_math_accuracy accuracy)
+    {
+        if constexpr (Arrnd::is_flat && fast_math_type<typename Arrnd::value_type>) {
+            if (accuracy == arrnd_math_accuracy::fast) {
+                auto res = elementwise(arr, [](const auto& a) {
+                    return fast_sin(a);
+                });
+                fast_math_fixup(
+                    arr, res,
+                    [](const auto& a) {
+                        return fast_trig_domain(a);
+                    },
+                    [](const auto& a) {
+                        using std::sin;
+                        return sin(a);
+                    });
+                return res;
+            }
+        }
+        return sin(arr);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto sinh(const Arrnd& arr)
     {
@@ -11164,12 +16066,19 @@ namespace details {
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto sqrt(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::sqrt;
             return sqrt(a);
         });
     }
 
+    // the hardware square root is correctly rounded, i.e. there is no faster approximation
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto sqrt(const Arrnd& arr, arrnd_math_accuracy)
+    {
+        return sqrt(arr);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto tan(const Arrnd& arr)
     {
@@ -11182,12 +16091,25 @@ namespace details {
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto tanh(const Arrnd& arr)
     {
-        return arr.transform([](const auto& a) {
+        return elementwise(arr, [](const auto& a) {
             using std::tanh;
             return tanh(a);
         });
     }
 
+    template <arrnd_type Arrnd>
+    [[nodiscard]] inline constexpr auto tanh(const Arrnd& arr, arrnd_math_accuracy accuracy)
+    {
+        if constexpr (Arrnd::is_flat && fast_math_type<typename Arrnd::value_type>) {
+            if (accuracy == arrnd_math_accuracy::fast) {
+                return elementwise(arr, [](const auto& a) {
+                    return fast_tanh(a);
+                });
+            }
+        }
+        return tanh(arr);
+    }
+
     template <arrnd_type Arrnd>
     [[nodiscard]] inline constexpr auto round(const Arrnd& arr)
     {
@@ -11685,15 +16607,26 @@ namespace details {
 }
 
 using details::arrnd_type;
+using details::arrnd_lazy_expr_type;
 using details::arrnd_json;
 
 using details::arrnd_traversal_type;
 using details::arrnd_traversal_result;
 using details::arrnd_traversal_container;
 
+using details::arrnd_parallel_policy;
+using details::arrnd_scan_type;
+using details::arrnd_math_accuracy;
+using details::accumulate_as;
+using details::arrnd_moments;
+
 using details::arrnd_common_shape;
 using details::arrnd_lazy_filter;
+using details::arrnd_lazy_expr;
 using details::arrnd;
+using details::arrnd_lu;
+using details::arrnd_cholesky;
+using details::arrnd_qr;
 
 using details::begin;
 using details::cbegin;
@@ -11705,6 +16638,7 @@ using details::rend;
 using details::crend;
 
 using details::concat;
+using details::lazy;
 
 using details::all;
 using details::any;
@@ -11714,12 +16648,27 @@ using details::any_equal;
 using details::any_close;
 
 using details::sum;
+using details::moments;
+using details::argmin;
+using details::argmax;
+using details::topk;
+using details::cumsum;
+using details::cumprod;
+using details::rolling_sum;
+using details::rolling_mean;
+using details::rolling_var;
+using details::rolling_min;
+using details::rolling_max;
 using details::prod;
 using details::min;
 using details::max;
 using details::dot;
 using details::det;
 using details::inv;
+using details::solve;
+using details::lu;
+using details::cholesky;
+using details::qr;
 using details::close;
 using details::abs;
 using details::acos;
@@ -11753,6 +16702,9 @@ using details::sign;
 
 using details::zeros;
 using details::eye;
+#ifdef OC_ARRND_HAS_MMAP
+using details::map_file;
+#endif // OC_ARRND_HAS_MMAP
 
 }
 
@@ -487,6 +487,31 @@ TEST(arrnd_test, transpose)
 //    EXPECT_EQ(0, (rarr[{0}][{0}][{1, 0}]));
 //}
 
+TEST(arrnd_test, traverse_continuous_and_non_continuous_arrays)
+{
+    using namespace oc::arrnd;
+
+    arrnd<int> arr({3, 2}, {1, 2, 3, 4, 5, 6});
+    auto slc = arr[{interval<>::from(1), interval<>::full()}];
+    auto tarr = transpose(arr, {1, 0});
+
+    EXPECT_TRUE(all_equal(arr + 1, arrnd<int>({3, 2}, {2, 3, 4, 5, 6, 7})));
+    EXPECT_TRUE(all_equal(slc + arrnd<int>({2, 2}, {1, 1, 1, 1}), arrnd<int>({2, 2}, {4, 5, 6, 7})));
+    EXPECT_TRUE(all_equal(tarr * tarr, arrnd<int>({2, 3}, {1, 9, 25, 4, 16, 36})));
+
+    EXPECT_EQ(21, arr.reduce(std::plus<>{}));
+    EXPECT_EQ(18, slc.reduce(std::plus<>{}));
+    EXPECT_EQ(31, arr.fold(10, std::plus<>{}));
+
+    slc.apply([](int a) {
+        return a * 10;
+    });
+    EXPECT_TRUE(all_equal(arr, arrnd<int>({3, 2}, {1, 2, 30, 40, 50, 60})));
+
+    arr.copy_from({6, 5, 4});
+    EXPECT_TRUE(all_equal(arr, arrnd<int>({3, 2}, {6, 5, 4, 40, 50, 60})));
+}
+
 TEST(arrnd_test, equal)
 {
     using Integer_array = oc::arrnd::arrnd<int>;
@@ -1682,6 +1707,77 @@ TEST(arrnd_test, can_access_its_creators_chain_if_available)
         // self assignment cancels creator
         EXPECT_EQ(nullptr, sarr1.creator());
     }
+
+    // chain of unsliced copy
+    {
+        arrnd<int> arr({2, 4}, 0);
+        arrnd<int> sarr2;
+        {
+            arrnd<int> carr = arr;
+            arrnd<int> sarr1 = carr[interval<>::at(0)];
+            EXPECT_EQ(&carr, sarr1.creator());
+            EXPECT_EQ(nullptr, carr.creator());
+
+            sarr2 = arr[interval<>::at(1)];
+            EXPECT_EQ(&arr, sarr2.creator());
+        }
+        // creator validity is shared with copies that were made before slicing
+        EXPECT_EQ(&arr, sarr2.creator());
+    }
+}
+
+// counts allocations of elements buffers (of double) and of other types (i.e. shared pointers control blocks)
+struct allocations_counter {
+    static inline std::size_t buffers = 0;
+    static inline std::size_t others = 0;
+};
+
+template <typename T>
+struct counting_allocator : oc::arrnd::simple_allocator<T> {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    constexpr counting_allocator(const counting_allocator<U>&) noexcept
+    { }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        ++(std::is_same_v<T, double> ? allocations_counter::buffers : allocations_counter::others);
+        return oc::arrnd::simple_allocator<T>::allocate(n);
+    }
+};
+
+TEST(arrnd_test, creators_chain_is_allocated_only_by_slicing_or_copying)
+{
+    using namespace oc::arrnd;
+
+    using counted_arrnd = arrnd<double, simple_vector_traits<double, counting_allocator>>;
+
+    counted_arrnd arr({4, 3}, 1.0);
+    allocations_counter::buffers = 0;
+    allocations_counter::others = 0;
+
+    // each storage allocates its buffer and its control block only
+    auto res = (arr + 1.0) * 2.0;
+    auto squares = arr.transform([](double value) {
+        return value * value;
+    });
+    auto moved = std::move(squares);
+    EXPECT_EQ(sum(res) + sum(moved), 60.0);
+    EXPECT_EQ(allocations_counter::others, allocations_counter::buffers);
+
+    // the slices of an array share a single token
+    double rows_sum = 0.0;
+    for (auto it = arr.cbegin(0, arrnd_returned_slice_iterator_tag{});
+         it != arr.cend(0, arrnd_returned_slice_iterator_tag{}); ++it) {
+        rows_sum += sum(*it);
+    }
+    auto col = arr[{interval<>::full(), interval<>::at(1)}];
+    EXPECT_EQ(rows_sum, 12.0);
+    EXPECT_EQ(col.creator(), &arr);
+    EXPECT_EQ(allocations_counter::others, allocations_counter::buffers + 1);
 }
 
 TEST(arrnd_test, can_be_assigned_with_value)
@@ -12,6 +12,8 @@
 #include <complex>
 #include <random>
 #include <thread>
+#include <vector>
+#include <numeric>
 
 #include <oc/arrnd.h>
 
@@ -67,6 +69,36 @@ TEST(arrnd_test, dot)
 
         EXPECT_TRUE(all_equal(res, arrnd<double>({1, 2, 2}, {17.0, 34.0, 39.5, 79.0})));
     }
+
+    // matrices sizes bigger than the multiplication blocks sizes
+    {
+        const std::size_t m = 70;
+        const std::size_t k = 130;
+        const std::size_t n = 260;
+
+        arrnd<int> arr1({m, k});
+        std::iota(arr1.begin(), arr1.end(), 0);
+        arrnd<int> arr2({n, k});
+        std::iota(arr2.begin(), arr2.end(), 0);
+        arr2 = arr2 % 7;
+
+        // transposed input
+        auto tarr2 = arr2;
+        tarr2.info() = transpose(arr2.info(), {1, 0});
+
+        arrnd<int> expected({m, n});
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                int sum = 0;
+                for (std::size_t p = 0; p < k; ++p) {
+                    sum += arr1[{i, p}] * arr2[{j, p}];
+                }
+                expected[{i, j}] = sum;
+            }
+        }
+
+        EXPECT_TRUE(all_equal(dot(arr1, tarr2), expected));
+    }
 }
 
 TEST(arrnd_test, det)
@@ -84,6 +116,31 @@ TEST(arrnd_test, det)
                 return det(val);
             }),
         arrnd<arrnd<int>>({2}, {arrnd<int>({2, 1}, {-240, -16}), arrnd<int>({1}, {49})})));
+
+    // big matrices - tridiagonal matrix with determinant n + 1
+    {
+        const std::size_t n = 20;
+
+        arrnd<int> iarr({n, n}, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            iarr[{i, i}] = 2;
+            if (i + 1 < n) {
+                iarr[{i, i + 1}] = -1;
+                iarr[{i + 1, i}] = -1;
+            }
+        }
+        EXPECT_TRUE(all_equal(det(iarr), arrnd<int>({1}, {static_cast<int>(n + 1)})));
+
+        arrnd<double> darr({n, n});
+        darr.copy_from(iarr);
+        EXPECT_TRUE(all_close(det(darr), arrnd<double>({1}, {static_cast<double>(n + 1)})));
+    }
+
+    // pivoting required and singular matrices
+    EXPECT_TRUE(all_close(det(arrnd<double>({3, 3}, {0, 1, 2, 1, 0, 3, 4, -3, 8})), arrnd<double>({1}, {-2})));
+    EXPECT_TRUE(all_equal(det(arrnd<int>({3, 3}, {0, 1, 2, 1, 0, 3, 4, -3, 8})), arrnd<int>({1}, {-2})));
+    EXPECT_TRUE(all_equal(det(arrnd<int>({3, 3}, {1, 2, 3, 2, 4, 6, 1, 0, 1})), arrnd<int>({1}, {0})));
+    EXPECT_TRUE(all_close(det(arrnd<double>({3, 3}, {1, 2, 3, 2, 4, 6, 1, 0, 1})), arrnd<double>({1}, {0})));
 }
 
 TEST(arrnd_test, inv)
@@ -103,97 +160,153 @@ TEST(arrnd_test, inv)
             {arrnd<double>({2, 2, 2}, {-1.5, 0.5, 1.25, -0.25, -3.5, 2.5, 3.25, -2.25}),
                 arrnd<double>({2, 2}, {1, 0, 0, 1}),
                 arrnd<double>({3, 3}, {0.2, 0.2, 0.0, -0.2, 0.3, 1.0, 0.2, -0.3, 0.0})})));
+
+    // big matrices - pages of diagonally dominant matrices
+    {
+        const std::size_t n = 16;
+
+        arrnd<double> arr({3, n, n}, [i = 0]() mutable {
+            return static_cast<double>((i++ * 7) % 11);
+        });
+        for (std::size_t p = 0; p < 3; ++p) {
+            for (std::size_t i = 0; i < n; ++i) {
+                arr[{p, i, i}] += 100.0;
+            }
+        }
+
+        EXPECT_TRUE(all_close(dot(arr, inv(arr)), eye<arrnd<double>>({3, n, n})));
+    }
+
+    // integral matrices are eliminated in floating point
+    EXPECT_TRUE(all_equal(inv(arrnd<int>({2, 2}, {2, 1, 1, 1})), arrnd<int>({2, 2}, {1, -1, -1, 2})));
+    EXPECT_TRUE(all_equal(inv(arrnd<int>({2, 3, 3}, {1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 2, 0, 0, 1, 0, 3, 7, 1})),
+        arrnd<int>({2, 3, 3}, {1, -1, 0, 0, 1, 0, 0, 0, 1, 1, -2, 0, 0, 1, 0, -3, -1, 1})));
+
+    EXPECT_THROW(std::ignore = inv(arrnd<double>({3, 3}, {1, 2, 3, 2, 4, 6, 1, 0, 1})), std::invalid_argument);
+}
+
+TEST(arrnd_test, solve)
+{
+    using namespace oc::arrnd;
+
+    {
+        arrnd<double> arr({2, 2}, {1, 2, 3, 5});
+        arrnd<double> b({2, 1}, {1, 2});
+
+        EXPECT_TRUE(all_close(solve(arr, b), arrnd<double>({2, 1}, {-1, 1})));
+    }
+
+    // pages
+    {
+        arrnd<double> arr({2, 3, 3}, {2, 1, 1, -1, 1, -1, 1, 2, 3, 1, 2, -2, 2, 1, -5, 1, -4, 1});
+        arrnd<double> b({2, 3, 1}, {2, 3, -10, -15, -21, 18});
+
+        EXPECT_TRUE(all_close(solve(arr, b), arrnd<double>({2, 3, 1}, {3, 1, -5, -1, -4, 3})));
+    }
+
+    // factorization reused for several right hand sides, and a single matrix shared by pages of rhs
+    {
+        arrnd<int> arr({3, 3}, {0, 1, 2, 1, 0, 3, 4, -3, 8});
+        auto fact = lu(arr);
+
+        arrnd<double> x1({3, 2}, {1, 2, 3, 4, 5, 6});
+        arrnd<double> x2({2, 3, 1}, {1, -1, 1, 0, 2, 0});
+
+        EXPECT_TRUE(all_close(fact.solve(dot(arr, x1)), x1));
+        EXPECT_TRUE(all_close(fact.solve(arrnd<double>({2, 3, 1}, {1, 4, 15, 2, 0, -6})), x2));
+    }
+
+    // many pages of factors sharing a single page of rhs of the same number of dims
+    {
+        arrnd<double> arr({4, 3, 3});
+        std::generate(arr.begin(), arr.end(), [i = 0]() mutable {
+            ++i;
+            return (i % 3 == 0 ? 5.0 : 0.0) + (i * 7) % 5;
+        });
+        arrnd<double> b({1, 3, 2}, {1, 2, -1, 0, 3, 1});
+
+        auto x = solve(arr, b);
+        ASSERT_TRUE(std::ranges::equal(x.info().dims(), std::vector<std::size_t>{4, 3, 2}));
+        auto page_of = [](const auto& pages, std::size_t page) {
+            auto res = pages[{interval<>::at(page), interval<>::full(), interval<>::full()}].clone();
+            res.refresh();
+            return res.reshape({3, res.info().dims().back()});
+        };
+        for (std::size_t page = 0; page < 4; ++page) {
+            EXPECT_TRUE(all_close(dot(page_of(arr, page), page_of(x, page)), b.reshape({3, 2})));
+        }
+    }
+
+    EXPECT_THROW(std::ignore = solve(arrnd<double>({2, 2}, {1, 2, 2, 4}), arrnd<double>({2, 1}, {1, 2})),
+        std::invalid_argument);
+}
+
+TEST(arrnd_test, cholesky)
+{
+    using namespace oc::arrnd;
+
+    arrnd<double> arr({3, 3}, {4, 12, -16, 12, 37, -43, -16, -43, 98});
+    arrnd<double> l({3, 3}, {2, 0, 0, 6, 1, 0, -8, 5, 3});
+
+    auto fact = cholesky(arr);
+
+    EXPECT_TRUE(all_close(fact.l(), l));
+
+    arrnd<double> x({3, 1}, {1, -2, 3});
+    EXPECT_TRUE(all_close(fact.solve(dot(arr, x)), x));
+
+    EXPECT_THROW(std::ignore = cholesky(arrnd<double>({2, 2}, {1, 2, 2, 1})), std::invalid_argument);
+}
+
+TEST(arrnd_test, lu)
+{
+    using namespace oc::arrnd;
+
+    arrnd<double> arr({2, 3, 3}, {2, -1, -2, -4, 6, 3, -4, -2, 8, 1, 2, 3, 0, 1, 4, 5, 6, 0});
+
+    auto fact = lu(arr);
+
+    EXPECT_TRUE(all_close(dot(fact.p(), arr), dot(fact.l(), fact.u())));
+
+    arrnd<double> l(
+        {2, 3, 3}, {1.0, 0.0, 0.0, 1.0, 1.0, 0.0, -0.5, -0.25, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.2, 0.8, 1.0});
+    arrnd<double> u(
+        {2, 3, 3}, {-4.0, 6.0, 3.0, 0.0, -8.0, 5.0, 0.0, 0.0, 0.75, 5.0, 6.0, 0.0, 0.0, 1.0, 4.0, 0.0, 0.0, -0.2});
+
+    EXPECT_TRUE(all_close(fact.l(), l));
+    EXPECT_TRUE(all_close(fact.u(), u));
+}
+
+TEST(arrnd_test, qr)
+{
+    using namespace oc::arrnd;
+
+    {
+        arrnd<double> arr({4, 3}, {-1, -1, 1, 1, 3, 3, -1, -1, 5, 1, 3, 7});
+
+        auto fact = qr(arr);
+
+        EXPECT_TRUE(all_close(dot(fact.q(), fact.r()), arr));
+        EXPECT_TRUE(all_close(dot(transpose(fact.q(), {1, 0}), fact.q()), eye<arrnd<double>>({4, 4})));
+        EXPECT_TRUE(all_close(abs(fact.r()), arrnd<double>({4, 3}, {2, 4, 2, 0, 2, 8, 0, 0, 4, 0, 0, 0})));
+
+        // least squares solution of consistent system
+        arrnd<double> x({3, 1}, {1, 2, -1});
+        EXPECT_TRUE(all_close(fact.solve(dot(arr, x)), x));
+    }
+
+    {
+        arrnd<double> arr({2, 3, 3}, {3, 2, 4, 2, 0, 2, 4, 2, 3, 1, 0, 0, 0, 1, 0, 0, 0, 1});
+
+        auto fact = qr(arr);
+
+        EXPECT_TRUE(all_close(dot(fact.q(), fact.r()), arr));
+
+        arrnd<double> x({2, 3, 2}, {1, 2, 3, 4, 5, 6, -1, -2, -3, -4, -5, -6});
+        EXPECT_TRUE(all_close(fact.solve(dot(arr, x)), x));
+    }
 }
 
-//TEST(arrnd_test, solve)
-//{
-//    using namespace oc::arrnd;
-//
-//    arrnd<arrnd<double>> arr({2},
-//        {arrnd<double>({2, 2}, {1, 2, 3, 5}),
-//            arrnd<double>({2, 3, 3}, {2, 1, 1, -1, 1, -1, 1, 2, 3, 1, 2, -2, 2, 1, -5, 1, -4, 1})});
-//
-//    arrnd<arrnd<double>> b({2}, {arrnd<double>({2, 1}, {1, 2}), arrnd<double>({2, 3, 1}, {2, 3, -10, -15, -21, 18})});
-//
-//    arrnd<arrnd<double>> x({2}, {arrnd<double>({2, 1}, {-1, 1}), arrnd<double>({2, 3, 1}, {3, 1, -5, -1, -4, 3})});
-//
-//    EXPECT_TRUE(all_close(solve(arr, b), x));
-//}
-//
-//TEST(arrnd_test, DISABLED_cholesky)
-//{
-//    using namespace oc::arrnd;
-//
-//    arrnd<double> arr({3, 3}, {4, 12, -16, 12, 37, -43, -16, -43, 98});
-//    arrnd<double> l({3, 3}, {2, 0, 0, 6, 1, 0, -8, 5, 3});
-//
-//    EXPECT_TRUE(all_close(cholesky(arr), l));
-//}
-//
-//TEST(arrnd_test, DISABLED_lu)
-//{
-//    using namespace oc::arrnd;
-//
-//    arrnd<double> arr({3, 3}, {2, -1, -2, -4, 6, 3, -4, -2, 8});
-//
-//    auto res = lu(arr)(0);
-//
-//    arrnd<double> l({3, 3}, {1, 0, 0, -2, 1, 0, -2, -1, 1});
-//    arrnd<double> u({3, 3}, {2, -1, -2, 0, 4, -1, 0, 0, 3});
-//
-//    EXPECT_TRUE(all_close(std::get<0>(res), l));
-//    EXPECT_TRUE(all_close(std::get<1>(res), u));
-//}
-//
-//TEST(arrnd_test, DISABLED_qr)
-//{
-//    using namespace oc::arrnd;
-//
-//    {
-//        arrnd<double> arr({4, 3}, {-1, -1, 1, 1, 3, 3, -1, -1, 5, 1, 3, 7});
-//
-//        auto [q, r] = qr(arr)(0);
-//
-//        //arrnd<double> q({4, 3}, {-0.5, 0.5, -0.5, 0.5, 0.5, -0.5, -0.5, 0.5, 0.5, 0.5, 0.5, 0.5});
-//        //arrnd<double> r({3, 3}, {2, 4, 2, 0, 2, 8, 0, 0, 4});
-//
-//        //std::cout <<q<< "\n";
-//        //std::cout << r << "\n\n";
-//
-//        //std::cout << std::get<0>(res) << "\n";
-//        //std::cout << std::get<1>(res) << "\n\n";
-//        //std::cout << std::get<0>(res).dot(std::get<1>(res)) << "\n\n";
-//
-//        EXPECT_TRUE(all_close(q,
-//            arrnd<double>(
-//                {4, 4}, {-0.5, 0.5, -0.5, 0.5, 0.5, 0.5, -0.5, -0.5, -0.5, 0.5, 0.5, -0.5, 0.5, 0.5, 0.5, 0.5})));
-//        EXPECT_TRUE(all_close(r,
-//            arrnd<double>({4, 3},
-//                {2.0, 4.0, 2.0, -3.05311e-16, 2.0, 8.0, 2.77556e-16, -3.88578e-16, 4.0, -3.33067e-16, -1.11022e-16, 8.88178e-16})));
-//
-//        EXPECT_TRUE(all_close(dot(q, r), arr));
-//    }
-//
-//    {
-//        arrnd<double> arr({3, 3}, {3, 2, 4, 2, 0, 2, 4, 2, 3});
-//
-//        auto [q, r] = qr(arr)(0);
-//
-//        //arrnd<double> q(
-//        //    {3, 3}, {0.557086, 0.495188, 0.666667, 0.371391, -0.866578, 0.333333, 0.742781, 0.0618984, -0.666667});
-//        //arrnd<double> r({3, 3}, {5.38516, 2.59973, 5.19947, 0, 1.11417, 0.433289, 0, 0, 1.33333});
-//
-//        EXPECT_TRUE(all_close(q,
-//            arrnd<double>({3, 3},
-//                {0.557086, 0.495188, 0.666667, 0.371391, -0.866578, 0.333333, 0.742781, 0.0618984, -0.666667})));
-//        EXPECT_TRUE(all_close(r,
-//            arrnd<double>({3, 3},
-//                {5.38516, 2.59973, 5.19947, -7.87957e-16, 1.11417, 0.433289, -1.39389e-15, 5.55112e-17, 1.33333})));
-//
-//        EXPECT_TRUE(all_close(dot(q, r), arr));
-//    }
-//}
-//
 //TEST(arrnd_test, DISABLED_hess)
 //{
 //    using namespace oc::arrnd;
@@ -1869,6 +1982,899 @@ TEST(arrnd_test, reduce_elements)
     }
 }
 
+TEST(arrnd_test, parallel_element_wise_passes)
+{
+    using namespace oc::arrnd;
+
+    arrnd_parallel_policy policy{4, 16};
+
+    arrnd<int> arr({40, 30});
+    std::iota(arr.begin(), arr.end(), 0);
+
+    // continuous and non continuous arrays
+    for (const auto& src : {arr, arr[{interval<>::between(1, 39, 2), interval<>::from(3, 3)}]}) {
+        EXPECT_TRUE(all_equal(src.transform(policy, [](int v) { return v * 0.5; }),
+            src.transform([](int v) { return v * 0.5; })));
+        EXPECT_TRUE(all_equal(src.transform(policy, src, std::plus<>{}), src.transform(src, std::plus<>{})));
+        EXPECT_TRUE(all_equal(src.transform(policy, arrnd<int>({1}, 3), std::multiplies<>{}), src * 3));
+
+        EXPECT_EQ(src.reduce(policy, std::plus<>{}), src.reduce(std::plus<>{}));
+        EXPECT_EQ(src.reduce(policy, [](int a, int b) { return std::max(a, b); }),
+            src.reduce([](int a, int b) { return std::max(a, b); }));
+        EXPECT_EQ(src.fold(policy, 7, std::plus<>{}), src.fold(7, std::plus<>{}));
+
+        // the partial results of a heterogeneous op are combined by a separate op
+        auto sum_squares = [](double acc, int v) { return acc + static_cast<double>(v) * v; };
+        EXPECT_DOUBLE_EQ(src.fold(policy, 0.5, sum_squares, std::plus<>{}),
+            std::accumulate(src.begin(), src.end(), 0.5, sum_squares));
+
+        auto cln = src.clone(policy);
+        EXPECT_TRUE(all_equal(cln, src));
+        EXPECT_NE(cln.shared_storage(), src.shared_storage());
+
+        auto cpy = src.clone();
+        cpy.apply(policy, [](int v) { return -v; });
+        EXPECT_TRUE(all_equal(cpy, -src));
+        cpy.apply(policy, src, std::plus<>{});
+        EXPECT_TRUE(all_equal(cpy, zeros<arrnd<int>>(src.info().dims())));
+
+        arrnd<int> dst(src.info().dims(), 0);
+        dst.copy_from(policy, src);
+        EXPECT_TRUE(all_equal(dst, src));
+    }
+
+    // copy into slice
+    {
+        auto dst = zeros<arrnd<int>>({40, 30});
+        auto slc = dst[{interval<>::full(), interval<>::between(5, 25)}];
+        std::vector<int> data(20 * 40, 1);
+        slc.copy_from(policy, data);
+        EXPECT_EQ(dst.reduce(policy, std::plus<>{}), 20 * 40);
+    }
+
+    // broadcasting falls back to sequential transform
+    {
+        arrnd<int> rhs({1, 30});
+        std::iota(rhs.begin(), rhs.end(), 0);
+        EXPECT_TRUE(all_equal(arr.transform(policy, rhs, std::plus<>{}), arr.transform(rhs, std::plus<>{})));
+
+        // including broadcastable arrays of the same number of elements
+        arrnd<int> col({3, 1}, {10, 20, 30});
+        arrnd<int> row({1, 3}, {1, 2, 3});
+        auto res = col.transform(arrnd_parallel_policy{2, 1}, row, std::plus<>{});
+        EXPECT_TRUE(std::ranges::equal(res.info().dims(), std::vector<std::size_t>{3, 3}));
+        EXPECT_TRUE(all_equal(res, col + row));
+
+        auto cpy = col.clone();
+        EXPECT_TRUE(all_equal(cpy.apply(arrnd_parallel_policy{2, 1}, row, std::plus<>{}),
+            col.clone().apply(row, std::plus<>{})));
+    }
+
+    // exceptions are propagated from the worker threads
+    EXPECT_THROW((void)arr.transform(policy,
+                     [](int v) {
+                         if (v == 1000) {
+                             throw std::invalid_argument("invalid value");
+                         }
+                         return v;
+                     }),
+        std::invalid_argument);
+
+    EXPECT_TRUE(arrnd<int>().transform(policy, [](int v) { return v; }).empty());
+    EXPECT_EQ(arrnd<int>().reduce(policy, std::plus<>{}), 0);
+}
+
+TEST(arrnd_test, lazy_expressions)
+{
+    using namespace oc::arrnd;
+
+    arrnd<int> a({3, 4}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    arrnd<int> b({3, 4}, 2);
+    arrnd<double> c({3, 4}, 0.5);
+    arrnd<int> d({3, 4}, {12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1});
+
+    // nodes are evaluated in a single pass only on conversion, assignment or reduction
+    auto expr = lazy(a) + b * c - d;
+    static_assert(arrnd_lazy_expr_type<decltype(expr)>);
+    static_assert(std::is_same_v<decltype(expr.eval()), arrnd<double>>);
+
+    arrnd<double> res = expr;
+    EXPECT_TRUE(all_equal(res, a + b * c - d));
+    EXPECT_TRUE(all_equal(expr.eval(), res));
+
+    EXPECT_EQ(sum(expr), sum(a + b * c - d));
+    EXPECT_EQ(prod(lazy(a) / 2.0), prod(a / 2.0));
+    EXPECT_EQ(expr.fold(1.0, std::plus<>{}), 1.0 + sum(res));
+
+    EXPECT_TRUE(all_equal(arrnd<int>(2 * -lazy(a) + 1), 2 * -a + 1));
+    EXPECT_TRUE(all_equal(arrnd<int>(lazy(a) * lazy(b)), a * b));
+
+    // non continuous arrays
+    auto ta = a;
+    ta.info() = transpose(a.info(), {1, 0});
+    arrnd<int> e({4, 6});
+    std::iota(e.begin(), e.end(), 0);
+    auto sd = e[{interval<>::full(), interval<>::full(2)}];
+    arrnd<int> tres = lazy(ta) - sd;
+    EXPECT_TRUE(all_equal(tres, ta - sd));
+
+    // in place evaluation into a non shared buffer
+    {
+        arrnd<int> dst({3, 4}, 0);
+        auto buff = dst.shared_storage()->data();
+        dst = lazy(a) + d;
+        EXPECT_EQ(buff, dst.shared_storage()->data());
+        EXPECT_TRUE(all_equal(dst, arrnd<int>({3, 4}, 13)));
+
+        // the expression references dst, therefore a new buffer is allocated
+        dst = lazy(dst) - a;
+        EXPECT_TRUE(all_equal(dst, d));
+
+        auto shared = dst;
+        dst = lazy(a) * 0;
+        EXPECT_TRUE(all_equal(shared, d));
+        EXPECT_TRUE(all_equal(dst, arrnd<int>({3, 4}, 0)));
+    }
+
+    // evaluation into a slice
+    {
+        arrnd<int> dst({3, 4}, 0);
+        dst[{interval<>::at(1), interval<>::full()}] = lazy(a[{interval<>::at(0), interval<>::full()}]) * 10;
+        EXPECT_TRUE(all_equal(dst, arrnd<int>({3, 4}, {0, 0, 0, 0, 10, 20, 30, 40, 0, 0, 0, 0})));
+    }
+
+    // evaluation into an overlapping slice of an expression array
+    {
+        arrnd<int> dst({6}, {0, 1, 2, 3, 4, 5});
+        dst[{interval<>::between(1, 6)}] = lazy(dst[{interval<>::between(0, 5)}]) + 0;
+        EXPECT_TRUE(all_equal(dst, arrnd<int>({6}, {0, 0, 1, 2, 3, 4})));
+    }
+
+    EXPECT_THROW((void)(lazy(a) + arrnd<int>({2, 2}, 1)).eval(), std::invalid_argument);
+
+    // arrays of different dims are not broadcasted, even of the same number of elements
+    arrnd<int> col({3, 1}, {1, 2, 3});
+    arrnd<int> row({1, 3}, {1, 2, 3});
+    EXPECT_THROW((void)(lazy(col) + row).eval(), std::invalid_argument);
+    EXPECT_THROW(std::ignore = sum(lazy(col) + row), std::invalid_argument);
+
+    EXPECT_TRUE((lazy(arrnd<int>()) + 1).eval().empty());
+    EXPECT_EQ(sum(lazy(arrnd<int>()) + 1), 0);
+}
+
+TEST(arrnd_test, vectorized_element_wise_operations)
+{
+    using namespace oc::arrnd;
+
+    auto check = []<typename T>(T) {
+        arrnd<T> lhs({7, 53});
+        arrnd<T> rhs({7, 53});
+        for (std::size_t i = 0; i < total(lhs.info()); ++i) {
+            lhs[i] = static_cast<T>(static_cast<int>(i % 17) - 8);
+            rhs[i] = static_cast<T>(static_cast<int>(i % 5) + 1);
+        }
+
+        auto expected = [](auto func) {
+            arrnd<decltype(func(std::size_t{0}))> res({7, 53});
+            for (std::size_t i = 0; i < total(res.info()); ++i) {
+                res[i] = func(i);
+            }
+            return res;
+        };
+
+        // same values through the continuous (vectorized) path and through the non continuous path
+        arrnd<T> tlhs = transpose(lhs, {1, 0});
+        tlhs.info() = transpose(tlhs.info(), {1, 0});
+        EXPECT_NE(tlhs.info().hints(), arrnd_hint::continuous);
+
+        for (const auto& l : {lhs, tlhs}) {
+            EXPECT_TRUE(all_equal(l + rhs, expected([&](std::size_t i) { return lhs[i] + rhs[i]; })));
+            EXPECT_TRUE(all_equal(l - rhs, expected([&](std::size_t i) { return lhs[i] - rhs[i]; })));
+            EXPECT_TRUE(all_equal(l * rhs, expected([&](std::size_t i) { return lhs[i] * rhs[i]; })));
+            EXPECT_TRUE(all_equal(l / rhs, expected([&](std::size_t i) { return lhs[i] / rhs[i]; })));
+            EXPECT_TRUE(all_equal(l * 3, expected([&](std::size_t i) { return lhs[i] * 3; })));
+            EXPECT_TRUE(all_equal(3 - l, expected([&](std::size_t i) { return 3 - lhs[i]; })));
+            EXPECT_TRUE(all_equal(l < rhs, expected([&](std::size_t i) { return lhs[i] < rhs[i]; })));
+            EXPECT_TRUE(all_equal(l >= 0, expected([&](std::size_t i) { return lhs[i] >= 0; })));
+            EXPECT_TRUE(all_equal(l == rhs, expected([&](std::size_t i) { return lhs[i] == rhs[i]; })));
+            EXPECT_TRUE(all_equal(abs(l), expected([&](std::size_t i) {
+                using std::abs;
+                return static_cast<T>(abs(lhs[i]));
+            })));
+            EXPECT_TRUE(all_equal(-l, expected([&](std::size_t i) { return static_cast<T>(-lhs[i]); })));
+
+            EXPECT_EQ(min(l), T{-8});
+            EXPECT_EQ(max(l), T{8});
+            EXPECT_EQ(sum(l), std::accumulate(lhs.begin(), lhs.end(), T{0}));
+        }
+    };
+
+    check(int{});
+    check(std::int64_t{});
+    check(float{});
+    check(double{});
+}
+
+TEST(arrnd_test, fast_math_functions)
+{
+    using namespace oc::arrnd;
+
+    auto check = []<typename T>(T, T tol) {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+        auto near = [tol](T a, T b) {
+            if (std::isnan(b)) {
+                return std::isnan(a);
+            }
+            if (std::isinf(b)) {
+                return a == b;
+            }
+            return std::abs(a - b) <= tol * std::max(std::abs(b), std::numeric_limits<T>::min());
+        };
+
+        auto range = [](T first, T last, std::size_t count, std::initializer_list<T> specials) {
+            arrnd<T> res({count + std::size(specials)});
+            for (std::size_t i = 0; i < count; ++i) {
+                res[i] = first + (last - first) * static_cast<T>(i) / static_cast<T>(count - 1);
+            }
+            std::copy(std::begin(specials), std::end(specials), std::next(res.begin(), count));
+            return res;
+        };
+
+        auto expect_near = [&near](const arrnd<T>& fast, auto std_func, const arrnd<T>& args) {
+            ASSERT_EQ(total(fast.info()), total(args.info()));
+            for (std::size_t i = 0; i < total(args.info()); ++i) {
+                EXPECT_TRUE(near(fast[i], std_func(args[i]))) << args[i] << ": " << fast[i] << " vs " << std_func(args[i]);
+            }
+        };
+
+        auto exp_args = range(T{-110}, T{90}, 1001,
+            {T{0}, T{-0.0}, T{1e-30}, T{-1e-30}, T{1000}, T{-1000}, inf, -inf, nan, std::numeric_limits<T>::max()});
+        expect_near(exp(exp_args, arrnd_math_accuracy::fast), [](T a) { return std::exp(a); }, exp_args);
+
+        auto log_args = range(T{1e-3}, T{1e3}, 1001,
+            {T{1}, T{2}, T{0.5}, T{0}, T{-0.0}, T{-1}, std::numeric_limits<T>::min(),
+                std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::min() / T{3},
+                std::numeric_limits<T>::max(), inf, -inf, nan});
+        expect_near(log(log_args, arrnd_math_accuracy::fast), [](T a) { return std::log(a); }, log_args);
+
+        auto tanh_args = range(T{-20}, T{20}, 1001, {T{0}, T{-0.0}, T{0.4999}, T{0.5}, T{1e-20}, inf, -inf, nan});
+        expect_near(tanh(tanh_args, arrnd_math_accuracy::fast), [](T a) { return std::tanh(a); }, tanh_args);
+
+        // sin and cos are compared in absolute terms, around their zeros the relative error is meaningless
+        auto trig_args = range(T{-100}, T{100}, 1001, {T{0}, T{-0.0}, T{1e6}, T{-1e30}, inf, -inf, nan});
+        auto fast_sin = sin(trig_args, arrnd_math_accuracy::fast);
+        auto fast_cos = cos(trig_args, arrnd_math_accuracy::fast);
+        for (std::size_t i = 0; i < total(trig_args.info()); ++i) {
+            T a = trig_args[i];
+            if (std::isnan(std::sin(a))) {
+                EXPECT_TRUE(std::isnan(fast_sin[i]));
+                EXPECT_TRUE(std::isnan(fast_cos[i]));
+            } else {
+                EXPECT_NEAR(fast_sin[i], std::sin(a), tol * T{4}) << a;
+                EXPECT_NEAR(fast_cos[i], std::cos(a), tol * T{4}) << a;
+            }
+        }
+
+        auto pow_args = range(T{1e-2}, T{10}, 101, {T{0}, T{-2}, T{1}, inf, nan});
+        expect_near(pow(pow_args, T{2.5}, arrnd_math_accuracy::fast), [](T a) { return std::pow(a, T{2.5}); },
+            pow_args);
+        expect_near(pow(pow_args, T{-3}, arrnd_math_accuracy::fast), [](T a) { return std::pow(a, T{-3}); },
+            pow_args);
+        arrnd<T> exps(pow_args.info().dims());
+        for (std::size_t i = 0; i < total(exps.info()); ++i) {
+            exps[i] = static_cast<T>(static_cast<int>(i % 7) - 3);
+        }
+        auto fast_pow = pow(pow_args, exps, arrnd_math_accuracy::fast);
+        for (std::size_t i = 0; i < total(pow_args.info()); ++i) {
+            EXPECT_TRUE(near(fast_pow[i], std::pow(pow_args[i], exps[i])));
+        }
+
+        // strict accuracy and non continuous arrays
+        auto strict_args = range(T{-10}, T{10}, 11, {});
+        EXPECT_TRUE(all_equal(exp(strict_args, arrnd_math_accuracy::strict), exp(strict_args)));
+
+        arrnd<T> mat({4, 6});
+        std::iota(mat.begin(), mat.end(), T{-10});
+        auto slice = mat[{interval<>::full(), interval<>::full(2)}];
+        EXPECT_NE(slice.info().hints(), arrnd_hint::continuous);
+        EXPECT_TRUE(all_close(exp(slice, arrnd_math_accuracy::fast), exp(slice)));
+        EXPECT_TRUE(all_close(sin(slice, arrnd_math_accuracy::fast), sin(slice)));
+        EXPECT_TRUE(all_equal(sqrt(abs(slice), arrnd_math_accuracy::fast), sqrt(abs(slice))));
+    };
+
+    check(float{}, 1e-6f);
+    check(double{}, 1e-14);
+
+    // not floating point arrays are computed by the std functions
+    arrnd<int> iarr({3}, {1, 2, 3});
+    EXPECT_TRUE(all_equal(exp(iarr, arrnd_math_accuracy::fast), exp(iarr)));
+}
+
+TEST(arrnd_test, rvalue_operands_reuse)
+{
+    using namespace oc::arrnd;
+
+    arrnd<double> a({3, 4});
+    arrnd<double> b({3, 4});
+    arrnd<double> c({3, 4});
+    arrnd<double> d({3, 4});
+    std::iota(a.begin(), a.end(), 1.0);
+    std::iota(b.begin(), b.end(), 2.0);
+    std::fill(c.begin(), c.end(), 3.0);
+    std::iota(d.begin(), d.end(), -5.0);
+
+    arrnd<double> expected({3, 4});
+    for (std::size_t i = 0; i < total(expected.info()); ++i) {
+        expected[i] = (a[i] + b[i]) * c[i] + d[i];
+    }
+
+    // the temporary of a + b is the buffer of the whole chain
+    {
+        auto ab = a + b;
+        const auto* data = ab.shared_storage()->data();
+        auto res = (std::move(ab) * c) + d;
+        EXPECT_EQ(res.shared_storage()->data(), data);
+        EXPECT_TRUE(all_equal(res, expected));
+
+        EXPECT_TRUE(all_equal((a + b) * c + d, expected));
+        EXPECT_TRUE(all_equal(d + c * (a + b), expected));
+        EXPECT_TRUE(all_equal(-(-(a + b) * c - d), expected));
+    }
+
+    // rvalue on the right side
+    {
+        auto ab = a + b;
+        const auto* data = ab.shared_storage()->data();
+        auto res = d - std::move(ab);
+        EXPECT_EQ(res.shared_storage()->data(), data);
+        EXPECT_TRUE(all_equal(res, d - (a + b)));
+
+        auto cd = c + d;
+        data = cd.shared_storage()->data();
+        res = 10.0 / std::move(cd);
+        EXPECT_EQ(res.shared_storage()->data(), data);
+        EXPECT_TRUE(all_equal(res, 10.0 / (c + d)));
+    }
+
+    // shared, non continuous or differently typed temporaries are not reused
+    {
+        auto ab = a + b;
+        auto shared = ab;
+        auto res = std::move(ab) + c;
+        EXPECT_NE(res.shared_storage()->data(), shared.shared_storage()->data());
+        EXPECT_TRUE(all_equal(shared, a + b));
+
+        arrnd<double> slice = (a + b)[{interval<>::full(), interval<>::full(2)}];
+        EXPECT_NE(slice.info().hints(), arrnd_hint::continuous);
+        auto slice_res = std::move(slice) * 2.0;
+        EXPECT_TRUE(all_equal(slice_res, ((a + b) * 2.0)[{interval<>::full(), interval<>::full(2)}]));
+
+        arrnd<int> ints({3, 4}, 1);
+        auto mixed = std::move(ints) + a;
+        static_assert(std::is_same_v<decltype(mixed), arrnd<double>>);
+        EXPECT_TRUE(all_equal(mixed, a + 1.0));
+
+        auto same = a + b;
+        auto twice = std::move(same) + std::move(same);
+        EXPECT_TRUE(all_equal(twice, (a + b) * 2.0));
+    }
+}
+
+TEST(arrnd_test, broadcasting_transform)
+{
+    using namespace oc::arrnd;
+
+    arrnd<int> mat({3, 4}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    arrnd<int> row({1, 4}, {10, 20, 30, 40});
+    arrnd<int> vec({4}, {10, 20, 30, 40});
+    arrnd<int> col({3, 1}, {100, 200, 300});
+
+    // zero strides views of the broadcasted dims
+    {
+        auto info = broadcast(col.info(), std::vector<std::size_t>{2, 3, 4});
+        EXPECT_TRUE(std::ranges::equal(info.dims(), std::vector<std::size_t>{2, 3, 4}));
+        EXPECT_TRUE(std::ranges::equal(info.strides(), std::vector<std::size_t>{0, 1, 0}));
+        EXPECT_EQ(info.indices_boundary(), col.info().indices_boundary());
+        EXPECT_FALSE(iscontinuous(info));
+
+        EXPECT_TRUE(isbroadcastable(mat.info(), vec.info()));
+        EXPECT_TRUE(isbroadcastable(row.info(), col.info()));
+        EXPECT_FALSE(isbroadcastable(mat.info(), arrnd<int>({3}).info()));
+        EXPECT_TRUE(std::ranges::equal(broadcast_dims(vec.info(), col.info()), std::vector<std::size_t>{3, 4}));
+        EXPECT_THROW((void)broadcast_dims(mat.info(), arrnd<int>({2, 4}).info()), std::invalid_argument);
+        EXPECT_THROW((void)broadcast(mat.info(), std::vector<std::size_t>{3, 5}), std::invalid_argument);
+    }
+
+    arrnd<int> mat_row({3, 4}, {11, 22, 33, 44, 15, 26, 37, 48, 19, 30, 41, 52});
+    EXPECT_TRUE(all_equal(mat + row, mat_row));
+    EXPECT_TRUE(all_equal(row + mat, mat_row));
+    EXPECT_TRUE(all_equal(mat + vec, mat_row));
+    EXPECT_TRUE(all_equal(vec + mat, mat_row));
+
+    arrnd<int> mat_col({3, 4}, {100, 200, 300, 400, 1000, 1200, 1400, 1600, 2700, 3000, 3300, 3600});
+    EXPECT_TRUE(all_equal(mat * col, mat_col));
+    EXPECT_TRUE(all_equal(col * mat, mat_col));
+
+    // both sides are broadcasted
+    arrnd<int> outer({3, 4}, {110, 120, 130, 140, 210, 220, 230, 240, 310, 320, 330, 340});
+    EXPECT_TRUE(all_equal(col + vec, outer));
+    EXPECT_TRUE(all_equal(vec + col, outer));
+
+    arrnd<int> tensor({2, 3, 4});
+    std::iota(tensor.begin(), tensor.end(), 0);
+    auto tensor_col = tensor - col;
+    ASSERT_TRUE(std::ranges::equal(tensor_col.info().dims(), std::vector<std::size_t>{2, 3, 4}));
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                EXPECT_EQ((tensor_col[{i, j, k}]), (tensor[{i, j, k}] - col[{j, 0}]));
+            }
+        }
+    }
+
+    // non continuous operands
+    arrnd<int> tmat = transpose(mat, {1, 0});
+    tmat.info() = transpose(tmat.info(), {1, 0});
+    EXPECT_TRUE(all_equal(tmat + row, mat_row));
+    EXPECT_TRUE(all_equal(mat + row[{interval<>::full(), interval<>::full()}], mat_row));
+
+    // different dims of the same number of elements are broadcasted too
+    arrnd<int> col_vec({3, 3}, {101, 102, 103, 201, 202, 203, 301, 302, 303});
+    EXPECT_TRUE(all_equal(col + arrnd<int>({3}, {1, 2, 3}), col_vec));
+    EXPECT_TRUE(all_equal(col.transform(arrnd<int>({3}, {1, 2, 3}), std::plus<>{}), col_vec));
+    EXPECT_TRUE(all_equal(col + arrnd<int>({2}, {1, 2}), arrnd<int>({3, 2}, {101, 102, 201, 202, 301, 302})));
+
+    // arrays of the same number of elements, which are not broadcastable, are transformed element-wise
+    EXPECT_TRUE(all_equal(arrnd<int>({2, 3}, {1, 2, 3, 4, 5, 6}) + arrnd<int>({3, 2}, {1, 2, 3, 4, 5, 6}),
+        arrnd<int>({2, 3}, {2, 4, 6, 8, 10, 12})));
+
+    // dims that are not broadcastable
+    EXPECT_THROW((void)(mat + arrnd<int>({3}, 1)), std::invalid_argument);
+    EXPECT_THROW((void)(mat + arrnd<int>({2, 1, 3}, 1)), std::invalid_argument);
+}
+
+TEST(arrnd_test, pairwise_sum)
+{
+    using namespace oc::arrnd;
+
+    arrnd<float> arr({1000, 1000}, 0.1f);
+    double exact = 1000 * 1000 * static_cast<double>(0.1f);
+
+    float naive = std::accumulate(arr.begin(), arr.end(), 0.0f);
+    float pairwise = sum(arr);
+    EXPECT_LT(std::abs(pairwise - exact), std::abs(naive - exact));
+    EXPECT_NEAR(pairwise, exact, exact * 1e-6);
+
+    auto accumulated = sum<accumulate_as<double>>(arr);
+    static_assert(std::is_same_v<decltype(accumulated), double>);
+    EXPECT_NEAR(accumulated, exact, exact * 1e-12);
+
+    // the summation order depends only on the elements order
+    arrnd<double> values({37, 129});
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(-1e3, 1e3);
+    std::generate(values.begin(), values.end(), [&] {
+        return dist(gen);
+    });
+    arrnd<double> tvalues = transpose(values, {1, 0});
+    arrnd<double> tview = values;
+    tview.info() = transpose(values.info(), {1, 0});
+    EXPECT_NE(tview.info().hints(), arrnd_hint::continuous);
+    EXPECT_EQ(sum(tview), sum(tvalues));
+    EXPECT_NEAR(sum(values), std::accumulate(values.begin(), values.end(), 0.0), 1e-8);
+
+    arrnd<int> ints({4}, 2'000'000'000);
+    EXPECT_EQ(sum<accumulate_as<std::int64_t>>(ints), std::int64_t{8'000'000'000});
+
+    EXPECT_EQ(sum(arrnd<float>{}), 0.0f);
+    EXPECT_EQ(sum<accumulate_as<double>>(arrnd<float>{}), 0.0);
+}
+
+TEST(arrnd_test, memory_order_axis_reduction)
+{
+    using namespace oc::arrnd;
+
+    arrnd<int> arr({3, 4, 5});
+    std::iota(arr.begin(), arr.end(), -20);
+
+    // same values through the iterators path
+    arrnd<int> padded({3, 4, 6}, 0);
+    for (std::size_t i = 0; i < 12; ++i) {
+        std::copy_n(std::next(arr.begin(), i * 5), 5, std::next(padded.begin(), i * 6));
+    }
+    auto view = padded[{interval<>::full(), interval<>::full(), interval<>::between(0, 5)}];
+    ASSERT_NE(view.info().hints(), arrnd_hint::continuous);
+    ASSERT_TRUE(all_equal(arr, view));
+
+    auto expected = [&arr](std::size_t axis, auto init, auto op) {
+        auto res_info = reduce(arr.info(), axis);
+        arrnd<decltype(op(init, 0))> res(res_info.dims());
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
+        for (std::size_t i = 0; i < outer; ++i) {
+            for (std::size_t k = 0; k < inner; ++k) {
+                auto acc = init;
+                for (std::size_t j = 0; j < arr.info().dims()[axis]; ++j) {
+                    acc = op(acc, arr[(i * arr.info().dims()[axis] + j) * inner + k]);
+                }
+                res[i * inner + k] = acc;
+            }
+        }
+        return res;
+    };
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        auto plus = expected(axis, 0, std::plus<>{});
+        EXPECT_TRUE(all_equal(arr.reduce(axis, std::plus<>{}), plus));
+        EXPECT_TRUE(all_equal(view.reduce(axis, std::plus<>{}), plus));
+
+        auto maxs = expected(axis, std::numeric_limits<int>::min(), [](int a, int b) {
+            return std::max(a, b);
+        });
+        EXPECT_TRUE(all_equal(arr.reduce(axis,
+                                  [](int a, int b) {
+                                      return std::max(a, b);
+                                  }),
+            maxs));
+
+        auto to_double = expected(axis, 0.5, std::plus<>{});
+        EXPECT_TRUE(all_equal(arr.reduce(axis, [](double a, int b) { return a + b; }) + 0.5, to_double));
+
+        std::vector<double> inits(total(to_double.info()), 0.5);
+        EXPECT_TRUE(all_equal(arr.fold(axis, inits, [](double a, int b) { return a + b; }), to_double));
+        EXPECT_TRUE(all_equal(view.fold(axis, inits, [](double a, int b) { return a + b; }), to_double));
+    }
+
+    // multiple axes
+    EXPECT_TRUE(all_equal(arr.reduce({0, 2}, std::plus<>{}), arr.reduce(2, std::plus<>{}).reduce(0, std::plus<>{})));
+    EXPECT_TRUE(all_equal(arr.reduce({2, 0}, std::plus<>{}), view.reduce({0, 2}, std::plus<>{})));
+    EXPECT_TRUE(all_equal(arr.reduce(std::vector<std::size_t>{0, 1, 2}, std::plus<>{}),
+        arrnd<int>({1}, {std::accumulate(arr.begin(), arr.end(), 0)})));
+    EXPECT_THROW((void)arr.reduce({0, 0}, std::plus<>{}), std::invalid_argument);
+    EXPECT_THROW((void)arr.reduce(std::vector<std::size_t>{}, std::plus<>{}), std::invalid_argument);
+    EXPECT_THROW((void)arr.reduce({3}, std::plus<>{}), std::out_of_range);
+}
+
+TEST(arrnd_test, moments)
+{
+    using namespace oc::arrnd;
+
+    arrnd<double> arr({4, 50});
+    std::generate(arr.begin(), arr.end(), [i = 0]() mutable {
+        ++i;
+        return 1e6 + (i % 7) * 0.25 - (i % 3);
+    });
+
+    auto two_pass = [](const auto& elems) {
+        double mean = std::accumulate(elems.begin(), elems.end(), 0.0) / total(elems.info());
+        double m2 = std::accumulate(elems.begin(), elems.end(), 0.0, [mean](double acc, double value) {
+            return acc + (value - mean) * (value - mean);
+        });
+        return std::make_pair(mean, m2);
+    };
+
+    auto [mean, m2] = two_pass(arr);
+
+    auto m = moments(arr);
+    EXPECT_EQ(m.count, 200);
+    EXPECT_EQ(m.min, *std::min_element(arr.begin(), arr.end()));
+    EXPECT_EQ(m.max, *std::max_element(arr.begin(), arr.end()));
+    EXPECT_DOUBLE_EQ(m.sum, std::accumulate(arr.begin(), arr.end(), 0.0));
+    EXPECT_DOUBLE_EQ(m.mean, mean);
+    EXPECT_NEAR(m.variance(), m2 / 200, 1e-9);
+    EXPECT_NEAR(m.variance(1), m2 / 199, 1e-9);
+
+    // merged partials of pages
+    arrnd_moments<double> merged;
+    for (std::size_t i = 0; i < 4; ++i) {
+        merged.merge(moments(arr[{interval<>::at(i), interval<>::full()}]));
+    }
+    EXPECT_EQ(merged.count, m.count);
+    EXPECT_EQ(merged.min, m.min);
+    EXPECT_EQ(merged.max, m.max);
+    EXPECT_DOUBLE_EQ(merged.mean, m.mean);
+    EXPECT_NEAR(merged.variance(), m.variance(), 1e-9);
+
+    auto par = moments(arrnd_parallel_policy{.num_threads = 3, .min_chunk_size = 16}, arr);
+    EXPECT_EQ(par.count, m.count);
+    EXPECT_DOUBLE_EQ(par.mean, m.mean);
+    EXPECT_NEAR(par.variance(), m.variance(), 1e-9);
+
+    // non continuous elements
+    auto view = arr[{interval<>::full(), interval<>::full(2)}];
+    auto [view_mean, view_m2] = two_pass(view.clone());
+    auto vm = moments(view);
+    EXPECT_EQ(vm.count, 100);
+    EXPECT_DOUBLE_EQ(vm.mean, view_mean);
+    EXPECT_NEAR(vm.variance(), view_m2 / 100, 1e-9);
+    EXPECT_NEAR(moments(arrnd_parallel_policy{.num_threads = 2, .min_chunk_size = 8}, view).variance(),
+        vm.variance(), 1e-9);
+
+    // integral elements are summarized as double
+    arrnd<int> iarr({2, 3}, {1, 2, 3, 4, 5, 7});
+    auto im = moments(iarr);
+    static_assert(std::is_same_v<decltype(im), arrnd_moments<double>>);
+    EXPECT_DOUBLE_EQ(im.mean, 22.0 / 6);
+    EXPECT_EQ(im.min, 1);
+    EXPECT_EQ(im.max, 7);
+
+    auto axis_moments = moments(iarr, 0);
+    EXPECT_EQ(axis_moments.info().dims().front(), 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(axis_moments[i].count, 2);
+        EXPECT_DOUBLE_EQ(axis_moments[i].mean, (iarr[{0, i}] + iarr[{1, i}]) / 2.0);
+        EXPECT_DOUBLE_EQ(axis_moments[i].variance(), std::pow((iarr[{1, i}] - iarr[{0, i}]) / 2.0, 2));
+    }
+
+    auto row_moments = moments(arr, 1);
+    for (std::size_t i = 0; i < 4; ++i) {
+        auto row = moments(arr[{interval<>::at(i), interval<>::full()}]);
+        EXPECT_DOUBLE_EQ(row_moments[i].mean, row.mean);
+        EXPECT_NEAR(row_moments[i].variance(), row.variance(), 1e-9);
+    }
+
+    auto empty = moments(arrnd<int>{});
+    EXPECT_EQ(empty.count, 0);
+    EXPECT_TRUE(std::isnan(empty.variance()));
+    EXPECT_EQ(moments(arrnd_parallel_policy{}, arrnd<int>{}).count, 0);
+}
+
+TEST(arrnd_test, argmin_argmax_and_topk)
+{
+    using namespace oc::arrnd;
+
+    arrnd<int> arr({3, 4, 700});
+    std::generate(arr.begin(), arr.end(), [i = 0]() mutable {
+        ++i;
+        return (i * 7919) % 2003;
+    });
+    arr[{1, 2, 650}] = 5000;
+    arr[{2, 3, 10}] = 5000;
+    arr[{0, 1, 3}] = -5;
+
+    // positions in elements order
+    EXPECT_EQ(argmax(arr), (1 * 4 + 2) * 700 + 650);
+    EXPECT_EQ(argmin(arr), 1 * 700 + 3);
+
+    auto view = arr[{interval<>::full(), interval<>::full(), interval<>::between(0, 700, 2)}];
+    ASSERT_NE(view.info().hints(), arrnd_hint::continuous);
+    EXPECT_EQ(argmax(view), (1 * 4 + 2) * 350 + 325);
+    EXPECT_EQ(argmax(view), argmax(view.clone()));
+    EXPECT_EQ(argmin(view), argmin(view.clone()));
+
+    EXPECT_THROW(std::ignore = argmin(arrnd<int>{}), std::invalid_argument);
+
+    auto expected_args = [](const auto& src, std::size_t axis, auto comp) {
+        auto res_info = reduce(src.info(), axis);
+        arrnd<std::size_t> res(res_info.dims());
+        auto [outer, inner] = reduction_extents(src.info(), axis);
+        std::size_t reduction = src.info().dims()[axis];
+        for (std::size_t i = 0; i < outer; ++i) {
+            for (std::size_t k = 0; k < inner; ++k) {
+                std::size_t best = 0;
+                for (std::size_t j = 1; j < reduction; ++j) {
+                    if (comp(src[(i * reduction + j) * inner + k], src[(i * reduction + best) * inner + k])) {
+                        best = j;
+                    }
+                }
+                res[i * inner + k] = best;
+            }
+        }
+        return res;
+    };
+
+    auto view_clone = view.clone();
+    view_clone.refresh();
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        EXPECT_TRUE(all_equal(argmin(arr, axis), expected_args(arr, axis, std::less<>{})));
+        EXPECT_TRUE(all_equal(argmax(arr, axis), expected_args(arr, axis, std::greater<>{})));
+        EXPECT_TRUE(all_equal(argmax(view, axis), expected_args(view_clone, axis, std::greater<>{})));
+    }
+    EXPECT_THROW(std::ignore = argmax(arr, 3), std::out_of_range);
+
+    // top k of the whole array
+    {
+        auto [values, indices] = topk(arr, 3);
+        EXPECT_TRUE(all_equal(values, arrnd<int>({3}, {5000, 5000, 2002})));
+        EXPECT_EQ(indices[0], (1 * 4 + 2) * 700 + 650);
+        EXPECT_EQ(indices[1], (2 * 4 + 3) * 700 + 10);
+
+        auto [smallest, smallest_indices] = topk(arr, 1, std::less<>{});
+        EXPECT_EQ(smallest[0], -5);
+        EXPECT_EQ(smallest_indices[0], argmin(arr));
+    }
+
+    // top k along axes by both of the selection paths
+    for (std::size_t k : {2, 100}) {
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            if (k > arr.info().dims()[axis]) {
+                EXPECT_THROW(std::ignore = topk(arr, k, axis), std::invalid_argument);
+                continue;
+            }
+
+            auto [values, indices] = topk(view, k, axis);
+            EXPECT_EQ(values.info().dims()[axis], k);
+
+            auto [outer, inner] = reduction_extents(view_clone.info(), axis);
+            std::size_t reduction = view_clone.info().dims()[axis];
+            for (std::size_t i = 0; i < outer; ++i) {
+                for (std::size_t j = 0; j < inner; ++j) {
+                    std::vector<std::pair<int, std::size_t>> lane;
+                    for (std::size_t n = 0; n < reduction; ++n) {
+                        lane.emplace_back(view_clone[(i * reduction + n) * inner + j], n);
+                    }
+                    std::stable_sort(lane.begin(), lane.end(), [](const auto& a, const auto& b) {
+                        return a.first > b.first;
+                    });
+                    for (std::size_t n = 0; n < k; ++n) {
+                        EXPECT_EQ(values[(i * k + n) * inner + j], lane[n].first);
+                        EXPECT_EQ(indices[(i * k + n) * inner + j], lane[n].second);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(arrnd_test, scan)
+{
+    using namespace oc::arrnd;
+
+    arrnd<int> arr({3, 40, 5});
+    std::generate(arr.begin(), arr.end(), [i = 0]() mutable {
+        ++i;
+        return (i * 37) % 11 - 5;
+    });
+
+    auto padded = arrnd<int>({3, 40, 6}, 0);
+    for (std::size_t i = 0; i < 120; ++i) {
+        std::copy_n(std::next(arr.begin(), i * 5), 5, std::next(padded.begin(), i * 6));
+    }
+    auto view = padded[{interval<>::full(), interval<>::full(), interval<>::between(0, 5)}];
+    ASSERT_NE(view.info().hints(), arrnd_hint::continuous);
+
+    auto expected = [&arr](std::size_t axis, auto init, auto op, bool exclusive) {
+        arrnd<decltype(op(init, 0))> res(arr.info().dims());
+        auto [outer, inner] = reduction_extents(arr.info(), axis);
+        std::size_t reduction = arr.info().dims()[axis];
+        for (std::size_t i = 0; i < outer; ++i) {
+            for (std::size_t k = 0; k < inner; ++k) {
+                auto acc = init;
+                for (std::size_t j = 0; j < reduction; ++j) {
+                    std::size_t pos = (i * reduction + j) * inner + k;
+                    if (exclusive) {
+                        res[pos] = acc;
+                        acc = op(acc, arr[pos]);
+                    } else {
+                        acc = op(acc, arr[pos]);
+                        res[pos] = acc;
+                    }
+                }
+            }
+        }
+        return res;
+    };
+
+    auto max_op = [](int a, int b) {
+        return std::max(a, b);
+    };
+
+    arrnd_parallel_policy policy{.num_threads = 4, .min_chunk_size = 8};
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        auto inclusive = expected(axis, 0, std::plus<>{}, false);
+        auto exclusive = expected(axis, 0, std::plus<>{}, true);
+
+        EXPECT_TRUE(all_equal(arr.scan(axis, std::plus<>{}), inclusive));
+        EXPECT_TRUE(all_equal(view.scan(axis, std::plus<>{}), inclusive));
+        EXPECT_TRUE(all_equal(cumsum(arr, axis), inclusive));
+        EXPECT_TRUE(all_equal(cumsum(view, axis, arrnd_scan_type::exclusive), exclusive));
+        EXPECT_TRUE(all_equal(arr.scan(axis, std::numeric_limits<int>::min(), max_op),
+            expected(axis, std::numeric_limits<int>::min(), max_op, false)));
+
+        // along long axes (two level) and along short ones (by outer blocks)
+        EXPECT_TRUE(all_equal(arr.scan(policy, axis, std::plus<>{}), inclusive));
+        EXPECT_TRUE(all_equal(cumsum(policy, view, axis), inclusive));
+        EXPECT_TRUE(all_equal(cumsum(policy, arr, axis, arrnd_scan_type::exclusive), exclusive));
+        EXPECT_TRUE(all_equal(arr.scan(policy, axis, 100, std::plus<>{}), expected(axis, 100, std::plus<>{}, false)));
+        EXPECT_TRUE(all_equal(arr.scan(policy, axis, 100, std::plus<>{}, arrnd_scan_type::exclusive),
+            expected(axis, 100, std::plus<>{}, true)));
+
+        auto to_double = expected(axis, 0.5, std::plus<>{}, true);
+        EXPECT_TRUE(all_equal(arr.scan(axis, 0.5, std::plus<>{}, arrnd_scan_type::exclusive), to_double));
+    }
+
+    arrnd<int> small({2, 3}, {1, 2, 3, 4, 5, 6});
+    EXPECT_TRUE(all_equal(cumprod(small, 1), arrnd<int>({2, 3}, {1, 2, 6, 4, 20, 120})));
+    EXPECT_TRUE(all_equal(cumprod(small, 0, arrnd_scan_type::exclusive), arrnd<int>({2, 3}, {1, 1, 1, 1, 2, 3})));
+    EXPECT_TRUE(all_equal(cumprod(arrnd_parallel_policy{.num_threads = 2, .min_chunk_size = 1}, small, 1),
+        arrnd<int>({2, 3}, {1, 2, 6, 4, 20, 120})));
+
+    arrnd<double> long_axis({100000}, 0.5);
+    auto long_sums = cumsum(arrnd_parallel_policy{.num_threads = 4, .min_chunk_size = 1024}, long_axis, 0);
+    EXPECT_EQ(long_sums[99999], 50000.0);
+    EXPECT_TRUE(all_equal(long_sums, cumsum(long_axis, 0)));
+
+    EXPECT_TRUE(cumsum(arrnd<int>{}, 0).empty());
+    EXPECT_THROW(std::ignore = cumsum(arr, 3), std::out_of_range);
+}
+
+TEST(arrnd_test, rolling_windows)
+{
+    using namespace oc::arrnd;
+
+    using window_type = arrnd<int>::window_type;
+
+    arrnd<int> series({50});
+    std::generate(series.begin(), series.end(), [i = 0]() mutable {
+        ++i;
+        return (i * 13) % 17 - 8;
+    });
+
+    // same windows as of slide for vectors
+    for (auto window : {window_type{{-3, 2}, arrnd_window_type::partial}, window_type{{0, 5}, arrnd_window_type::partial},
+             window_type{{-2, 3}, arrnd_window_type::complete}, window_type{{0, 50}, arrnd_window_type::complete}}) {
+        EXPECT_TRUE(all_equal(rolling_sum(series, 0, window), series.slide(0, window, [](const auto& slice) {
+            return sum(slice);
+        })));
+        EXPECT_TRUE(all_equal(rolling_min(series, 0, window), series.slide(0, window, [](const auto& slice) {
+            return min(slice);
+        })));
+        EXPECT_TRUE(all_equal(rolling_max(series, 0, window), series.slide(0, window, [](const auto& slice) {
+            return max(slice);
+        })));
+        EXPECT_TRUE(all_close(rolling_mean(series, 0, window), series.slide(0, window, [](const auto& slice) {
+            return static_cast<double>(sum(slice)) / total(slice.info());
+        })));
+        EXPECT_TRUE(all_close(rolling_var(series, 0, window), series.slide(0, window, [](const auto& slice) {
+            return moments(slice).variance();
+        })));
+    }
+
+    // each lane is rolled separately
+    arrnd<double> arr({30, 4, 6});
+    std::generate(arr.begin(), arr.end(), [i = 0]() mutable {
+        ++i;
+        return 1e3 + (i * 7) % 23 * 0.5;
+    });
+    auto view = arr[{interval<>::full(), interval<>::full(), interval<>::full(2)}];
+    ASSERT_NE(view.info().hints(), arrnd_hint::continuous);
+    auto view_clone = view.clone();
+    view_clone.refresh();
+
+    window_type window{{-4, 2}, arrnd_window_type::partial};
+    auto rolled = rolling_max(view, 0, window);
+    auto rolled_var = rolling_var(view, 0, window);
+    ASSERT_EQ(rolled.info().dims()[0], 30);
+    for (std::size_t i = 0; i < 30; ++i) {
+        std::size_t lo = i > 4 ? i - 4 : 0;
+        std::size_t hi = std::min(i + 2, std::size_t{30});
+        for (std::size_t j = 0; j < 12; ++j) {
+            double best = -1;
+            arrnd_moments<double> m;
+            for (std::size_t n = lo; n < hi; ++n) {
+                best = std::max(best, view_clone[n * 12 + j]);
+                m.push(view_clone[n * 12 + j]);
+            }
+            EXPECT_EQ(rolled[i * 12 + j], best);
+            EXPECT_NEAR(rolled_var[i * 12 + j], m.variance(), 1e-6);
+        }
+    }
+
+    EXPECT_EQ(rolling_mean(arr, 2, window_type{{-1, 2}, arrnd_window_type::complete}).info().dims()[2], 4);
+    EXPECT_TRUE(rolling_sum(arrnd<int>{}, 0, window).empty());
+    EXPECT_THROW(std::ignore = rolling_sum(series, 0, window_type{{-2, 60}, arrnd_window_type::complete}),
+        std::invalid_argument);
+    EXPECT_THROW(std::ignore = rolling_sum(series, 1, window), std::out_of_range);
+
+    // windows that might be empty
+    EXPECT_THROW(std::ignore = rolling_max(series, 0, window_type{{-3, 0}, arrnd_window_type::partial}),
+        std::invalid_argument);
+    EXPECT_THROW(std::ignore = rolling_min(series, 0, window_type{{0, 0}, arrnd_window_type::complete}),
+        std::invalid_argument);
+}
+
 TEST(arrnd_test, all)
 {
     const bool data[] = {1, 0, 1, 1};
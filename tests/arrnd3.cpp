@@ -12,6 +12,8 @@
 #include <complex>
 #include <random>
 #include <thread>
+#include <fstream>
+#include <filesystem>
 
 #include <oc/arrnd.h>
 
@@ -170,6 +172,311 @@ TEST(simple_allocator, is_copyable_and_movable)
     EXPECT_NE(simple_allocator<int>(std::move(alloc1_copy)), other_alloc1_copy);
 }
 
+TEST(simple_aligned_allocator, allocates_aligned_and_padded_memory)
+{
+    using namespace oc::arrnd;
+
+    simple_aligned_allocator<float> alloc;
+    static_assert(simple_aligned_allocator<float>::padded_size(1) == 64);
+    static_assert(simple_aligned_allocator<float>::padded_size(17) == 128);
+    static_assert(simple_aligned_allocator<float, 32, 0>::padded_size(17) == 68);
+
+    for (std::size_t n : {1, 3, 16, 17, 1000}) {
+        float* p = alloc.allocate(n);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0);
+        // padding elements are accessible
+        std::fill_n(p, simple_aligned_allocator<float>::padded_size(n) / sizeof(float), 1.0f);
+        alloc.deallocate(p, n);
+    }
+
+    EXPECT_THROW(std::ignore = alloc.allocate(std::numeric_limits<std::size_t>::max() / sizeof(float)), std::bad_alloc);
+
+    EXPECT_EQ(simple_aligned_allocator<int>(alloc), alloc);
+    EXPECT_NE((simple_aligned_allocator<char>(alloc)), alloc);
+}
+
+TEST(simple_aligned_allocator, can_be_used_as_arrnd_storage)
+{
+    using namespace oc::arrnd;
+
+    using aligned_arrnd = arrnd<double, simple_aligned_vector_traits<double>>;
+
+    aligned_arrnd arr({3, 7}, 0.5);
+    std::iota(arr.begin(), arr.end(), 1.0);
+
+    auto is_aligned = [](const auto& a) {
+        return reinterpret_cast<std::uintptr_t>(a.shared_storage()->data()) % 64 == 0;
+    };
+
+    EXPECT_TRUE(is_aligned(arr));
+    EXPECT_TRUE(is_aligned(arr.clone()));
+
+    auto res = arr * 2.0 + arr;
+    EXPECT_TRUE(is_aligned(res));
+    EXPECT_TRUE(all_equal(res, arr * 3.0));
+    EXPECT_EQ(sum(arr), 231.0);
+
+    auto mask = arr > 10.0;
+    EXPECT_TRUE(is_aligned(mask));
+    EXPECT_EQ(std::count(mask.begin(), mask.end(), true), 11);
+
+    arrnd<double, simple_aligned_vector_traits<double, 128, 0>> wide({5}, 1.0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide.shared_storage()->data()) % 128, 0);
+}
+
+TEST(simple_arena, bump_allocates_and_releases_at_once)
+{
+    using namespace oc::arrnd;
+
+    simple_arena arena(256);
+
+    void* p1 = arena.allocate(10, 1);
+    void* p2 = arena.allocate(8, 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p2) % 8, 0);
+    EXPECT_GE(static_cast<char*>(p2) - static_cast<char*>(p1), 10);
+    EXPECT_EQ(arena.used(), 18);
+
+    // beyond the first block
+    void* p3 = arena.allocate(1000, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p3) % 64, 0);
+    std::size_t capacity = arena.capacity();
+    EXPECT_GT(capacity, 1000);
+
+    // replaced by a single block of the previous capacity
+    arena.release();
+    EXPECT_EQ(arena.used(), 0);
+    std::ignore = arena.allocate(1018);
+    EXPECT_EQ(arena.capacity(), capacity);
+    arena.release();
+    std::ignore = arena.allocate(1018);
+    EXPECT_EQ(arena.capacity(), capacity);
+}
+
+TEST(simple_arena, arrays_of_scope_are_allocated_from_arena)
+{
+    using namespace oc::arrnd;
+
+    using arena_arrnd = arrnd<double, simple_arena_vector_traits<double>>;
+
+    simple_arena arena;
+
+    arena_arrnd outside({3, 4}, 1.0);
+    EXPECT_EQ(arena.used(), 0);
+
+    for (int i = 0; i < 3; ++i) {
+        simple_arena_scope scope(arena);
+
+        arena_arrnd arr({3, 4});
+        std::iota(arr.begin(), arr.end(), 0.0);
+
+        std::size_t used = arena.used();
+        auto res = (arr + outside) * 2.0 - arr;
+        EXPECT_GT(arena.used(), used);
+        EXPECT_TRUE(all_equal(res, arr + 2.0));
+        EXPECT_EQ(sum(res), 90.0);
+        EXPECT_TRUE(all_equal(arr.filter(arr > 5.0), arena_arrnd({6}, {6, 7, 8, 9, 10, 11})));
+
+        {
+            simple_arena_scope nested(arena);
+            used = arena.used();
+            auto nested_clone = res.clone();
+            EXPECT_GT(arena.used(), used);
+        }
+        EXPECT_GT(arena.used(), 0);
+    }
+
+    EXPECT_EQ(arena.used(), 0);
+    arena_arrnd after({2}, 1.0);
+    EXPECT_EQ(arena.used(), 0);
+
+    // the arena is released only by its outermost scope, even if scopes of other arenas are nested between
+    {
+        simple_arena other;
+        simple_arena_scope outer(arena);
+        arena_arrnd arr({3, 4}, 1.0);
+        {
+            simple_arena_scope between(other);
+            {
+                simple_arena_scope inner(arena);
+                auto cln = arr.clone();
+            }
+            EXPECT_GT(arena.used(), 0);
+        }
+        EXPECT_GT(arena.used(), 0);
+        EXPECT_EQ(sum(arr), 12.0);
+    }
+    EXPECT_EQ(arena.used(), 0);
+}
+
+TEST(simple_pool, recycles_buffers_by_size_classes)
+{
+    using namespace oc::arrnd;
+
+    simple_pool pool(1024);
+
+    void* p1 = pool.allocate(100);
+    pool.deallocate(p1, 100);
+    EXPECT_EQ(pool.stats().misses, 1);
+    EXPECT_EQ(pool.stats().bytes_retained, 128);
+
+    // same size class
+    void* p2 = pool.allocate(120);
+    EXPECT_EQ(p2, p1);
+    EXPECT_EQ(pool.stats().hits, 1);
+    EXPECT_EQ(pool.stats().bytes_retained, 0);
+
+    // bounded by max retained bytes
+    void* p3 = pool.allocate(1000);
+    void* p4 = pool.allocate(1000);
+    pool.deallocate(p2, 120);
+    pool.deallocate(p3, 1000);
+    pool.deallocate(p4, 1000);
+    EXPECT_EQ(pool.stats().bytes_retained, 128);
+    EXPECT_EQ(pool.stats().high_water_mark, 128);
+    pool.set_max_retained(2048);
+    pool.deallocate(pool.allocate(1000), 1000);
+    EXPECT_EQ(pool.stats().bytes_retained, 1152);
+    EXPECT_EQ(pool.stats().high_water_mark, 1152);
+
+    pool.trim();
+    EXPECT_EQ(pool.stats().bytes_retained, 0);
+
+    void* large = pool.allocate(simple_pool::max_class_size + 1);
+    pool.deallocate(large, simple_pool::max_class_size + 1);
+    EXPECT_EQ(pool.stats().bytes_retained, 0);
+}
+
+TEST(simple_pool, arrays_buffers_are_recycled)
+{
+    using namespace oc::arrnd;
+
+    using pool_arrnd = arrnd<double, simple_pool_vector_traits<double>>;
+
+    auto& pool = *current_simple_pool();
+    pool.reset_stats();
+
+    pool_arrnd arr({20, 30}, 1.0);
+    for (int i = 0; i < 10; ++i) {
+        auto res = (arr * 2.0).reduce(0, std::plus<>{});
+        EXPECT_TRUE(all_equal(res, pool_arrnd({30}, 40.0)));
+    }
+
+    EXPECT_GT(pool.stats().hits, pool.stats().misses);
+    EXPECT_GT(pool.stats().high_water_mark, 0);
+
+    // pools are per thread
+    std::size_t other_hits = 0;
+    std::thread([&other_hits]() {
+        pool_arrnd tmp({10}, 1.0);
+        tmp = pool_arrnd({10}, 2.0);
+        other_hits = current_simple_pool()->stats().hits;
+    }).join();
+    EXPECT_EQ(other_hits, 0);
+}
+
+#ifdef OC_ARRND_HAS_MMAP
+TEST(simple_mapped_allocator, arrays_are_mapped_from_files)
+{
+    using namespace oc::arrnd;
+
+    using mapped_arrnd = arrnd<double, simple_mapped_vector_traits<double>>;
+
+    // unique per process, since tests of several builds might run concurrently
+    auto file_name = "oc_arrnd_map_file_test_" + std::to_string(::getpid()) + ".bin";
+    auto path = (std::filesystem::temp_directory_path() / file_name).string();
+    {
+        std::vector<double> values(1000);
+        std::iota(values.begin(), values.end(), 0.0);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+
+    auto read_file = [&path](std::size_t index) {
+        std::ifstream file(path, std::ios::binary);
+        file.seekg(index * sizeof(double));
+        double value;
+        file.read(reinterpret_cast<char*>(&value), sizeof(double));
+        return value;
+    };
+
+    {
+        auto arr = map_file<mapped_arrnd>(path, {10, 100}, simple_file_map_mode::read_only,
+            simple_file_map_advice::sequential);
+        EXPECT_EQ(sum(arr), 499500.0);
+        EXPECT_EQ((arr[{3, 7}]), 307.0);
+
+        // copies are not mapped
+        auto c = arr.clone();
+        c[{0, 0}] = -1.0;
+        EXPECT_EQ((arr[{0, 0}]), 0.0);
+        EXPECT_EQ(read_file(0), 0.0);
+
+        // offsets are not required to be page aligned
+        auto tail = map_file<mapped_arrnd>(path, {5}, simple_file_map_mode::read_only,
+            simple_file_map_advice::random, 995 * sizeof(double));
+        EXPECT_TRUE(all_equal(tail, arrnd<double>({5}, {995, 996, 997, 998, 999})));
+    }
+
+    {
+        auto arr = map_file<mapped_arrnd>(path, {1000}, simple_file_map_mode::copy_on_write);
+        arr[{5}] = -5.0;
+        EXPECT_EQ(read_file(5), 5.0);
+    }
+
+    {
+        auto arr = map_file<mapped_arrnd>(path, {1000}, simple_file_map_mode::read_write);
+        arr[{5}] = -5.0;
+        EXPECT_EQ(read_file(5), -5.0);
+    }
+
+    // read_write mappings extend the file
+    {
+        auto arr = map_file<mapped_arrnd>(path, {1100}, simple_file_map_mode::read_write);
+        arr[{1099}] = 1099.0;
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 1100 * sizeof(double));
+    EXPECT_EQ(read_file(1099), 1099.0);
+
+    EXPECT_THROW(std::ignore = map_file<mapped_arrnd>(path, {2000}), std::invalid_argument);
+    // offsets should be aligned to the value type
+    EXPECT_THROW(std::ignore = map_file<mapped_arrnd>(
+                     path, {5}, simple_file_map_mode::read_only, simple_file_map_advice::normal, 3),
+        std::invalid_argument);
+    EXPECT_THROW(std::ignore = map_file<mapped_arrnd>(path + ".missing", {1}), std::system_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST(simple_huge_page_allocator, maps_allocations_above_threshold)
+{
+    using namespace oc::arrnd;
+
+    simple_huge_page_allocator<double> alloc;
+
+    double* small = alloc.allocate(100);
+    std::fill_n(small, 100, 1.0);
+    alloc.deallocate(small, 100);
+
+    EXPECT_FALSE(simple_huge_page_allocator<double>::is_huge(1000));
+    EXPECT_TRUE(simple_huge_page_allocator<double>::is_huge(std::size_t{1} << 18));
+    EXPECT_EQ(simple_huge_page_allocator<double>::mapped_size((std::size_t{1} << 18) + 1), std::size_t{1} << 22);
+
+    std::size_t n = (std::size_t{1} << 18) + 1;
+    double* large = alloc.allocate(n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large) % simple_huge_page_allocator<double>::huge_page_size, 0);
+    std::fill_n(large, n, 2.0);
+    EXPECT_EQ(large[n - 1], 2.0);
+    alloc.deallocate(large, n);
+
+    using huge_arrnd = arrnd<float, simple_huge_page_vector_traits<float, std::size_t{1} << 16>>;
+    huge_arrnd arr({256, 128}, 1.0f);
+    huge_arrnd small_arr({4, 4}, 1.0f);
+    EXPECT_EQ(sum(arr.reduce(0, std::plus<>{})), 32768.0f);
+    EXPECT_TRUE(all_equal(transpose(arr, {1, 0}) * 2.0f, huge_arrnd({128, 256}, 2.0f)));
+    EXPECT_EQ(sum(small_arr), 16.0f);
+}
+#endif // OC_ARRND_HAS_MMAP
+
 TEST(simple_vector, methods)
 {
     using namespace oc::arrnd::details;
@@ -762,6 +1069,86 @@ TEST(simple_array, erase)
     }
 }
 
+TEST(simple_small_vector, methods)
+{
+    using namespace oc::arrnd::details;
+
+    std::array<std::string, 6> arr{"a", "b", "c", "d", "e", "f"};
+
+    simple_small_vector<std::string, 4> sv(arr.cbegin(), arr.cbegin() + 3);
+    EXPECT_EQ(4, sv.capacity());
+    EXPECT_EQ(3, sv.size());
+    EXPECT_TRUE(std::equal(sv.cbegin(), sv.cend(), arr.cbegin(), arr.cbegin() + 3));
+
+    // move from inline to allocated storage
+    sv.insert(sv.cend(), arr.cbegin() + 3, arr.cend());
+    EXPECT_EQ(9, sv.capacity());
+    EXPECT_EQ(6, sv.size());
+    EXPECT_TRUE(std::equal(sv.cbegin(), sv.cend(), arr.cbegin(), arr.cend()));
+
+    auto csv = sv;
+    EXPECT_EQ(9, csv.capacity());
+    EXPECT_TRUE(std::equal(csv.cbegin(), csv.cend(), arr.cbegin(), arr.cend()));
+
+    auto msv = std::move(csv);
+    EXPECT_EQ(9, msv.capacity());
+    EXPECT_TRUE(std::equal(msv.cbegin(), msv.cend(), arr.cbegin(), arr.cend()));
+    EXPECT_TRUE(csv.empty());
+
+    // move back from allocated to inline storage
+    sv.erase(sv.cbegin() + 2, sv.cend());
+    sv.shrink_to_fit();
+    EXPECT_EQ(4, sv.capacity());
+    EXPECT_EQ(2, sv.size());
+    EXPECT_EQ("a", sv.front());
+    EXPECT_EQ("b", sv.back());
+
+    msv = sv;
+    EXPECT_EQ(4, msv.capacity());
+    EXPECT_TRUE(std::equal(msv.cbegin(), msv.cend(), arr.cbegin(), arr.cbegin() + 2));
+
+    simple_small_vector<std::string, 4> isv;
+    isv = std::move(sv);
+    EXPECT_EQ(4, isv.capacity());
+    EXPECT_TRUE(std::equal(isv.cbegin(), isv.cend(), arr.cbegin(), arr.cbegin() + 2));
+    EXPECT_TRUE(sv.empty());
+}
+
+TEST(simple_small_vector, int_methods)
+{
+    using namespace oc::arrnd::details;
+
+    simple_small_vector<int, 4> sv(3, 1);
+    EXPECT_EQ(4, sv.capacity());
+    EXPECT_EQ(3, sv.size());
+
+    sv.append(2);
+    EXPECT_EQ(7, sv.capacity());
+    EXPECT_EQ(5, sv.size());
+
+    sv.insert(sv.cbegin() + 1, 2, 0);
+    {
+        std::array<int, 7> res{1, 0, 0, 1, 1};
+        EXPECT_TRUE(std::equal(sv.cbegin(), sv.cbegin() + 5, res.cbegin(), res.cbegin() + 5));
+        EXPECT_EQ(7, sv.size());
+    }
+
+    sv.resize(2);
+    sv.reserve(3);
+    EXPECT_EQ(7, sv.capacity());
+    sv.shrink_to_fit();
+    EXPECT_EQ(4, sv.capacity());
+    {
+        std::array<int, 2> res{1, 0};
+        EXPECT_TRUE(std::equal(sv.cbegin(), sv.cend(), res.cbegin(), res.cend()));
+    }
+
+    // arrnd info uses inline storage by default
+    oc::arrnd::arrnd_info info({2, 3, 4});
+    EXPECT_EQ(8, info.dims().capacity());
+    EXPECT_EQ(3, info.dims().size());
+}
+
 
 //TEST(simple_view, methods)
 //{
@@ -1774,6 +2161,48 @@ TEST(experimental_arrnd_indexer, random_access)
     EXPECT_EQ(expected_inds_list[5], *(gen[3]));
 }
 
+TEST(experimental_arrnd_indexer, random_access_with_steps_across_boundaries)
+{
+    using namespace oc::arrnd;
+
+    const std::size_t dims[]{3, 1, 2}; // strides = {2, 2, 1}
+    const std::size_t order[]{2, 0, 1};
+    oc::arrnd::arrnd_info hdr(dims);
+
+    // expected indices order: {0, 2, 4, 1, 3, 5}
+    arrnd_indexer gen(oc::arrnd::transpose(hdr, order));
+
+    gen += 4;
+    EXPECT_EQ(3, *gen);
+    gen -= 3;
+    EXPECT_EQ(2, *gen);
+
+    gen += 10;
+    EXPECT_FALSE(gen);
+    gen -= 1;
+    EXPECT_EQ(5, *gen);
+
+    gen -= 10;
+    EXPECT_FALSE(gen);
+    gen += 1;
+    EXPECT_EQ(0, *gen);
+
+    // negative counts are being treated as steps in the opposite direction
+    gen += 5;
+    gen += static_cast<std::size_t>(-2);
+    EXPECT_EQ(1, *gen);
+    gen -= static_cast<std::size_t>(-1);
+    EXPECT_EQ(3, *gen);
+
+    oc::arrnd::arrnd<int> arr({3, 1, 2}, {0, 1, 2, 3, 4, 5});
+    arr.info() = oc::arrnd::transpose(arr.info(), {2, 0, 1});
+    auto it = arr.begin() + 5;
+    EXPECT_EQ(5, *it);
+    it -= 4;
+    EXPECT_EQ(2, *it);
+    EXPECT_EQ(4, it[2]);
+}
+
 //TEST(experimental_window_slider, dummy)
 //{
 //    oc::arrnd::arrnd_info ai({/*2*/ 6, 4});